@@ -20,6 +20,7 @@
 #ifndef _FASTDDS_ENTITY_HPP_
 #define _FASTDDS_ENTITY_HPP_
 
+#include <fastdds/dds/core/condition/StatusCondition.hpp>
 #include <fastdds/dds/core/status/StatusMask.hpp>
 #include <fastdds/rtps/common/InstanceHandle.h>
 #include <fastrtps/types/TypesBase.h>
@@ -44,7 +45,7 @@ public:
     RTPS_DllAPI Entity(
             const StatusMask& mask = StatusMask::all())
         : status_mask_(mask)
-        , status_changes_(StatusMask::none())
+        , status_condition_(this)
         , enable_(false)
     {
     }
@@ -88,11 +89,20 @@ public:
      * refers to the status that are triggered on the Entity itself
      * and does not include statuses that apply to contained entities.
      *
-     * @return const reference to the StatusMask with the triggered statuses set to 1
+     * @return StatusMask with the triggered statuses set to 1
      */
-    RTPS_DllAPI const StatusMask& get_status_changes() const
+    RTPS_DllAPI StatusMask get_status_changes() const
     {
-        return status_changes_;
+        return status_condition_.get_raw_status();
+    }
+
+    /**
+     * @brief Allows access to the StatusCondition associated with the Entity
+     * @return Reference to StatusCondition object
+     */
+    RTPS_DllAPI StatusCondition& get_statuscondition()
+    {
+        return status_condition_;
     }
 
     /**
@@ -134,8 +144,8 @@ protected:
     //! StatusMask with relevant statuses set to 1
     StatusMask status_mask_;
 
-    //! StatusMask with triggered statuses set to 1
-    StatusMask status_changes_;
+    //! Condition associated to the Entity, keeping the statuses that have been triggered
+    StatusCondition status_condition_;
 
     //! InstanceHandle associated to the Entity
     fastrtps::rtps::InstanceHandle_t instance_handle_;
@@ -0,0 +1,80 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Condition.hpp
+ */
+
+#ifndef _FASTDDS_CONDITION_HPP_
+#define _FASTDDS_CONDITION_HPP_
+
+#include <fastrtps/fastrtps_dll.h>
+
+#include <memory>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+namespace detail {
+class ConditionNotifier;
+} // namespace detail
+
+/**
+ * @brief The Condition class is the root class of all the conditions that may be attached to a WaitSet.
+ */
+class Condition
+{
+public:
+
+    /**
+     * @brief Retrieves the trigger_value of the Condition
+     * @return true if trigger_value is set to 'true', 'false' otherwise
+     */
+    RTPS_DllAPI virtual bool get_trigger_value() const = 0;
+
+    /**
+     * @brief Retrieves the object used to wake up the WaitSets this condition is attached to
+     * @return Pointer to the notifier of this condition
+     */
+    detail::ConditionNotifier* get_notifier() const
+    {
+        return notifier_.get();
+    }
+
+protected:
+
+    RTPS_DllAPI Condition();
+
+    RTPS_DllAPI virtual ~Condition();
+
+    Condition(
+            const Condition&) = delete;
+
+    Condition& operator =(
+            const Condition&) = delete;
+
+    //! Keeps track of the WaitSets this condition is attached to
+    std::unique_ptr<detail::ConditionNotifier> notifier_;
+};
+
+//! Sequence of conditions, as returned by WaitSet::wait and WaitSet::get_conditions
+using ConditionSeq = std::vector<Condition*>;
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_CONDITION_HPP_
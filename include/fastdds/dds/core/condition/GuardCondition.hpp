@@ -0,0 +1,70 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file GuardCondition.hpp
+ */
+
+#ifndef _FASTDDS_GUARD_CONDITION_HPP_
+#define _FASTDDS_GUARD_CONDITION_HPP_
+
+#include <fastdds/dds/core/condition/Condition.hpp>
+#include <fastrtps/fastrtps_dll.h>
+#include <fastrtps/types/TypesBase.h>
+
+#include <atomic>
+
+using eprosima::fastrtps::types::ReturnCode_t;
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+/**
+ * @brief The GuardCondition class is a specific Condition whose trigger_value is completely under the control
+ * of the application.
+ *
+ * The purpose of the GuardCondition is to provide the means for the application to manually wake up a WaitSet.
+ */
+class GuardCondition : public Condition
+{
+public:
+
+    RTPS_DllAPI GuardCondition();
+
+    RTPS_DllAPI ~GuardCondition();
+
+    RTPS_DllAPI bool get_trigger_value() const override;
+
+    /**
+     * @brief Set the trigger_value
+     *
+     * Waking up the WaitSets this condition is attached to does not take any lock when no WaitSet is
+     * waiting, and consecutive triggers are coalesced into a single wake up.
+     * @param value new value for trigger
+     * @return RETURN_OK
+     */
+    RTPS_DllAPI ReturnCode_t set_trigger_value(
+            bool value);
+
+private:
+
+    std::atomic<bool> trigger_value_;
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_GUARD_CONDITION_HPP_
@@ -1989,6 +1989,65 @@ public:
 
 };
 
+/**
+ * Class BatchQosPolicy, configures the writer to coalesce several small samples into a single batch submessage.
+ *
+ * A batch is sent when any of its limits is reached, or when max_flush_delay has elapsed since its first
+ * sample was written. Enabling batching makes the writer publish asynchronously.
+ * Only samples that are not fragmented are batched, and batches are only sent to Fast DDS participants, so
+ * readers of other vendors keep receiving regular DATA submessages.
+ * @note Immutable Qos Policy
+ */
+class BatchQosPolicy : public QosPolicy
+{
+public:
+
+    /**
+     * @brief Constructor
+     */
+    RTPS_DllAPI BatchQosPolicy()
+        : QosPolicy(false)
+        , enable(false)
+        , max_samples(0)
+        , max_data_bytes(1024)
+        , max_flush_delay(0, 1000000)
+    {
+    }
+
+    /**
+     * @brief Destructor
+     */
+    virtual RTPS_DllAPI ~BatchQosPolicy() = default;
+
+    bool operator ==(
+            const BatchQosPolicy& b) const
+    {
+        return (this->enable == b.enable) &&
+               (this->max_samples == b.max_samples) &&
+               (this->max_data_bytes == b.max_data_bytes) &&
+               (this->max_flush_delay == b.max_flush_delay) &&
+               QosPolicy::operator ==(b);
+    }
+
+    inline void clear() override
+    {
+        BatchQosPolicy reset = BatchQosPolicy();
+        std::swap(*this, reset);
+    }
+
+    //!Whether samples are batched. <br> By default, false.
+    bool enable;
+
+    //!Maximum number of samples in a batch, 0 means no limit. <br> By default, 0.
+    uint32_t max_samples;
+
+    //!Maximum number of serialized payload bytes in a batch. <br> By default, 1024.
+    uint32_t max_data_bytes;
+
+    //!Maximum time a written sample waits for its batch to be sent. <br> By default, 1 ms.
+    fastrtps::Duration_t max_flush_delay;
+};
+
 /**
  * Enum DataRepresentationId, different kinds of topic data representation
  */
@@ -21,6 +21,7 @@
 #define _FASTDDS_DOMAIN_PARTICIPANT_HPP_
 
 #include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/dds/topic/ContentFilteredTopic.hpp>
 #include <fastdds/dds/topic/Topic.hpp>
 #include <fastrtps/types/TypeIdentifier.h>
 
@@ -61,6 +62,7 @@ class SubscriberAttributes;
 namespace fastdds {
 namespace dds {
 
+class ContentFilteredTopic;
 class DomainParticipantImpl;
 class DomainParticipantListener;
 class Publisher;
@@ -268,6 +270,31 @@ public:
     RTPS_DllAPI ReturnCode_t delete_topic(
             Topic* topic);
 
+    /**
+     * Create a ContentFilteredTopic in this Participant.
+     * @param name Name of the ContentFilteredTopic.
+     * @param related_topic Topic being filtered.
+     * @param filter_expression DDS-SQL expression the samples should pass. An empty expression lets all the
+     * samples pass.
+     * @param expression_parameters Values of the parameters (%0 to %99) referenced on the expression.
+     * @return Pointer to the created ContentFilteredTopic, or nullptr if the expression is not valid for the type
+     * of the related topic.
+     */
+    RTPS_DllAPI ContentFilteredTopic* create_contentfilteredtopic(
+            const std::string& name,
+            Topic* related_topic,
+            const std::string& filter_expression,
+            const std::vector<std::string>& expression_parameters);
+
+    /**
+     * Deletes an existing ContentFilteredTopic.
+     * @param a_contentfilteredtopic ContentFilteredTopic to be deleted.
+     * @return RETCODE_BAD_PARAMETER if the topic passed is a nullptr, RETCODE_PRECONDITION_NOT_MET if the topic does
+     * not belong to this participant or if it is referenced by any entity and RETCODE_OK if it was deleted.
+     */
+    RTPS_DllAPI ReturnCode_t delete_contentfilteredtopic(
+            const ContentFilteredTopic* a_contentfilteredtopic);
+
     /**
      * Looks up an existing, locally created @ref TopicDescription, based on its name.
      * May be called on a disabled participant.
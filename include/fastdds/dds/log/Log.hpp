@@ -20,6 +20,7 @@
 #include <thread>
 #include <sstream>
 #include <atomic>
+#include <chrono>
 #include <regex>
 
 /**
@@ -48,6 +49,7 @@ namespace fastdds {
 namespace dds {
 
 class LogConsumer;
+class LogRing;
 
 /**
  * Logging utilities.
@@ -93,6 +95,27 @@ public:
     RTPS_DllAPI static void ReportFunctions(
             bool);
 
+    /**
+     * Enables the coalescing of consecutive duplicated entries. Disabled by default.
+     * When enabled, consecutive entries with the same kind, origin and message are delivered to the consumers
+     * only once, with the number of repetitions appended to the message.
+     */
+    RTPS_DllAPI static void CoalesceDuplicates(
+            bool);
+
+    /**
+     * Queues the entries on a preallocated lock-free ring instead of the default double buffered queue.
+     * Disabled by default. Producers neither block nor allocate to queue the entries on the ring, but messages
+     * longer than 256 characters are truncated, and entries found with the ring full are dropped and counted on
+     * DroppedEntries().
+     * @param capacity Number of entries of the ring, rounded up to a power of two. 0 goes back to the default queue.
+     */
+    RTPS_DllAPI static void UseRingBuffer(
+            size_t capacity);
+
+    //! Returns the number of entries dropped because the ring buffer was full.
+    RTPS_DllAPI static uint64_t DroppedEntries();
+
     //! Sets the verbosity level, allowing for messages equal or under that priority to be logged.
     RTPS_DllAPI static void SetVerbosity(
             Log::Kind);
@@ -137,7 +160,10 @@ public:
         std::string message;
         Log::Context context;
         Log::Kind kind;
+        //! Formatted timestamp. Filled by the logging thread before the entry is consumed.
         std::string timestamp;
+        //! Time at which the entry was queued.
+        std::chrono::system_clock::time_point time;
     };
 
     /**
@@ -156,20 +182,26 @@ private:
     struct Resources
     {
         fastrtps::DBQueue<Entry> logs;
+        //! Ring the entries are queued on, if enabled.
+        std::atomic<LogRing*> ring;
+        //! Every ring created. They are kept until destruction, as producers may still be using a replaced one.
+        std::vector<std::unique_ptr<LogRing>> rings;
+        std::atomic<uint64_t> dropped_entries;
         std::vector<std::unique_ptr<LogConsumer>> consumers;
         std::unique_ptr<std::thread> logging_thread;
 
         // Condition variable segment.
         std::condition_variable cv;
         std::mutex cv_mutex;
-        bool logging;
-        bool work;
+        std::atomic<bool> logging;
+        std::atomic<bool> work;
         int current_loop;
 
         // Context configuration.
         std::mutex config_mutex;
         bool filenames;
         bool functions;
+        bool coalesce_duplicates;
         std::unique_ptr<std::regex> category_filter;
         std::unique_ptr<std::regex> filename_filter;
         std::unique_ptr<std::regex> error_string_filter;
@@ -189,9 +221,17 @@ private:
     static bool preprocess(
             Entry&);
 
+    // Delivers an entry to all the registered consumers, formatting its timestamp first.
+    static void consume(
+            Entry&);
+
     static void run();
 
+    // Reports whether there are no entries on the queue nor on the rings.
+    static bool queues_empty();
+
     static void get_timestamp(
+            const std::chrono::system_clock::time_point&,
             std::string&);
 };
 
@@ -104,6 +104,7 @@ public:
                (this->ownership_strength_ == b.ownership_strength()) &&
                (this->writer_data_lifecycle_ == b.writer_data_lifecycle()) &&
                (this->publish_mode_ == b.publish_mode()) &&
+               (this->batch_ == b.batch()) &&
                (this->representation_ == b.representation()) &&
                (this->properties_ == b.properties()) &&
                (this->reliable_writer_qos_ == b.reliable_writer_qos()) &&
@@ -564,6 +565,34 @@ public:
         publish_mode_ = publish_mode;
     }
 
+    /**
+     * Getter for BatchQosPolicy
+     * @return BatchQosPolicy reference
+     */
+    RTPS_DllAPI BatchQosPolicy& batch()
+    {
+        return batch_;
+    }
+
+    /**
+     * Getter for BatchQosPolicy
+     * @return BatchQosPolicy reference
+     */
+    RTPS_DllAPI const BatchQosPolicy& batch() const
+    {
+        return batch_;
+    }
+
+    /**
+     * Setter for BatchQosPolicy
+     * @param batch new value for the BatchQosPolicy
+     */
+    RTPS_DllAPI void batch(
+            const BatchQosPolicy& batch)
+    {
+        batch_ = batch;
+    }
+
     /**
      * Getter for DataRepresentationQosPolicy
      * @return DataRepresentationQosPolicy reference
@@ -782,6 +811,9 @@ private:
     //!Publication Mode Qos, implemented in the library.
     PublishModeQosPolicy publish_mode_;
 
+    //!Batch Qos, implemented in the library.
+    BatchQosPolicy batch_;
+
     //!Data Representation Qos, implemented in the library.
     DataRepresentationQosPolicy representation_;
 
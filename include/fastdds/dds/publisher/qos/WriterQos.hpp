@@ -60,6 +60,7 @@ public:
                (this->m_topicData == b.m_topicData) &&
                (this->m_groupData == b.m_groupData) &&
                (this->m_publishMode == b.m_publishMode) &&
+               (this->m_batch == b.m_batch) &&
                (this->m_disablePositiveACKs == b.m_disablePositiveACKs) &&
                (this->representation == b.representation);
     }
@@ -115,6 +116,9 @@ public:
     //!Publication Mode Qos, implemented in the library.
     PublishModeQosPolicy m_publishMode;
 
+    //!Batch Qos, implemented in the library.
+    BatchQosPolicy m_batch;
+
     //!Data Representation Qos, implemented in the library.
     DataRepresentationQosPolicy representation;
 
@@ -26,11 +26,15 @@
 #include <fastdds/dds/core/status/StatusMask.hpp>
 #include <fastdds/dds/core/status/IncompatibleQosStatus.hpp>
 #include <fastdds/dds/core/Entity.hpp>
+#include <fastdds/dds/subscriber/InstanceState.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/SampleState.hpp>
+#include <fastdds/dds/subscriber/ViewState.hpp>
 
 #include <fastrtps/types/TypesBase.h>
 
 
+#include <string>
 #include <vector>
 #include <cstdint>
 
@@ -62,6 +66,8 @@ namespace dds {
 class Subscriber;
 class SubscriberImpl;
 class DataReaderImpl;
+class QueryCondition;
+class ReadCondition;
 class DataReaderListener;
 class TypeSupport;
 class DataReaderQos;
@@ -307,6 +313,59 @@ public:
      */
     RTPS_DllAPI const Subscriber* get_subscriber() const;
 
+    /**
+     * @brief This operation creates a ReadCondition. The returned ReadCondition will be attached and belong to the
+     * DataReader.
+     *
+     * Only enabled DataReaders can create conditions. Samples are always considered NOT_NEW_VIEW_STATE.
+     *
+     * @param sample_states Only data samples with sample_state matching one of these will trigger the created
+     *                      condition.
+     * @param view_states Only data samples with view_state matching one of these will trigger the created
+     *                    condition.
+     * @param instance_states Only data samples with instance_state matching one of these will trigger the created
+     *                        condition.
+     * @return ReadCondition pointer on success, nullptr on error.
+     */
+    RTPS_DllAPI ReadCondition* create_readcondition(
+            SampleStateMask sample_states,
+            ViewStateMask view_states,
+            InstanceStateMask instance_states);
+
+    /**
+     * @brief This operation creates a QueryCondition. The returned QueryCondition will be attached and belong to the
+     * DataReader.
+     *
+     * The query expression follows the DDS-SQL grammar of the filter expression of a ContentFilteredTopic, and
+     * requires type information (a DynamicType or a registered TypeObject) to be available for the type of the
+     * DataReader.
+     *
+     * @param sample_states Only data samples with sample_state matching one of these will trigger the created
+     *                      condition.
+     * @param view_states Only data samples with view_state matching one of these will trigger the created
+     *                    condition.
+     * @param instance_states Only data samples with instance_state matching one of these will trigger the created
+     *                        condition.
+     * @param query_expression Only data samples that pass this expression will trigger the created condition.
+     * @param query_parameters Value of the parameters on query_expression.
+     * @return QueryCondition pointer on success, nullptr on error.
+     */
+    RTPS_DllAPI QueryCondition* create_querycondition(
+            SampleStateMask sample_states,
+            ViewStateMask view_states,
+            InstanceStateMask instance_states,
+            const std::string& query_expression,
+            const std::vector<std::string>& query_parameters);
+
+    /**
+     * @brief This operation deletes a ReadCondition (or QueryCondition) attached to the DataReader.
+     * @param a_condition pointer to a ReadCondition belonging to the DataReader
+     * @return RETCODE_OK if the condition is deleted, RETCODE_BAD_PARAMETER if it is nullptr and
+     *         RETCODE_PRECONDITION_NOT_MET if it does not belong to this DataReader
+     */
+    RTPS_DllAPI ReturnCode_t delete_readcondition(
+            ReadCondition* a_condition);
+
     /* TODO
        RTPS_DllAPI bool wait_for_historical_data(
             const fastrtps::Duration_t& max_wait) const;
@@ -0,0 +1,106 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file QueryCondition.hpp
+ */
+
+#ifndef _FASTDDS_QUERY_CONDITION_HPP_
+#define _FASTDDS_QUERY_CONDITION_HPP_
+
+#include <fastdds/dds/subscriber/ReadCondition.hpp>
+#include <fastrtps/fastrtps_dll.h>
+#include <fastrtps/types/TypesBase.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+using eprosima::fastrtps::types::ReturnCode_t;
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+namespace DDSSQLFilter {
+class DDSFilterExpression;
+} // namespace DDSSQLFilter
+
+/**
+ * @brief A specialized ReadCondition that also filters the samples with a DDS-SQL expression.
+ *
+ * The query expression uses the same grammar as the filter expression of a ContentFilteredTopic, and is
+ * evaluated on the serialized samples held by the DataReader.
+ *
+ * QueryCondition objects are created with DataReader::create_querycondition and deleted with
+ * DataReader::delete_readcondition.
+ */
+class QueryCondition final : public ReadCondition
+{
+    friend class DataReaderImpl;
+
+    QueryCondition(
+            DataReaderImpl* reader,
+            SampleStateMask sample_states,
+            ViewStateMask view_states,
+            InstanceStateMask instance_states,
+            const std::string& query_expression);
+
+public:
+
+    RTPS_DllAPI ~QueryCondition();
+
+    RTPS_DllAPI bool get_trigger_value() const override;
+
+    /**
+     * @brief Retrieves the query expression of this condition.
+     * @return The query_expression specified when the QueryCondition was created.
+     */
+    RTPS_DllAPI const std::string& get_query_expression() const;
+
+    /**
+     * @brief Retrieves the current values of the query parameters.
+     * @param [out] query_parameters Vector where the parameters will be copied.
+     * @return RETCODE_OK
+     */
+    RTPS_DllAPI ReturnCode_t get_query_parameters(
+            std::vector<std::string>& query_parameters) const;
+
+    /**
+     * @brief Changes the values of the query parameters.
+     * @param query_parameters New values of the parameters.
+     * @return RETCODE_OK if the query could be compiled with the new parameters,
+     *         RETCODE_BAD_PARAMETER otherwise.
+     */
+    RTPS_DllAPI ReturnCode_t set_query_parameters(
+            const std::vector<std::string>& query_parameters);
+
+private:
+
+    std::string query_expression_;
+
+    std::vector<std::string> query_parameters_;
+
+    //! Compiled query, only used with the mutex of the DataReader taken
+    std::unique_ptr<DDSSQLFilter::DDSFilterExpression> query_;
+
+    std::atomic<bool> trigger_value_;
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_QUERY_CONDITION_HPP_
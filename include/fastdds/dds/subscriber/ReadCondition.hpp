@@ -0,0 +1,108 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReadCondition.hpp
+ */
+
+#ifndef _FASTDDS_READ_CONDITION_HPP_
+#define _FASTDDS_READ_CONDITION_HPP_
+
+#include <fastdds/dds/core/condition/Condition.hpp>
+#include <fastdds/dds/subscriber/InstanceState.hpp>
+#include <fastdds/dds/subscriber/SampleState.hpp>
+#include <fastdds/dds/subscriber/ViewState.hpp>
+#include <fastrtps/fastrtps_dll.h>
+
+#include <cstdint>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+class DataReader;
+class DataReaderImpl;
+
+/**
+ * @brief A Condition specifically dedicated to read operations and attached to one DataReader.
+ *
+ * Its trigger_value is true whenever the DataReader holds at least one sample whose sample, view and
+ * instance states match the ones specified on the condition. The DataReader keeps the trigger value up to date
+ * as samples arrive and are read or taken, so checking it from a WaitSet does not take any lock.
+ *
+ * ReadCondition objects are created with DataReader::create_readcondition and deleted with
+ * DataReader::delete_readcondition.
+ */
+class ReadCondition : public Condition
+{
+    friend class DataReaderImpl;
+
+protected:
+
+    ReadCondition(
+            DataReaderImpl* reader,
+            SampleStateMask sample_states,
+            ViewStateMask view_states,
+            InstanceStateMask instance_states);
+
+public:
+
+    RTPS_DllAPI virtual ~ReadCondition();
+
+    RTPS_DllAPI bool get_trigger_value() const override;
+
+    /**
+     * @brief Retrieves the DataReader associated with the ReadCondition.
+     * @return Pointer to the DataReader
+     */
+    RTPS_DllAPI DataReader* get_datareader() const;
+
+    /**
+     * @brief Retrieves the set of sample_states taken into account to determine the trigger_value of this condition.
+     * @return The sample_states specified when the ReadCondition was created.
+     */
+    RTPS_DllAPI SampleStateMask get_sample_state_mask() const;
+
+    /**
+     * @brief Retrieves the set of view_states taken into account to determine the trigger_value of this condition.
+     * @return The view_states specified when the ReadCondition was created.
+     */
+    RTPS_DllAPI ViewStateMask get_view_state_mask() const;
+
+    /**
+     * @brief Retrieves the set of instance_states taken into account to determine the trigger_value of this
+     * condition.
+     * @return The instance_states specified when the ReadCondition was created.
+     */
+    RTPS_DllAPI InstanceStateMask get_instance_state_mask() const;
+
+protected:
+
+    DataReaderImpl* reader_;
+
+    SampleStateMask sample_states_;
+
+    ViewStateMask view_states_;
+
+    InstanceStateMask instance_states_;
+
+    //! Combinations of sample and instance states of the samples matched by this condition
+    uint32_t states_;
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_READ_CONDITION_HPP_
@@ -96,7 +96,8 @@ public:
     bool operator ==(
             const ReaderResourceLimitsQos& b) const
     {
-        return (this->matched_publisher_allocation == b.matched_publisher_allocation);
+        return (this->matched_publisher_allocation == b.matched_publisher_allocation) &&
+               (this->max_incomplete_samples_memory == b.max_incomplete_samples_memory);
     }
 
     inline void clear()
@@ -107,6 +108,9 @@ public:
 
     //!Matched publishers allocation limits.
     fastrtps::ResourceLimitedContainerConfig matched_publisher_allocation;
+
+    //!Maximum payload memory (in bytes) held by samples pending reassembly. Default value 0 means unlimited.
+    uint32_t max_incomplete_samples_memory = 0;
 };
 
 //! Qos Policy to configure the XTypes Qos associated to the DataReader
@@ -0,0 +1,121 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ContentFilteredTopic.hpp
+ */
+
+#ifndef _FASTDDS_CONTENTFILTEREDTOPIC_HPP_
+#define _FASTDDS_CONTENTFILTEREDTOPIC_HPP_
+
+#include <fastrtps/fastrtps_dll.h>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TopicDescription.hpp>
+#include <fastrtps/types/TypesBase.h>
+
+#include <string>
+#include <vector>
+
+using eprosima::fastrtps::types::ReturnCode_t;
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+class DomainParticipant;
+class DomainParticipantImpl;
+class ContentFilteredTopicImpl;
+
+/**
+ * Specialization of TopicDescription that allows for content-based subscriptions.
+ *
+ * The filter expression follows the DDS-SQL grammar of the DDS specification, and is evaluated
+ * on the serialized samples. When the writer is able to, samples not passing the filter of a
+ * remote reader are not sent to it.
+ * @ingroup FASTDDS_MODULE
+ */
+class ContentFilteredTopic : public TopicDescription
+{
+    friend class ContentFilteredTopicImpl;
+    friend class DomainParticipantImpl;
+
+    /**
+     * Create a content filtered topic, assigning its pointer to the associated implementation.
+     * Don't use directly, create ContentFilteredTopic using create_contentfilteredtopic from DomainParticipant.
+     */
+    ContentFilteredTopic(
+            const std::string& name,
+            Topic* related_topic,
+            ContentFilteredTopicImpl* p);
+
+public:
+
+    /**
+     * @brief Destructor
+     */
+    RTPS_DllAPI virtual ~ContentFilteredTopic();
+
+    /**
+     * @brief Getter for the DomainParticipant
+     * @return DomainParticipant pointer
+     */
+    virtual DomainParticipant* get_participant() const override;
+
+    /**
+     * Get the related topic of this content filtered topic.
+     * @return Pointer to the Topic being filtered.
+     */
+    RTPS_DllAPI Topic* get_related_topic() const;
+
+    /**
+     * Get the filter expression used to create this content filtered topic.
+     * @return The filter expression.
+     */
+    RTPS_DllAPI const std::string& get_filter_expression() const;
+
+    /**
+     * Get the values of the parameters of the filter expression.
+     * @param expression_parameters [out] Vector where the parameters are returned.
+     * @return RETCODE_OK
+     */
+    RTPS_DllAPI ReturnCode_t get_expression_parameters(
+            std::vector<std::string>& expression_parameters) const;
+
+    /**
+     * Modifies the values of the parameters of the filter expression.
+     * Readers created on this content filtered topic update the filter announced to the writers.
+     * @param expression_parameters New values of the parameters.
+     * @return RETCODE_BAD_PARAMETER if the parameters are not valid for the filter expression,
+     * RETCODE_OK otherwise.
+     */
+    RTPS_DllAPI ReturnCode_t set_expression_parameters(
+            const std::vector<std::string>& expression_parameters);
+
+    /**
+     * @brief Getter for the TopicDescriptionImpl
+     * @return pointer to TopicDescriptionImpl
+     */
+    TopicDescriptionImpl* get_impl() const override;
+
+protected:
+
+    ContentFilteredTopicImpl* impl_;
+
+};
+
+} /* namespace dds */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif /* _FASTDDS_CONTENTFILTEREDTOPIC_HPP_ */
@@ -34,6 +34,9 @@
 // This version of TypeSupport has `construct_sample()`
 #define TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
 
+// This version of TypeSupport has `copy_sample()`
+#define TOPIC_DATA_TYPE_API_HAS_COPY_SAMPLE
+
 namespace eprosima {
 namespace fastrtps {
 
@@ -302,6 +305,25 @@ public:
         return false;
     }
 
+    /**
+     * Copy a sample into another one.
+     * Types supporting it let DataWriters share the written samples with the DataReaders on the same process,
+     * which then take them without serializing nor deserializing.
+     *
+     * @param src Pointer to the sample to be copied.
+     * @param dst Pointer to a sample created with createData() where src should be copied.
+     *
+     * @return whether this type supports copying samples or not.
+     */
+    RTPS_DllAPI virtual inline bool copy_sample(
+            const void* src,
+            void* dst) const
+    {
+        static_cast<void>(src);
+        static_cast<void>(dst);
+        return false;
+    }
+
     //! Maximum serialized size of the type in bytes.
     //! If the type has unbounded fields, and therefore cannot have a maximum size, use 0.
     uint32_t m_typeSize;
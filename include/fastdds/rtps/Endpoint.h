@@ -30,7 +30,17 @@
 
 #include <fastrtps/utils/TimedMutex.hpp>
 
+#include <memory>
+
 namespace eprosima {
+namespace fastdds {
+namespace statistics {
+
+class EndpointStatistics;
+
+} // namespace statistics
+} // namespace fastdds
+
 namespace fastrtps {
 namespace rtps {
 
@@ -99,6 +109,15 @@ public:
         return m_att;
     }
 
+    /**
+     * Get the statistics of this endpoint.
+     * @return Pointer to the statistics, or nullptr when statistics are not enabled on the participant.
+     */
+    inline fastdds::statistics::EndpointStatistics* statistics() const
+    {
+        return statistics_.get();
+    }
+
 #if HAVE_SECURITY
     bool supports_rtps_protection()
     {
@@ -130,6 +149,9 @@ protected:
     //!Fixed size of payloads
     uint32_t fixed_payload_size_ = 0;
 
+    //!Statistics of the endpoint. Only set when statistics are enabled on the participant.
+    std::shared_ptr<fastdds::statistics::EndpointStatistics> statistics_;
+
 private:
 
     Endpoint& operator =(
@@ -74,6 +74,7 @@ public:
         , liveliness_lease_duration(TIME_T_INFINITE_SECONDS, TIME_T_INFINITE_NANOSECONDS)
         , expectsInlineQos(false)
         , disable_positive_acks(false)
+        , max_incomplete_samples_memory(0)
     {
         endpoint.endpointKind = READER;
         endpoint.durabilityKind = VOLATILE;
@@ -102,6 +103,10 @@ public:
 
     //! Define the allocation behaviour for matched-writer-dependent collections.
     ResourceLimitedContainerConfig matched_writers_allocation;
+
+    //! Maximum payload memory (in bytes) held by samples pending reassembly (only for stateful readers).
+    //! Oldest incomplete samples are evicted when exceeded. Default value 0 means unlimited.
+    uint32_t max_incomplete_samples_memory;
 };
 
 } /* namespace rtps */
@@ -55,6 +55,14 @@ struct WriterTimes
     Duration_t nackResponseDelay;
     //!This time allows the RTPSWriter to ignore nack messages too soon after the data as sent, default value 0s.
     Duration_t nackSupressionDuration;
+    //! Whether the periodic HB period adapts to the acknowledgement state of the readers, default value false.
+    //! The period starts at heartbeatPeriod, is halved when unacknowledged data grows or readers NACK, and is
+    //! doubled each time all readers are in sync.
+    bool adaptiveHeartbeat;
+    //! Lower bound of the adaptive HB period, default value 100ms.
+    Duration_t minHeartbeatPeriod;
+    //! Upper bound of the adaptive HB period, default value 30s.
+    Duration_t maxHeartbeatPeriod;
 
     WriterTimes()
     {
@@ -63,6 +71,9 @@ struct WriterTimes
         heartbeatPeriod.seconds = 3;
         //nackResponseDelay.fraction = 20*1000*1000;
         nackResponseDelay.nanosec = 5 * 1000 * 1000;
+        adaptiveHeartbeat = false;
+        minHeartbeatPeriod.nanosec = 100 * 1000 * 1000;
+        maxHeartbeatPeriod.seconds = 30;
     }
 
     virtual ~WriterTimes()
@@ -75,7 +86,36 @@ struct WriterTimes
         return (this->initialHeartbeatDelay == b.initialHeartbeatDelay) &&
                (this->heartbeatPeriod == b.heartbeatPeriod) &&
                (this->nackResponseDelay == b.nackResponseDelay) &&
-               (this->nackSupressionDuration == b.nackSupressionDuration);
+               (this->nackSupressionDuration == b.nackSupressionDuration) &&
+               (this->adaptiveHeartbeat == b.adaptiveHeartbeat) &&
+               (this->minHeartbeatPeriod == b.minHeartbeatPeriod) &&
+               (this->maxHeartbeatPeriod == b.maxHeartbeatPeriod);
+    }
+
+};
+
+/**
+ * Struct WriterBatchAttributes, defining how a writer coalesces small samples into batch submessages.
+ * @ingroup RTPS_ATTRIBUTES_MODULE
+ */
+struct WriterBatchAttributes
+{
+    //! Whether samples are batched. Default value false.
+    bool enabled = false;
+    //! Maximum number of samples in a batch, 0 means no limit. Default value 0.
+    uint32_t max_samples = 0;
+    //! Maximum number of payload bytes in a batch. Default value 1024.
+    uint32_t max_bytes = 1024;
+    //! Maximum time a sample waits for its batch to be sent. Default value 1ms.
+    Duration_t max_flush_delay {0, 1000000};
+
+    bool operator ==(
+            const WriterBatchAttributes& b) const
+    {
+        return (this->enabled == b.enabled) &&
+               (this->max_samples == b.max_samples) &&
+               (this->max_bytes == b.max_bytes) &&
+               (this->max_flush_delay == b.max_flush_delay);
     }
 
 };
@@ -138,6 +178,9 @@ public:
 
     //! Keep duration to keep a sample before considering it has been acked
     Duration_t keep_duration;
+
+    //! Batching of small samples. Enabling it makes the writer asynchronous.
+    WriterBatchAttributes batch;
 };
 
 } /* namespace rtps */
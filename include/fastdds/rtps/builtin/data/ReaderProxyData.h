@@ -31,6 +31,7 @@
 #include <fastdds/rtps/security/accesscontrol/EndpointSecurityAttributes.h>
 #endif // if HAVE_SECURITY
 
+#include <fastdds/rtps/common/ContentFilterProperty.hpp>
 #include <fastdds/rtps/common/RemoteLocators.hpp>
 
 namespace eprosima {
@@ -337,6 +338,21 @@ public:
         return m_type_information != nullptr;
     }
 
+    /**
+     * Set the content filter applied by the reader.
+     * @param filter Content filter property, with an empty filter expression when no filter is applied.
+     */
+    RTPS_DllAPI void content_filter(
+            const fastdds::rtps::ContentFilterProperty& filter)
+    {
+        content_filter_ = filter;
+    }
+
+    RTPS_DllAPI const fastdds::rtps::ContentFilterProperty& content_filter() const
+    {
+        return content_filter_;
+    }
+
     inline bool disable_positive_acks() const
     {
         return m_qos.m_disablePositiveACKs.enabled;
@@ -457,6 +473,8 @@ private:
     xtypes::TypeInformation* m_type_information;
     //!
     ParameterPropertyList_t m_properties;
+    //!Content filter applied by the reader
+    fastdds::rtps::ContentFilterProperty content_filter_;
 };
 
 } // namespace rtps
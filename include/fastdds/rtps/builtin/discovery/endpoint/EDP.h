@@ -161,12 +161,14 @@ public:
      * @param R Pointer to the RTPSReader.
      * @param att Attributes of the associated topic
      * @param qos QoS policies dictated by the subscriber
+     * @param content_filter Optional content filter announced for the reader
      * @return True if correct.
      */
     bool newLocalReaderProxyData(
             RTPSReader* R,
             const TopicAttributes& att,
-            const ReaderQos& qos);
+            const ReaderQos& qos,
+            const fastdds::rtps::ContentFilterProperty* content_filter = nullptr);
     /**
      * Create a new ReaderPD for a local Writer.
      * @param W Pointer to the RTPSWriter.
@@ -183,12 +185,14 @@ public:
      * @param R Pointer to the reader;
      * @param att Attributes of the associated topic
      * @param qos QoS policies dictated by the subscriber
+     * @param content_filter Optional new content filter for the reader. When nullptr the filter is not modified.
      * @return True if correctly updated
      */
     bool updatedLocalReader(
             RTPSReader* R,
             const TopicAttributes& att,
-            const ReaderQos& qos);
+            const ReaderQos& qos,
+            const fastdds::rtps::ContentFilterProperty* content_filter = nullptr);
     /**
      * A previously created Writer has been updated
      * @param W Pointer to the Writer
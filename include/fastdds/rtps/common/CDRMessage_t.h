@@ -42,6 +42,9 @@ namespace rtps {
 #define RTPSMESSAGE_OCTETSTOINLINEQOS_DATASUBMSG 16 //may change in future versions
 #define RTPSMESSAGE_OCTETSTOINLINEQOS_DATAFRAGSUBMSG 28 //may change in future versions
 #define RTPSMESSAGE_DATA_MIN_LENGTH 24
+#define RTPSMESSAGE_OCTETSTOINLINEQOS_DATABATCHSUBMSG 20 //may change in future versions
+#define RTPSMESSAGE_DATA_BATCH_MIN_LENGTH 24
+#define RTPSMESSAGE_DATA_BATCH_SAMPLE_HEADER_SIZE 16
 
 /**
  * @brief Structure CDRMessage_t, contains a serialized message.
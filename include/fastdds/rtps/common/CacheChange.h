@@ -27,8 +27,15 @@
 #include <fastdds/rtps/common/FragmentNumber.h>
 
 #include <cassert>
+#include <memory>
+#include <vector>
+
+#if _MSC_VER
+#include <intrin.h>
+#endif // if _MSC_VER
 
 #include <fastdds/rtps/history/IPayloadPool.h>
+#include <fastdds/rtps/common/IIntraprocessSample.hpp>
 
 namespace eprosima {
 namespace fastrtps {
@@ -53,18 +60,21 @@ enum RTPS_DllAPI ChangeKind_t
  */
 struct RTPS_DllAPI CacheChange_t
 {
+    // Fields accessed when traversing a history are kept together at the beginning of the structure,
+    // so they share a cache line.
+
     //!Kind of change, default value ALIVE.
     ChangeKind_t kind = ALIVE;
+    //!Indicates if the cache has been read (only used in READERS)
+    bool isRead = false;
     //!GUID_t of the writer that generated this change.
     GUID_t writerGUID;
-    //!Handle of the data associated wiht this change.
-    InstanceHandle_t instanceHandle;
     //!SequenceNumber of the change
     SequenceNumber_t sequenceNumber;
+    //!Handle of the data associated wiht this change.
+    InstanceHandle_t instanceHandle;
     //!Serialized Payload associated with the change.
     SerializedPayload_t serializedPayload;
-    //!Indicates if the cache has been read (only used in READERS)
-    bool isRead = false;
     //!Source TimeStamp (only used in Readers)
     Time_t sourceTimestamp;
     //!Reception TimeStamp (only used in Readers)
@@ -73,6 +83,9 @@ struct RTPS_DllAPI CacheChange_t
     WriteParams write_params;
     bool is_untyped_ = true;
 
+    //!User sample shared with the readers on the same process. The payload is empty until it is serialized.
+    std::shared_ptr<fastdds::rtps::IIntraprocessSample> intraprocess_sample;
+
     /*!
      * @brief Default constructor.
      * Creates an empty CacheChange_t.
@@ -115,6 +128,7 @@ struct RTPS_DllAPI CacheChange_t
         fragment_size_ = ch_ptr->fragment_size_;
         fragment_count_ = ch_ptr->fragment_count_;
         first_missing_fragment_ = ch_ptr->first_missing_fragment_;
+        missing_fragments_ = ch_ptr->missing_fragments_;
 
         return serializedPayload.copy(&ch_ptr->serializedPayload, !ch_ptr->is_untyped_);
     }
@@ -134,6 +148,7 @@ struct RTPS_DllAPI CacheChange_t
         sourceTimestamp = ch_ptr->sourceTimestamp;
         write_params = ch_ptr->write_params;
         isRead = ch_ptr->isRead;
+        intraprocess_sample = ch_ptr->intraprocess_sample;
 
         // Copy certain values from serializedPayload
         serializedPayload.encapsulation = ch_ptr->serializedPayload.encapsulation;
@@ -188,12 +203,13 @@ struct RTPS_DllAPI CacheChange_t
         // Note: Fragment numbers are 1-based but we keep them 0 based.
         frag_sns.base(first_missing_fragment_ + 1);
 
-        // Traverse list of missing fragments, adding them to frag_sns
+        // Scan the bitmap of missing fragments, stopping when the range of frag_sns is exceeded
+        uint32_t max_frag = first_missing_fragment_ + 256u;
         uint32_t current_frag = first_missing_fragment_;
-        while (current_frag < fragment_count_)
+        while (current_frag < fragment_count_ && current_frag < max_frag)
         {
             frag_sns.add(current_frag + 1);
-            current_frag = get_next_missing_fragment(current_frag);
+            current_frag = find_missing_fragment(current_frag + 1);
         }
     }
 
@@ -213,6 +229,7 @@ struct RTPS_DllAPI CacheChange_t
         fragment_size_ = fragment_size;
         fragment_count_ = 0;
         first_missing_fragment_ = 0;
+        missing_fragments_.clear();
 
         if (fragment_size > 0)
         {
@@ -221,12 +238,13 @@ struct RTPS_DllAPI CacheChange_t
 
             if (create_fragment_list)
             {
-                // Keep index of next fragment on the payload portion at the beginning of each fragment. Last
-                // fragment will have fragment_count_ as 'next fragment index'
-                size_t offset = 0;
-                for (uint32_t i = 1; i <= fragment_count_; i++, offset += fragment_size_)
+                // All fragments start as missing. Bits past the last fragment are kept cleared, so the
+                // scans never need to check for them.
+                missing_fragments_.assign((fragment_count_ + 31u) / 32u, ~0u);
+                uint32_t tail_bits = fragment_count_ & 31u;
+                if (tail_bits != 0u)
                 {
-                    set_next_missing_fragment(i - 1, i);  // index to next fragment in missing list
+                    missing_fragments_.back() = (1u << tail_bits) - 1u;
                 }
             }
             else
@@ -273,14 +291,44 @@ struct RTPS_DllAPI CacheChange_t
 
         if (received_fragments(fragment_starting_num - 1, fragments_in_submessage))
         {
-            memcpy(
-                &serializedPayload.data[original_offset],
-                incoming_data.data, incoming_length);
+            // Fragments are already in place when the payload is a reassembly buffer shared with other readers
+            octet* destination = &serializedPayload.data[original_offset];
+            if (destination != incoming_data.data)
+            {
+                memcpy(destination, incoming_data.data, incoming_length);
+            }
         }
 
         return is_fully_assembled();
     }
 
+    /*!
+     * Copy the fragments received so far to another buffer.
+     *
+     * @param buffer Destination buffer, with room for the whole payload.
+     */
+    void copy_received_fragments(
+            octet* buffer) const
+    {
+        uint32_t current_frag = 0;
+        while (current_frag < fragment_count_)
+        {
+            // Copy the run of received fragments up to the next missing one
+            uint32_t missing_frag = find_missing_fragment(current_frag);
+            if (missing_frag > current_frag)
+            {
+                uint32_t offset = current_frag * fragment_size_;
+                uint32_t end = missing_frag * fragment_size_;
+                if (end > serializedPayload.length)
+                {
+                    end = serializedPayload.length;
+                }
+                memcpy(&buffer[offset], &serializedPayload.data[offset], end - offset);
+            }
+            current_frag = missing_frag + 1;
+        }
+    }
+
     IPayloadPool const* payload_owner() const
     {
         return payload_owner_;
@@ -297,6 +345,22 @@ struct RTPS_DllAPI CacheChange_t
         payload_owner_ = owner;
     }
 
+    /*!
+     * Whether the payload is a reassembly buffer shared with other readers.
+     * Such a payload is only written by the MessageReceiver that reassembles it, so it should be copied before
+     * writing fragments received by other means.
+     */
+    bool payload_is_shared() const
+    {
+        return payload_shared_;
+    }
+
+    void payload_is_shared(
+            bool shared)
+    {
+        payload_shared_ = shared;
+    }
+
 private:
 
     // Fragment size
@@ -311,34 +375,51 @@ private:
     // Pool that created the payload of this cache change
     IPayloadPool* payload_owner_ = nullptr;
 
-    uint32_t get_next_missing_fragment(
-            uint32_t fragment_index)
-    {
-        uint32_t* ptr = next_fragment_pointer(fragment_index);
-        return *ptr;
-    }
+    // Whether the payload is a reassembly buffer shared with other readers
+    bool payload_shared_ = false;
 
-    void set_next_missing_fragment(
-            uint32_t fragment_index,
-            uint32_t next_fragment_index)
-    {
-        uint32_t* ptr = next_fragment_pointer(fragment_index);
-        *ptr = next_fragment_index;
-    }
+    // Bitmap of missing fragments (bit set means the fragment has not been received yet)
+    std::vector<uint32_t> missing_fragments_;
 
-    uint32_t* next_fragment_pointer(
-            uint32_t fragment_index)
+    /*!
+     * Find the first missing fragment starting at a given one.
+     *
+     * @param fragment_index Index (0-based) of the fragment where the search begins.
+     * @return the index of the first missing fragment at or after fragment_index, or
+     *         fragment_count_ if there are none.
+     */
+    uint32_t find_missing_fragment(
+            uint32_t fragment_index) const
     {
-        size_t offset = fragment_size_;
-        offset *= fragment_index;
-        offset = (offset + 3u) & ~3u;
-        return reinterpret_cast<uint32_t*>(&serializedPayload.data[offset]);
+        size_t word_index = fragment_index >> 5u;
+        if (word_index >= missing_fragments_.size())
+        {
+            return fragment_count_;
+        }
+
+        uint32_t bits = missing_fragments_[word_index] & (~0u << (fragment_index & 31u));
+        while (bits == 0u)
+        {
+            if (++word_index >= missing_fragments_.size())
+            {
+                return fragment_count_;
+            }
+            bits = missing_fragments_[word_index];
+        }
+
+#if _MSC_VER
+        unsigned long bit;
+        _BitScanForward(&bit, bits);
+#else
+        uint32_t bit = static_cast<uint32_t>(__builtin_ctz(bits));
+#endif // if _MSC_VER
+
+        return static_cast<uint32_t>(word_index << 5u) + static_cast<uint32_t>(bit);
     }
 
     /*!
      * Mark a set of consecutive fragments as received.
-     * This will remove a set of consecutive fragments from the missing list.
-     * Should be called BEFORE copying the received data into the serialized payload.
+     * This will remove a set of consecutive fragments from the missing bitmap.
      *
      * @param initial_fragment Index (0-based) of first received fragment.
      * @param num_of_fragments Number of received fragments. Should be strictly positive.
@@ -350,7 +431,7 @@ private:
     {
         bool at_least_one_changed = false;
 
-        if ((fragment_size_ > 0) && (initial_fragment < fragment_count_))
+        if ((fragment_size_ > 0) && (initial_fragment < fragment_count_) && !missing_fragments_.empty())
         {
             uint32_t last_fragment = initial_fragment + num_of_fragments;
             if (last_fragment > fragment_count_)
@@ -358,42 +439,33 @@ private:
                 last_fragment = fragment_count_;
             }
 
-            if (initial_fragment <= first_missing_fragment_)
+            // Clear the bits of the received range one word at a time
+            uint32_t current_frag = initial_fragment;
+            while (current_frag < last_fragment)
             {
-                // Perform first = *first until first >= last_received
-                while (first_missing_fragment_ < last_fragment)
+                uint32_t bit = current_frag & 31u;
+                uint32_t bits_in_word = 32u - bit;
+                if (bits_in_word > last_fragment - current_frag)
+                {
+                    bits_in_word = last_fragment - current_frag;
+                }
+
+                uint32_t mask = (bits_in_word == 32u) ? ~0u : (((1u << bits_in_word) - 1u) << bit);
+                uint32_t& word = missing_fragments_[current_frag >> 5u];
+                if ((word & mask) != 0u)
                 {
-                    first_missing_fragment_ = get_next_missing_fragment(first_missing_fragment_);
+                    word &= ~mask;
                     at_least_one_changed = true;
                 }
+
+                current_frag += bits_in_word;
             }
-            else
+
+            // Only when the first hole is filled the scan for the next one is needed
+            if (at_least_one_changed && initial_fragment <= first_missing_fragment_ &&
+                    first_missing_fragment_ < last_fragment)
             {
-                // Find prev in missing list
-                uint32_t current_frag = first_missing_fragment_;
-                while (current_frag < initial_fragment)
-                {
-                    uint32_t next_frag = get_next_missing_fragment(current_frag);
-                    if (next_frag >= initial_fragment)
-                    {
-                        // This is the fragment previous to initial_fragment.
-                        // Find future value for next by repeating next = *next until next >= last_fragment.
-                        uint32_t next_missing_fragment = next_frag;
-                        while (next_missing_fragment < last_fragment)
-                        {
-                            next_missing_fragment = get_next_missing_fragment(next_missing_fragment);
-                            at_least_one_changed = true;
-                        }
-
-                        // Update next and finish loop
-                        if (at_least_one_changed)
-                        {
-                            set_next_missing_fragment(current_frag, next_missing_fragment);
-                        }
-                        break;
-                    }
-                    current_frag = next_frag;
-                }
+                first_missing_fragment_ = find_missing_fragment(last_fragment);
             }
         }
 
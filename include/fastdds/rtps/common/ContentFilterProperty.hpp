@@ -0,0 +1,78 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ContentFilterProperty.hpp
+ *
+ */
+
+#ifndef _FASTDDS_RTPS_COMMON_CONTENTFILTERPROPERTY_HPP_
+#define _FASTDDS_RTPS_COMMON_CONTENTFILTERPROPERTY_HPP_
+
+#include <fastrtps/utils/fixed_size_string.hpp>
+
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Information about the content filter being applied by a reader, as announced on discovery
+ * (ContentFilterProperty_t on the DDSI-RTPS specification).
+ * @ingroup COMMON_MODULE
+ */
+struct ContentFilterProperty
+{
+    //! Name of the content filtered topic of the reader
+    fastrtps::string_255 content_filtered_topic_name;
+    //! Name of the topic being filtered
+    fastrtps::string_255 related_topic_name;
+    //! Class of the filter, i.e. the grammar of the filter expression
+    fastrtps::string_255 filter_class_name;
+    //! Filter expression. An empty expression means no filter is being applied
+    std::string filter_expression;
+    //! Values of the parameters of the filter expression
+    std::vector<std::string> expression_parameters;
+
+    bool operator ==(
+            const ContentFilterProperty& other) const
+    {
+        return content_filtered_topic_name == other.content_filtered_topic_name &&
+               related_topic_name == other.related_topic_name &&
+               filter_class_name == other.filter_class_name &&
+               filter_expression == other.filter_expression &&
+               expression_parameters == other.expression_parameters;
+    }
+
+    bool operator !=(
+            const ContentFilterProperty& other) const
+    {
+        return !(*this == other);
+    }
+
+    //! Whether a filter is being applied
+    bool is_set() const
+    {
+        return filter_class_name.size() > 0 && !filter_expression.empty();
+    }
+
+};
+
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif /* _FASTDDS_RTPS_COMMON_CONTENTFILTERPROPERTY_HPP_ */
@@ -0,0 +1,65 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file IIntraprocessSample.hpp
+ *
+ */
+
+#ifndef _FASTDDS_RTPS_COMMON_IINTRAPROCESSSAMPLE_HPP_
+#define _FASTDDS_RTPS_COMMON_IINTRAPROCESSSAMPLE_HPP_
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+struct CacheChange_t;
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Abstract class IIntraprocessSample that acts as virtual interface for user samples attached to a CacheChange_t.
+ *
+ * A writer may attach an immutable user sample to a change instead of serializing it, so the readers on the same
+ * process can take the sample without deserializing it. The payload of such a change is empty until the writer
+ * needs the serialized data, i.e. for a remote reader, and calls serialize().
+ *
+ * @ingroup COMMON_MODULE
+ */
+class IIntraprocessSample
+{
+public:
+
+    virtual ~IIntraprocessSample() = default;
+
+    /**
+     * Serializes the sample into the payload of the change it is attached to.
+     * The payload of the change should have been reserved with enough room for the serialized sample.
+     *
+     * @param change The CacheChange_t this sample is attached to.
+     * @return true if the payload was serialized.
+     */
+    virtual bool serialize(
+            fastrtps::rtps::CacheChange_t& change) const = 0;
+};
+
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif /* _FASTDDS_RTPS_COMMON_IINTRAPROCESSSAMPLE_HPP_ */
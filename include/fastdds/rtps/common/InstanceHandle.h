@@ -23,6 +23,8 @@
 #include <fastdds/rtps/common/Types.h>
 #include <fastdds/rtps/common/Guid.h>
 
+#include <cstring>
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
@@ -214,6 +216,25 @@ inline bool operator <(
     return memcmp(h1.value, h2.value, 16) < 0;
 }
 
+/*!
+ * @brief Defines the STL hash function for type InstanceHandle_t.
+ * Both halves of the handle are mixed, as keys smaller than 16 bytes are stored unhashed on the handle.
+ */
+struct InstanceHandleHash
+{
+    std::size_t operator ()(
+            const InstanceHandle_t& handle) const noexcept
+    {
+        uint64_t low;
+        uint64_t high;
+        memcpy(&low, handle.value, sizeof(low));
+        memcpy(&high, handle.value + sizeof(low), sizeof(high));
+        uint64_t hash = (low ^ (high * 0x9E3779B97F4A7C15ull)) * 0xBF58476D1CE4E5B9ull;
+        return static_cast<std::size_t>(hash ^ (hash >> 31));
+    }
+
+};
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
 /**
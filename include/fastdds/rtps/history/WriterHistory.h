@@ -91,9 +91,25 @@ public:
             const CacheChange_t* inner,
             CacheChange_t* outer) override;
 
-    //! Introduce base class method into scope
+    //! Introduce base class methods into scope
+    using History::find_change_nts;
     using History::remove_change;
 
+    /**
+     * Find the change with a sequence number in the history.
+     * Changes are kept sorted by sequence number, so the change is looked up with a binary search.
+     * No Thread Safe
+     * @param sequence_number Sequence number of the change to search for.
+     * @return an iterator to the change, or changesEnd() if it is not in the history
+     */
+    RTPS_DllAPI const_iterator find_change_nts(
+            const SequenceNumber_t& sequence_number);
+
+    /**
+     * Remove a change of this writer from the history, looking it up by its sequence number.
+     * @param a_change Pointer to the CacheChange_t.
+     * @return True if removed.
+     */
     RTPS_DllAPI virtual bool remove_change_g(
             CacheChange_t* a_change);
 
@@ -79,6 +79,11 @@ inline bool readUInt32(
         CDRMessage_t* msg,
         uint32_t* ulo);
 
+inline bool readUInt32Array(
+        CDRMessage_t* msg,
+        uint32_t* values,
+        uint32_t count);
+
 inline bool readInt64(
         CDRMessage_t* msg,
         int64_t* lolo);
@@ -184,6 +189,18 @@ inline bool appendMsg(
         CDRMessage_t* first,
         CDRMessage_t* second);
 
+/**
+ * Copy an array of 32 bit words, reversing the bytes of each one. Used to convert whole arrays between endiannesses.
+ * The loop is simple enough for the compiler to vectorize it where SIMD instructions are available.
+ * @param[out] dest Pointer to the destination words.
+ * @param[in] src Pointer to the source words.
+ * @param[in] count Number of words to copy.
+ */
+inline void copyUInt32ArrayReversed(
+        octet* dest,
+        const octet* src,
+        uint32_t count);
+
 
 /** @name Add to a CDRMessage_t.
  * Methods to add different data types to a CDR message. Pointers to the message and to the data types are provided.
@@ -221,6 +238,11 @@ inline bool addUInt32(
         CDRMessage_t* msg,
         uint32_t lo);
 
+inline bool addUInt32Array(
+        CDRMessage_t* msg,
+        const uint32_t* values,
+        uint32_t count);
+
 inline bool addInt64(
         CDRMessage_t* msg,
         int64_t lo);
@@ -69,6 +69,20 @@ inline bool CDRMessage::appendMsg(
     return(CDRMessage::addData(first, second->buffer, second->length));
 }
 
+inline void CDRMessage::copyUInt32ArrayReversed(
+        octet* dest,
+        const octet* src,
+        uint32_t count)
+{
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        uint32_t value;
+        memcpy(&value, src + i * 4u, 4u);
+        value = (value >> 24) | ((value >> 8) & 0x0000FF00u) | ((value << 8) & 0x00FF0000u) | (value << 24);
+        memcpy(dest + i * 4u, &value, 4u);
+    }
+}
+
 inline bool CDRMessage::readEntityId(
         CDRMessage_t* msg,
         EntityId_t* id)
@@ -177,6 +191,27 @@ inline bool CDRMessage::readUInt32(
     return true;
 }
 
+inline bool CDRMessage::readUInt32Array(
+        CDRMessage_t* msg,
+        uint32_t* values,
+        uint32_t count)
+{
+    if (msg->pos > msg->length || count > (msg->length - msg->pos) / 4u)
+    {
+        return false;
+    }
+    if (msg->msg_endian == DEFAULT_ENDIAN)
+    {
+        memcpy(values, &msg->buffer[msg->pos], count * 4u);
+    }
+    else
+    {
+        copyUInt32ArrayReversed((octet*)values, &msg->buffer[msg->pos], count);
+    }
+    msg->pos += count * 4u;
+    return true;
+}
+
 inline bool CDRMessage::readInt64(
         CDRMessage_t* msg,
         int64_t* lolo)
@@ -231,10 +266,7 @@ inline SequenceNumberSet_t CDRMessage::readSequenceNumberSet(
 
     uint32_t n_longs = (numBits + 31u) / 32u;
     uint32_t bitmap[8];
-    for (uint32_t i = 0; valid && (i < n_longs); ++i)
-    {
-        valid &= CDRMessage::readUInt32(msg, &bitmap[i]);
-    }
+    valid = valid && CDRMessage::readUInt32Array(msg, bitmap, n_longs);
 
     if (valid)
     {
@@ -259,10 +291,7 @@ inline bool CDRMessage::readFragmentNumberSet(
 
     uint32_t n_longs = (numBits + 31u) / 32u;
     uint32_t bitmap[8];
-    for (uint32_t i = 0; valid && (i < n_longs); ++i)
-    {
-        valid &= CDRMessage::readUInt32(msg, &bitmap[i]);
-    }
+    valid = valid && CDRMessage::readUInt32Array(msg, bitmap, n_longs);
 
     if (valid)
     {
@@ -555,6 +584,28 @@ inline bool CDRMessage::addUInt32(
     return true;
 }
 
+inline bool CDRMessage::addUInt32Array(
+        CDRMessage_t* msg,
+        const uint32_t* values,
+        uint32_t count)
+{
+    if (msg->pos > msg->max_size || count > (msg->max_size - msg->pos) / 4u)
+    {
+        return false;
+    }
+    if (msg->msg_endian == DEFAULT_ENDIAN)
+    {
+        memcpy(&msg->buffer[msg->pos], values, count * 4u);
+    }
+    else
+    {
+        copyUInt32ArrayReversed(&msg->buffer[msg->pos], (const octet*)values, count);
+    }
+    msg->pos += count * 4u;
+    msg->length += count * 4u;
+    return true;
+}
+
 inline bool CDRMessage::addInt64(
         CDRMessage_t* msg,
         int64_t lolo)
@@ -603,17 +654,14 @@ inline bool CDRMessage::addOctetVector(
 
     if (add_final_padding)
     {
-        int rest = ocvec->size() % 4;
-        if (rest != 0)
+        uint32_t rest = (4u - static_cast<uint32_t>(ocvec->size() % 4u)) & 3u;
+        if (msg->pos + rest > msg->max_size)
         {
-            rest = 4 - rest; //how many you have to add
-
-            octet oc = '\0';
-            for (int i = 0; i < rest; i++)
-            {
-                valid &= CDRMessage::addOctet(msg, oc);
-            }
+            return false;
         }
+        memset(&msg->buffer[msg->pos], 0, rest);
+        msg->pos += rest;
+        msg->length += rest;
     }
 
     return valid;
@@ -663,11 +711,7 @@ inline bool CDRMessage::addSequenceNumberSet(
     sns->bitmap_get(numBits, bitmap, n_longs);
 
     addUInt32(msg, numBits);
-
-    for (uint32_t i = 0; i < n_longs; i++)
-    {
-        addUInt32(msg, bitmap[i]);
-    }
+    addUInt32Array(msg, bitmap.data(), n_longs);
 
     return true;
 }
@@ -697,11 +741,7 @@ inline bool CDRMessage::addFragmentNumberSet(
     fns->bitmap_get(numBits, bitmap, n_longs);
 
     addUInt32(msg, numBits);
-
-    for (uint32_t i = 0; i < n_longs; i++)
-    {
-        addUInt32(msg, bitmap[i]);
-    }
+    addUInt32Array(msg, bitmap.data(), n_longs);
 
     return true;
 }
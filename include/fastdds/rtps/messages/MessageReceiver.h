@@ -22,7 +22,9 @@
 
 #include <fastdds/rtps/common/all_common.h>
 
+#include <chrono>
 #include <unordered_map>
+#include <memory>
 #include <mutex>
 #include <functional>
 
@@ -94,6 +96,25 @@ private:
     SerializedPayload_t crypto_payload_;
 #endif // if HAVE_SECURITY
 
+    //! Changes reused to process the samples of DATA_BATCH submessages
+    std::vector<CacheChange_t*> batch_changes_;
+
+    //! Reassembly buffer of a fragmented sample, shared by the readers using the same payload pool
+    struct FragmentAssembly
+    {
+        //! Pool the buffer was taken from, kept alive while the buffer is referenced
+        std::shared_ptr<IPayloadPool> pool;
+        //! Change holding the buffer and the fragments already copied to it
+        CacheChange_t change;
+        //! When the last fragment was copied to the buffer
+        std::chrono::steady_clock::time_point last_fragment_time;
+    };
+
+    //! Samples being reassembled, at most one per writer and payload pool
+    std::vector<std::unique_ptr<FragmentAssembly>> fragment_assemblies_;
+    //! When the samples being reassembled should be checked again for release
+    std::chrono::steady_clock::time_point next_fragment_assemblies_check_;
+
     //! Function used to process a received message
     std::function<void(
                 const EntityId_t&,
@@ -168,6 +189,9 @@ private:
     bool proc_Submsg_DataFrag(
             CDRMessage_t* msg,
             SubmessageHeader_t* smh);
+    bool proc_Submsg_DataBatch(
+            CDRMessage_t* msg,
+            SubmessageHeader_t* smh);
     bool proc_Submsg_Acknack(
             CDRMessage_t* msg,
             SubmessageHeader_t* smh);
@@ -240,6 +264,31 @@ private:
             uint32_t fragment_starting_num,
             uint16_t fragments_in_submessage);
     ///@}
+
+    /**
+     * Copy the fragments of a DATA_FRAG to the reassembly buffer of its sample for the payload pool of a reader.
+     * Readers using the same payload pool share that buffer instead of reassembling the sample on their own.
+     * @param[in] reader                  The reader the fragments are dispatched to
+     * @param[in] change                  The CacheChange with the received fragments
+     * @param[in] sample_size             The size of the message
+     * @param[in] fragment_starting_num   The index of the first fragment in the message
+     * @param[in] fragments_in_submessage The number of fragments in the message
+     * @return The reassembly buffer holding the fragments, or nullptr when it cannot be shared.
+     */
+    FragmentAssembly* assemble_fragments(
+            RTPSReader* reader,
+            const CacheChange_t& change,
+            uint32_t sample_size,
+            uint32_t fragment_starting_num,
+            uint16_t fragments_in_submessage);
+
+    /**
+     * Periodically release the reassembly buffers of samples that will not be completed on them: those of writers no
+     * longer matched with any reader of the buffer pool, and those that did not receive fragments for a while.
+     * Readers holding the buffer keep their own reference to it.
+     * @remarks Should be called with mtx_ locked.
+     */
+    void check_fragment_assemblies_nts();
 };
 
 } /* namespace rtps */
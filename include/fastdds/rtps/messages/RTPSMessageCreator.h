@@ -154,6 +154,48 @@ public:
             bool expectsInlineQos,
             InlineQosWriter* inlineQos);
 
+    /**
+     * Add the header of a DATA_BATCH submessage. Samples are then appended with addDataBatchSample and the
+     * submessage is completed with finishSubmessageDataBatch.
+     * @param msg Pointer to the message where the submessage is serialized.
+     * @param readerId Entity id of the destination reader.
+     * @param writerId Entity id of the writer.
+     * @param first_sn Sequence number of the first sample of the batch.
+     * @param with_key Whether the samples carry their instance handle.
+     * @return True if correct.
+     */
+    static bool addSubmessageDataBatchHeader(
+            CDRMessage_t* msg,
+            const EntityId_t& readerId,
+            const EntityId_t& writerId,
+            const SequenceNumber_t& first_sn,
+            bool with_key);
+
+    /**
+     * Append a sample to the DATA_BATCH submessage being built.
+     * @param msg Pointer to the message where the submessage is serialized.
+     * @param change Change to append. It should be ALIVE and not fragmented.
+     * @param first_sn Sequence number of the first sample of the batch.
+     * @param with_key Whether the samples carry their instance handle.
+     * @return True if correct.
+     */
+    static bool addDataBatchSample(
+            CDRMessage_t* msg,
+            const CacheChange_t* change,
+            const SequenceNumber_t& first_sn,
+            bool with_key);
+
+    /**
+     * Write the length and the sample count of a DATA_BATCH submessage.
+     * @param msg Pointer to the message where the submessage is serialized.
+     * @param header_pos Position of the submessage header on the message.
+     * @param sample_count Number of samples appended to the batch.
+     */
+    static void finishSubmessageDataBatch(
+            CDRMessage_t* msg,
+            uint32_t header_pos,
+            uint32_t sample_count);
+
     static bool addMessageGap(
             CDRMessage_t* msg,
             const GuidPrefix_t& guidprefix,
@@ -228,6 +228,16 @@ private:
             const SequenceNumberSet_t& gap_bitmap,
             const EntityId_t& reader_id);
 
+    bool can_be_batched(
+            const CacheChange_t& change) const;
+
+    bool destinations_support_batches() const;
+
+    bool add_data_to_batch(
+            const CacheChange_t& change);
+
+    void close_batch();
+
     const RTPSMessageSenderInterface& sender_;
 
     Endpoint* endpoint_;
@@ -250,6 +260,25 @@ private:
 
     std::chrono::steady_clock::time_point max_blocking_time_point_;
 
+    //! Batching limits of the writer. batch_max_bytes_ is zero when batching is not used.
+    uint32_t batch_max_samples_;
+    uint32_t batch_max_bytes_;
+
+    //! Maximum size of the submessage buffer holding a batch
+    uint32_t batch_max_submessage_size_;
+
+    //! Number of samples and payload bytes of the DATA_BATCH being built on submessage_msg_
+    uint32_t batch_samples_;
+    uint32_t batch_bytes_;
+
+    //! Position of the DATA_BATCH header on submessage_msg_
+    uint32_t batch_header_pos_;
+
+    SequenceNumber_t batch_first_sn_;
+
+    //! Destination of the DATA_BATCH being built
+    GuidPrefix_t batch_dst_;
+
     std::unique_ptr<RTPSMessageGroup_t> send_buffer_;
 };
 
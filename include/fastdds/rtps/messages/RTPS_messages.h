@@ -44,7 +44,9 @@ enum SubmessageId : uint8_t
     NACK_FRAG       = 0x12,
     HEARTBEAT_FRAG  = 0x13,
     DATA            = 0x15,
-    DATA_FRAG       = 0x16
+    DATA_FRAG       = 0x16,
+    // Vendor specific submessages, only interpreted when sent by an eProsima participant
+    DATA_BATCH      = 0x80
 };
 
 //!@brief Structure Header_t, RTPS Message Header Structure.
@@ -22,6 +22,7 @@
 #include <cstdlib>
 #include <memory>
 #include <fastrtps/fastrtps_dll.h>
+#include <fastdds/rtps/common/ContentFilterProperty.hpp>
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/reader/StatefulReader.h>
 #include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
@@ -139,12 +140,14 @@ public:
      * @param Reader Pointer to the RTPSReader.
      * @param topicAtt Topic Attributes where you want to register it.
      * @param rqos ReaderQos.
+     * @param content_filter Optional content filter announced for the reader.
      * @return True if correctly registered.
      */
     bool registerReader(
             RTPSReader* Reader,
             const TopicAttributes& topicAtt,
-            const ReaderQos& rqos);
+            const ReaderQos& rqos,
+            const fastdds::rtps::ContentFilterProperty* content_filter = nullptr);
 
     /**
      * Update writer QOS
@@ -163,12 +166,14 @@ public:
      * @param Reader to update
      * @param topicAtt Topic Attributes where you want to register it.
      * @param rqos New reader QoS
+     * @param content_filter Optional new content filter for the reader. When nullptr the filter is not modified.
      * @return true on success
      */
     bool updateReader(
             RTPSReader* Reader,
             const TopicAttributes& topicAtt,
-            const ReaderQos& rqos);
+            const ReaderQos& rqos,
+            const fastdds::rtps::ContentFilterProperty* content_filter = nullptr);
 
     /**
      * Returns a list with the participant names.
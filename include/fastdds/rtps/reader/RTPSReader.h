@@ -117,6 +117,18 @@ public:
     RTPS_DllAPI virtual bool processDataMsg(
             CacheChange_t* change) = 0;
 
+    /**
+     * Processes the samples carried by a DATA_BATCH message. All of them belong to the same writer and are
+     * sorted by sequence number. Previously the message must have been accepted by function acceptMsgDirectedTo.
+     *
+     * @param changes Array of pointers to the CacheChange_t of each sample.
+     * @param count Number of samples in the array.
+     * @return true if the reader accepts messages from the writer.
+     */
+    RTPS_DllAPI virtual bool processDataBatchMsg(
+            CacheChange_t* const* changes,
+            uint32_t count);
+
     /**
      * Processes a new DATA FRAG message.
      *
@@ -341,6 +353,37 @@ protected:
             CacheChange_t** change,
             History::const_iterator hint) const;
 
+    /*!
+     * @brief Reserve a CacheChange_t where a fragmented sample will be reassembled.
+     * When the MessageReceiver provides the fragments on a reassembly buffer taken from the payload pool of this
+     * reader, the change shares that buffer instead of getting a new one.
+     * @param incoming_change CacheChange_t of the received fragments.
+     * @param sample_size Size of the complete, assembled sample.
+     * @param fragment_starting_num Number of the first fragment on incoming_change.
+     * @param change If a CacheChange_t was reserved, this argument will fill with its pointer.
+     * @return true if the change was reserved.
+     */
+    bool reserve_fragmented_change(
+            const CacheChange_t* incoming_change,
+            uint32_t sample_size,
+            uint32_t fragment_starting_num,
+            CacheChange_t** change);
+
+    /*!
+     * @brief Add received fragments to a change being reassembled.
+     * A shared reassembly buffer is copied before writing fragments that are not already on it.
+     * @param change CacheChange_t being reassembled.
+     * @param incoming_change CacheChange_t of the received fragments.
+     * @param fragment_starting_num Number of the first fragment on incoming_change.
+     * @param fragments_in_submessage Number of fragments on incoming_change.
+     * @return true if the change is fully reassembled.
+     */
+    bool add_fragments(
+            CacheChange_t* change,
+            const CacheChange_t* incoming_change,
+            uint32_t fragment_starting_num,
+            uint16_t fragments_in_submessage);
+
     //!ReaderHistory
     ReaderHistory* mp_history;
     //!Listener
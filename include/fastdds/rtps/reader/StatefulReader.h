@@ -118,6 +118,17 @@ public:
     bool processDataMsg(
             CacheChange_t* change) override;
 
+    /**
+     * Processes the samples carried by a DATA_BATCH message.
+     *
+     * @param changes Array of pointers to the CacheChange_t of each sample.
+     * @param count Number of samples in the array.
+     * @return true if the reader accepts messages from the writer.
+     */
+    bool processDataBatchMsg(
+            CacheChange_t* const* changes,
+            uint32_t count) override;
+
     /**
      * Processes a new DATA FRAG message.
      *
@@ -292,6 +303,41 @@ private:
     void NotifyChanges(
             WriterProxy* wp);
 
+    /**
+     * @brief Assert liveliness of remote writer
+     * @param writer_guid The guid of the remote writer
+     * @remarks Non thread-safe.
+     */
+    void assert_writer_liveliness(
+            const GUID_t& writer_guid);
+
+    /**
+     * Copies a received change into the history, unless it was already received.
+     * @param change Received change.
+     * @param pWP Proxy of the writer of the change, nullptr for framework data.
+     * @return false when the change could not be copied.
+     * @remarks Non thread-safe.
+     */
+    bool add_received_change(
+            CacheChange_t* change,
+            WriterProxy* pWP);
+
+    /*!
+     * Makes room for a new fragmented change within the limit of memory for incomplete samples.
+     * Best-effort readers evict the oldest incomplete changes. Reliable readers only evict the incomplete
+     * changes their writer will not send again, and otherwise refuse the new change until there is room.
+     * A sample larger than the limit is marked as irrelevant on its WriterProxy.
+     * @param writer WriterProxy of the writer sending the new fragmented change.
+     * @param sequence_number Sequence number of the new fragmented change.
+     * @param sample_size Size of the new fragmented sample.
+     * @return true when the new sample can be reserved.
+     * @remarks Non thread-safe.
+     */
+    bool make_room_for_incomplete_sample_nts(
+            WriterProxy* writer,
+            const SequenceNumber_t& sequence_number,
+            uint32_t sample_size);
+
     //! Acknack Count
     uint32_t acknack_count_;
     //! NACKFRAG Count
@@ -308,6 +354,10 @@ private:
     bool disable_positive_acks_;
     //! False when being destroyed
     bool is_alive_;
+    //! Maximum payload memory held by incomplete fragmented changes (0 means unlimited)
+    uint32_t max_incomplete_samples_memory_;
+    //! Payload memory currently held by incomplete fragmented changes
+    uint64_t incomplete_samples_memory_;
 };
 
 } /* namespace rtps */
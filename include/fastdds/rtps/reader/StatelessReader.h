@@ -116,6 +116,17 @@ public:
     bool processDataMsg(
             CacheChange_t* change) override;
 
+    /**
+     * Processes the samples carried by a DATA_BATCH message.
+     *
+     * @param changes Array of pointers to the CacheChange_t of each sample.
+     * @param count Number of samples in the array.
+     * @return true if the reader accepts messages from the writer.
+     */
+    bool processDataBatchMsg(
+            CacheChange_t* const* changes,
+            uint32_t count) override;
+
     /**
      * Processes a new DATA FRAG message.
      *
@@ -224,6 +235,15 @@ private:
             const GUID_t& guid,
             const SequenceNumber_t& seq);
 
+    /**
+     * Copies a received change into the history.
+     * @param change Received change.
+     * @return false when the change could not be copied.
+     * @remarks Non thread-safe.
+     */
+    bool add_received_change(
+            CacheChange_t* change);
+
     /**
      * @brief Assert liveliness of remote writer
      * @param guid The guid of the remote writer
@@ -44,10 +44,11 @@ typedef struct UDPTransportDescriptor: public SocketTransportDescriptor
    /**
     * Whether to use non-blocking calls to send_to().
     *
-    * When set to true, calls to send_to() will return inmediately if the buffer is full, but
-    * no error will be returned to the upper layer. This means that the application will behave
-    * as if the datagram is sent but lost (i.e. throughput may be reduced). This value is
-    * specially useful on high-frequency best-effort writers.
+    * When set to true, calls to send_to() will return inmediately if the buffer is full. The datagram
+    * is then kept on a pending queue of the socket, bounded by sendBufferSize, and sent in order as soon
+    * as the socket drains. When the queue is also full, the sender waits for the socket to drain up to
+    * its max blocking time, and the datagram is dropped as if it was lost on the network if it does not.
+    * This value is specially useful on high-frequency writers.
     *
     * When set to false, calls to send_to() will block until the network buffer has space for the
     * datagram. This may hinder performance on high-frequency writers.
@@ -23,6 +23,9 @@
 #include <fastdds/rtps/transport/UDPTransportDescriptor.h>
 #include <fastrtps/utils/IPFinder.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <vector>
 #include <memory>
 #include <map>
@@ -40,6 +43,12 @@ public:
 
     void clean();
 
+    /**
+     * Stops the thread flushing the pending queues of the non-blocking sockets.
+     * Datagrams still pending are only retried by later sends through their sockets.
+     */
+    virtual void shutdown() override;
+
     //! Removes the listening socket for the specified port.
     virtual bool CloseInputChannel(
             const fastrtps::rtps::Locator_t&) override;
@@ -155,8 +164,47 @@ public:
         return configuration()->maxMessageSize;
     }
 
+    //! Number of times a non-blocking send found the socket buffer full.
+    uint64_t would_block_count() const
+    {
+        return would_block_count_.load(std::memory_order_relaxed);
+    }
+
+    //! Number of bytes currently waiting on the pending queues of non-blocking sockets.
+    uint64_t queued_bytes() const
+    {
+        return queued_bytes_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Number of datagrams dropped because a pending queue stayed full until the blocking time expired.
+     * These drops are best-effort losses: the send is not reported as failed.
+     */
+    uint64_t dropped_datagrams_count() const
+    {
+        return dropped_datagrams_count_.load(std::memory_order_relaxed);
+    }
+
 protected:
 
+    //! Datagram waiting for its socket to become writable.
+    struct PendingDatagram
+    {
+        std::vector<fastrtps::rtps::octet> data;
+        asio::ip::udp::endpoint destination;
+    };
+
+    //! Bounded queue of datagrams pending to be sent through a non-blocking socket.
+    struct PendingQueue
+    {
+        //! Protects this queue only, so a congested socket does not block the senders of the others.
+        std::mutex mutex;
+        //! Socket the datagrams are sent through. Null once its output channel has been closed.
+        asio::ip::udp::socket* socket = nullptr;
+        std::deque<PendingDatagram> datagrams;
+        uint32_t bytes = 0;
+    };
+
     friend class UDPChannelResource;
 
     // For UDPv6, the notion of channel corresponds to a port + direction tuple.
@@ -169,6 +217,19 @@ protected:
     uint32_t mSendBufferSize;
     uint32_t mReceiveBufferSize;
 
+    //! Protects pending_queues_ and the flush thread state. Never held while sending or polling.
+    std::mutex pending_queues_mutex_;
+    //! Pending queues of the non-blocking output sockets, by native handle.
+    std::map<asio::ip::udp::socket::native_handle_type, std::shared_ptr<PendingQueue>> pending_queues_;
+    //! Drains the pending queues when their sockets become writable, started on the first queued datagram.
+    std::thread pending_flush_thread_;
+    std::condition_variable pending_flush_cv_;
+    bool pending_flush_stop_ = false;
+
+    std::atomic<uint64_t> would_block_count_;
+    std::atomic<uint64_t> queued_bytes_;
+    std::atomic<uint64_t> dropped_datagrams_count_;
+
     UDPTransportInterface(
             int32_t transport_kind);
 
@@ -254,6 +315,49 @@ protected:
             const fastrtps::rtps::Locator_t& remote_locator,
             bool only_multicast_purpose,
             const std::chrono::microseconds& timeout);
+
+    /**
+     * Send a buffer to a destination through a non-blocking socket.
+     * When the socket buffer is full, the datagram is kept on the pending queue of the socket. When the queue is
+     * also full, the call waits for the socket to be writable up to timeout, throttling the sender. If it is still
+     * full then, the datagram is dropped and counted on dropped_datagrams_count().
+     * @return false only when the socket reported an error.
+     */
+    bool send_non_blocking(
+            const fastrtps::rtps::octet* send_buffer,
+            uint32_t send_buffer_size,
+            eProsimaUDPSocket& socket,
+            const asio::ip::udp::endpoint& destination,
+            const std::chrono::microseconds& timeout);
+
+    /**
+     * Send a datagram through a non-blocking socket, without waiting for room on its buffer.
+     * @param ec Set to would_block or try_again when the socket buffer is full.
+     */
+    virtual void send_datagram(
+            asio::ip::udp::socket& socket,
+            const fastrtps::rtps::octet* data,
+            uint32_t size,
+            const asio::ip::udp::endpoint& destination,
+            asio::error_code& ec);
+
+    //! Returns the pending queue of a socket, creating it if needed.
+    std::shared_ptr<PendingQueue> get_pending_queue(
+            eProsimaUDPSocket& socket);
+
+    /**
+     * Try to send all the datagrams on a pending queue, in order.
+     * @return true when the queue has been emptied.
+     * @remarks Should be called with the mutex of the queue locked.
+     */
+    bool flush_pending_queue_nts(
+            PendingQueue& queue);
+
+    //! Wakes up the flush thread, starting it if needed, after a datagram has been queued.
+    void notify_pending_datagrams();
+
+    //! Body of the flush thread.
+    void run_pending_flush();
 };
 
 } // namespace rtps
@@ -17,8 +17,18 @@
 
 #include <fastdds/rtps/transport/UDPv4Transport.h>
 #include <fastdds/rtps/messages/RTPS_messages.h>
+#include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/common/SequenceNumber.h>
 #include <fastdds/rtps/messages/CDRMessage.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include <fastdds/rtps/transport/test_UDPv4TransportDescriptor.h>
@@ -39,6 +49,8 @@ public:
     test_UDPv4Transport(
             const test_UDPv4TransportDescriptor& descriptor);
 
+    virtual ~test_UDPv4Transport() override;
+
     virtual bool send(
             const fastrtps::rtps::octet* send_buffer,
             uint32_t send_buffer_size,
@@ -55,6 +67,25 @@ public:
     RTPS_DllAPI static bool always_drop_participant_builtin_topic_data;
     RTPS_DllAPI static bool simulate_no_interfaces;
 
+    //! Traffic of user endpoints sent by the transports with trackUserTraffic enabled.
+    struct UserTraffic
+    {
+        std::atomic<uint64_t> datas{0};
+        std::atomic<uint64_t> data_bytes{0};
+        //! DATA and DATA_FRAG submessages of a sample already sent to the same destination.
+        std::atomic<uint64_t> repair_datas{0};
+        std::atomic<uint64_t> repair_bytes{0};
+        std::atomic<uint64_t> heartbeats{0};
+        std::atomic<uint64_t> acknacks{0};
+        std::atomic<uint64_t> gaps{0};
+        //! Datagrams lost due to the impairments.
+        std::atomic<uint64_t> impaired_drops{0};
+
+        RTPS_DllAPI void reset();
+    };
+
+    RTPS_DllAPI static UserTraffic user_traffic;
+
 protected:
 
     virtual void get_ips(
@@ -95,6 +126,65 @@ private:
     test_UDPv4TransportDescriptor::filter messages_filter_;
     std::vector<fastrtps::rtps::SequenceNumber_t> sequence_number_data_messages_to_drop_;
 
+    struct ImpairmentState
+    {
+        test_UDPv4TransportDescriptor::Impairment config;
+        //! Percentage of datagrams that start a loss burst, while not on one.
+        double enter_burst = 0.0;
+        //! Percentage of datagrams that end a loss burst, while on one.
+        double leave_burst = 100.0;
+        //! Whether the destination is on a loss burst.
+        bool in_burst = false;
+    };
+
+    struct DelayedDatagram
+    {
+        std::vector<fastrtps::rtps::octet> data;
+        fastrtps::rtps::Locator_t destination;
+    };
+
+    std::map<uint32_t, ImpairmentState> impairments_;
+    std::mt19937 random_;
+    std::mutex impairments_mutex_;
+
+    bool track_user_traffic_;
+    //! Highest sequence number, and its highest fragment number, each writer has sent to each destination port.
+    std::map<std::pair<uint32_t, fastrtps::rtps::GUID_t>,
+            std::pair<fastrtps::rtps::SequenceNumber_t, uint32_t>> highest_sent_;
+    std::mutex user_traffic_mutex_;
+
+    //! Datagrams waiting for their delay to expire, sorted by the time they have to be sent.
+    std::multimap<std::chrono::steady_clock::time_point, DelayedDatagram> delayed_datagrams_;
+    std::mutex delayed_mutex_;
+    std::condition_variable delayed_cv_;
+    bool delayed_stop_;
+    //! Sends the delayed datagrams. Only started when the first datagram is delayed.
+    std::thread delayed_thread_;
+    std::unique_ptr<eProsimaUDPSocket> delayed_socket_;
+
+    /**
+     * Applies the impairment of the destination to a datagram.
+     * @param[in] remote_locator Destination of the datagram.
+     * @param[out] delay Time the datagram has to be held before sending it.
+     * @return true when the datagram is lost.
+     */
+    bool apply_impairment(
+            const fastrtps::rtps::Locator_t& remote_locator,
+            std::chrono::microseconds& delay);
+
+    void delay_datagram(
+            const fastrtps::rtps::octet* send_buffer,
+            uint32_t send_buffer_size,
+            const fastrtps::rtps::Locator_t& remote_locator,
+            const std::chrono::microseconds& delay);
+
+    void send_delayed_datagrams();
+
+    void account_user_traffic(
+            const fastrtps::rtps::octet* send_buffer,
+            uint32_t send_buffer_size,
+            const fastrtps::rtps::Locator_t& remote_locator);
+
 
     bool log_drop(
             const fastrtps::rtps::octet* buffer,
@@ -17,7 +17,9 @@
 
 #include <fastdds/rtps/transport/SocketTransportDescriptor.h>
 #include <fastdds/rtps/common/SequenceNumber.h>
+#include <chrono>
 #include <functional>
+#include <map>
 
 namespace eprosima{
 namespace fastdds{
@@ -50,6 +52,30 @@ typedef struct test_UDPv4TransportDescriptor : public SocketTransportDescriptor{
 
    uint32_t dropLogLength; // logs dropped packets.
 
+   //! Network impairment of the datagrams sent to a destination.
+   struct Impairment
+   {
+       //! Percentage of datagrams lost.
+       uint8_t lossPercentage = 0;
+       //! Mean number of datagrams lost in a row (Gilbert-Elliott model).
+       //! Raised to lossPercentage / (100 - lossPercentage) when shorter, as shorter bursts cannot reach the loss.
+       uint32_t meanBurstLength = 1;
+       //! Delay applied to every datagram.
+       std::chrono::microseconds delay{0};
+       //! Percentage of datagrams held back, so they arrive after the following ones.
+       uint8_t reorderPercentage = 0;
+       //! Extra delay of the datagrams held back.
+       std::chrono::microseconds reorderDelay{1000};
+   };
+
+   //! Impairments of the datagrams sent to each destination port, so each reader gets its own network conditions.
+   //! The entry of port 0 applies to the destinations without their own entry.
+   std::map<uint32_t, Impairment> impairments;
+   //! Seed of the random generator of the impairments, so runs are reproducible.
+   uint32_t impairmentsSeed;
+   //! Gather the traffic of user endpoints on test_UDPv4Transport::user_traffic.
+   bool trackUserTraffic;
+
    RTPS_DllAPI test_UDPv4TransportDescriptor();
    virtual ~test_UDPv4TransportDescriptor(){}
 
@@ -22,6 +22,7 @@
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
 #include <fastdds/rtps/resources/TimedEvent.h>
 
+#include <atomic>
 #include <mutex>
 
 namespace eprosima {
@@ -37,7 +38,10 @@ using LivelinessCallback = std::function<void(
 
 /**
  * @brief A class managing the liveliness of a set of writers. Writers are represented by their LivelinessData
- * @details Uses a shared timed event and informs outside classes on liveliness changes
+ * @details Uses a shared timed event and informs outside classes on liveliness changes.
+ * Asserting the liveliness of writers which are already alive does not restart the timer. Automatic and manual by
+ * participant assertions only record the time of the assertion, and the timer takes it into account when it expires,
+ * re-arming itself for the new deadline.
  * @ingroup WRITER_MODULE
  */
 class LivelinessManager
@@ -92,6 +96,7 @@ public:
 
     /**
      * @brief Asserts liveliness of a writer in the set
+     * @details When all the automatic or manual by participant writers are alive, the writer is not looked up
      * @param guid The writer to assert liveliness of
      * @param kind The kind of the writer
      * @param lease_duration The lease duration
@@ -132,11 +137,30 @@ private:
 
     /**
      * @brief A method to calculate the time when the next writer is going to lose liveliness
-     * @details This method is public for testing purposes but it should not be used from outside this class
+     * @details Takes into account the assertions recorded without taking the mutex
      * @return True if at least one writer is alive
      */
     bool calculate_next();
 
+    //! @brief Updates the time when a writer loses liveliness with the last assertion recorded for its kind
+    //! @param writer The liveliness data of the writer
+    void apply_kind_assertion(
+            LivelinessData& writer);
+
+    //! @brief Records an assertion of a liveliness kind without taking the mutex
+    //! @param kind The liveliness kind
+    //! @return True if all the writers of this kind were alive, so the assertion was recorded
+    bool record_kind_assertion(
+            LivelinessQosPolicyKind kind);
+
+    //! @brief Recomputes whether assertions of a kind can be recorded without taking the mutex
+    //! @param kind The liveliness kind
+    void update_kind_alive(
+            LivelinessQosPolicyKind kind);
+
+    //! @brief Sets the timer interval so it expires when the timer owner loses liveliness
+    void update_timer_interval();
+
     //! @brief A method to find a writer from a guid, liveliness kind and lease duration
     //! @param guid The guid of the writer
     //! @param kind The liveliness kind
@@ -171,6 +195,15 @@ private:
 
     //! A timed callback expiring when a writer (the timer owner) loses its liveliness
     TimedEvent timer_;
+
+    //! Number of liveliness kinds whose assertions apply to all the writers of the kind
+    static constexpr size_t num_kind_assertions = MANUAL_BY_TOPIC_LIVELINESS_QOS;
+
+    //! Whether all the writers of each kind are alive, so their assertions can be recorded without the mutex
+    std::atomic<bool> kind_alive_[num_kind_assertions];
+
+    //! Time of the last assertion recorded without the mutex for each kind, in steady clock nanoseconds
+    std::atomic<int64_t> kind_assertion_[num_kind_assertions];
 };
 
 } /* namespace rtps */
@@ -41,6 +41,7 @@ namespace rtps {
 class WriterListener;
 class WriterHistory;
 class FlowController;
+class TimedEvent;
 struct CacheChange_t;
 
 /**
@@ -169,6 +170,29 @@ public:
         return true;
     }
 
+    /**
+     * Check if all the readers matched with this writer are on the same process.
+     * While this holds, new changes can carry a shared user sample instead of a serialized payload.
+     * Should be called with the writer mutex taken.
+     * @return True if there are matched readers and all of them are local.
+     */
+    RTPS_DllAPI virtual bool matched_readers_are_local() const
+    {
+        return false;
+    }
+
+    /**
+     * Check if a change can be sent to remote destinations.
+     * Should be called with the writer mutex taken.
+     * @param change Pointer to the change.
+     * @return False if the change only carries a sample shared with local readers, which has not been serialized.
+     */
+    static bool is_serialized(
+            const CacheChange_t* change)
+    {
+        return ALIVE != change->kind || !change->intraprocess_sample || 0 != change->serializedPayload.length;
+    }
+
     /**
      * Update the Attributes of the Writer.
      * @param att New attributes
@@ -232,6 +256,15 @@ public:
         return is_async_;
     }
 
+    /**
+     * Get the batching configuration of this writer.
+     * @return Reference to the batch attributes.
+     */
+    RTPS_DllAPI inline const WriterBatchAttributes& get_batch_attributes() const
+    {
+        return batch_;
+    }
+
     /**
      * Remove an specified max number of changes
      * @param max Maximum number of changes to remove.
@@ -434,6 +467,54 @@ protected:
     //! The liveliness announcement period
     Duration_t liveliness_announcement_period_;
 
+    //! Batching configuration. Batching writers are always asynchronous.
+    WriterBatchAttributes batch_;
+    //! Event waking up the asynchronous thread when the oldest batched change has waited max_flush_delay
+    TimedEvent* batch_flush_event_ = nullptr;
+    //! Changes and payload bytes pending to be sent on the next batch
+    uint32_t batch_pending_samples_ = 0;
+    uint32_t batch_pending_bytes_ = 0;
+
+    /**
+     * Wake up the asynchronous thread to send a new change. When batching is enabled, the wake up is delayed until
+     * the batch limits are reached or the flush delay expires.
+     * Should be called with the writer mutex taken.
+     * @param change Pointer to the change added to the history.
+     * @param max_blocking_time Maximum time this method has to complete the task.
+     */
+    void wake_up_async_thread(
+            CacheChange_t* change,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
+
+    /**
+     * Forget the changes pending to be batched, as every unsent change is being sent. Should be called whenever the
+     * unsent changes are sent, as wake ups not triggered by the batch (matched readers changes, NACK responses...)
+     * also send the changes waiting for their batch.
+     * Should be called with the writer mutex taken.
+     */
+    void pending_batch_sent_nts();
+
+    /**
+     * Destroy the batch flush event. As the rest of events, should be called from the child destructor.
+     */
+    void destroy_batch_flush_event();
+
+    /**
+     * Serialize the payload of a change that only carries a sample shared with local readers.
+     * Should be called with the writer mutex taken, before the change is sent to a remote destination.
+     * @param change Pointer to the change.
+     * @return False if the sample could not be serialized.
+     */
+    bool serialize_intraprocess_sample(
+            CacheChange_t* change);
+
+    /**
+     * Serialize the payloads of all the changes in the history that only carry a sample shared with local readers.
+     * Changes that cannot be serialized are not sent to remote destinations.
+     * Should be called with the writer mutex taken, when a remote destination is added.
+     */
+    void serialize_intraprocess_samples();
+
     void add_guid(
             const GUID_t& remote_guid);
 
@@ -467,6 +548,8 @@ private:
             const std::shared_ptr<IPayloadPool>& payload_pool,
             const std::shared_ptr<IChangePool>& change_pool);
 
+    void flush_batch();
+
 
     RTPSWriter* next_[2] = { nullptr, nullptr };
 };
@@ -40,6 +40,7 @@
 #include <mutex>
 #include <set>
 #include <atomic>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -232,9 +233,12 @@ public:
 
     /**
      * Turns all REQUESTED changes into UNSENT.
+     * @param[out] repairs When not nullptr, the sequence numbers of the relevant changes turned into UNSENT are
+     * appended to it.
      * @return true if at least one change changed its status, false otherwise.
      */
-    bool perform_acknack_response();
+    bool perform_acknack_response(
+            std::vector<SequenceNumber_t>* repairs = nullptr);
 
     /**
      * Call this to inform a change was removed from history.
@@ -443,9 +447,9 @@ private:
      * Converts all changes with a given status to a different status.
      * @param previous Status to change.
      * @param next Status to adopt.
-     * @return true when at least one change has been modified, false otherwise.
+     * @return Number of changes modified.
      */
-    bool convert_status_on_all_changes(
+    uint32_t convert_status_on_all_changes(
             ChangeForReaderStatus_t previous,
             ChangeForReaderStatus_t next);
 
@@ -28,6 +28,8 @@
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
 #include <condition_variable>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -198,6 +200,8 @@ public:
     bool is_acked_by_all(
             const CacheChange_t* a_change) const override;
 
+    bool matched_readers_are_local() const override;
+
     template <typename Function>
     Function for_each_reader_proxy(
             Function f) const
@@ -255,6 +259,37 @@ public:
         return this->m_heartbeatCount;
     }
 
+    /**
+     * Get the number of repairs sent once to a multicast locator shared by several requesting readers.
+     * @return Number of coalesced repairs
+     */
+    inline uint64_t get_coalesced_repairs_count() const
+    {
+        std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+        return coalesced_repairs_count_;
+    }
+
+    /**
+     * Get the number of repairs that were not sent separately to each requesting reader thanks to coalescing.
+     * @return Number of saved retransmissions
+     */
+    inline uint64_t get_saved_retransmissions_count() const
+    {
+        std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+        return saved_retransmissions_count_;
+    }
+
+    /**
+     * Get the current period of the periodic heartbeat.
+     * It only differs from WriterTimes::heartbeatPeriod when the adaptive heartbeat is enabled.
+     * @return Heartbeat period in milliseconds
+     */
+    inline double get_heartbeat_period_ms() const
+    {
+        std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+        return heartbeat_period_ms_;
+    }
+
     /**
      * Get the RTPS participant
      * @return RTPS participant
@@ -390,6 +425,28 @@ private:
 
     void check_acked_status();
 
+    /**
+     * Adapts the heartbeat period to the acknowledgement state of the readers on each periodic heartbeat.
+     * It is halved while readers do not acknowledge what the previous heartbeat announced, doubled while they
+     * keep up, and reset to the configured period once all of them are in sync.
+     * Only called when the adaptive heartbeat is enabled.
+     */
+    void adapt_heartbeat_period_nts_();
+
+    /**
+     * Halves the heartbeat period when a reader NACKs, at most once per periodic heartbeat.
+     * Only has effect when the adaptive heartbeat is enabled.
+     */
+    void shorten_heartbeat_period_on_nack_nts_();
+
+    /**
+     * Sets the heartbeat period, bounded by the limits of the adaptive heartbeat when it is enabled.
+     * When the new period makes the armed periodic heartbeat expire earlier, it is rescheduled with it.
+     * @param period_ms New period in milliseconds.
+     */
+    void set_heartbeat_period_nts_(
+            double period_ms);
+
     /**
      * @brief A method called when the ack timer expires
      * @details Only used if disable positive ACKs QoS is enabled
@@ -402,6 +459,14 @@ private:
             SequenceNumber_t max_sequence,
             bool& activateHeartbeatPeriod);
 
+    /**
+     * Sends once the repairs requested by several reliable readers sharing a multicast locator.
+     * Only used when separate sending is enabled, as otherwise repairs are already sent to the merged locators of
+     * the requesting readers.
+     */
+    void send_coalesced_repairs(
+            bool& activateHeartbeatPeriod);
+
     void send_all_intraprocess_changes(
             SequenceNumber_t max_sequence);
 
@@ -440,6 +505,21 @@ private:
     bool there_are_remote_readers_ = false;
     bool there_are_local_readers_ = false;
 
+    //! Changes turned into UNSENT by the last nack responses, with the reader requesting them.
+    //! Only filled when separate sending is enabled.
+    std::vector<std::pair<SequenceNumber_t, GUID_t>> pending_repairs_;
+    //! Repairs sent once to a multicast locator shared by several requesting readers
+    uint64_t coalesced_repairs_count_ = 0;
+    //! Repairs not sent separately to each requesting reader thanks to coalescing
+    uint64_t saved_retransmissions_count_ = 0;
+
+    //! Current period of the periodic heartbeat, in milliseconds
+    double heartbeat_period_ms_ = 0;
+    //! Last sequence number announced by the periodic heartbeat, unknown while all readers are in sync
+    SequenceNumber_t last_announced_seq_ = c_SequenceNumber_Unknown;
+    //! Whether a NACK already shortened the heartbeat period since the last periodic heartbeat
+    bool heartbeat_period_shortened_ = false;
+
     StatefulWriter& operator =(
             const StatefulWriter&) = delete;
 
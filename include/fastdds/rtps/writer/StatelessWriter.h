@@ -146,6 +146,8 @@ public:
     bool is_acked_by_all(
             const CacheChange_t* change) const override;
 
+    bool matched_readers_are_local() const override;
+
     bool try_remove_change(
             const std::chrono::steady_clock::time_point&,
             std::unique_lock<RecursiveTimedMutex>&) override;
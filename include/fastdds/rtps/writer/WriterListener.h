@@ -19,6 +19,7 @@
 #define _FASTDDS_RTPS_WRITERLISTENER_H_
 
 #include <fastdds/rtps/common/MatchingInfo.h>
+#include <fastdds/rtps/reader/ReaderDiscoveryInfo.h>
 #include <fastrtps/qos/LivelinessLostStatus.h>
 #include <fastdds/dds/core/status/PublicationMatchedStatus.hpp>
 #include <fastdds/dds/core/status/IncompatibleQosStatus.hpp>
@@ -83,6 +84,27 @@ public:
         (void)qos;
     }
 
+    /**
+     * This method is called when a reader is matched with this Writer, when the information of a matched reader
+     * changes, and when a matched reader is removed.
+     * It is called before the history of the writer is evaluated for the reader.
+     * @param writer Pointer to the RTPSWriter.
+     * @param reason The reason motivating this method to be called.
+     * @param reader_guid GUID of the affected reader.
+     * @param reader_info Information of the reader, nullptr when the reader is removed.
+     */
+    virtual void on_reader_discovery(
+            RTPSWriter* writer,
+            ReaderDiscoveryInfo::DISCOVERY_STATUS reason,
+            const GUID_t& reader_guid,
+            const ReaderProxyData* reader_info)
+    {
+        (void)writer;
+        (void)reason;
+        (void)reader_guid;
+        (void)reader_info;
+    }
+
     /**
      * This method is called when all the readers matched with this Writer acknowledge that a cache
      * change has been received.
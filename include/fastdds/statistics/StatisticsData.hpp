@@ -0,0 +1,146 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatisticsData.hpp
+ *
+ */
+
+#ifndef _FASTDDS_STATISTICS_STATISTICSDATA_HPP_
+#define _FASTDDS_STATISTICS_STATISTICSDATA_HPP_
+
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/rtps/common/Guid.h>
+
+#include <cstdint>
+
+namespace eprosima {
+namespace fastcdr {
+class Cdr;
+} // namespace fastcdr
+
+namespace fastdds {
+namespace statistics {
+
+/**
+ * Kinds of statistics, one per statistics topic.
+ * Values are bit flags, so a set of kinds can be stored on a mask.
+ */
+enum EventKind : uint32_t
+{
+    HISTORY2HISTORY_LATENCY = 0x00000001,
+    PUBLICATION_THROUGHPUT = 0x00000002,
+    SUBSCRIPTION_THROUGHPUT = 0x00000004,
+    RTPS_SENT = 0x00000008,
+    RTPS_RECEIVED = 0x00000010,
+    RESENT_DATAS = 0x00000020,
+    HEARTBEAT_COUNT = 0x00000040,
+    ACKNACK_COUNT = 0x00000080,
+    NACKFRAG_COUNT = 0x00000100,
+    GAP_COUNT = 0x00000200,
+    DATA_COUNT = 0x00000400,
+    DISCOVERED_ENTITY = 0x00000800
+};
+
+/**
+ * Sample published on the statistics topics.
+ *
+ * All topics share this type. Each sample describes the events measured on one entity during the last
+ * publication period. Counters only fill @c count, @c bytes and @c rate, while latencies and discovery
+ * times also fill the percentiles.
+ */
+struct StatisticsData
+{
+    //! Kind of statistic, one of EventKind.
+    uint32_t kind = 0;
+
+    //! Entity the statistic refers to. A participant GUID for participant-wide statistics.
+    fastrtps::rtps::GUID_t guid;
+
+    //! Number of events on the period.
+    uint64_t count = 0;
+
+    //! Number of bytes on the period, when applicable.
+    uint64_t bytes = 0;
+
+    //! Events per second for counters. Mean value for latencies (nanoseconds) and discovery times (milliseconds).
+    double value = 0;
+
+    //! Median of the measured values.
+    double p50 = 0;
+
+    //! 90th percentile of the measured values.
+    double p90 = 0;
+
+    //! 99th percentile of the measured values.
+    double p99 = 0;
+
+    //! Maximum measured value.
+    double max = 0;
+
+    RTPS_DllAPI static size_t getMaxCdrSerializedSize(
+            size_t current_alignment = 0);
+
+    RTPS_DllAPI void serialize(
+            eprosima::fastcdr::Cdr& cdr) const;
+
+    RTPS_DllAPI void deserialize(
+            eprosima::fastcdr::Cdr& cdr);
+};
+
+/**
+ * TopicDataType of StatisticsData, to be registered by the applications monitoring the statistics topics.
+ */
+class StatisticsDataPubSubType : public fastdds::dds::TopicDataType
+{
+public:
+
+    typedef StatisticsData type;
+
+    RTPS_DllAPI StatisticsDataPubSubType();
+
+    RTPS_DllAPI virtual ~StatisticsDataPubSubType() override;
+
+    RTPS_DllAPI bool serialize(
+            void* data,
+            fastrtps::rtps::SerializedPayload_t* payload) override;
+
+    RTPS_DllAPI bool deserialize(
+            fastrtps::rtps::SerializedPayload_t* payload,
+            void* data) override;
+
+    RTPS_DllAPI std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override;
+
+    RTPS_DllAPI bool getKey(
+            void* data,
+            fastrtps::rtps::InstanceHandle_t* ihandle,
+            bool force_md5 = false) override;
+
+    RTPS_DllAPI void* createData() override;
+
+    RTPS_DllAPI void deleteData(
+            void* data) override;
+
+    RTPS_DllAPI inline bool is_bounded() const override
+    {
+        return true;
+    }
+};
+
+} // namespace statistics
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_STATISTICS_STATISTICSDATA_HPP_
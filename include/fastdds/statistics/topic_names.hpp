@@ -0,0 +1,65 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file topic_names.hpp
+ *
+ */
+
+#ifndef _FASTDDS_STATISTICS_TOPIC_NAMES_HPP_
+#define _FASTDDS_STATISTICS_TOPIC_NAMES_HPP_
+
+namespace eprosima {
+namespace fastdds {
+namespace statistics {
+
+/**
+ * Participant property with the ';' separated list of statistics topics to publish.
+ * Statistics are disabled when the property is not set.
+ */
+constexpr const char* STATISTICS_PROPERTY = "fastdds.statistics";
+
+//! Participant property with the publication period of the statistics topics, in milliseconds.
+constexpr const char* STATISTICS_PERIOD_PROPERTY = "fastdds.statistics.period_ms";
+
+//! Latency between the writer history and the reader history of each sample.
+constexpr const char* HISTORY_LATENCY_TOPIC = "_fastdds_statistics_history2history_latency";
+//! Samples written by each writer.
+constexpr const char* PUBLICATION_THROUGHPUT_TOPIC = "_fastdds_statistics_publication_throughput";
+//! Samples received by each reader.
+constexpr const char* SUBSCRIPTION_THROUGHPUT_TOPIC = "_fastdds_statistics_subscription_throughput";
+//! RTPS packets and bytes sent by the participant.
+constexpr const char* RTPS_SENT_TOPIC = "_fastdds_statistics_rtps_sent";
+//! RTPS packets and bytes received by the participant.
+constexpr const char* RTPS_RECEIVED_TOPIC = "_fastdds_statistics_rtps_received";
+//! Samples resent by each writer as a response to negative acknowledgements.
+constexpr const char* RESENT_DATAS_TOPIC = "_fastdds_statistics_resent_datas";
+//! HEARTBEAT submessages sent by each writer.
+constexpr const char* HEARTBEAT_COUNT_TOPIC = "_fastdds_statistics_heartbeat_count";
+//! ACKNACK submessages sent by each reader.
+constexpr const char* ACKNACK_COUNT_TOPIC = "_fastdds_statistics_acknack_count";
+//! NACKFRAG submessages sent by each reader.
+constexpr const char* NACKFRAG_COUNT_TOPIC = "_fastdds_statistics_nackfrag_count";
+//! GAP submessages sent by each writer.
+constexpr const char* GAP_COUNT_TOPIC = "_fastdds_statistics_gap_count";
+//! DATA and DATA_FRAG submessages sent by each writer.
+constexpr const char* DATA_COUNT_TOPIC = "_fastdds_statistics_data_count";
+//! Time elapsed until each remote participant is discovered.
+constexpr const char* DISCOVERY_TOPIC = "_fastdds_statistics_discovered_entity";
+
+} // namespace statistics
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_STATISTICS_TOPIC_NAMES_HPP_
@@ -70,9 +70,13 @@ class SubscriberAttributes
         //!Matched publishers allocation limits
         ResourceLimitedContainerConfig matched_publisher_allocation;
 
+        //!Maximum payload memory held by samples pending reassembly (0 means unlimited)
+        uint32_t max_incomplete_samples_memory;
+
         SubscriberAttributes()
             : expectsInlineQos(false)
             , historyMemoryPolicy(rtps::PREALLOCATED_MEMORY_MODE)
+            , max_incomplete_samples_memory(0)
             , m_userDefinedID(-1)
             , m_entityID(-1)
         {}
@@ -88,7 +92,8 @@ class SubscriberAttributes
                 (this->multicastLocatorList == b.multicastLocatorList) &&
                 (this->remoteLocatorList == b.remoteLocatorList) &&
                 (this->historyMemoryPolicy == b.historyMemoryPolicy) &&
-                (this->properties == b.properties);
+                (this->properties == b.properties) &&
+                (this->max_incomplete_samples_memory == b.max_incomplete_samples_memory);
         }
 
         bool operator!=(const SubscriberAttributes& b) const
@@ -28,6 +28,8 @@
 #include <fastrtps/common/KeyedChanges.h>
 #include <fastrtps/attributes/TopicAttributes.h>
 
+#include <unordered_map>
+
 namespace eprosima {
 namespace fastrtps {
 
@@ -143,9 +145,9 @@ public:
 
 private:
 
-    typedef std::map<rtps::InstanceHandle_t, KeyedChanges> t_m_Inst_Caches;
+    typedef std::unordered_map<rtps::InstanceHandle_t, KeyedChanges, rtps::InstanceHandleHash> t_m_Inst_Caches;
 
-    //!Map where keys are instance handles and values are vectors of cache changes associated
+    //!Hash table where keys are instance handles and values are vectors of cache changes associated
     t_m_Inst_Caches keyed_changes_;
     //!Time point when the next deadline will occur (only used for topics with no key)
     std::chrono::steady_clock::time_point next_deadline_us_;
@@ -87,6 +87,7 @@ using PublishModeQosPolicyKind = fastdds::dds::PublishModeQosPolicyKind;
 constexpr PublishModeQosPolicyKind SYNCHRONOUS_PUBLISH_MODE = PublishModeQosPolicyKind::SYNCHRONOUS_PUBLISH_MODE;
 constexpr PublishModeQosPolicyKind ASYNCHRONOUS_PUBLISH_MODE = PublishModeQosPolicyKind::ASYNCHRONOUS_PUBLISH_MODE;
 using PublishModeQosPolicy = fastdds::dds::PublishModeQosPolicy;
+using BatchQosPolicy = fastdds::dds::BatchQosPolicy;
 using DataRepresentationId = fastdds::dds::DataRepresentationId;
 using DataRepresentationQosPolicy = fastdds::dds::DataRepresentationQosPolicy;
 using TypeConsistencyKind = fastdds::dds::TypeConsistencyKind;
@@ -107,6 +107,17 @@ public:
     bool remove_change_sub(
             rtps::CacheChange_t* change);
 
+    /**
+     * Remove a specific change from the history, keeping the changes of its instance up to date.
+     * No Thread Safe
+     * @param removal iterator to the change for removal
+     * @param release specifies if the change must be returned to the pool
+     * @return iterator to the next change if any
+     */
+    iterator remove_change_nts(
+            const_iterator removal,
+            bool release = true) override;
+
     /**
      * @brief A method to set the next deadline for the given instance
      * @param handle The handle to the instance
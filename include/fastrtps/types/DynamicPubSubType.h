@@ -34,6 +34,8 @@ protected:
     DynamicType_ptr dynamic_type_;
     MD5 m_md5;
     unsigned char* m_keyBuffer;
+    //! Maximum serialized size of the key, computed when the type is set
+    size_t m_keyBufferSize;
 
 public:
 
@@ -19,7 +19,9 @@
 #include <fastrtps/types/DynamicTypeBuilder.h>
 #include <fastrtps/types/DynamicTypeBuilderPtr.h>
 #include <fastrtps/types/DynamicTypePtr.h>
+#include <map>
 #include <mutex>
+#include <unordered_map>
 
 namespace eprosima {
 namespace fastrtps {
@@ -34,20 +36,55 @@ private:
 
 protected:
     TypeObjectFactory();
-    mutable std::map<const std::string, const TypeIdentifier*> identifiers_; // Basic, builtin and EK_MINIMAL
-    std::map<const std::string, const TypeIdentifier*> complete_identifiers_; // Only EK_COMPLETE
+    //! Candidates sharing the same TypeIdentifier hash, ordered by name to keep reverse lookups deterministic.
+    using IdentifierBucket = std::map<std::string, const TypeIdentifier*>;
+    //! Reverse index: TypeIdentifier hash -> named identifiers with that hash.
+    using IdentifierIndex = std::unordered_map<size_t, IdentifierBucket>;
+
+    mutable std::unordered_map<std::string, const TypeIdentifier*> identifiers_; // Basic, builtin and EK_MINIMAL
+    std::unordered_map<std::string, const TypeIdentifier*> complete_identifiers_; // Only EK_COMPLETE
+    mutable IdentifierIndex identifiers_index_; // Reverse index of identifiers_
+    IdentifierIndex complete_identifiers_index_; // Reverse index of complete_identifiers_
     std::map<const TypeIdentifier*, const TypeObject*> objects_; // EK_MINIMAL
     std::map<const TypeIdentifier*, const TypeObject*> complete_objects_; // EK_COMPLETE
     mutable std::vector<TypeIdentifier*> identifiers_created_;
     mutable std::map<const TypeIdentifier*, TypeInformation*> informations_;
     mutable std::vector<TypeInformation*> informations_created_;
-    std::map<std::string, std::string> aliases_; // Aliases
+    std::unordered_map<std::string, std::string> aliases_; // Aliases
 
     DynamicType_ptr build_dynamic_type(
             TypeDescriptor& descriptor,
             const TypeObject* object,
             const DynamicType_ptr annotation_member_type = DynamicType_ptr(nullptr)) const;
 
+    /**
+     * @brief Computes a hash of the given identifier consistent with TypeIdentifier::operator==.
+     * EK_MINIMAL and EK_COMPLETE identifiers are hashed using their equivalence hash.
+     * @param identifier
+     * @return Hash value.
+     */
+    static size_t hash_type_identifier(
+            const TypeIdentifier& identifier);
+
+    /**
+     * @brief Stores (or replaces) a named identifier on the given map, keeping its reverse index updated.
+     * m_MutexIdentifiers must be locked by the caller.
+     */
+    static void store_identifier_nts(
+            std::unordered_map<std::string, const TypeIdentifier*>& identifiers,
+            IdentifierIndex& index,
+            const std::string& type_name,
+            const TypeIdentifier* identifier);
+
+    /**
+     * @brief Looks for a stored identifier equal to the given one using the reverse index.
+     * m_MutexIdentifiers must be locked by the caller.
+     * @return The bucket entry with the lowest name whose identifier is equal, or nullptr.
+     */
+    static const IdentifierBucket::value_type* find_in_index_nts(
+            const IdentifierIndex& index,
+            const TypeIdentifier& identifier);
+
     const TypeIdentifier* try_get_complete(
             const TypeIdentifier* identifier) const;
 
@@ -212,7 +249,7 @@ public:
             const std::string& target_type)
     {
         std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
-        aliases_.emplace(std::pair<std::string, std::string>(alias_name, target_type));
+        aliases_.emplace(alias_name, target_type);
     }
 
     /**
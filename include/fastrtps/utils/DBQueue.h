@@ -56,6 +56,13 @@ public:
       mBackgroundQueue->push(item);
    }
 
+   //! Pushes to the background queue.
+   void Push(T&& item)
+   {
+      std::unique_lock<std::mutex> guard(mBackgroundMutex);
+      mBackgroundQueue->push(std::move(item));
+   }
+
    //! Returns a reference to the front element
    //! in the foregrund queue.
    T& Front()
@@ -22,6 +22,7 @@
 
 
 
+#include <cstdint>
 #include <vector>
 #include <string>
 
@@ -62,8 +63,25 @@ class IPFinder
         IPFinder();
         virtual ~IPFinder();
 
+        /**
+         * Get the addresses of all the interfaces.
+         * Interfaces are enumerated once and shared by the whole process, until they change or refresh is called.
+         * @param[out] vec_name List to be populated with the addresses.
+         * @param return_loopback Whether loopback addresses should be returned.
+         */
         RTPS_DllAPI static bool getIPs(std::vector<info_IP>* vec_name, bool return_loopback = false);
 
+        /**
+         * Discard the interfaces snapshot, so they are enumerated again on the next query.
+         */
+        RTPS_DllAPI static void refresh();
+
+        /**
+         * Get a number that changes each time the interfaces snapshot changes.
+         * Users of the addresses can compare it with a previous value to know if they should query them again.
+         */
+        RTPS_DllAPI static uint32_t generation();
+
         /**
          * Get the IP4Adresses in all interfaces.
          * @param[out] locators List of locators to be populated with the IP4 addresses.
@@ -92,6 +110,14 @@ class IPFinder
 
         RTPS_DllAPI static std::string getIPv4Address(const std::string &name);
         RTPS_DllAPI static std::string getIPv6Address(const std::string &name);
+
+    private:
+
+        //! Enumerates the interfaces from the operating system.
+        static bool query_ips(std::vector<info_IP>* vec_name, bool return_loopback);
+
+        //! Enumerates the interfaces again if they may have changed. Called with the snapshot locked.
+        static bool update_snapshot_nts();
 };
 
 }
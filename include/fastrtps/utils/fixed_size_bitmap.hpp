@@ -383,9 +383,11 @@ public:
         uint32_t num_bytes = num_items * static_cast<uint32_t>(sizeof(uint32_t));
         bitmap_.fill(0u);
         memcpy(bitmap_.data(), bitmap, num_bytes);
-        if (0 < num_bits)
+        // Clear the bits after the last significant one, if it does not end a word
+        uint32_t shift = num_bits_ & 31u;
+        if (0 < shift)
         {
-            bitmap_[num_items - 1] &= ~(std::numeric_limits<uint32_t>::max() >> (num_bits & 31u));
+            bitmap_[num_items - 1] &= ~(std::numeric_limits<uint32_t>::max() >> shift);
         }
         calc_maximum_bit_set(num_items, 0);
     }
@@ -383,6 +383,11 @@ protected:
             PublishModeQosPolicy& publishMode,
             uint8_t ident);
 
+    RTPS_DllAPI static XMLP_ret getXMLBatchQos(
+            tinyxml2::XMLElement* elem,
+            BatchQosPolicy& batch,
+            uint8_t ident);
+
     RTPS_DllAPI static XMLP_ret getXMLGroupDataQos(
             tinyxml2::XMLElement* elem,
             GroupDataQosPolicy& groupData,
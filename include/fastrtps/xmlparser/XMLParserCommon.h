@@ -146,6 +146,7 @@ extern const char* USER_DEF_ID;
 extern const char* ENTITY_ID;
 extern const char* MATCHED_SUBSCRIBERS_ALLOCATION;
 extern const char* MATCHED_PUBLISHERS_ALLOCATION;
+extern const char* MAX_INCOMPLETE_SAMPLES_MEMORY;
 
 ///
 extern const char* PROPERTIES;
@@ -178,6 +179,9 @@ extern const char* INIT_HEARTB_DELAY;
 extern const char* HEARTB_PERIOD;
 extern const char* NACK_RESP_DELAY;
 extern const char* NACK_SUPRESSION;
+extern const char* ADAPTIVE_HEARTB;
+extern const char* MIN_HEARTB_PERIOD;
+extern const char* MAX_HEARTB_PERIOD;
 extern const char* BY_NAME;
 extern const char* BY_VAL;
 extern const char* DURATION_INFINITY;
@@ -206,6 +210,9 @@ extern const char* TOPIC_DATA;
 extern const char* GROUP_DATA;
 extern const char* PUB_MODE;
 extern const char* DISABLE_POSITIVE_ACKS;
+extern const char* BATCH;
+extern const char* MAX_DATA_BYTES;
+extern const char* MAX_FLUSH_DELAY;
 
 extern const char* SYNCHRONOUS;
 extern const char* ASYNCHRONOUS;
@@ -29,12 +29,14 @@ namespace types {
 DynamicPubSubType::DynamicPubSubType()
     : dynamic_type_(nullptr)
     , m_keyBuffer(nullptr)
+    , m_keyBufferSize(0)
 {
 }
 
 DynamicPubSubType::DynamicPubSubType(DynamicType_ptr pType)
     : dynamic_type_(pType)
     , m_keyBuffer(nullptr)
+    , m_keyBufferSize(0)
 {
     UpdateDynamicTypeInfo();
 }
@@ -129,18 +131,18 @@ bool DynamicPubSubType::getKey(
         return false;
     }
     DynamicData* pDynamicData = (DynamicData*)data;
-    size_t keyBufferSize = static_cast<uint32_t>(DynamicData::getKeyMaxCdrSerializedSize(dynamic_type_));
 
-    if (m_keyBuffer == nullptr)
+    // Keys which may not fill the whole handle must leave no bytes of a previous key behind
+    bool use_md5 = force_md5 || m_keyBufferSize > 16;
+    if (!use_md5)
     {
-        m_keyBuffer = (unsigned char*)malloc(keyBufferSize > 16 ? keyBufferSize : 16);
-        memset(m_keyBuffer, 0, keyBufferSize > 16 ? keyBufferSize : 16);
+        memset(m_keyBuffer, 0, 16);
     }
 
-    eprosima::fastcdr::FastBuffer fastbuffer((char*)m_keyBuffer, keyBufferSize);
+    eprosima::fastcdr::FastBuffer fastbuffer((char*)m_keyBuffer, m_keyBufferSize);
     eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);     // Object that serializes the data.
     pDynamicData->serializeKey(ser);
-    if (force_md5 || keyBufferSize > 16)
+    if (use_md5)
     {
         m_md5.init();
         m_md5.update(m_keyBuffer, (unsigned int)ser.getSerializedDataLength());
@@ -210,6 +212,18 @@ void DynamicPubSubType::UpdateDynamicTypeInfo()
 
         m_typeSize = static_cast<uint32_t>(DynamicData::getMaxCdrSerializedSize(dynamic_type_) + 4);
         setName(dynamic_type_->get_name().c_str());
+
+        // The key size decides whether the instance handle needs MD5, so it is computed once instead of on each write
+        if (m_isGetKeyDefined)
+        {
+            m_keyBufferSize = DynamicData::getKeyMaxCdrSerializedSize(dynamic_type_);
+            if (m_keyBuffer != nullptr)
+            {
+                free(m_keyBuffer);
+            }
+            m_keyBuffer = (unsigned char*)malloc(m_keyBufferSize > 16 ? m_keyBufferSize : 16);
+            memset(m_keyBuffer, 0, m_keyBufferSize > 16 ? m_keyBufferSize : 16);
+        }
     }
 }
 
@@ -74,82 +74,82 @@ TypeObjectFactory::TypeObjectFactory()
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_BOOLEAN);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_BOOLEAN, auxIdent));
+    store_identifier_nts(identifiers_, identifiers_index_, TKNAME_BOOLEAN, auxIdent);
     // TK_BYTE:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_BYTE);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_BYTE, auxIdent));
+    store_identifier_nts(identifiers_, identifiers_index_, TKNAME_BYTE, auxIdent);
     // TK_BYTE:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_BYTE);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_UINT8, auxIdent));
+    store_identifier_nts(identifiers_, identifiers_index_, TKNAME_UINT8, auxIdent);
     // TK_BYTE:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_BYTE);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_INT8, auxIdent));
+    store_identifier_nts(identifiers_, identifiers_index_, TKNAME_INT8, auxIdent);
     // TK_INT16:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_INT16);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_INT16, auxIdent));
+    store_identifier_nts(identifiers_, identifiers_index_, TKNAME_INT16, auxIdent);
     // TK_INT32:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_INT32);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_INT32, auxIdent));
+    store_identifier_nts(identifiers_, identifiers_index_, TKNAME_INT32, auxIdent);
     // TK_INT64:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_INT64);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_INT64, auxIdent));
+    store_identifier_nts(identifiers_, identifiers_index_, TKNAME_INT64, auxIdent);
     // TK_UINT16:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_UINT16);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_UINT16, auxIdent));
+    store_identifier_nts(identifiers_, identifiers_index_, TKNAME_UINT16, auxIdent);
     // TK_UINT32:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_UINT32);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_UINT32, auxIdent));
+    store_identifier_nts(identifiers_, identifiers_index_, TKNAME_UINT32, auxIdent);
     // TK_UINT64:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_UINT64);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_UINT64, auxIdent));
+    store_identifier_nts(identifiers_, identifiers_index_, TKNAME_UINT64, auxIdent);
     // TK_FLOAT32:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_FLOAT32);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_FLOAT32, auxIdent));
+    store_identifier_nts(identifiers_, identifiers_index_, TKNAME_FLOAT32, auxIdent);
     // TK_FLOAT64:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_FLOAT64);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_FLOAT64, auxIdent));
+    store_identifier_nts(identifiers_, identifiers_index_, TKNAME_FLOAT64, auxIdent);
     // TK_FLOAT128:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_FLOAT128);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_FLOAT128, auxIdent));
+    store_identifier_nts(identifiers_, identifiers_index_, TKNAME_FLOAT128, auxIdent);
     // TK_CHAR8:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_CHAR8);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_CHAR8, auxIdent));
+    store_identifier_nts(identifiers_, identifiers_index_, TKNAME_CHAR8, auxIdent);
     // TK_CHAR16:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_CHAR16);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_CHAR16, auxIdent));
+    store_identifier_nts(identifiers_, identifiers_index_, TKNAME_CHAR16, auxIdent);
     // TK_CHAR16:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_CHAR16);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_CHAR16T, auxIdent));
+    store_identifier_nts(identifiers_, identifiers_index_, TKNAME_CHAR16T, auxIdent);
 }
 
 TypeObjectFactory::~TypeObjectFactory()
@@ -167,6 +167,8 @@ TypeObjectFactory::~TypeObjectFactory()
         std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
         identifiers_.clear();
         complete_identifiers_.clear();
+        identifiers_index_.clear();
+        complete_identifiers_index_.clear();
 
         for (TypeIdentifier* id : identifiers_created_)
         {
@@ -199,6 +201,100 @@ void TypeObjectFactory::create_builtin_annotations()
     register_builtin_annotations_types(g_instance);
 }
 
+size_t TypeObjectFactory::hash_type_identifier(
+        const TypeIdentifier& identifier)
+{
+    size_t hash = identifier._d();
+    auto combine = [&hash](size_t value)
+            {
+                hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            };
+
+    // Only fields compared by TypeIdentifier::operator== are used, so equal identifiers always share a hash.
+    switch (identifier._d())
+    {
+        case EK_MINIMAL:
+        case EK_COMPLETE:
+        {
+            const octet* eq_hash = identifier.equivalence_hash();
+            for (size_t i = 0; i < 14; ++i)
+            {
+                combine(eq_hash[i]);
+            }
+            break;
+        }
+        case TI_STRING8_SMALL:
+        case TI_STRING16_SMALL:
+            combine(identifier.string_sdefn().bound());
+            break;
+        case TI_STRING8_LARGE:
+        case TI_STRING16_LARGE:
+            combine(identifier.string_ldefn().bound());
+            break;
+        case TI_PLAIN_SEQUENCE_SMALL:
+            combine(identifier.seq_sdefn().bound());
+            break;
+        case TI_PLAIN_SEQUENCE_LARGE:
+            combine(identifier.seq_ldefn().bound());
+            break;
+        case TI_PLAIN_MAP_SMALL:
+            combine(identifier.map_sdefn().bound());
+            break;
+        case TI_PLAIN_MAP_LARGE:
+            combine(identifier.map_ldefn().bound());
+            break;
+        default:
+            break;
+    }
+
+    return hash;
+}
+
+void TypeObjectFactory::store_identifier_nts(
+        std::unordered_map<std::string, const TypeIdentifier*>& identifiers,
+        IdentifierIndex& index,
+        const std::string& type_name,
+        const TypeIdentifier* identifier)
+{
+    const TypeIdentifier*& entry = identifiers[type_name];
+    if (entry != nullptr)
+    {
+        auto bucket = index.find(hash_type_identifier(*entry));
+        if (bucket != index.end())
+        {
+            bucket->second.erase(type_name);
+            if (bucket->second.empty())
+            {
+                index.erase(bucket);
+            }
+        }
+    }
+
+    entry = identifier;
+    if (identifier != nullptr)
+    {
+        index[hash_type_identifier(*identifier)][type_name] = identifier;
+    }
+}
+
+const TypeObjectFactory::IdentifierBucket::value_type* TypeObjectFactory::find_in_index_nts(
+        const IdentifierIndex& index,
+        const TypeIdentifier& identifier)
+{
+    auto bucket = index.find(hash_type_identifier(identifier));
+    if (bucket != index.end())
+    {
+        for (const IdentifierBucket::value_type& candidate : bucket->second)
+        {
+            if (*candidate.second == identifier)
+            {
+                return &candidate;
+            }
+        }
+    }
+    return nullptr;
+}
+
 void TypeObjectFactory::nullify_all_entries(
         const TypeIdentifier* identifier)
 {
@@ -206,7 +302,7 @@ void TypeObjectFactory::nullify_all_entries(
     {
         if (it->second == identifier)
         {
-            it->second = nullptr;
+            store_identifier_nts(identifiers_, identifiers_index_, it->first, nullptr);
         }
     }
 
@@ -214,7 +310,7 @@ void TypeObjectFactory::nullify_all_entries(
     {
         if (it->second == identifier)
         {
-            it->second = nullptr;
+            store_identifier_nts(complete_identifiers_, complete_identifiers_index_, it->first, nullptr);
         }
     }
 
@@ -880,16 +976,18 @@ const TypeObject* TypeObjectFactory::get_type_object(
     }
     if (identifier->_d() == EK_COMPLETE)
     {
-        if (complete_objects_.find(identifier) != complete_objects_.end())
+        auto it = complete_objects_.find(identifier);
+        if (it != complete_objects_.end())
         {
-            return complete_objects_.at(identifier);
+            return it->second;
         }
     }
     else
     {
-        if (objects_.find(identifier) != objects_.end())
+        auto it = objects_.find(identifier);
+        if (it != objects_.end())
         {
-            return objects_.at(identifier);
+            return it->second;
         }
     }
 
@@ -1072,9 +1170,10 @@ const TypeIdentifier* TypeObjectFactory::get_type_identifier(
 
     if (complete)
     {
-        if (complete_identifiers_.find(type_name) != complete_identifiers_.end())
+        auto it = complete_identifiers_.find(type_name);
+        if (it != complete_identifiers_.end())
         {
-            return complete_identifiers_.at(type_name);
+            return it->second;
         }
         /*else // Try it with minimal
            {
@@ -1083,16 +1182,18 @@ const TypeIdentifier* TypeObjectFactory::get_type_identifier(
     }
     else
     {
-        if (identifiers_.find(type_name) != identifiers_.end())
+        auto it = identifiers_.find(type_name);
+        if (it != identifiers_.end())
         {
-            return identifiers_.at(type_name);
+            return it->second;
         }
     }
 
     // Try with aliases
-    if (aliases_.find(type_name) != aliases_.end())
+    auto alias = aliases_.find(type_name);
+    if (alias != aliases_.end())
     {
-        return get_type_identifier(aliases_.at(type_name), complete);
+        return get_type_identifier(alias->second, complete);
     }
 
     return nullptr;
@@ -1103,9 +1204,10 @@ const TypeIdentifier* TypeObjectFactory::get_type_identifier_trying_complete(
 {
     std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
 
-    if (complete_identifiers_.find(type_name) != complete_identifiers_.end())
+    auto it = complete_identifiers_.find(type_name);
+    if (it != complete_identifiers_.end())
     {
-        return complete_identifiers_.at(type_name);
+        return it->second;
     }
     else // Try it with minimal
     {
@@ -1121,25 +1223,11 @@ const TypeIdentifier* TypeObjectFactory::get_stored_type_identifier(
     {
         return nullptr;
     }
-    if (identifier->_d() == EK_COMPLETE)
-    {
-        for (auto& it : complete_identifiers_)
-        {
-            if (*(it.second) == *identifier)
-            {
-                return it.second;
-            }
-        }
-    }
-    else
+    const IdentifierBucket::value_type* stored = find_in_index_nts(
+        identifier->_d() == EK_COMPLETE ? complete_identifiers_index_ : identifiers_index_, *identifier);
+    if (stored != nullptr)
     {
-        for (auto& it : identifiers_)
-        {
-            if (*(it.second) == *identifier)
-            {
-                return it.second;
-            }
-        }
+        return stored->second;
     }
     // If isn't minimal, return directly
     if (identifier->_d() < EK_MINIMAL)
@@ -1157,25 +1245,11 @@ std::string TypeObjectFactory::get_type_name(
     {
         return "<NULLPTR>";
     }
-    if (identifier->_d() == EK_COMPLETE)
-    {
-        for (auto& it : complete_identifiers_)
-        {
-            if (*(it.second) == *identifier)
-            {
-                return it.first;
-            }
-        }
-    }
-    else
+    const IdentifierBucket::value_type* stored = find_in_index_nts(
+        identifier->_d() == EK_COMPLETE ? complete_identifiers_index_ : identifiers_index_, *identifier);
+    if (stored != nullptr)
     {
-        for (auto& it : identifiers_)
-        {
-            if (*(it.second) == *identifier)
-            {
-                return it.first;
-            }
-        }
+        return stored->first;
     }
 
     // Maybe they are using an external TypeIdentifier?
@@ -1338,23 +1412,23 @@ void TypeObjectFactory::add_type_identifier(
         const std::string& type_name,
         const TypeIdentifier* identifier)
 {
+    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
+
     const TypeIdentifier* alreadyExists = get_stored_type_identifier(identifier);
     if (alreadyExists != nullptr && alreadyExists != identifier)
     {
         // Don't copy
         if (is_type_identifier_complete(alreadyExists))
         {
-            complete_identifiers_[type_name] = alreadyExists;
+            store_identifier_nts(complete_identifiers_, complete_identifiers_index_, type_name, alreadyExists);
         }
         else
         {
-            identifiers_[type_name] = alreadyExists;
+            store_identifier_nts(identifiers_, identifiers_index_, type_name, alreadyExists);
         }
         return;
     }
 
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
-    //identifiers_.insert(std::pair<const std::string, const TypeIdentifier*>(type_name, identifier));
     if (is_type_identifier_complete(identifier))
     {
         if (complete_identifiers_.find(type_name) == complete_identifiers_.end())
@@ -1362,7 +1436,7 @@ void TypeObjectFactory::add_type_identifier(
             TypeIdentifier* id = new TypeIdentifier();
             identifiers_created_.push_back(id);
             *id = *identifier;
-            complete_identifiers_[type_name] = id;
+            store_identifier_nts(complete_identifiers_, complete_identifiers_index_, type_name, id);
         }
     }
     else
@@ -1372,7 +1446,7 @@ void TypeObjectFactory::add_type_identifier(
             TypeIdentifier* id = new TypeIdentifier();
             identifiers_created_.push_back(id);
             *id = *identifier;
-            identifiers_[type_name] = id;
+            store_identifier_nts(identifiers_, identifiers_index_, type_name, id);
         }
     }
 }
@@ -1384,6 +1458,22 @@ void TypeObjectFactory::add_type_object(
 {
     add_type_identifier(type_name, identifier);
 
+    const TypeIdentifier* minimal_id = nullptr;
+    const TypeIdentifier* complete_id = nullptr;
+    {
+        std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
+        auto min_it = identifiers_.find(type_name);
+        if (min_it != identifiers_.end())
+        {
+            minimal_id = min_it->second;
+        }
+        auto comp_it = complete_identifiers_.find(type_name);
+        if (comp_it != complete_identifiers_.end())
+        {
+            complete_id = comp_it->second;
+        }
+    }
+
     std::unique_lock<std::recursive_mutex> scopedObj(m_MutexObjects);
 
     if (object != nullptr)
@@ -1392,7 +1482,7 @@ void TypeObjectFactory::add_type_object(
         {
             if (object->_d() == EK_MINIMAL)
             {
-                const TypeIdentifier* typeId = identifiers_[type_name];
+                const TypeIdentifier* typeId = minimal_id;
                 if (objects_.find(typeId) == objects_.end())
                 {
                     TypeObject* obj = new TypeObject();
@@ -1402,7 +1492,7 @@ void TypeObjectFactory::add_type_object(
             }
             else if (object->_d() == EK_COMPLETE)
             {
-                const TypeIdentifier* typeId = complete_identifiers_[type_name];
+                const TypeIdentifier* typeId = complete_id;
                 if (complete_objects_.find(typeId) == complete_objects_.end())
                 {
                     TypeObject* obj = new TypeObject();
@@ -1413,7 +1503,7 @@ void TypeObjectFactory::add_type_object(
         }
         else
         {
-            const TypeIdentifier* typeId = identifiers_[type_name];
+            const TypeIdentifier* typeId = minimal_id;
             if (object->_d() == EK_MINIMAL)
             {
                 if (objects_.find(typeId) == objects_.end())
@@ -0,0 +1,81 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ConditionNotifier.cpp
+ */
+
+#include <fastdds/core/condition/ConditionNotifier.hpp>
+#include <fastdds/core/condition/WaitSetImpl.hpp>
+
+#include <algorithm>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace detail {
+
+void ConditionNotifier::attach_to(
+        WaitSetImpl* wait_set)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (std::find(entries_.begin(), entries_.end(), wait_set) == entries_.end())
+    {
+        entries_.push_back(wait_set);
+        num_entries_.store(entries_.size(), std::memory_order_release);
+    }
+}
+
+void ConditionNotifier::detach_from(
+        WaitSetImpl* wait_set)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = std::find(entries_.begin(), entries_.end(), wait_set);
+    if (it != entries_.end())
+    {
+        entries_.erase(it);
+        num_entries_.store(entries_.size(), std::memory_order_release);
+    }
+}
+
+void ConditionNotifier::notify()
+{
+    if (0 == num_entries_.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    for (WaitSetImpl* wait_set : entries_)
+    {
+        wait_set->wake_up();
+    }
+}
+
+void ConditionNotifier::will_be_deleted(
+        const Condition& condition)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    for (WaitSetImpl* wait_set : entries_)
+    {
+        wait_set->will_be_deleted(condition);
+    }
+    entries_.clear();
+    num_entries_.store(0, std::memory_order_release);
+}
+
+} // namespace detail
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
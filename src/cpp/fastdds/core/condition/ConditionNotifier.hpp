@@ -0,0 +1,89 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ConditionNotifier.hpp
+ */
+
+#ifndef _FASTDDS_CORE_CONDITION_CONDITIONNOTIFIER_HPP_
+#define _FASTDDS_CORE_CONDITION_CONDITIONNOTIFIER_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+class Condition;
+
+namespace detail {
+
+class WaitSetImpl;
+
+/**
+ * Keeps the list of WaitSets a Condition is attached to, and wakes them up when the condition triggers.
+ *
+ * Conditions are triggered from the reception and event threads, so notifying a condition that is not
+ * attached to any WaitSet only costs an atomic load.
+ */
+class ConditionNotifier
+{
+public:
+
+    /**
+     * Adds a WaitSet to the list of WaitSets to be notified.
+     * @param wait_set The WaitSet to add. Adding a WaitSet twice has no effect.
+     */
+    void attach_to(
+            WaitSetImpl* wait_set);
+
+    /**
+     * Removes a WaitSet from the list of WaitSets to be notified.
+     * @param wait_set The WaitSet to remove.
+     */
+    void detach_from(
+            WaitSetImpl* wait_set);
+
+    /**
+     * Wakes up all the WaitSets the condition is attached to.
+     */
+    void notify();
+
+    /**
+     * Informs the attached WaitSets that the condition is being deleted, so they stop using it.
+     * @param condition The condition being deleted.
+     */
+    void will_be_deleted(
+            const Condition& condition);
+
+private:
+
+    //! Number of attached WaitSets, checked before taking the mutex
+    std::atomic<size_t> num_entries_{0};
+
+    std::mutex mutex_;
+
+    std::vector<WaitSetImpl*> entries_;
+};
+
+} // namespace detail
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _FASTDDS_CORE_CONDITION_CONDITIONNOTIFIER_HPP_
@@ -0,0 +1,87 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatusConditionImpl.cpp
+ */
+
+#include <fastdds/core/condition/StatusConditionImpl.hpp>
+#include <fastdds/core/condition/ConditionNotifier.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace detail {
+
+StatusConditionImpl::StatusConditionImpl(
+        ConditionNotifier* notifier)
+    : mask_(to_bits(StatusMask::all()))
+    , status_(0)
+    , notifier_(notifier)
+{
+}
+
+bool StatusConditionImpl::get_trigger_value() const
+{
+    return 0 != (mask_.load(std::memory_order_acquire) & status_.load(std::memory_order_acquire));
+}
+
+ReturnCode_t StatusConditionImpl::set_enabled_statuses(
+        const StatusMask& mask)
+{
+    uint32_t new_mask = to_bits(mask);
+    uint32_t old_mask = mask_.exchange(new_mask, std::memory_order_acq_rel);
+    uint32_t status = status_.load(std::memory_order_acquire);
+    if (0 == (old_mask & status) && 0 != (new_mask & status))
+    {
+        notifier_->notify();
+    }
+    return ReturnCode_t::RETCODE_OK;
+}
+
+StatusMask StatusConditionImpl::get_enabled_statuses() const
+{
+    return StatusMask(mask_.load(std::memory_order_acquire));
+}
+
+StatusMask StatusConditionImpl::get_raw_status() const
+{
+    return StatusMask(status_.load(std::memory_order_acquire));
+}
+
+void StatusConditionImpl::set_status(
+        const StatusMask& status,
+        bool trigger_value)
+{
+    uint32_t bits = to_bits(status);
+    if (trigger_value)
+    {
+        uint32_t old_status = status_.fetch_or(bits, std::memory_order_acq_rel);
+        uint32_t mask = mask_.load(std::memory_order_acquire);
+        // Notify only when the trigger value changes, statuses changing again before being read are coalesced
+        if (0 == (old_status & mask) && 0 != (bits & mask))
+        {
+            notifier_->notify();
+        }
+    }
+    else
+    {
+        status_.fetch_and(~bits, std::memory_order_acq_rel);
+    }
+}
+
+} // namespace detail
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,197 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WaitSetImpl.cpp
+ */
+
+#include <fastdds/core/condition/WaitSetImpl.hpp>
+#include <fastdds/core/condition/ConditionNotifier.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace detail {
+
+WaitSetImpl::~WaitSetImpl()
+{
+    std::vector<const Condition*> old_entries;
+
+    {
+        // We only need to protect access to the collection.
+        std::lock_guard<std::mutex> guard(mutex_);
+        old_entries.swap(entries_);
+    }
+
+    for (const Condition* c : old_entries)
+    {
+        c->get_notifier()->detach_from(this);
+    }
+}
+
+ReturnCode_t WaitSetImpl::attach_condition(
+        const Condition& condition)
+{
+    bool was_there = false;
+
+    {
+        // We only need to protect access to the collection.
+        std::lock_guard<std::mutex> guard(mutex_);
+        was_there = std::find(entries_.begin(), entries_.end(), &condition) != entries_.end();
+        if (!was_there)
+        {
+            entries_.push_back(&condition);
+        }
+    }
+
+    if (!was_there)
+    {
+        // Should only be attached once
+        condition.get_notifier()->attach_to(this);
+
+        // The condition may have triggered before the notifier knew about this WaitSet
+        if (condition.get_trigger_value())
+        {
+            wake_up();
+        }
+    }
+
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t WaitSetImpl::detach_condition(
+        const Condition& condition)
+{
+    bool was_there = false;
+
+    {
+        // We only need to protect access to the collection.
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = std::find(entries_.begin(), entries_.end(), &condition);
+        was_there = it != entries_.end();
+        if (was_there)
+        {
+            entries_.erase(it);
+        }
+    }
+
+    if (!was_there)
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    condition.get_notifier()->detach_from(this);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t WaitSetImpl::wait(
+        ConditionSeq& active_conditions,
+        const fastrtps::Duration_t& timeout)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if (is_waiting_)
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    auto fill_active_conditions = [&]()
+            {
+                // Triggers happening from now on will wake us up again
+                notified_.store(false, std::memory_order_release);
+
+                active_conditions.clear();
+                for (const Condition* c : entries_)
+                {
+                    if (c->get_trigger_value())
+                    {
+                        active_conditions.push_back(const_cast<Condition*>(c));
+                    }
+                }
+                return !active_conditions.empty();
+            };
+
+    auto has_been_notified = [&]()
+            {
+                return notified_.load(std::memory_order_acquire);
+            };
+
+    bool condition_value = fill_active_conditions();
+    if (!condition_value)
+    {
+        is_waiting_ = true;
+
+        if (fastrtps::c_TimeInfinite == timeout)
+        {
+            while (!condition_value)
+            {
+                cond_.wait(lock, has_been_notified);
+                condition_value = fill_active_conditions();
+            }
+        }
+        else
+        {
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::nanoseconds(timeout.to_ns());
+            while (!condition_value && cond_.wait_until(lock, deadline, has_been_notified))
+            {
+                condition_value = fill_active_conditions();
+            }
+        }
+
+        is_waiting_ = false;
+    }
+
+    return condition_value ? ReturnCode_t::RETCODE_OK : ReturnCode_t::RETCODE_TIMEOUT;
+}
+
+ReturnCode_t WaitSetImpl::get_conditions(
+        ConditionSeq& attached_conditions) const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    attached_conditions.clear();
+    for (const Condition* c : entries_)
+    {
+        attached_conditions.push_back(const_cast<Condition*>(c));
+    }
+    return ReturnCode_t::RETCODE_OK;
+}
+
+void WaitSetImpl::wake_up()
+{
+    // Only the first notification since the last evaluation needs to signal the waiting thread
+    if (!notified_.exchange(true, std::memory_order_acq_rel))
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        cond_.notify_one();
+    }
+}
+
+void WaitSetImpl::will_be_deleted(
+        const Condition& condition)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = std::find(entries_.begin(), entries_.end(), &condition);
+    if (it != entries_.end())
+    {
+        entries_.erase(it);
+    }
+}
+
+} // namespace detail
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,117 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WaitSetImpl.hpp
+ */
+
+#ifndef _FASTDDS_CORE_CONDITION_WAITSETIMPL_HPP_
+#define _FASTDDS_CORE_CONDITION_WAITSETIMPL_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastdds/dds/core/condition/Condition.hpp>
+#include <fastdds/rtps/common/Time_t.h>
+#include <fastrtps/types/TypesBase.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+using eprosima::fastrtps::types::ReturnCode_t;
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace detail {
+
+/**
+ * Implementation of WaitSet.
+ *
+ * Wake ups are coalesced: only the first notification after the waiting thread last evaluated the
+ * attached conditions takes the mutex to signal it, the rest just find the notified flag already set.
+ *
+ * Lock order is ConditionNotifier mutex before WaitSetImpl mutex. The WaitSet never calls a notifier while
+ * holding its own mutex, and evaluating the trigger value of a condition must not take any lock.
+ */
+class WaitSetImpl
+{
+public:
+
+    ~WaitSetImpl();
+
+    /**
+     * @brief Attach a condition to this WaitSet implementation
+     * @param condition The Condition to attach to this WaitSet implementation
+     * @return RETCODE_OK
+     */
+    ReturnCode_t attach_condition(
+            const Condition& condition);
+
+    /**
+     * @brief Detach a condition from this WaitSet implementation
+     * @param condition The Condition to detach from this WaitSet implementation
+     * @return RETCODE_OK if the condition was detached, RETCODE_PRECONDITION_NOT_MET if it was not attached
+     */
+    ReturnCode_t detach_condition(
+            const Condition& condition);
+
+    /**
+     * @brief Wait for any of the attached conditions to be triggered
+     * @param active_conditions Reference to the collection of conditions which trigger_value are TRUE
+     * @param timeout Maximum time of the wait
+     * @return RETCODE_OK if everything correct, RETCODE_PRECONDITION_NOT_MET if WaitSet already waiting,
+     *         RETCODE_TIMEOUT if wait takes more than timeout
+     */
+    ReturnCode_t wait(
+            ConditionSeq& active_conditions,
+            const fastrtps::Duration_t& timeout);
+
+    /**
+     * @brief Retrieve the list of attached conditions
+     * @param attached_conditions Reference to the collection of attached conditions
+     * @return RETCODE_OK
+     */
+    ReturnCode_t get_conditions(
+            ConditionSeq& attached_conditions) const;
+
+    /**
+     * @brief Wake up this WaitSet implementation if it was waiting
+     */
+    void wake_up();
+
+    /**
+     * @brief Called from the destructor of a Condition to inform this WaitSet implementation that the condition
+     * should be automatically detached.
+     */
+    void will_be_deleted(
+            const Condition& condition);
+
+private:
+
+    mutable std::mutex mutex_;
+    std::condition_variable cond_;
+    std::vector<const Condition*> entries_;
+    //! Set when a condition has triggered since the attached conditions were last evaluated
+    std::atomic<bool> notified_{false};
+    bool is_waiting_ = false;
+};
+
+} // namespace detail
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _FASTDDS_CORE_CONDITION_WAITSETIMPL_HPP_
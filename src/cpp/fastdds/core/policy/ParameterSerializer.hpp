@@ -22,6 +22,7 @@
 
 #include "ParameterList.hpp"
 #include <fastdds/rtps/common/CDRMessage_t.h>
+#include <fastdds/rtps/common/ContentFilterProperty.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -808,6 +809,87 @@ inline bool ParameterSerializer<ParameterEndpointSecurityInfo_t>::read_content_f
 
 #endif // if HAVE_SECURITY
 
+template<>
+inline uint32_t ParameterSerializer<rtps::ContentFilterProperty>::cdr_serialized_size(
+        const rtps::ContentFilterProperty& parameter)
+{
+    // str_len + str_data + null_char, aligned
+    auto string_size = [](size_t length)
+            {
+                return (4 + static_cast<uint32_t>(length) + 1 + 3) & ~3u;
+            };
+
+    // p_id + p_length
+    uint32_t ret_val = 2 + 2;
+    ret_val += string_size(parameter.content_filtered_topic_name.size());
+    ret_val += string_size(parameter.related_topic_name.size());
+    ret_val += string_size(parameter.filter_class_name.size());
+    ret_val += string_size(parameter.filter_expression.size());
+    // n_parameters
+    ret_val += 4;
+    for (const std::string& expression_parameter : parameter.expression_parameters)
+    {
+        ret_val += string_size(expression_parameter.size());
+    }
+    return ret_val;
+}
+
+template<>
+inline bool ParameterSerializer<rtps::ContentFilterProperty>::add_to_cdr_message(
+        const rtps::ContentFilterProperty& parameter,
+        fastrtps::rtps::CDRMessage_t* cdr_message)
+{
+    uint32_t size = cdr_serialized_size(parameter);
+    if (size - 4 > 0xFFFF)
+    {
+        return false;
+    }
+
+    bool valid = fastrtps::rtps::CDRMessage::addUInt16(cdr_message, PID_CONTENT_FILTER_PROPERTY);
+    valid &= fastrtps::rtps::CDRMessage::addUInt16(cdr_message, static_cast<uint16_t>(size - 4));
+    valid &= fastrtps::rtps::CDRMessage::add_string(cdr_message, parameter.content_filtered_topic_name);
+    valid &= fastrtps::rtps::CDRMessage::add_string(cdr_message, parameter.related_topic_name);
+    valid &= fastrtps::rtps::CDRMessage::add_string(cdr_message, parameter.filter_class_name);
+    valid &= fastrtps::rtps::CDRMessage::add_string(cdr_message, parameter.filter_expression);
+    valid &= fastrtps::rtps::CDRMessage::addUInt32(cdr_message,
+                    static_cast<uint32_t>(parameter.expression_parameters.size()));
+    for (const std::string& expression_parameter : parameter.expression_parameters)
+    {
+        valid &= fastrtps::rtps::CDRMessage::add_string(cdr_message, expression_parameter);
+    }
+    return valid;
+}
+
+template<>
+inline bool ParameterSerializer<rtps::ContentFilterProperty>::read_content_from_cdr_message(
+        rtps::ContentFilterProperty& parameter,
+        fastrtps::rtps::CDRMessage_t* cdr_message,
+        const uint16_t parameter_length)
+{
+    uint32_t pos_ref = cdr_message->pos;
+    bool valid = fastrtps::rtps::CDRMessage::readString(cdr_message, &parameter.content_filtered_topic_name);
+    valid &= fastrtps::rtps::CDRMessage::readString(cdr_message, &parameter.related_topic_name);
+    valid &= fastrtps::rtps::CDRMessage::readString(cdr_message, &parameter.filter_class_name);
+    valid &= fastrtps::rtps::CDRMessage::readString(cdr_message, &parameter.filter_expression);
+
+    uint32_t num_parameters = 0;
+    valid &= fastrtps::rtps::CDRMessage::readUInt32(cdr_message, &num_parameters);
+    // Each parameter takes at least 4 bytes
+    if (!valid || num_parameters > parameter_length / 4u)
+    {
+        return false;
+    }
+
+    parameter.expression_parameters.resize(num_parameters);
+    for (std::string& expression_parameter : parameter.expression_parameters)
+    {
+        valid &= fastrtps::rtps::CDRMessage::readString(cdr_message, &expression_parameter);
+    }
+
+    valid &= (cdr_message->pos - pos_ref) == parameter_length;
+    return valid;
+}
+
 } //namespace dds
 } //namespace fastdds
 } //namespace eprosima
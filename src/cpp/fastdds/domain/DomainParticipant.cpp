@@ -176,6 +176,21 @@ ReturnCode_t DomainParticipant::delete_topic(
     return impl_->delete_topic(topic);
 }
 
+ContentFilteredTopic* DomainParticipant::create_contentfilteredtopic(
+        const std::string& name,
+        Topic* related_topic,
+        const std::string& filter_expression,
+        const std::vector<std::string>& expression_parameters)
+{
+    return impl_->create_contentfilteredtopic(name, related_topic, filter_expression, expression_parameters);
+}
+
+ReturnCode_t DomainParticipant::delete_contentfilteredtopic(
+        const ContentFilteredTopic* a_contentfilteredtopic)
+{
+    return impl_->delete_contentfilteredtopic(a_contentfilteredtopic);
+}
+
 TopicDescription* DomainParticipant::lookup_topicdescription(
         const std::string& topic_name) const
 {
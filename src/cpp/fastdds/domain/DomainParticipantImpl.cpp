@@ -49,6 +49,7 @@
 
 #include <fastdds/publisher/PublisherImpl.hpp>
 #include <fastdds/subscriber/SubscriberImpl.hpp>
+#include <fastdds/topic/ContentFilteredTopicImpl.hpp>
 #include <fastdds/topic/TopicImpl.hpp>
 
 #include <rtps/RTPSDomainImpl.hpp>
@@ -221,6 +222,13 @@ DomainParticipantImpl::~DomainParticipantImpl()
     {
         std::lock_guard<std::mutex> lock(mtx_topics_);
 
+        // Content filtered topics reference their related topics, so they are deleted first
+        for (auto topic_it = filtered_topics_.begin(); topic_it != filtered_topics_.end(); ++topic_it)
+        {
+            delete topic_it->second;
+        }
+        filtered_topics_.clear();
+
         for (auto topic_it = topics_.begin(); topic_it != topics_.end(); ++topic_it)
         {
             delete topic_it->second;
@@ -442,6 +450,80 @@ ReturnCode_t DomainParticipantImpl::delete_topic(
     return ReturnCode_t::RETCODE_ERROR;
 }
 
+ContentFilteredTopic* DomainParticipantImpl::create_contentfilteredtopic(
+        const std::string& name,
+        Topic* related_topic,
+        const std::string& filter_expression,
+        const std::vector<std::string>& expression_parameters)
+{
+    if (related_topic == nullptr || participant_ != related_topic->get_participant())
+    {
+        logError(PARTICIPANT, "Related topic of " << name << " does not belong to this participant");
+        return nullptr;
+    }
+
+    if (name.size() > 255)
+    {
+        logError(PARTICIPANT, "ContentFilteredTopic name " << name << " is too long");
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx_topics_);
+
+    //Check there is no TopicDescription with the same name
+    if (topics_.find(name) != topics_.end() || filtered_topics_.find(name) != filtered_topics_.end())
+    {
+        logError(PARTICIPANT, "Topic with name : " << name << " already exists");
+        return nullptr;
+    }
+
+    ContentFilteredTopicImpl* topic_impl = new ContentFilteredTopicImpl(related_topic, filter_expression);
+    ContentFilteredTopic* topic = new ContentFilteredTopic(name, related_topic, topic_impl);
+    topic_impl->user_topic_ = topic;
+
+    if (ReturnCode_t::RETCODE_OK != topic_impl->compile(expression_parameters))
+    {
+        delete topic_impl;
+        return nullptr;
+    }
+
+    related_topic->get_impl()->reference();
+    filtered_topics_[name] = topic_impl;
+
+    return topic;
+}
+
+ReturnCode_t DomainParticipantImpl::delete_contentfilteredtopic(
+        const ContentFilteredTopic* topic)
+{
+    if (topic == nullptr)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    if (participant_ != topic->get_participant())
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx_topics_);
+    auto it = filtered_topics_.find(topic->get_name());
+
+    if (it != filtered_topics_.end() && topic == it->second->user_topic_)
+    {
+        if (it->second->is_referenced())
+        {
+            return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+        }
+        it->second->get_related_topic()->get_impl()->dereference();
+        delete it->second;
+        filtered_topics_.erase(it);
+        return ReturnCode_t::RETCODE_OK;
+    }
+
+    return ReturnCode_t::RETCODE_ERROR;
+}
+
 const InstanceHandle_t& DomainParticipantImpl::get_instance_handle() const
 {
     return static_cast<const InstanceHandle_t&>(guid_);
@@ -934,7 +1016,7 @@ Topic* DomainParticipantImpl::create_topic(
     std::lock_guard<std::mutex> lock(mtx_topics_);
 
     //Check there is no Topic with the same name
-    if (topics_.find(topic_name) != topics_.end())
+    if (topics_.find(topic_name) != topics_.end() || filtered_topics_.find(topic_name) != filtered_topics_.end())
     {
         logError(PARTICIPANT, "Topic with name : " << topic_name << " already exists");
         return nullptr;
@@ -995,6 +1077,13 @@ TopicDescription* DomainParticipantImpl::lookup_topicdescription(
         return it->second->user_topic_;
     }
 
+    auto filtered_it = filtered_topics_.find(topic_name);
+
+    if (filtered_it != filtered_topics_.end())
+    {
+        return filtered_it->second->user_topic_;
+    }
+
     return nullptr;
 }
 
@@ -1717,6 +1806,10 @@ bool DomainParticipantImpl::has_active_entities()
     {
         return true;
     }
+    if (!filtered_topics_.empty())
+    {
+        return true;
+    }
     return false;
 }
 
@@ -28,6 +28,7 @@
 #include <fastdds/dds/subscriber/qos/SubscriberQos.hpp>
 #include <fastdds/dds/domain/qos/DomainParticipantQos.hpp>
 #include <fastdds/dds/topic/qos/TopicQos.hpp>
+#include <fastdds/dds/topic/ContentFilteredTopic.hpp>
 #include <fastdds/dds/topic/Topic.hpp>
 
 #include <fastdds/dds/topic/TypeSupport.hpp>
@@ -55,6 +56,7 @@ class SubscriberAttributes;
 namespace fastdds {
 namespace dds {
 
+class ContentFilteredTopicImpl;
 class DomainParticipant;
 class DomainParticipantListener;
 class Publisher;
@@ -196,6 +198,23 @@ public:
     ReturnCode_t delete_topic(
             Topic* topic);
 
+    /**
+     * Create a ContentFilteredTopic in this Participant.
+     * @param name Name of the ContentFilteredTopic.
+     * @param related_topic Topic being filtered.
+     * @param filter_expression DDS-SQL filter expression.
+     * @param expression_parameters Values of the parameters of the expression.
+     * @return Pointer to the created ContentFilteredTopic, nullptr on error.
+     */
+    ContentFilteredTopic* create_contentfilteredtopic(
+            const std::string& name,
+            Topic* related_topic,
+            const std::string& filter_expression,
+            const std::vector<std::string>& expression_parameters);
+
+    ReturnCode_t delete_contentfilteredtopic(
+            const ContentFilteredTopic* topic);
+
     /**
      * Looks up an existing, locally created @ref TopicDescription, based on its name.
      * May be called on a disabled participant.
@@ -437,6 +456,8 @@ protected:
     //!Topic map
     std::map<std::string, TopicImpl*> topics_;
     std::map<fastrtps::rtps::InstanceHandle_t, Topic*> topics_by_handle_;
+    //!ContentFilteredTopic map, protected by mtx_topics_ as well
+    std::map<std::string, ContentFilteredTopicImpl*> filtered_topics_;
     mutable std::mutex mtx_topics_;
 
     TopicQos default_topic_qos_;
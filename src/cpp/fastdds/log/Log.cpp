@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <chrono>
+#include <cstring>
 #include <iomanip>
 #include <mutex>
 
@@ -23,6 +24,8 @@
 #include <fastdds/dds/log/Colors.hpp>
 #include <iostream>
 
+#include "LogRing.hpp"
+
 using namespace std;
 namespace eprosima {
 namespace fastdds {
@@ -31,11 +34,14 @@ namespace dds {
 struct Log::Resources Log::resources_;
 
 Log::Resources::Resources()
-    : logging(false)
+    : ring(nullptr)
+    , dropped_entries(0)
+    , logging(false)
     , work(false)
     , current_loop(0)
     , filenames(false)
     , functions(true)
+    , coalesce_duplicates(false)
     , verbosity(Log::Error)
 {
 #if STDOUTERR_LOG_CONSUMER
@@ -63,7 +69,7 @@ void Log::ClearConsumers()
     resources_.cv.wait(working,
             [&]()
             {
-                return resources_.logs.BothEmpty();
+                return queues_empty();
             });
     std::unique_lock<std::mutex> guard(resources_.config_mutex);
     resources_.consumers.clear();
@@ -77,6 +83,8 @@ void Log::Reset()
     resources_.error_string_filter.reset();
     resources_.filenames = false;
     resources_.functions = true;
+    resources_.coalesce_duplicates = false;
+    resources_.ring = nullptr;
     resources_.verbosity = Log::Error;
     resources_.consumers.clear();
 #if STDOUTERR_LOG_CONSUMER
@@ -113,11 +121,11 @@ void Log::Flush()
                 {
                     /* I must avoid:
                      + the two calls be processed without an intermediate Run() loop (by using last_loop sequence number)
-                     + deadlock by absence of Run() loop activity (by using BothEmpty() call)
+                     + deadlock by absence of Run() loop activity (by using queues_empty() call)
                      */
                     return !resources_.logging ||
                     ( resources_.logs.Empty() &&
-                    ( last_loop != resources_.current_loop || resources_.logs.BothEmpty()));
+                    ( last_loop != resources_.current_loop || queues_empty()));
                 });
 
         last_loop = resources_.current_loop;
@@ -125,6 +133,51 @@ void Log::Flush()
     }
 }
 
+bool Log::queues_empty()
+{
+    if (!resources_.logs.BothEmpty())
+    {
+        return false;
+    }
+
+    std::unique_lock<std::mutex> configGuard(resources_.config_mutex);
+    for (const auto& ring : resources_.rings)
+    {
+        if (!ring->empty())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool is_duplicate(
+        const Log::Entry& previous,
+        const Log::Entry& entry)
+{
+    auto same_string = [](const char* a, const char* b)
+            {
+                return a == b || (a != nullptr && b != nullptr && strcmp(a, b) == 0);
+            };
+
+    return previous.kind == entry.kind &&
+           previous.context.line == entry.context.line &&
+           same_string(previous.context.category, entry.context.category) &&
+           same_string(previous.context.filename, entry.context.filename) &&
+           same_string(previous.context.function, entry.context.function) &&
+           previous.message == entry.message;
+}
+
+void Log::consume(
+        Log::Entry& entry)
+{
+    get_timestamp(entry.time, entry.timestamp);
+    for (auto& consumer : resources_.consumers)
+    {
+        consumer->Consume(entry);
+    }
+}
+
 void Log::run()
 {
     std::unique_lock<std::mutex> guard(resources_.cv_mutex);
@@ -137,24 +190,82 @@ void Log::run()
                     return !resources_.logging || resources_.work;
                 });
 
+        // Must be cleared before swapping, so producers queueing after the swap signal a new loop.
         resources_.work = false;
 
         guard.unlock();
         {
             resources_.logs.Swap();
+
+            // Pending entry and number of times it has been consecutively logged (coalescing only)
+            Log::Entry pending;
+            uint32_t repetitions = 0;
+
+            auto flush_pending = [&]()
+                    {
+                        if (repetitions > 1)
+                        {
+                            pending.message += " [repeated " + std::to_string(repetitions) + " times]";
+                        }
+                        if (repetitions > 0)
+                        {
+                            consume(pending);
+                        }
+                        repetitions = 0;
+                    };
+
+            // Called with config_mutex locked
+            auto process = [&](Log::Entry& entry)
+                    {
+                        if (preprocess(entry))
+                        {
+                            if (!resources_.coalesce_duplicates)
+                            {
+                                flush_pending();
+                                consume(entry);
+                            }
+                            else if (repetitions > 0 && is_duplicate(pending, entry))
+                            {
+                                ++repetitions;
+                            }
+                            else
+                            {
+                                flush_pending();
+                                pending = std::move(entry);
+                                repetitions = 1;
+                            }
+                        }
+                    };
+
             while (!resources_.logs.Empty())
             {
                 std::unique_lock<std::mutex> configGuard(resources_.config_mutex);
-                if (preprocess(resources_.logs.Front()))
+                process(resources_.logs.Front());
+                resources_.logs.Pop();
+            }
+
+            // Replaced rings are drained too, as their producers may have queued entries before the replacement
+            Log::Entry ring_entry;
+            size_t ring_index = 0;
+            for (;;)
+            {
+                std::unique_lock<std::mutex> configGuard(resources_.config_mutex);
+                if (ring_index >= resources_.rings.size())
                 {
-                    for (auto& consumer : resources_.consumers)
-                    {
-                        consumer->Consume(resources_.logs.Front());
-                    }
+                    break;
+                }
+                if (resources_.rings[ring_index]->pop(ring_entry))
+                {
+                    process(ring_entry);
+                }
+                else
+                {
+                    ++ring_index;
                 }
-
-                resources_.logs.Pop();
             }
+
+            std::unique_lock<std::mutex> configGuard(resources_.config_mutex);
+            flush_pending();
         }
         guard.lock();
 
@@ -182,6 +293,42 @@ void Log::ReportFunctions(
     resources_.functions = report;
 }
 
+void Log::CoalesceDuplicates(
+        bool coalesce)
+{
+    std::unique_lock<std::mutex> configGuard(resources_.config_mutex);
+    resources_.coalesce_duplicates = coalesce;
+}
+
+void Log::UseRingBuffer(
+        size_t capacity)
+{
+    std::unique_lock<std::mutex> configGuard(resources_.config_mutex);
+    if (0 == capacity)
+    {
+        resources_.ring = nullptr;
+        return;
+    }
+
+    // The rings are never destroyed while logging, so an existing one of the same capacity is reused
+    for (const auto& ring : resources_.rings)
+    {
+        if (ring->capacity() >= capacity && ring->capacity() < 2 * capacity)
+        {
+            resources_.ring = ring.get();
+            return;
+        }
+    }
+
+    resources_.rings.emplace_back(new LogRing(capacity));
+    resources_.ring = resources_.rings.back().get();
+}
+
+uint64_t Log::DroppedEntries()
+{
+    return resources_.dropped_entries;
+}
+
 bool Log::preprocess(
         Log::Entry& entry)
 {
@@ -235,6 +382,7 @@ void Log::QueueLog(
         const Log::Context& context,
         Log::Kind kind)
 {
+    if (!resources_.logging)
     {
         std::unique_lock<std::mutex> guard(resources_.cv_mutex);
         if (!resources_.logging && !resources_.logging_thread)
@@ -244,14 +392,27 @@ void Log::QueueLog(
         }
     }
 
-    std::string timestamp;
-    get_timestamp(timestamp);
-    resources_.logs.Push(Log::Entry{message, context, kind, timestamp});
+    // Timestamp formatting is deferred to the logging thread
+    LogRing* ring = resources_.ring;
+    if (nullptr == ring)
     {
-        std::unique_lock<std::mutex> guard(resources_.cv_mutex);
-        resources_.work = true;
+        resources_.logs.Push(Log::Entry{message, context, kind, std::string(), std::chrono::system_clock::now()});
+    }
+    else if (!ring->push(message, context, kind, std::chrono::system_clock::now()))
+    {
+        ++resources_.dropped_entries;
+    }
+
+    // Only the producer raising the work flag wakes up the logging thread. The rest of the entries pushed
+    // before the logging thread swaps the queues are processed on the same loop.
+    if (!resources_.work.exchange(true))
+    {
+        {
+            // Synchronize with the wait predicate, so the notification cannot be lost
+            std::unique_lock<std::mutex> guard(resources_.cv_mutex);
+        }
+        resources_.cv.notify_all();
     }
-    resources_.cv.notify_all();
 }
 
 Log::Kind Log::GetVerbosity()
@@ -288,10 +449,10 @@ void Log::SetErrorStringFilter(
 }
 
 void Log::get_timestamp(
+        const std::chrono::system_clock::time_point& now,
         std::string& timestamp)
 {
     std::stringstream stream;
-    auto now = std::chrono::system_clock::now();
     std::time_t now_c = std::chrono::system_clock::to_time_t(now);
     std::chrono::system_clock::duration tp = now.time_since_epoch();
     tp -= std::chrono::duration_cast<std::chrono::seconds>(tp);
@@ -0,0 +1,184 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LogRing.hpp
+ *
+ */
+
+#ifndef _FASTDDS_LOG_LOGRING_HPP_
+#define _FASTDDS_LOG_LOGRING_HPP_
+
+#include <fastdds/dds/log/Log.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+/**
+ * Preallocated ring of fixed-size log entries for MPSC (multi-producer, single-consumer) comms.
+ * Producers claim a slot with a compare and swap, so they never block nor allocate. When the ring is full, the
+ * entry is rejected instead of waiting for the consumer.
+ */
+class LogRing
+{
+public:
+
+    //! Maximum length of a message on the ring. Longer messages are truncated.
+    static constexpr size_t max_message_size = 256;
+
+    /**
+     * LogRing constructor.
+     * @param capacity Number of entries of the ring, rounded up to a power of two.
+     */
+    explicit LogRing(
+            size_t capacity)
+    {
+        size_t size = 1;
+        while (size < capacity)
+        {
+            size <<= 1;
+        }
+
+        slots_.reset(new Slot[size]);
+        mask_ = size - 1;
+        for (size_t i = 0; i < size; ++i)
+        {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        enqueue_pos_.store(0, std::memory_order_relaxed);
+        dequeue_pos_.store(0, std::memory_order_relaxed);
+    }
+
+    //! Number of entries of the ring.
+    size_t capacity() const
+    {
+        return mask_ + 1;
+    }
+
+    /**
+     * Copies an entry on the ring. Can be called from any thread.
+     * @return false if the ring is full.
+     */
+    bool push(
+            const std::string& message,
+            const Log::Context& context,
+            Log::Kind kind,
+            const std::chrono::system_clock::time_point& time)
+    {
+        Slot* slot = nullptr;
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            slot = &slots_[pos & mask_];
+            size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0)
+            {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // The consumer has not released this slot yet
+                return false;
+            }
+            else
+            {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->context = context;
+        slot->kind = kind;
+        slot->time = time;
+        if (message.size() <= max_message_size)
+        {
+            slot->length = static_cast<uint32_t>(message.size());
+            memcpy(slot->message, message.data(), slot->length);
+        }
+        else
+        {
+            slot->length = static_cast<uint32_t>(max_message_size);
+            memcpy(slot->message, message.data(), max_message_size - 3);
+            memcpy(&slot->message[max_message_size - 3], "...", 3);
+        }
+
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Moves the oldest entry out of the ring. Should only be called from the consumer thread.
+     * @return false if the ring is empty, or its oldest entry is still being copied.
+     */
+    bool pop(
+            Log::Entry& entry)
+    {
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[pos & mask_];
+        if (slot.sequence.load(std::memory_order_acquire) != pos + 1)
+        {
+            return false;
+        }
+
+        entry.message.assign(slot.message, slot.length);
+        entry.context = slot.context;
+        entry.kind = slot.kind;
+        entry.timestamp.clear();
+        entry.time = slot.time;
+
+        slot.sequence.store(pos + mask_ + 1, std::memory_order_release);
+        dequeue_pos_.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    //! Reports whether the ring is empty, including entries still being copied by their producers.
+    bool empty() const
+    {
+        return dequeue_pos_.load(std::memory_order_acquire) == enqueue_pos_.load(std::memory_order_acquire);
+    }
+
+private:
+
+    struct Slot
+    {
+        std::atomic<size_t> sequence;
+        Log::Context context;
+        Log::Kind kind;
+        std::chrono::system_clock::time_point time;
+        uint32_t length;
+        char message[max_message_size];
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    size_t mask_;
+    std::atomic<size_t> enqueue_pos_;
+    std::atomic<size_t> dequeue_pos_;
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_LOG_LOGRING_HPP_
@@ -28,6 +28,7 @@
 
 #include <fastdds/rtps/writer/RTPSWriter.h>
 #include <fastdds/rtps/writer/StatefulWriter.h>
+#include <fastdds/rtps/builtin/data/ReaderProxyData.h>
 
 #include <fastdds/dds/domain/DomainParticipant.hpp>
 #include <fastdds/rtps/participant/RTPSParticipant.h>
@@ -38,7 +39,10 @@
 #include <fastdds/rtps/resources/ResourceEvent.h>
 #include <fastdds/rtps/resources/TimedEvent.h>
 #include <fastdds/rtps/builtin/liveliness/WLP.h>
+#include <fastdds/core/condition/StatusConditionImpl.hpp>
 #include <fastdds/core/policy/ParameterSerializer.hpp>
+#include <fastdds/publisher/IntraprocessSample.hpp>
+#include <fastrtps/xmlparser/XMLProfileManager.h>
 
 #include <rtps/history/TopicPayloadPoolRegistry.hpp>
 
@@ -93,6 +97,10 @@ ReturnCode_t DataWriterImpl::enable()
     w_att.endpoint.unicastLocatorList = qos_.endpoint().unicast_locator_list;
     w_att.endpoint.remoteLocatorList = qos_.endpoint().remote_locator_list;
     w_att.mode = qos_.publish_mode().kind == SYNCHRONOUS_PUBLISH_MODE ? SYNCHRONOUS_WRITER : ASYNCHRONOUS_WRITER;
+    w_att.batch.enabled = qos_.batch().enable;
+    w_att.batch.max_samples = qos_.batch().max_samples;
+    w_att.batch.max_bytes = qos_.batch().max_data_bytes;
+    w_att.batch.max_flush_delay = qos_.batch().max_flush_delay;
     w_att.endpoint.properties = qos_.properties();
 
     if (qos_.endpoint().entity_id > 0)
@@ -155,9 +163,23 @@ ReturnCode_t DataWriterImpl::enable()
 
     writer_ = writer;
 
+    // Let the writer skip the samples that do not pass the content filter of a reliable reader
+    StatefulWriter* stateful_writer = dynamic_cast<StatefulWriter*>(writer_);
+    if (stateful_writer != nullptr)
+    {
+        reader_filters_.reset(new ReaderFilterCollection(type_));
+        stateful_writer->reader_data_filter(reader_filters_.get());
+    }
+
     // In case it has been loaded from the persistence DB, rebuild instances on history
     history_.rebuild_instances();
 
+    // Samples can be shared with local readers, and serialized later for remote ones. Persistent writers always
+    // need the serialized data.
+    share_intraprocess_samples_ =
+            xmlparser::XMLProfileManager::library_settings().intraprocess_delivery != INTRAPROCESS_OFF &&
+            qos_.durability().kind < TRANSIENT_DURABILITY_QOS;
+
     //TODO(Ricardo) This logic in a class. Then a user of rtps layer can use it.
     if (high_mark_for_frag_ == 0)
     {
@@ -460,8 +482,17 @@ bool DataWriterImpl::perform_create_new_change(
         {
             if (change_kind == ALIVE)
             {
+                // When all the matched readers are local, they receive a copy of the sample, which is only
+                // serialized if a remote reader appears while the change is on the history.
+                if (share_intraprocess_samples_ && writer_->matched_readers_are_local())
+                {
+                    ch->intraprocess_sample = IntraprocessSample::create(type_, data, high_mark_for_frag_);
+                    // Stop trying with types that cannot copy samples
+                    share_intraprocess_samples_ = static_cast<bool>(ch->intraprocess_sample);
+                }
+
                 //If these two checks are correct, we asume the cachechange is valid and thwn we can write to it.
-                if (!type_->serialize(data, &ch->serializedPayload))
+                if (!ch->intraprocess_sample && !type_->serialize(data, &ch->serializedPayload))
                 {
                     logWarning(RTPS_WRITER, "RTPSWriter:Serialization returns false"; );
                     writer_->release_change(ch);
@@ -677,9 +708,13 @@ void DataWriterImpl::InnerDataWriterListener::onWriterMatched(
         RTPSWriter* /*writer*/,
         const PublicationMatchedStatus& info)
 {
+    detail::StatusConditionImpl* writer_status = data_writer_->user_datawriter_->get_statuscondition().get_impl();
+    writer_status->set_status(StatusMask::publication_matched(), true);
+
     DataWriterListener* listener = data_writer_->get_listener_for(StatusMask::publication_matched());
     if (listener != nullptr)
     {
+        writer_status->set_status(StatusMask::publication_matched(), false);
         listener->on_publication_matched(data_writer_->user_datawriter_, info);
     }
 }
@@ -689,6 +724,8 @@ void DataWriterImpl::InnerDataWriterListener::on_offered_incompatible_qos(
         fastdds::dds::PolicyMask qos)
 {
     data_writer_->update_offered_incompatible_qos(qos);
+    data_writer_->user_datawriter_->get_statuscondition().get_impl()->set_status(
+        StatusMask::offered_incompatible_qos(), true);
     DataWriterListener* listener = data_writer_->get_listener_for(StatusMask::offered_incompatible_qos());
     if (listener != nullptr)
     {
@@ -720,6 +757,8 @@ void DataWriterImpl::InnerDataWriterListener::on_liveliness_lost(
         fastrtps::rtps::RTPSWriter* /*writer*/,
         const fastrtps::LivelinessLostStatus& status)
 {
+    data_writer_->user_datawriter_->get_statuscondition().get_impl()->set_status(
+        StatusMask::liveliness_lost(), true);
     DataWriterListener* listener = data_writer_->get_listener_for(StatusMask::liveliness_lost());
     if (listener != nullptr)
     {
@@ -728,6 +767,30 @@ void DataWriterImpl::InnerDataWriterListener::on_liveliness_lost(
     }
 }
 
+void DataWriterImpl::InnerDataWriterListener::on_reader_discovery(
+        fastrtps::rtps::RTPSWriter* /*writer*/,
+        fastrtps::rtps::ReaderDiscoveryInfo::DISCOVERY_STATUS reason,
+        const fastrtps::rtps::GUID_t& reader_guid,
+        const fastrtps::rtps::ReaderProxyData* reader_info)
+{
+    if (!data_writer_->reader_filters_)
+    {
+        return;
+    }
+
+    switch (reason)
+    {
+        case fastrtps::rtps::ReaderDiscoveryInfo::DISCOVERED_READER:
+        case fastrtps::rtps::ReaderDiscoveryInfo::CHANGED_QOS_READER:
+            data_writer_->reader_filters_->update_reader(reader_guid, &reader_info->content_filter());
+            break;
+
+        case fastrtps::rtps::ReaderDiscoveryInfo::REMOVED_READER:
+            data_writer_->reader_filters_->remove_reader(reader_guid);
+            break;
+    }
+}
+
 ReturnCode_t DataWriterImpl::wait_for_acknowledgments(
         const Duration_t& max_wait)
 {
@@ -770,6 +833,7 @@ bool DataWriterImpl::deadline_missed()
     deadline_missed_status_.total_count++;
     deadline_missed_status_.total_count_change++;
     deadline_missed_status_.last_instance_handle = timer_owner_;
+    user_datawriter_->get_statuscondition().get_impl()->set_status(StatusMask::offered_deadline_missed(), true);
     if (listener_ != nullptr)
     {
         listener_->on_offered_deadline_missed(user_datawriter_, deadline_missed_status_);
@@ -799,6 +863,7 @@ ReturnCode_t DataWriterImpl::get_offered_deadline_missed_status(
 
     status = deadline_missed_status_;
     deadline_missed_status_.total_count_change = 0;
+    user_datawriter_->get_statuscondition().get_impl()->set_status(StatusMask::offered_deadline_missed(), false);
     return ReturnCode_t::RETCODE_OK;
 }
 
@@ -814,6 +879,7 @@ ReturnCode_t DataWriterImpl::get_offered_incompatible_qos_status(
 
     status = offered_incompatible_qos_status_;
     offered_incompatible_qos_status_.total_count_change = 0u;
+    user_datawriter_->get_statuscondition().get_impl()->set_status(StatusMask::offered_incompatible_qos(), false);
     return ReturnCode_t::RETCODE_OK;
 }
 
@@ -873,6 +939,7 @@ ReturnCode_t DataWriterImpl::get_liveliness_lost_status(
     status.total_count_change = writer_->liveliness_lost_status_.total_count_change;
 
     writer_->liveliness_lost_status_.total_count_change = 0u;
+    user_datawriter_->get_statuscondition().get_impl()->set_status(StatusMask::liveliness_lost(), false);
 
     return ReturnCode_t::RETCODE_OK;
 }
@@ -1035,6 +1102,10 @@ void DataWriterImpl::set_qos(
     {
         to.publish_mode() = from.publish_mode();
     }
+    if (is_default && !(to.batch() == from.batch()))
+    {
+        to.batch() = from.batch();
+    }
     if (!(to.representation() == from.representation()))
     {
         to.representation() = from.representation();
@@ -1137,6 +1208,11 @@ bool DataWriterImpl::can_qos_be_updated(
         updatable = false;
         logWarning(RTPS_QOS_CHECK, "Destination order Kind cannot be changed after the creation of a DataWriter.");
     }
+    if (!(to.batch() == from.batch()))
+    {
+        updatable = false;
+        logWarning(RTPS_QOS_CHECK, "Batch Qos cannot be changed after the creation of a DataWriter.");
+    }
     return updatable;
 }
 
@@ -39,6 +39,7 @@
 
 #include <fastrtps/types/TypesBase.h>
 
+#include <fastdds/publisher/ReaderFilterCollection.hpp>
 #include <rtps/history/ITopicPayloadPool.h>
 
 using eprosima::fastrtps::types::ReturnCode_t;
@@ -71,6 +72,7 @@ class DataWriterImpl
 protected:
 
     friend class PublisherImpl;
+    friend class IntraprocessSample;
 
     /**
      * Create a data writer, assigning its pointer to the associated writer.
@@ -278,6 +280,12 @@ protected:
                 fastrtps::rtps::RTPSWriter* writer,
                 const fastrtps::LivelinessLostStatus& status) override;
 
+        void on_reader_discovery(
+                fastrtps::rtps::RTPSWriter* writer,
+                fastrtps::rtps::ReaderDiscoveryInfo::DISCOVERY_STATUS reason,
+                const fastrtps::rtps::GUID_t& reader_guid,
+                const fastrtps::rtps::ReaderProxyData* reader_info) override;
+
         DataWriterImpl* data_writer_;
     }
     writer_listener_;
@@ -309,6 +317,12 @@ protected:
 
     std::shared_ptr<ITopicPayloadPool> payload_pool_;
 
+    //! Content filters of the matched readers, applied when the RTPS writer is stateful
+    std::unique_ptr<ReaderFilterCollection> reader_filters_;
+
+    //! Whether written samples may be shared with local readers instead of being serialized
+    bool share_intraprocess_samples_ = false;
+
     /**
      *
      * @param kind
@@ -405,7 +419,7 @@ protected:
     DataWriterListener* get_listener_for(
             const StatusMask& status);
 
-    void set_fragment_size_on_change(
+    static void set_fragment_size_on_change(
             fastrtps::rtps::WriteParams& wparams,
             fastrtps::rtps::CacheChange_t* ch,
             const uint32_t& high_mark_for_frag);
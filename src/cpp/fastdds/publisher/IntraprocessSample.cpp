@@ -0,0 +1,131 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file IntraprocessSample.cpp
+ */
+
+#include <fastdds/publisher/IntraprocessSample.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/publisher/DataWriterImpl.hpp>
+
+#include <cstring>
+#include <typeinfo>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+using fastrtps::rtps::CacheChange_t;
+using fastrtps::rtps::SerializedPayload_t;
+
+std::shared_ptr<IntraprocessSample> IntraprocessSample::create(
+        const TypeSupport& type,
+        const void* data,
+        uint32_t high_mark_for_frag)
+{
+    void* copy = type->createData();
+    if (copy == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (!type->copy_sample(data, copy))
+    {
+        type->deleteData(copy);
+        return nullptr;
+    }
+
+    return std::shared_ptr<IntraprocessSample>(new IntraprocessSample(type, copy, high_mark_for_frag));
+}
+
+IntraprocessSample::IntraprocessSample(
+        const TypeSupport& type,
+        void* data,
+        uint32_t high_mark_for_frag)
+    : type_(type)
+    , data_(data)
+    , high_mark_for_frag_(high_mark_for_frag)
+{
+}
+
+IntraprocessSample::~IntraprocessSample()
+{
+    type_->deleteData(data_);
+}
+
+bool IntraprocessSample::serialize(
+        CacheChange_t& change) const
+{
+    if (!serialize_to(change.serializedPayload))
+    {
+        return false;
+    }
+
+    // Fragmentation could not be decided until the serialized size was known
+    DataWriterImpl::set_fragment_size_on_change(change.write_params, &change, high_mark_for_frag_);
+    return true;
+}
+
+bool IntraprocessSample::copy_to(
+        TopicDataType* type,
+        void* data) const
+{
+    // Samples can only be copied between instances of the same type support
+    bool same_type = type == type_.get() ||
+            (typeid(*type) == typeid(*type_.get()) && strcmp(type->getName(), type_->getName()) == 0);
+    if (same_type && type->copy_sample(data_, data))
+    {
+        return true;
+    }
+
+    SerializedPayload_t payload(type_->getSerializedSizeProvider(data_)());
+    return serialize_to(payload) && type->deserialize(&payload, data);
+}
+
+const SerializedPayload_t& IntraprocessSample::payload_of(
+        const CacheChange_t& change,
+        SerializedPayload_t& scratch)
+{
+    if (0 == change.serializedPayload.length && change.intraprocess_sample)
+    {
+        const IntraprocessSample* sample = dynamic_cast<const IntraprocessSample*>(change.intraprocess_sample.get());
+        if (sample != nullptr)
+        {
+            scratch.reserve(sample->type_->getSerializedSizeProvider(sample->data_)());
+            if (sample->serialize_to(scratch))
+            {
+                return scratch;
+            }
+        }
+    }
+
+    return change.serializedPayload;
+}
+
+bool IntraprocessSample::serialize_to(
+        SerializedPayload_t& payload) const
+{
+    if (!type_->serialize(data_, &payload))
+    {
+        logWarning(DATA_WRITER, "Serialization of a shared sample of type " << type_->getName() << " failed");
+        return false;
+    }
+    return true;
+}
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,106 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file IntraprocessSample.hpp
+ */
+
+#ifndef _FASTDDS_PUBLISHER_INTRAPROCESSSAMPLE_HPP_
+#define _FASTDDS_PUBLISHER_INTRAPROCESSSAMPLE_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/IIntraprocessSample.hpp>
+#include <fastdds/rtps/common/SerializedPayload.h>
+
+#include <memory>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+/**
+ * Copy of a sample written by a DataWriter, shared with the DataReaders on the same process.
+ *
+ * The copy is never modified after creation, so it can be read from any thread. It keeps a reference to the
+ * TypeSupport that created it, as readers may keep it after the writer is gone.
+ */
+class IntraprocessSample : public fastdds::rtps::IIntraprocessSample
+{
+public:
+
+    /**
+     * Create a copy of a user sample.
+     * @param type TypeSupport of the sample.
+     * @param data Pointer to the sample to copy.
+     * @param high_mark_for_frag Payload size above which the change is fragmented once serialized.
+     * @return The shared copy, or nullptr if the type does not support copying samples.
+     */
+    static std::shared_ptr<IntraprocessSample> create(
+            const TypeSupport& type,
+            const void* data,
+            uint32_t high_mark_for_frag);
+
+    ~IntraprocessSample();
+
+    bool serialize(
+            fastrtps::rtps::CacheChange_t& change) const override;
+
+    /**
+     * Fill a user sample from a change carrying a shared sample.
+     * The shared sample is copied when the reader uses the same type as the writer. Otherwise it is serialized
+     * and deserialized with the type of the reader.
+     * @param type Type of the reader.
+     * @param data Pointer to the user sample to fill.
+     * @return true on success.
+     */
+    bool copy_to(
+            TopicDataType* type,
+            void* data) const;
+
+    /**
+     * Get the serialized payload of a change. Changes only carrying a shared sample are serialized into
+     * @c scratch, leaving the change untouched.
+     * @param change The change whose payload is needed.
+     * @param scratch Payload where the shared sample is serialized if needed.
+     * @return Reference to the payload to use.
+     */
+    static const fastrtps::rtps::SerializedPayload_t& payload_of(
+            const fastrtps::rtps::CacheChange_t& change,
+            fastrtps::rtps::SerializedPayload_t& scratch);
+
+private:
+
+    IntraprocessSample(
+            const TypeSupport& type,
+            void* data,
+            uint32_t high_mark_for_frag);
+
+    bool serialize_to(
+            fastrtps::rtps::SerializedPayload_t& payload) const;
+
+    TypeSupport type_;
+
+    void* data_;
+
+    uint32_t high_mark_for_frag_;
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _FASTDDS_PUBLISHER_INTRAPROCESSSAMPLE_HPP_
@@ -76,6 +76,7 @@ static void set_qos_from_attributes(
     qos.destination_order() = attr.qos.m_destinationOrder;
     qos.representation() = attr.qos.representation;
     qos.publish_mode() = attr.qos.m_publishMode;
+    qos.batch() = attr.qos.m_batch;
     qos.history() = attr.topic.historyQos;
     qos.resource_limits() = attr.topic.resourceLimitsQos;
 }
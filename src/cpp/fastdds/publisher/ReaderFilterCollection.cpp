@@ -0,0 +1,146 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReaderFilterCollection.cpp
+ */
+
+#include <fastdds/publisher/ReaderFilterCollection.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+
+#include <cstring>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+using fastrtps::rtps::CacheChange_t;
+using fastrtps::rtps::GUID_t;
+
+ReaderFilterCollection::ReaderFilterCollection(
+        const TypeSupport& type)
+    : type_(type)
+{
+}
+
+bool ReaderFilterCollection::is_relevant(
+        const CacheChange_t& change,
+        const GUID_t& reader_guid) const
+{
+    // Only samples are filtered, so readers always know about the lifecycle of the instances
+    if (fastrtps::rtps::ALIVE != change.kind)
+    {
+        return true;
+    }
+
+    // Samples shared with local readers are not serialized here, so those readers filter them on reception
+    if (0 == change.serializedPayload.length && change.intraprocess_sample)
+    {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = readers_.find(reader_guid);
+    if (it == readers_.end())
+    {
+        return true;
+    }
+
+    CompiledFilter& filter = *it->second;
+    if (filter.last_sequence != change.sequenceNumber)
+    {
+        filter.last_result = filter.expression.evaluate(change.serializedPayload);
+        filter.last_sequence = change.sequenceNumber;
+    }
+    return filter.last_result;
+}
+
+void ReaderFilterCollection::update_reader(
+        const GUID_t& reader_guid,
+        const fastdds::rtps::ContentFilterProperty* filter)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::shared_ptr<CompiledFilter> compiled;
+    if (filter != nullptr && filter->is_set())
+    {
+        if (0 != std::strcmp(filter->filter_class_name.c_str(),
+                DDSSQLFilter::DDSFilterExpression::filter_class_name))
+        {
+            logWarning(CONTENT_FILTER, "Filter class " << filter->filter_class_name.c_str() << " of reader "
+                                                       << reader_guid << " is not supported. It will be filtered by the reader");
+        }
+        else
+        {
+            compiled = get_filter(*filter);
+        }
+    }
+
+    if (compiled)
+    {
+        readers_[reader_guid] = compiled;
+    }
+    else
+    {
+        readers_.erase(reader_guid);
+    }
+}
+
+void ReaderFilterCollection::remove_reader(
+        const GUID_t& reader_guid)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    readers_.erase(reader_guid);
+}
+
+std::shared_ptr<ReaderFilterCollection::CompiledFilter> ReaderFilterCollection::get_filter(
+        const fastdds::rtps::ContentFilterProperty& filter)
+{
+    // Remove the entries of the filters no longer used
+    for (auto it = filters_.begin(); it != filters_.end();)
+    {
+        it = it->second.expired() ? filters_.erase(it) : std::next(it);
+    }
+
+    FilterKey key(filter.filter_expression, filter.expression_parameters);
+    std::shared_ptr<CompiledFilter> compiled = filters_[key].lock();
+    if (compiled)
+    {
+        return compiled;
+    }
+
+    if (!type_resolved_)
+    {
+        dynamic_type_ = DDSSQLFilter::DDSFilterExpression::get_dynamic_type(type_);
+        type_resolved_ = true;
+    }
+
+    compiled = std::make_shared<CompiledFilter>();
+    if (!dynamic_type_ ||
+            ReturnCode_t::RETCODE_OK != compiled->expression.compile(dynamic_type_, filter.filter_expression,
+            filter.expression_parameters))
+    {
+        // The reader will evaluate its filter itself
+        filters_.erase(key);
+        return nullptr;
+    }
+
+    filters_[key] = compiled;
+    return compiled;
+}
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,107 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReaderFilterCollection.hpp
+ */
+
+#ifndef _FASTDDS_PUBLISHER_READERFILTERCOLLECTION_HPP_
+#define _FASTDDS_PUBLISHER_READERFILTERCOLLECTION_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/ContentFilterProperty.hpp>
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/writer/IReaderDataFilter.hpp>
+#include <fastrtps/types/DynamicTypePtr.h>
+
+#include <fastdds/topic/DDSSQLFilter/DDSFilterExpression.hpp>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+/**
+ * Filters applied by a DataWriter on behalf of the matched readers that announced a content filter.
+ *
+ * Readers announcing the same filter share the same compiled expression, and the result of the last
+ * evaluated change is kept, so each change is evaluated once per distinct filter.
+ */
+class ReaderFilterCollection : public fastdds::rtps::IReaderDataFilter
+{
+public:
+
+    /**
+     * @param type TypeSupport of the topic of the writer.
+     */
+    explicit ReaderFilterCollection(
+            const TypeSupport& type);
+
+    bool is_relevant(
+            const fastrtps::rtps::CacheChange_t& change,
+            const fastrtps::rtps::GUID_t& reader_guid) const override;
+
+    /**
+     * Updates the filter applied for a matched reader.
+     * @param reader_guid GUID of the reader.
+     * @param filter Content filter announced by the reader, nullptr if it does not filter.
+     */
+    void update_reader(
+            const fastrtps::rtps::GUID_t& reader_guid,
+            const fastdds::rtps::ContentFilterProperty* filter);
+
+    /**
+     * Stops applying the filter of a reader.
+     * @param reader_guid GUID of the reader.
+     */
+    void remove_reader(
+            const fastrtps::rtps::GUID_t& reader_guid);
+
+private:
+
+    struct CompiledFilter
+    {
+        DDSSQLFilter::DDSFilterExpression expression;
+        //! Last change evaluated with this filter
+        fastrtps::rtps::SequenceNumber_t last_sequence;
+        bool last_result = true;
+    };
+
+    using FilterKey = std::pair<std::string, std::vector<std::string>>;
+
+    std::shared_ptr<CompiledFilter> get_filter(
+            const fastdds::rtps::ContentFilterProperty& filter);
+
+    TypeSupport type_;
+    bool type_resolved_ = false;
+    fastrtps::types::DynamicType_ptr dynamic_type_;
+
+    mutable std::mutex mutex_;
+    std::map<fastrtps::rtps::GUID_t, std::shared_ptr<CompiledFilter>> readers_;
+    std::map<FilterKey, std::weak_ptr<CompiledFilter>> filters_;
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _FASTDDS_PUBLISHER_READERFILTERCOLLECTION_HPP_
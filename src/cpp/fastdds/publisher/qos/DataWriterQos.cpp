@@ -48,6 +48,7 @@ WriterQos DataWriterQos::get_writerqos(
     qos.m_partition = pqos.partition();
     qos.m_presentation = pqos.presentation();
     qos.m_publishMode = publish_mode();
+    qos.m_batch = batch();
     qos.m_reliability = reliability();
     qos.m_topicData = tqos.topic_data();
     qos.m_userData = user_data();
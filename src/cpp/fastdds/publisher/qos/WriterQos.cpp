@@ -138,6 +138,10 @@ void WriterQos::setQos(
         m_disablePositiveACKs = qos.m_disablePositiveACKs;
         m_disablePositiveACKs.hasChanged = true;
     }
+    if (first_time)
+    {
+        m_batch = qos.m_batch;
+    }
     // Writers only manages the first element in the list of data representations.
     if (qos.representation.m_value.size() != representation.m_value.size() ||
             (qos.representation.m_value.size() > 0 && representation.m_value.size() > 0 &&
@@ -244,6 +248,7 @@ void WriterQos::clear()
     m_disablePositiveACKs.clear();
     m_ownershipStrength.clear();
     m_publishMode.clear();
+    m_batch.clear();
     representation.clear();
 }
 
@@ -224,6 +224,31 @@ const Subscriber* DataReader::get_subscriber() const
     return impl_->get_subscriber();
 }
 
+ReadCondition* DataReader::create_readcondition(
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    return impl_->create_readcondition(sample_states, view_states, instance_states);
+}
+
+QueryCondition* DataReader::create_querycondition(
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states,
+        const std::string& query_expression,
+        const std::vector<std::string>& query_parameters)
+{
+    return impl_->create_querycondition(sample_states, view_states, instance_states, query_expression,
+                   query_parameters);
+}
+
+ReturnCode_t DataReader::delete_readcondition(
+        ReadCondition* a_condition)
+{
+    return impl_->delete_readcondition(a_condition);
+}
+
 /* TODO
    bool DataReader::wait_for_historical_data(
         const Duration_t& max_wait) const
@@ -20,11 +20,14 @@
 
 #include <fastdds/subscriber/DataReaderImpl.hpp>
 #include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/QueryCondition.hpp>
+#include <fastdds/dds/subscriber/ReadCondition.hpp>
 #include <fastdds/dds/subscriber/Subscriber.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
 #include <fastdds/dds/subscriber/SubscriberListener.hpp>
 #include <fastdds/subscriber/SubscriberImpl.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/dds/topic/ContentFilteredTopic.hpp>
 #include <fastdds/dds/topic/Topic.hpp>
 #include <fastdds/rtps/reader/RTPSReader.h>
 #include <fastdds/rtps/reader/StatefulReader.h>
@@ -38,8 +41,16 @@
 
 #include <fastdds/dds/log/Log.hpp>
 
+#include <fastdds/core/condition/ConditionNotifier.hpp>
+#include <fastdds/core/condition/StatusConditionImpl.hpp>
+#include <fastdds/publisher/IntraprocessSample.hpp>
+#include <fastdds/topic/ContentFilteredTopicImpl.hpp>
+#include <fastdds/topic/DDSSQLFilter/DDSFilterExpression.hpp>
+
 #include <rtps/history/TopicPayloadPoolRegistry.hpp>
 
+#include <algorithm>
+
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
 using namespace std::chrono;
@@ -81,6 +92,31 @@ void sample_info_to_dds (
     }
 }
 
+/*
+ * Combination of states of a change, as reported by sample_info_to_dds, encoded as in
+ * DataReaderImpl::present_states
+ */
+static uint32_t change_states(
+        const CacheChange_t& change)
+{
+    uint32_t sample_state = change.isRead ? 0 : 1;
+    uint32_t instance_state = eprosima::fastrtps::rtps::NOT_ALIVE_DISPOSED == change.kind ? 1 : 0;
+    return 1u << (sample_state * 3 + instance_state);
+}
+
+static bool query_matches(
+        const DDSSQLFilter::DDSFilterExpression& query,
+        const CacheChange_t& change)
+{
+    if (eprosima::fastrtps::rtps::ALIVE != change.kind)
+    {
+        return false;
+    }
+
+    SerializedPayload_t scratch;
+    return query.evaluate(IntraprocessSample::payload_of(change, scratch));
+}
+
 DataReaderImpl::DataReaderImpl(
         SubscriberImpl* s,
         TypeSupport& type,
@@ -102,6 +138,11 @@ DataReaderImpl::DataReaderImpl(
     , deadline_duration_us_(qos_.deadline().period.to_ns() * 1e-3)
     , lifespan_duration_us_(qos_.lifespan().duration.to_ns() * 1e-3)
 {
+    ContentFilteredTopic* content_topic = dynamic_cast<ContentFilteredTopic*>(topic_);
+    if (content_topic != nullptr)
+    {
+        content_topic_ = static_cast<ContentFilteredTopicImpl*>(content_topic->get_impl());
+    }
 }
 
 ReturnCode_t DataReaderImpl::enable()
@@ -133,6 +174,7 @@ ReturnCode_t DataReaderImpl::enable()
     att.liveliness_lease_duration = qos_.liveliness().lease_duration;
     att.liveliness_kind_ = qos_.liveliness().kind;
     att.matched_writers_allocation = qos_.reader_resource_limits().matched_publisher_allocation;
+    att.max_incomplete_samples_memory = qos_.reader_resource_limits().max_incomplete_samples_memory;
     att.expectsInlineQos = qos_.expects_inline_qos();
     att.disable_positive_acks = qos_.reliable_reader_qos().disable_positive_ACKs.enabled;
 
@@ -141,7 +183,7 @@ ReturnCode_t DataReaderImpl::enable()
     // Insert topic_name and partitions
     Property property;
     property.name("topic_name");
-    property.value(topic_->get_name().c_str());
+    property.value(topic_->get_impl()->get_rtps_topic_name().c_str());
     att.endpoint.properties.properties().push_back(std::move(property));
     if (subscriber_->get_qos().partition().names().size() > 0)
     {
@@ -187,9 +229,16 @@ ReturnCode_t DataReaderImpl::enable()
                     },
                     qos_.lifespan().duration.to_ns() * 1e-6);
 
+    if (content_topic_ != nullptr)
+    {
+        content_topic_->add_reader(this);
+    }
+
     // Register the reader
     ReaderQos rqos = qos_.get_readerqos(subscriber_->get_qos());
-    subscriber_->rtps_participant()->registerReader(reader_, topic_attributes(), rqos);
+    fastdds::rtps::ContentFilterProperty content_filter;
+    subscriber_->rtps_participant()->registerReader(reader_, topic_attributes(), rqos,
+            content_filter_property(content_filter));
 
     return ReturnCode_t::RETCODE_OK;
 }
@@ -208,9 +257,22 @@ DataReaderImpl::~DataReaderImpl()
     delete lifespan_timer_;
     delete deadline_timer_;
 
+    for (ReadCondition* condition : read_conditions_)
+    {
+        delete condition;
+    }
+    for (QueryCondition* condition : query_conditions_)
+    {
+        delete condition;
+    }
+
     if (reader_ != nullptr)
     {
         logInfo(DATA_READER, guid().entityId << " in topic: " << topic_->get_name());
+        if (content_topic_ != nullptr)
+        {
+            content_topic_->remove_reader(this);
+        }
         RTPSDomain::removeRTPSReader(reader_);
         release_payload_pool();
     }
@@ -248,6 +310,7 @@ ReturnCode_t DataReaderImpl::read_next_sample(
     if (history_.readNextData(data, &rtps_info, max_blocking_time))
     {
         sample_info_to_dds(rtps_info, info);
+        sample_accessed();
         return ReturnCode_t::RETCODE_OK;
     }
     return ReturnCode_t::RETCODE_ERROR;
@@ -278,6 +341,7 @@ ReturnCode_t DataReaderImpl::take_next_sample(
     if (history_.takeNextData(data, &rtps_info, max_blocking_time))
     {
         sample_info_to_dds(rtps_info, info);
+        sample_accessed();
         return ReturnCode_t::RETCODE_OK;
     }
     return ReturnCode_t::RETCODE_ERROR;
@@ -316,7 +380,21 @@ void DataReaderImpl::subscriber_qos_updated()
     {
         //NOTIFY THE BUILTIN PROTOCOLS THAT THE READER HAS CHANGED
         ReaderQos rqos = qos_.get_readerqos(get_subscriber()->get_qos());
-        subscriber_->rtps_participant()->updateReader(reader_, topic_attributes(), rqos);
+        fastdds::rtps::ContentFilterProperty content_filter;
+        subscriber_->rtps_participant()->updateReader(reader_, topic_attributes(), rqos,
+                content_filter_property(content_filter));
+    }
+}
+
+void DataReaderImpl::filter_has_been_updated()
+{
+    if (reader_)
+    {
+        //NOTIFY THE BUILTIN PROTOCOLS THAT THE FILTER OF THE READER HAS CHANGED
+        ReaderQos rqos = qos_.get_readerqos(get_subscriber()->get_qos());
+        fastdds::rtps::ContentFilterProperty content_filter;
+        subscriber_->rtps_participant()->updateReader(reader_, topic_attributes(), rqos,
+                content_filter_property(content_filter));
     }
 }
 
@@ -355,7 +433,9 @@ ReturnCode_t DataReaderImpl::set_qos(
     {
         //NOTIFY THE BUILTIN PROTOCOLS THAT THE READER HAS CHANGED
         ReaderQos rqos = qos.get_readerqos(get_subscriber()->get_qos());
-        subscriber_->rtps_participant()->updateReader(reader_, topic_attributes(), rqos);
+        fastdds::rtps::ContentFilterProperty content_filter;
+        subscriber_->rtps_participant()->updateReader(reader_, topic_attributes(), rqos,
+                content_filter_property(content_filter));
 
         // Deadline
         if (qos_.deadline().period != c_TimeInfinite)
@@ -395,11 +475,24 @@ void DataReaderImpl::InnerDataReaderListener::onNewCacheChangeAdded(
 {
     if (data_reader_->on_new_cache_change_added(change_in))
     {
+        detail::StatusConditionImpl* reader_status =
+                data_reader_->user_datareader_->get_statuscondition().get_impl();
+        detail::StatusConditionImpl* subscriber_status =
+                data_reader_->subscriber_->user_subscriber_->get_statuscondition().get_impl();
+        reader_status->set_status(StatusMask::data_available(), true);
+        subscriber_status->set_status(StatusMask::data_on_readers(), true);
+
+        {
+            std::lock_guard<RecursiveTimedMutex> lock(data_reader_->reader_->getMutex());
+            data_reader_->read_conditions_change_added(change_in);
+        }
+
         //First check if we can handle with on_data_on_readers
         SubscriberListener* subscriber_listener =
                 data_reader_->subscriber_->get_listener_for(StatusMask::data_on_readers());
         if (subscriber_listener != nullptr)
         {
+            subscriber_status->set_status(StatusMask::data_on_readers(), false);
             subscriber_listener->on_data_on_readers(data_reader_->subscriber_->user_subscriber_);
         }
         else
@@ -408,6 +501,7 @@ void DataReaderImpl::InnerDataReaderListener::onNewCacheChangeAdded(
             DataReaderListener* listener = data_reader_->get_listener_for(StatusMask::data_available());
             if (listener != nullptr)
             {
+                reader_status->set_status(StatusMask::data_available(), false);
                 listener->on_data_available(data_reader_->user_datareader_);
             }
         }
@@ -418,9 +512,13 @@ void DataReaderImpl::InnerDataReaderListener::onReaderMatched(
         RTPSReader* /*reader*/,
         const SubscriptionMatchedStatus& info)
 {
+    detail::StatusConditionImpl* reader_status = data_reader_->user_datareader_->get_statuscondition().get_impl();
+    reader_status->set_status(StatusMask::subscription_matched(), true);
+
     DataReaderListener* listener = data_reader_->get_listener_for(StatusMask::subscription_matched());
     if (listener != nullptr)
     {
+        reader_status->set_status(StatusMask::subscription_matched(), false);
         listener->on_subscription_matched(data_reader_->user_datareader_, info);
     }
 }
@@ -430,6 +528,8 @@ void DataReaderImpl::InnerDataReaderListener::on_liveliness_changed(
         const fastrtps::LivelinessChangedStatus& status)
 {
     data_reader_->update_liveliness_status(status);
+    data_reader_->user_datareader_->get_statuscondition().get_impl()->set_status(
+        StatusMask::liveliness_changed(), true);
     DataReaderListener* listener = data_reader_->get_listener_for(StatusMask::liveliness_changed());
     if (listener != nullptr)
     {
@@ -446,6 +546,8 @@ void DataReaderImpl::InnerDataReaderListener::on_requested_incompatible_qos(
         fastdds::dds::PolicyMask qos)
 {
     data_reader_->update_requested_incompatible_qos(qos);
+    data_reader_->user_datareader_->get_statuscondition().get_impl()->set_status(
+        StatusMask::requested_incompatible_qos(), true);
     DataReaderListener* listener = data_reader_->get_listener_for(StatusMask::requested_incompatible_qos());
     if (listener != nullptr)
     {
@@ -460,6 +562,19 @@ void DataReaderImpl::InnerDataReaderListener::on_requested_incompatible_qos(
 bool DataReaderImpl::on_new_cache_change_added(
         const CacheChange_t* const change)
 {
+    // Writers may not be able to filter on behalf of this reader (i.e. best-effort ones), so samples not
+    // passing the filter are discarded here before any status is updated
+    if (content_topic_ != nullptr && fastrtps::rtps::ALIVE == change->kind)
+    {
+        SerializedPayload_t scratch;
+        if (!content_topic_->evaluate(IntraprocessSample::payload_of(*change, scratch)))
+        {
+            std::unique_lock<RecursiveTimedMutex> lock(reader_->getMutex());
+            history_.remove_change_sub(const_cast<CacheChange_t*>(change));
+            return false;
+        }
+    }
+
     if (qos_.deadline().period != c_TimeInfinite)
     {
         std::unique_lock<RecursiveTimedMutex> lock(reader_->getMutex());
@@ -550,6 +665,7 @@ bool DataReaderImpl::deadline_missed()
     deadline_missed_status_.total_count++;
     deadline_missed_status_.total_count_change++;
     deadline_missed_status_.last_instance_handle = timer_owner_;
+    user_datareader_->get_statuscondition().get_impl()->set_status(StatusMask::requested_deadline_missed(), true);
     listener_->on_requested_deadline_missed(user_datareader_, deadline_missed_status_);
     subscriber_->subscriber_listener_.on_requested_deadline_missed(user_datareader_, deadline_missed_status_);
     deadline_missed_status_.total_count_change = 0;
@@ -576,6 +692,7 @@ ReturnCode_t DataReaderImpl::get_requested_deadline_missed_status(
 
     status = deadline_missed_status_;
     deadline_missed_status_.total_count_change = 0;
+    user_datareader_->get_statuscondition().get_impl()->set_status(StatusMask::requested_deadline_missed(), false);
     return ReturnCode_t::RETCODE_OK;
 }
 
@@ -599,6 +716,7 @@ bool DataReaderImpl::lifespan_expired()
 
         // The earliest change has expired
         history_.remove_change_sub(earliest_change);
+        read_conditions_update();
 
         // Set the timer for the next change if there is one
         if (!history_.get_earliest_change(&earliest_change))
@@ -684,6 +802,7 @@ ReturnCode_t DataReaderImpl::get_liveliness_changed_status(
     status = liveliness_changed_status_;
     liveliness_changed_status_.alive_count_change = 0u;
     liveliness_changed_status_.not_alive_count_change = 0u;
+    user_datareader_->get_statuscondition().get_impl()->set_status(StatusMask::liveliness_changed(), false);
 
     return ReturnCode_t::RETCODE_OK;
 }
@@ -700,6 +819,7 @@ ReturnCode_t DataReaderImpl::get_requested_incompatible_qos_status(
 
     status = requested_incompatible_qos_status_;
     requested_incompatible_qos_status_.total_count_change = 0u;
+    user_datareader_->get_statuscondition().get_impl()->set_status(StatusMask::requested_incompatible_qos(), false);
     return ReturnCode_t::RETCODE_OK;
 }
 
@@ -778,6 +898,240 @@ LivelinessChangedStatus& DataReaderImpl::update_liveliness_status(
     return liveliness_changed_status_;
 }
 
+ReadCondition* DataReaderImpl::create_readcondition(
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    if (reader_ == nullptr)
+    {
+        return nullptr;
+    }
+
+    ReadCondition* condition = new ReadCondition(this, sample_states, view_states, instance_states);
+
+    std::lock_guard<RecursiveTimedMutex> lock(reader_->getMutex());
+    read_conditions_.push_back(condition);
+    read_conditions_update();
+    return condition;
+}
+
+QueryCondition* DataReaderImpl::create_querycondition(
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states,
+        const std::string& query_expression,
+        const std::vector<std::string>& query_parameters)
+{
+    if (reader_ == nullptr)
+    {
+        return nullptr;
+    }
+
+    QueryCondition* condition = new QueryCondition(this, sample_states, view_states, instance_states,
+                    query_expression);
+    if (ReturnCode_t::RETCODE_OK != condition->query_->compile(
+                DDSSQLFilter::DDSFilterExpression::get_dynamic_type(type_), query_expression, query_parameters))
+    {
+        delete condition;
+        return nullptr;
+    }
+    condition->query_parameters_ = query_parameters;
+
+    std::lock_guard<RecursiveTimedMutex> lock(reader_->getMutex());
+    query_conditions_.push_back(condition);
+    read_conditions_update();
+    return condition;
+}
+
+ReturnCode_t DataReaderImpl::delete_readcondition(
+        ReadCondition* a_condition)
+{
+    if (a_condition == nullptr)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    if (reader_ == nullptr || a_condition->reader_ != this)
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    {
+        std::lock_guard<RecursiveTimedMutex> lock(reader_->getMutex());
+        auto it = std::find(read_conditions_.begin(), read_conditions_.end(), a_condition);
+        if (it != read_conditions_.end())
+        {
+            read_conditions_.erase(it);
+        }
+        else
+        {
+            auto qit = std::find_if(query_conditions_.begin(), query_conditions_.end(),
+                            [a_condition](const QueryCondition* condition)
+                            {
+                                return condition == a_condition;
+                            });
+            if (qit == query_conditions_.end())
+            {
+                return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+            }
+            query_conditions_.erase(qit);
+        }
+    }
+
+    // Deleted without the reader mutex, as the condition will inform the WaitSets it is attached to
+    delete a_condition;
+    return ReturnCode_t::RETCODE_OK;
+}
+
+bool DataReaderImpl::has_read_conditions() const
+{
+    if (reader_ == nullptr)
+    {
+        return false;
+    }
+
+    std::lock_guard<RecursiveTimedMutex> lock(reader_->getMutex());
+    return !read_conditions_.empty() || !query_conditions_.empty();
+}
+
+ReturnCode_t DataReaderImpl::get_query_parameters(
+        const QueryCondition& condition,
+        std::vector<std::string>& query_parameters) const
+{
+    std::lock_guard<RecursiveTimedMutex> lock(reader_->getMutex());
+    query_parameters = condition.query_parameters_;
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t DataReaderImpl::set_query_parameters(
+        QueryCondition& condition,
+        const std::vector<std::string>& query_parameters)
+{
+    std::unique_ptr<DDSSQLFilter::DDSFilterExpression> query(new DDSSQLFilter::DDSFilterExpression());
+    ReturnCode_t ret = query->compile(
+        DDSSQLFilter::DDSFilterExpression::get_dynamic_type(type_), condition.query_expression_, query_parameters);
+    if (!ret)
+    {
+        return ret;
+    }
+
+    std::lock_guard<RecursiveTimedMutex> lock(reader_->getMutex());
+    condition.query_.swap(query);
+    condition.query_parameters_ = query_parameters;
+    read_conditions_update();
+    return ReturnCode_t::RETCODE_OK;
+}
+
+uint32_t DataReaderImpl::condition_states(
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    // Samples are always reported as not new
+    if (0 == (view_states & NOT_NEW_VIEW_STATE))
+    {
+        return 0;
+    }
+
+    uint32_t states = 0;
+    for (uint32_t sample_state = 0; sample_state < 2; ++sample_state)
+    {
+        for (uint32_t instance_state = 0; instance_state < 3; ++instance_state)
+        {
+            if (0 != (sample_states & (1u << sample_state)) && 0 != (instance_states & (1u << instance_state)))
+            {
+                states |= 1u << (sample_state * 3 + instance_state);
+            }
+        }
+    }
+    return states;
+}
+
+void DataReaderImpl::read_conditions_change_added(
+        const CacheChange_t* change)
+{
+    if (read_conditions_.empty() && query_conditions_.empty())
+    {
+        return;
+    }
+
+    // A new change can only make conditions become true, so the history need not be traversed
+    uint32_t states = change_states(*change);
+    uint32_t old_states = present_states_.fetch_or(states, std::memory_order_acq_rel);
+    for (ReadCondition* condition : read_conditions_)
+    {
+        if (0 == (old_states & condition->states_) && 0 != (states & condition->states_))
+        {
+            condition->get_notifier()->notify();
+        }
+    }
+
+    for (QueryCondition* condition : query_conditions_)
+    {
+        if (!condition->trigger_value_.load(std::memory_order_acquire) &&
+                0 != (states & condition->states_) && query_matches(*condition->query_, *change))
+        {
+            condition->trigger_value_.store(true, std::memory_order_release);
+            condition->get_notifier()->notify();
+        }
+    }
+}
+
+void DataReaderImpl::read_conditions_update()
+{
+    if (read_conditions_.empty() && query_conditions_.empty())
+    {
+        return;
+    }
+
+    uint32_t wanted_states = 0;
+    for (ReadCondition* condition : read_conditions_)
+    {
+        wanted_states |= condition->states_;
+    }
+
+    // Stop as soon as all the combinations the conditions are interested in have been found
+    uint32_t states = 0;
+    for (auto it = history_.changesBegin();
+            it != history_.changesEnd() && (states & wanted_states) != wanted_states; ++it)
+    {
+        states |= change_states(**it);
+    }
+
+    uint32_t old_states = present_states_.exchange(states, std::memory_order_acq_rel);
+    for (ReadCondition* condition : read_conditions_)
+    {
+        if (0 == (old_states & condition->states_) && 0 != (states & condition->states_))
+        {
+            condition->get_notifier()->notify();
+        }
+    }
+
+    for (QueryCondition* condition : query_conditions_)
+    {
+        bool value = false;
+        for (auto it = history_.changesBegin(); !value && it != history_.changesEnd(); ++it)
+        {
+            value = 0 != (change_states(**it) & condition->states_) && query_matches(*condition->query_, **it);
+        }
+
+        if (!condition->trigger_value_.exchange(value, std::memory_order_acq_rel) && value)
+        {
+            condition->get_notifier()->notify();
+        }
+    }
+}
+
+void DataReaderImpl::sample_accessed()
+{
+    user_datareader_->get_statuscondition().get_impl()->set_status(StatusMask::data_available(), false);
+    subscriber_->user_subscriber_->get_statuscondition().get_impl()->set_status(StatusMask::data_on_readers(), false);
+
+    std::lock_guard<RecursiveTimedMutex> lock(reader_->getMutex());
+    read_conditions_update();
+}
+
 ReturnCode_t DataReaderImpl::check_qos (
         const DataReaderQos& qos)
 {
@@ -956,7 +1310,7 @@ fastrtps::TopicAttributes DataReaderImpl::topic_attributes() const
 {
     fastrtps::TopicAttributes topic_att;
     topic_att.topicKind = type_->m_isGetKeyDefined ? WITH_KEY : NO_KEY;
-    topic_att.topicName = topic_->get_name();
+    topic_att.topicName = topic_->get_impl()->get_rtps_topic_name();
     topic_att.topicDataType = topic_->get_type_name();
     topic_att.historyQos = qos_.history();
     topic_att.resourceLimitsQos = qos_.resource_limits();
@@ -978,6 +1332,18 @@ fastrtps::TopicAttributes DataReaderImpl::topic_attributes() const
     return topic_att;
 }
 
+const fastdds::rtps::ContentFilterProperty* DataReaderImpl::content_filter_property(
+        fastdds::rtps::ContentFilterProperty& property) const
+{
+    if (content_topic_ == nullptr)
+    {
+        return nullptr;
+    }
+
+    content_topic_->get_content_filter_property(property);
+    return &property;
+}
+
 DataReaderListener* DataReaderImpl::get_listener_for(
         const StatusMask& status)
 {
@@ -995,7 +1361,7 @@ std::shared_ptr<IPayloadPool> DataReaderImpl::get_payload_pool()
 
     if (!payload_pool_)
     {
-        payload_pool_ = TopicPayloadPoolRegistry::get(topic_->get_name(), config);
+        payload_pool_ = TopicPayloadPoolRegistry::get(topic_->get_impl()->get_rtps_topic_name(), config);
     }
 
     payload_pool_->reserve_history(config, true);
@@ -24,10 +24,14 @@
 #include <fastdds/dds/core/status/StatusMask.hpp>
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
 #include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/InstanceState.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/SampleState.hpp>
+#include <fastdds/dds/subscriber/ViewState.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
 
 #include <fastdds/rtps/attributes/ReaderAttributes.h>
+#include <fastdds/rtps/common/ContentFilterProperty.hpp>
 #include <fastdds/rtps/common/Locator.h>
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/history/IPayloadPool.h>
@@ -40,6 +44,10 @@
 
 #include <rtps/history/ITopicPayloadPool.h>
 
+#include <atomic>
+#include <string>
+#include <vector>
+
 using eprosima::fastrtps::types::ReturnCode_t;
 
 namespace eprosima {
@@ -57,6 +65,9 @@ namespace dds {
 
 class Subscriber;
 class SubscriberImpl;
+class ContentFilteredTopicImpl;
+class QueryCondition;
+class ReadCondition;
 class TopicDescription;
 
 /**
@@ -71,6 +82,7 @@ protected:
     using IPayloadPool = eprosima::fastrtps::rtps::IPayloadPool;
 
     friend class SubscriberImpl;
+    friend class ReadCondition;
 
     /**
      * Creates a DataReader. Don't use it directly, but through Subscriber.
@@ -223,6 +235,72 @@ public:
             const DataReaderQos& from,
             bool first_time);
 
+    /**
+     * Called by the ContentFilteredTopic of this reader when its expression parameters change,
+     * to announce the new filter.
+     */
+    void filter_has_been_updated();
+
+    /**
+     * Creates a ReadCondition on this reader.
+     * @param sample_states Sample states the matched samples should have.
+     * @param view_states View states the matched samples should have.
+     * @param instance_states Instance states the matched samples should have.
+     * @return The new condition, nullptr if the reader is not enabled.
+     */
+    ReadCondition* create_readcondition(
+            SampleStateMask sample_states,
+            ViewStateMask view_states,
+            InstanceStateMask instance_states);
+
+    /**
+     * Creates a QueryCondition on this reader.
+     * @param sample_states Sample states the matched samples should have.
+     * @param view_states View states the matched samples should have.
+     * @param instance_states Instance states the matched samples should have.
+     * @param query_expression DDS-SQL expression the matched samples should pass.
+     * @param query_parameters Values of the parameters of the expression.
+     * @return The new condition, nullptr if the reader is not enabled or the query is not valid.
+     */
+    QueryCondition* create_querycondition(
+            SampleStateMask sample_states,
+            ViewStateMask view_states,
+            InstanceStateMask instance_states,
+            const std::string& query_expression,
+            const std::vector<std::string>& query_parameters);
+
+    ReturnCode_t delete_readcondition(
+            ReadCondition* a_condition);
+
+    //! Whether there are read conditions created on this reader
+    bool has_read_conditions() const;
+
+    ReturnCode_t get_query_parameters(
+            const QueryCondition& condition,
+            std::vector<std::string>& query_parameters) const;
+
+    ReturnCode_t set_query_parameters(
+            QueryCondition& condition,
+            const std::vector<std::string>& query_parameters);
+
+    /**
+     * Combinations of sample and instance states present in the history, as a bit mask with the bit
+     * (sample state bit index * 3 + instance state bit index) set for each combination.
+     * Only kept up to date while there are read conditions.
+     */
+    uint32_t present_states() const
+    {
+        return present_states_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Computes the combinations of states matched by a ReadCondition, encoded as in present_states().
+     */
+    static uint32_t condition_states(
+            SampleStateMask sample_states,
+            ViewStateMask view_states,
+            InstanceStateMask instance_states);
+
 protected:
 
     //!Subscriber
@@ -236,6 +314,9 @@ protected:
 
     TopicDescription* topic_ = nullptr;
 
+    //! Implementation of topic_ when the reader is created on a ContentFilteredTopic
+    ContentFilteredTopicImpl* content_topic_ = nullptr;
+
     DataReaderQos qos_;
 
     //!History
@@ -306,6 +387,31 @@ protected:
 
     std::shared_ptr<ITopicPayloadPool> payload_pool_;
 
+    //! Read conditions created on this reader, protected by the mutex of the RTPSReader
+    std::vector<ReadCondition*> read_conditions_;
+
+    //! Query conditions created on this reader, protected by the mutex of the RTPSReader
+    std::vector<QueryCondition*> query_conditions_;
+
+    //! Combinations of states of the samples in the history
+    std::atomic<uint32_t> present_states_{0};
+
+    /**
+     * Updates the trigger value of the read conditions with a change just added to the history.
+     * Should be called with the mutex of the RTPSReader taken.
+     */
+    void read_conditions_change_added(
+            const fastrtps::rtps::CacheChange_t* change);
+
+    /**
+     * Updates the trigger value of the read conditions from the whole history, after samples have been
+     * read or removed. Should be called with the mutex of the RTPSReader taken.
+     */
+    void read_conditions_update();
+
+    //! Marks a sample as accessed by the application for the status and read conditions
+    void sample_accessed();
+
     /**
      * @brief A method called when a new cache change is added
      * @param change The cache change that has been added
@@ -331,6 +437,14 @@ protected:
 
     fastrtps::TopicAttributes topic_attributes() const;
 
+    /**
+     * Fills the content filter this reader announces on discovery.
+     * @param property ContentFilterProperty to fill.
+     * @return Pointer to property, or nullptr if the reader is not created on a ContentFilteredTopic.
+     */
+    const fastdds::rtps::ContentFilterProperty* content_filter_property(
+            fastdds::rtps::ContentFilterProperty& property) const;
+
     void subscriber_qos_updated();
 
     RequestedIncompatibleQosStatus& update_requested_incompatible_qos(
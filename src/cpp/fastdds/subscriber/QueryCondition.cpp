@@ -0,0 +1,68 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file QueryCondition.cpp
+ */
+
+#include <fastdds/dds/subscriber/QueryCondition.hpp>
+#include <fastdds/subscriber/DataReaderImpl.hpp>
+#include <fastdds/topic/DDSSQLFilter/DDSFilterExpression.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+QueryCondition::QueryCondition(
+        DataReaderImpl* reader,
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states,
+        const std::string& query_expression)
+    : ReadCondition(reader, sample_states, view_states, instance_states)
+    , query_expression_(query_expression)
+    , query_(new DDSSQLFilter::DDSFilterExpression())
+    , trigger_value_(false)
+{
+}
+
+QueryCondition::~QueryCondition()
+{
+}
+
+bool QueryCondition::get_trigger_value() const
+{
+    return trigger_value_.load(std::memory_order_acquire);
+}
+
+const std::string& QueryCondition::get_query_expression() const
+{
+    return query_expression_;
+}
+
+ReturnCode_t QueryCondition::get_query_parameters(
+        std::vector<std::string>& query_parameters) const
+{
+    return reader_->get_query_parameters(*this, query_parameters);
+}
+
+ReturnCode_t QueryCondition::set_query_parameters(
+        const std::vector<std::string>& query_parameters)
+{
+    return reader_->set_query_parameters(*this, query_parameters);
+}
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
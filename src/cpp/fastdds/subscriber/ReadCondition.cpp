@@ -0,0 +1,70 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReadCondition.cpp
+ */
+
+#include <fastdds/dds/subscriber/ReadCondition.hpp>
+#include <fastdds/subscriber/DataReaderImpl.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+ReadCondition::ReadCondition(
+        DataReaderImpl* reader,
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+    : reader_(reader)
+    , sample_states_(sample_states)
+    , view_states_(view_states)
+    , instance_states_(instance_states)
+    , states_(DataReaderImpl::condition_states(sample_states, view_states, instance_states))
+{
+}
+
+ReadCondition::~ReadCondition()
+{
+}
+
+bool ReadCondition::get_trigger_value() const
+{
+    return 0 != (reader_->present_states() & states_);
+}
+
+DataReader* ReadCondition::get_datareader() const
+{
+    return reader_->user_datareader_;
+}
+
+SampleStateMask ReadCondition::get_sample_state_mask() const
+{
+    return sample_states_;
+}
+
+ViewStateMask ReadCondition::get_view_state_mask() const
+{
+    return view_states_;
+}
+
+InstanceStateMask ReadCondition::get_instance_state_mask() const
+{
+    return instance_states_;
+}
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
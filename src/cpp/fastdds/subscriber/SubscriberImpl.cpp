@@ -52,6 +52,7 @@ static void set_qos_from_attributes(
         const SubscriberAttributes& attr)
 {
     qos.reader_resource_limits().matched_publisher_allocation = attr.matched_publisher_allocation;
+    qos.reader_resource_limits().max_incomplete_samples_memory = attr.max_incomplete_samples_memory;
     qos.properties() = attr.properties;
     qos.expects_inline_qos(attr.expectsInlineQos);
     qos.endpoint().unicast_locator_list = attr.unicastLocatorList;
@@ -277,6 +278,11 @@ ReturnCode_t SubscriberImpl::delete_datareader(
     {
         return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
     }
+    // The read conditions created on the reader should be deleted first
+    if (reader->impl_->has_read_conditions())
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
     std::unique_lock<std::mutex> lock(mtx_readers_);
     auto it = readers_.find(reader->impl_->get_topicdescription()->get_name());
     if (it != readers_.end())
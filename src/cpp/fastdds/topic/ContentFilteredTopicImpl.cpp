@@ -0,0 +1,169 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * ContentFilteredTopicImpl.cpp
+ *
+ */
+
+#include <fastdds/topic/ContentFilteredTopicImpl.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/dds/topic/ContentFilteredTopic.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+
+#include <fastdds/core/policy/ParameterSerializer.hpp>
+#include <fastdds/subscriber/DataReaderImpl.hpp>
+#include <fastdds/topic/TopicImpl.hpp>
+
+#include <algorithm>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+ContentFilteredTopicImpl::ContentFilteredTopicImpl(
+        Topic* related_topic,
+        const std::string& filter_expression)
+    : related_topic_(related_topic)
+    , filter_expression_(filter_expression)
+{
+}
+
+ContentFilteredTopicImpl::~ContentFilteredTopicImpl()
+{
+    delete user_topic_;
+}
+
+Topic* ContentFilteredTopicImpl::get_related_topic() const
+{
+    return related_topic_;
+}
+
+const std::string& ContentFilteredTopicImpl::get_filter_expression() const
+{
+    return filter_expression_;
+}
+
+std::vector<std::string> ContentFilteredTopicImpl::get_expression_parameters() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return expression_parameters_;
+}
+
+ReturnCode_t ContentFilteredTopicImpl::set_expression_parameters(
+        const std::vector<std::string>& expression_parameters)
+{
+    ReturnCode_t ret = compile(expression_parameters);
+    if (!ret)
+    {
+        return ret;
+    }
+
+    // Readers are notified without holding the mutex, as they will ask for the new filter property
+    std::vector<DataReaderImpl*> readers;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        readers = readers_;
+    }
+    for (DataReaderImpl* reader : readers)
+    {
+        reader->filter_has_been_updated();
+    }
+
+    return ReturnCode_t::RETCODE_OK;
+}
+
+const std::string& ContentFilteredTopicImpl::get_rtps_topic_name() const
+{
+    return related_topic_->get_name();
+}
+
+void ContentFilteredTopicImpl::get_content_filter_property(
+        fastdds::rtps::ContentFilterProperty& property) const
+{
+    property.content_filtered_topic_name = user_topic_->get_name();
+    property.related_topic_name = related_topic_->get_name();
+    property.filter_class_name = DDSSQLFilter::DDSFilterExpression::filter_class_name;
+    property.filter_expression = filter_expression_;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    property.expression_parameters = expression_parameters_;
+}
+
+bool ContentFilteredTopicImpl::evaluate(
+        const fastrtps::rtps::SerializedPayload_t& payload) const
+{
+    std::shared_ptr<DDSSQLFilter::DDSFilterExpression> filter;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        filter = filter_;
+    }
+
+    return !filter || filter->evaluate(payload);
+}
+
+void ContentFilteredTopicImpl::add_reader(
+        DataReaderImpl* reader)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    readers_.push_back(reader);
+}
+
+void ContentFilteredTopicImpl::remove_reader(
+        DataReaderImpl* reader)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = std::find(readers_.begin(), readers_.end(), reader);
+    if (it != readers_.end())
+    {
+        readers_.erase(it);
+    }
+}
+
+ReturnCode_t ContentFilteredTopicImpl::compile(
+        const std::vector<std::string>& expression_parameters)
+{
+    // The filter travels inside a single parameter of the subscription data
+    fastdds::rtps::ContentFilterProperty property;
+    property.content_filtered_topic_name = user_topic_->get_name();
+    property.related_topic_name = related_topic_->get_name();
+    property.filter_class_name = DDSSQLFilter::DDSFilterExpression::filter_class_name;
+    property.filter_expression = filter_expression_;
+    property.expression_parameters = expression_parameters;
+    if (ParameterSerializer<fastdds::rtps::ContentFilterProperty>::cdr_serialized_size(property) - 4 > 0xFFFF)
+    {
+        logError(CONTENT_FILTER, "Filter expression of " << user_topic_->get_name() << " is too large");
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    const TypeSupport& type = static_cast<TopicImpl*>(related_topic_->get_impl())->get_type();
+    std::shared_ptr<DDSSQLFilter::DDSFilterExpression> filter =
+            std::make_shared<DDSSQLFilter::DDSFilterExpression>();
+    ReturnCode_t ret = filter->compile(
+        DDSSQLFilter::DDSFilterExpression::get_dynamic_type(type), filter_expression_, expression_parameters);
+    if (!ret)
+    {
+        return ret;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    expression_parameters_ = expression_parameters;
+    filter_ = filter;
+    return ReturnCode_t::RETCODE_OK;
+}
+
+} // dds
+} // fastdds
+} // eprosima
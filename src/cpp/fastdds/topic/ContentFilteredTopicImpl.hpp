@@ -0,0 +1,116 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ContentFilteredTopicImpl.hpp
+ *
+ */
+
+#ifndef _FASTDDS_CONTENTFILTEREDTOPICIMPL_HPP_
+#define _FASTDDS_CONTENTFILTEREDTOPICIMPL_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastdds/rtps/common/ContentFilterProperty.hpp>
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastrtps/types/TypesBase.h>
+
+#include <fastdds/topic/DDSSQLFilter/DDSFilterExpression.hpp>
+#include <fastdds/topic/TopicDescriptionImpl.hpp>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using eprosima::fastrtps::types::ReturnCode_t;
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+class ContentFilteredTopic;
+class DataReaderImpl;
+class DomainParticipantImpl;
+class Topic;
+
+class ContentFilteredTopicImpl : public TopicDescriptionImpl
+{
+    friend class DomainParticipantImpl;
+
+    ContentFilteredTopicImpl(
+            Topic* related_topic,
+            const std::string& filter_expression);
+
+public:
+
+    virtual ~ContentFilteredTopicImpl();
+
+    Topic* get_related_topic() const;
+
+    const std::string& get_filter_expression() const;
+
+    std::vector<std::string> get_expression_parameters() const;
+
+    /**
+     * Compiles the filter expression with new parameter values, and notifies the readers
+     * created on this topic so they announce the new filter.
+     */
+    ReturnCode_t set_expression_parameters(
+            const std::vector<std::string>& expression_parameters);
+
+    const std::string& get_rtps_topic_name() const override;
+
+    /**
+     * Fills the content filter information a reader on this topic announces on discovery.
+     * @param property ContentFilterProperty to fill.
+     */
+    void get_content_filter_property(
+            fastdds::rtps::ContentFilterProperty& property) const;
+
+    /**
+     * Evaluates the filter on a serialized sample.
+     * @param payload Serialized sample.
+     * @return true if the sample passes the filter.
+     */
+    bool evaluate(
+            const fastrtps::rtps::SerializedPayload_t& payload) const;
+
+    void add_reader(
+            DataReaderImpl* reader);
+
+    void remove_reader(
+            DataReaderImpl* reader);
+
+private:
+
+    ReturnCode_t compile(
+            const std::vector<std::string>& expression_parameters);
+
+    Topic* related_topic_;
+    ContentFilteredTopic* user_topic_ = nullptr;
+    const std::string filter_expression_;
+
+    mutable std::mutex mutex_;
+    std::vector<std::string> expression_parameters_;
+    //! Compiled expression, replaced as a whole when the parameters change
+    std::shared_ptr<DDSSQLFilter::DDSFilterExpression> filter_;
+    std::vector<DataReaderImpl*> readers_;
+};
+
+} // dds
+} // fastdds
+} // eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif /* _FASTDDS_CONTENTFILTEREDTOPICIMPL_HPP_ */
@@ -0,0 +1,1505 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file DDSFilterExpression.cpp
+ */
+
+#include <fastdds/topic/DDSSQLFilter/DDSFilterExpression.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/common/Types.h>
+#include <fastrtps/types/DynamicPubSubType.h>
+#include <fastrtps/types/DynamicType.h>
+#include <fastrtps/types/DynamicTypeMember.h>
+#include <fastrtps/types/MemberDescriptor.h>
+#include <fastrtps/types/TypeDescriptor.h>
+#include <fastrtps/types/TypeObjectFactory.h>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace DDSSQLFilter {
+
+using namespace eprosima::fastrtps::types;
+using eprosima::fastrtps::rtps::SerializedPayload_t;
+
+constexpr const char* DDSFilterExpression::filter_class_name;
+constexpr size_t DDSFilterExpression::max_fields;
+constexpr uint16_t DDSFilterExpression::constant_flag;
+constexpr size_t DDSFilterExpression::no_member;
+
+//! Sequential reader of a plain CDR stream, which never reads past the end of the payload
+class CdrReader
+{
+public:
+
+    CdrReader(
+            const uint8_t* begin,
+            const uint8_t* end,
+            bool swap)
+        : begin_(begin)
+        , end_(end)
+        , position_(begin)
+        , swap_(swap)
+    {
+    }
+
+    //! Offset from the beginning of the stream, which is always aligned to 8
+    uint64_t offset() const
+    {
+        return static_cast<uint64_t>(position_ - begin_);
+    }
+
+    uint64_t remaining() const
+    {
+        return static_cast<uint64_t>(end_ - position_);
+    }
+
+    const uint8_t* position() const
+    {
+        return position_;
+    }
+
+    bool advance(
+            uint64_t bytes)
+    {
+        if (bytes > remaining())
+        {
+            return false;
+        }
+        position_ += bytes;
+        return true;
+    }
+
+    bool align(
+            uint64_t alignment)
+    {
+        return advance((alignment - (offset() & (alignment - 1))) & (alignment - 1));
+    }
+
+    //! Reads size bytes on host byte order
+    bool read(
+            uint8_t* value,
+            size_t size)
+    {
+        if (size > remaining())
+        {
+            return false;
+        }
+
+        if (swap_)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                value[i] = position_[size - 1 - i];
+            }
+        }
+        else
+        {
+            memcpy(value, position_, size);
+        }
+        position_ += size;
+        return true;
+    }
+
+    bool read_length(
+            uint32_t& length)
+    {
+        uint8_t buffer[4];
+        if (!align(4) || !read(buffer, 4))
+        {
+            return false;
+        }
+        memcpy(&length, buffer, 4);
+        return true;
+    }
+
+private:
+
+    const uint8_t* begin_;
+    const uint8_t* end_;
+    const uint8_t* position_;
+    bool swap_;
+};
+
+namespace {
+
+template<typename T>
+T from_bytes(
+        const uint8_t* buffer)
+{
+    T value;
+    memcpy(&value, buffer, sizeof(T));
+    return value;
+}
+
+uint64_t round_up(
+        uint64_t offset,
+        uint64_t alignment)
+{
+    return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+bool is_blank(
+        const std::string& text)
+{
+    return std::all_of(text.begin(), text.end(), [](char c)
+                   {
+                       return std::isspace(static_cast<unsigned char>(c)) != 0;
+                   });
+}
+
+std::string path_to_string(
+        const std::vector<DDSFilterFieldStep>& path)
+{
+    std::string result;
+    for (const DDSFilterFieldStep& step : path)
+    {
+        if (!result.empty())
+        {
+            result += '.';
+        }
+        result += step.name;
+        if (step.index != DDSFilterFieldStep::no_index)
+        {
+            result += '[' + std::to_string(step.index) + ']';
+        }
+    }
+    return result;
+}
+
+/*!
+ * Compares two values.
+ * @return false if the values cannot be compared, i.e. a string with a number or a NaN.
+ */
+bool compare_values(
+        const DDSFilterExpression::Value& left,
+        const DDSFilterExpression::Value& right,
+        int& result)
+{
+    using Value = DDSFilterExpression::Value;
+
+    if (left.kind == Value::STRING || right.kind == Value::STRING)
+    {
+        if (left.kind != right.kind)
+        {
+            return false;
+        }
+        uint32_t length = std::min(left.string_length, right.string_length);
+        int cmp = length > 0 ? memcmp(left.string_value, right.string_value, length) : 0;
+        if (cmp == 0)
+        {
+            cmp = left.string_length < right.string_length ? -1 : (left.string_length > right.string_length ? 1 : 0);
+        }
+        result = cmp < 0 ? -1 : (cmp > 0 ? 1 : 0);
+        return true;
+    }
+
+    if (left.kind == Value::FLOAT || right.kind == Value::FLOAT)
+    {
+        auto to_double = [](const Value& value)
+                {
+                    return value.kind == Value::FLOAT ? value.float_value :
+                           (value.kind == Value::SIGNED ? static_cast<double>(value.signed_value) :
+                           static_cast<double>(value.unsigned_value));
+                };
+        double l = to_double(left);
+        double r = to_double(right);
+        if (std::isnan(l) || std::isnan(r))
+        {
+            return false;
+        }
+        result = l < r ? -1 : (l > r ? 1 : 0);
+        return true;
+    }
+
+    if (left.kind == Value::SIGNED && right.kind == Value::SIGNED)
+    {
+        result = left.signed_value < right.signed_value ? -1 : (left.signed_value > right.signed_value ? 1 : 0);
+        return true;
+    }
+
+    // At least one of them is unsigned, so a negative value is always the lowest
+    if (left.kind == Value::SIGNED && left.signed_value < 0)
+    {
+        result = -1;
+        return true;
+    }
+    if (right.kind == Value::SIGNED && right.signed_value < 0)
+    {
+        result = 1;
+        return true;
+    }
+    result = left.unsigned_value < right.unsigned_value ? -1 : (left.unsigned_value > right.unsigned_value ? 1 : 0);
+    return true;
+}
+
+/*!
+ * Matches a string with a LIKE pattern, where '%' and '*' match any sequence of characters and '_' and '?' match
+ * a single character.
+ */
+bool like_match(
+        const DDSFilterExpression::Value& value,
+        const DDSFilterExpression::Value& pattern)
+{
+    const char* text = value.string_value;
+    const char* text_end = text + value.string_length;
+    const char* p = pattern.string_value;
+    const char* p_end = p + pattern.string_length;
+    const char* star = nullptr;
+    const char* star_text = nullptr;
+
+    while (text < text_end)
+    {
+        if (p < p_end && (*p == '%' || *p == '*'))
+        {
+            star = p++;
+            star_text = text;
+        }
+        else if (p < p_end && (*p == '_' || *p == '?' || *p == *text))
+        {
+            ++p;
+            ++text;
+        }
+        else if (star != nullptr)
+        {
+            // Backtrack, letting the last wildcard take one more character
+            p = star + 1;
+            text = ++star_text;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    while (p < p_end && (*p == '%' || *p == '*'))
+    {
+        ++p;
+    }
+    return p == p_end;
+}
+
+bool evaluate_predicate(
+        DDSFilterCondition::Operator op,
+        const DDSFilterExpression::Value& left,
+        const DDSFilterExpression::Value& right)
+{
+    if (op == DDSFilterCondition::LIKE)
+    {
+        return like_match(left, right);
+    }
+
+    int result = 0;
+    if (!compare_values(left, right, result))
+    {
+        return false;
+    }
+
+    switch (op)
+    {
+        case DDSFilterCondition::EQUAL:
+            return result == 0;
+        case DDSFilterCondition::NOT_EQUAL:
+            return result != 0;
+        case DDSFilterCondition::LESS:
+            return result < 0;
+        case DDSFilterCondition::LESS_EQUAL:
+            return result <= 0;
+        case DDSFilterCondition::GREATER:
+            return result > 0;
+        case DDSFilterCondition::GREATER_EQUAL:
+            return result >= 0;
+        default:
+            return false;
+    }
+}
+
+DynamicType_ptr resolve_alias(
+        DynamicType_ptr type)
+{
+    while (type && type->get_kind() == TK_ALIAS)
+    {
+        type = type->get_type_descriptor()->get_base_type();
+    }
+    return type;
+}
+
+} // namespace
+
+ReturnCode_t DDSFilterExpression::compile(
+        const DynamicType_ptr& type,
+        const std::string& expression,
+        const std::vector<std::string>& parameters)
+{
+    layouts_.clear();
+    layout_by_type_.clear();
+    fields_.clear();
+    field_by_path_.clear();
+    constants_.clear();
+    constant_strings_.clear();
+    program_.clear();
+
+    if (is_blank(expression))
+    {
+        return ReturnCode_t::RETCODE_OK;
+    }
+
+    std::string error;
+    std::unique_ptr<DDSFilterCondition> root = parse_filter_expression(expression, error);
+    if (!root)
+    {
+        logError(CONTENT_FILTER, "Invalid filter expression '" << expression << "': " << error);
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    if (!type)
+    {
+        logError(CONTENT_FILTER, "No type information available to compile filter expression '" << expression << "'");
+        return ReturnCode_t::RETCODE_UNSUPPORTED;
+    }
+
+    root_layout_ = add_layout(type);
+    if (layouts_[root_layout_].kind != TypeLayout::STRUCT)
+    {
+        logError(CONTENT_FILTER, "Filter expressions can only be applied to structures");
+        return ReturnCode_t::RETCODE_UNSUPPORTED;
+    }
+
+    ReturnCode_t ret = compile_condition(*root, parameters, error);
+    if (ret != ReturnCode_t::RETCODE_OK)
+    {
+        logError(CONTENT_FILTER, "Cannot compile filter expression '" << expression << "': " << error);
+        program_.clear();
+    }
+    return ret;
+}
+
+bool DDSFilterExpression::evaluate(
+        const SerializedPayload_t& payload) const
+{
+    if (program_.empty())
+    {
+        return true;
+    }
+
+    // Only plain CDR can be evaluated, other encapsulations pass the filter
+    if (payload.data == nullptr || payload.length < 4 || payload.data[0] != 0 || payload.data[1] > CDR_LE)
+    {
+        return true;
+    }
+    const bool swap = (payload.data[1] == CDR_BE) != (fastrtps::rtps::DEFAULT_ENDIAN == fastrtps::rtps::BIGEND);
+
+    // Members are read lazily, at most once per evaluation
+    std::array<Value, max_fields> values;
+    std::array<uint8_t, max_fields> state{};
+    constexpr uint8_t not_read = 0;
+    constexpr uint8_t present = 1;
+    constexpr uint8_t absent = 2;
+
+    bool result = false;
+    size_t pc = 0;
+    while (pc < program_.size())
+    {
+        const Instruction& instruction = program_[pc++];
+        switch (instruction.code)
+        {
+            case Instruction::JUMP_IF_FALSE:
+                if (!result)
+                {
+                    pc = instruction.target;
+                }
+                break;
+
+            case Instruction::JUMP_IF_TRUE:
+                if (result)
+                {
+                    pc = instruction.target;
+                }
+                break;
+
+            case Instruction::NOT:
+                result = !result;
+                break;
+
+            case Instruction::COMPARE:
+            case Instruction::BETWEEN:
+            {
+                const size_t count = instruction.code == Instruction::BETWEEN ? 3 : 2;
+                const Value* operands[3] = {nullptr, nullptr, nullptr};
+                bool all_present = true;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    uint16_t index = instruction.operands[i];
+                    if (index & constant_flag)
+                    {
+                        operands[i] = &constants_[index & ~constant_flag];
+                        continue;
+                    }
+
+                    if (state[index] == not_read)
+                    {
+                        CdrReader reader(payload.data + 4, payload.data + payload.length, swap);
+                        bool field_present = false;
+                        if (!read_field(fields_[index], reader, values[index], field_present))
+                        {
+                            // Malformed or truncated payload
+                            return true;
+                        }
+                        state[index] = field_present ? present : absent;
+                    }
+                    all_present = all_present && state[index] == present;
+                    operands[i] = &values[index];
+                }
+
+                if (!all_present)
+                {
+                    result = false;
+                }
+                else if (instruction.code == Instruction::COMPARE)
+                {
+                    result = evaluate_predicate(instruction.op, *operands[0], *operands[1]);
+                }
+                else
+                {
+                    result = evaluate_predicate(DDSFilterCondition::GREATER_EQUAL, *operands[0], *operands[1]) &&
+                            evaluate_predicate(DDSFilterCondition::LESS_EQUAL, *operands[0], *operands[2]);
+                }
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
+DynamicType_ptr DDSFilterExpression::get_dynamic_type(
+        const TypeSupport& type)
+{
+    DynamicPubSubType* dynamic_type = dynamic_cast<DynamicPubSubType*>(type.get());
+    if (dynamic_type != nullptr)
+    {
+        return dynamic_type->GetDynamicType();
+    }
+
+    // Member names are only available on complete type objects
+    TypeObjectFactory* factory = TypeObjectFactory::get_instance();
+    const std::string type_name = type.get_type_name();
+    const TypeIdentifier* identifier = factory->get_type_identifier_trying_complete(type_name);
+    if (identifier != nullptr && identifier->_d() == EK_COMPLETE)
+    {
+        const TypeObject* object = factory->get_type_object(type_name, true);
+        if (object != nullptr)
+        {
+            return factory->build_dynamic_type(type_name, identifier, object);
+        }
+    }
+    return DynamicType_ptr(nullptr);
+}
+
+uint32_t DDSFilterExpression::add_layout(
+        const DynamicType_ptr& type)
+{
+    DynamicType_ptr resolved = resolve_alias(type);
+    auto it = layout_by_type_.find(resolved.get());
+    if (it != layout_by_type_.end())
+    {
+        return it->second;
+    }
+
+    // Registered before adding the members, so recursive types end up referencing themselves
+    uint32_t index = static_cast<uint32_t>(layouts_.size());
+    layouts_.emplace_back();
+    layout_by_type_[resolved.get()] = index;
+
+    TypeLayout layout;
+    layout.type = resolved;
+    auto primitive = [&layout](uint8_t size, uint8_t alignment)
+            {
+                layout.kind = TypeLayout::PRIMITIVE;
+                layout.size = size;
+                layout.alignment = alignment;
+            };
+
+    const TypeKind kind = resolved ? resolved->get_kind() : TK_NONE;
+    layout.type_kind = kind;
+    switch (kind)
+    {
+        case TK_BOOLEAN:
+        case TK_BYTE:
+        case TK_CHAR8:
+            primitive(1, 1);
+            break;
+        case TK_INT16:
+        case TK_UINT16:
+            primitive(2, 2);
+            break;
+        case TK_INT32:
+        case TK_UINT32:
+        case TK_FLOAT32:
+        case TK_ENUM:
+        // Wide characters are serialized with 4 bytes
+        case TK_CHAR16:
+            primitive(4, 4);
+            break;
+        case TK_INT64:
+        case TK_UINT64:
+        case TK_FLOAT64:
+            primitive(8, 8);
+            break;
+        case TK_FLOAT128:
+            primitive(16, 8);
+            break;
+        case TK_BITMASK:
+        {
+            uint32_t bits = resolved->get_type_descriptor()->get_bounds(0);
+            uint8_t size = bits <= 8 ? 1 : (bits <= 16 ? 2 : (bits <= 32 ? 4 : 8));
+            primitive(size, size);
+            break;
+        }
+        case TK_STRING8:
+            layout.kind = TypeLayout::STRING;
+            break;
+        case TK_STRING16:
+            layout.kind = TypeLayout::WSTRING;
+            break;
+        case TK_STRUCTURE:
+            layout.kind = TypeLayout::STRUCT;
+            add_struct_members(resolved, layout);
+            break;
+        case TK_ARRAY:
+            layout.kind = TypeLayout::ARRAY;
+            layout.element = add_layout(resolved->get_type_descriptor()->get_element_type());
+            layout.count = resolved->get_total_bounds();
+            break;
+        case TK_SEQUENCE:
+            layout.kind = TypeLayout::SEQUENCE;
+            layout.element = add_layout(resolved->get_type_descriptor()->get_element_type());
+            break;
+        case TK_MAP:
+            layout.kind = TypeLayout::MAP;
+            layout.key = add_layout(resolved->get_type_descriptor()->get_key_element_type());
+            layout.element = add_layout(resolved->get_type_descriptor()->get_element_type());
+            break;
+        case TK_UNION:
+        {
+            layout.kind = TypeLayout::UNION;
+            layout.element = add_layout(resolved->get_type_descriptor()->get_discriminator_type());
+            std::map<MemberId, DynamicTypeMember*> members;
+            resolved->get_all_members(members);
+            for (const auto& member : members)
+            {
+                const MemberDescriptor* descriptor = member.second->get_descriptor();
+                TypeLayout::Member union_member;
+                union_member.name = descriptor->get_name();
+                union_member.layout = add_layout(descriptor->get_type());
+                union_member.labels = descriptor->get_union_labels();
+                union_member.is_default = descriptor->is_default_union_value();
+                layout.members.push_back(std::move(union_member));
+            }
+            break;
+        }
+        default:
+            layout.kind = TypeLayout::UNSUPPORTED;
+            break;
+    }
+
+    switch (layout.kind)
+    {
+        case TypeLayout::PRIMITIVE:
+            layout.fixed = true;
+            layout.max_alignment = layout.alignment;
+            layout.min_size = layout.size;
+            break;
+        case TypeLayout::STRING:
+        case TypeLayout::WSTRING:
+        case TypeLayout::SEQUENCE:
+        case TypeLayout::MAP:
+            layout.alignment = 4;
+            layout.max_alignment = 4;
+            layout.min_size = 4;
+            break;
+        case TypeLayout::STRUCT:
+            layout.fixed = true;
+            for (const TypeLayout::Member& member : layout.members)
+            {
+                const TypeLayout& member_layout = layouts_[member.layout];
+                layout.fixed = layout.fixed && member_layout.fixed;
+                layout.max_alignment = std::max(layout.max_alignment, member_layout.max_alignment);
+                layout.min_size += member_layout.min_size;
+            }
+            break;
+        case TypeLayout::ARRAY:
+            layout.fixed = layouts_[layout.element].fixed;
+            layout.alignment = layouts_[layout.element].alignment;
+            layout.max_alignment = layouts_[layout.element].max_alignment;
+            layout.min_size = layout.count * layouts_[layout.element].min_size;
+            break;
+        case TypeLayout::UNION:
+            layout.max_alignment = 8;
+            layout.min_size = layouts_[layout.element].min_size;
+            break;
+        case TypeLayout::UNSUPPORTED:
+            break;
+    }
+
+    layouts_[index] = std::move(layout);
+    return index;
+}
+
+void DDSFilterExpression::add_struct_members(
+        const DynamicType_ptr& type,
+        TypeLayout& layout)
+{
+    // Members of the base type are serialized first
+    DynamicType_ptr base = resolve_alias(type->get_type_descriptor()->get_base_type());
+    if (base && base->get_kind() == TK_STRUCTURE)
+    {
+        add_struct_members(base, layout);
+    }
+
+    std::map<MemberId, DynamicTypeMember*> members;
+    type->get_all_members(members);
+    std::vector<const MemberDescriptor*> descriptors;
+    for (const auto& member : members)
+    {
+        if (!member.second->get_descriptor()->annotation_is_non_serialized())
+        {
+            descriptors.push_back(member.second->get_descriptor());
+        }
+    }
+    std::stable_sort(descriptors.begin(), descriptors.end(), [](const MemberDescriptor* a, const MemberDescriptor* b)
+            {
+                return a->get_index() < b->get_index();
+            });
+
+    for (const MemberDescriptor* descriptor : descriptors)
+    {
+        TypeLayout::Member member;
+        member.name = descriptor->get_name();
+        member.layout = add_layout(descriptor->get_type());
+        layout.members.push_back(std::move(member));
+    }
+}
+
+ReturnCode_t DDSFilterExpression::add_field(
+        const std::vector<DDSFilterFieldStep>& path,
+        uint16_t& index,
+        std::string& error)
+{
+    const std::string key = path_to_string(path);
+    auto it = field_by_path_.find(key);
+    if (it != field_by_path_.end())
+    {
+        index = it->second;
+        return ReturnCode_t::RETCODE_OK;
+    }
+
+    if (fields_.size() >= max_fields)
+    {
+        error = "Too many members referenced";
+        return ReturnCode_t::RETCODE_UNSUPPORTED;
+    }
+
+    Field field;
+    Cursor cursor;
+    uint32_t current = root_layout_;
+    for (const DDSFilterFieldStep& step : path)
+    {
+        const TypeLayout& parent = layouts_[current];
+        if (parent.kind != TypeLayout::STRUCT && parent.kind != TypeLayout::UNION)
+        {
+            error = "Cannot access member '" + step.name + "' of '" + key + "', its parent is not a structure";
+            return ReturnCode_t::RETCODE_BAD_PARAMETER;
+        }
+
+        size_t position = no_member;
+        for (size_t i = 0; i < parent.members.size(); ++i)
+        {
+            if (parent.members[i].name == step.name)
+            {
+                position = i;
+                break;
+            }
+        }
+        if (position == no_member)
+        {
+            error = "Member '" + step.name + "' of '" + key + "' not found";
+            return ReturnCode_t::RETCODE_BAD_PARAMETER;
+        }
+
+        if (parent.kind == TypeLayout::STRUCT)
+        {
+            for (size_t i = 0; i < position; ++i)
+            {
+                if (layouts_[parent.members[i].layout].kind == TypeLayout::UNSUPPORTED)
+                {
+                    error = "Member '" + parent.members[i].name + "' before '" + key + "' cannot be skipped";
+                    return ReturnCode_t::RETCODE_UNSUPPORTED;
+                }
+                emit_skip(field, cursor, parent.members[i].layout, 1);
+            }
+        }
+        else
+        {
+            flush(field, cursor);
+            field.steps.push_back({FieldStep::UNION_SELECT, current, position});
+            cursor.anchor_alignment = layouts_[parent.element].alignment;
+        }
+        current = parent.members[position].layout;
+
+        if (step.index != DDSFilterFieldStep::no_index)
+        {
+            const TypeLayout& container = layouts_[current];
+            if (container.kind == TypeLayout::ARRAY)
+            {
+                if (step.index >= container.count)
+                {
+                    error = "Index of '" + key + "' out of bounds";
+                    return ReturnCode_t::RETCODE_BAD_PARAMETER;
+                }
+            }
+            else if (container.kind == TypeLayout::SEQUENCE)
+            {
+                flush(field, cursor);
+                field.steps.push_back({FieldStep::SEQUENCE_INDEX, current, step.index});
+                cursor.anchor_alignment = 4;
+            }
+            else
+            {
+                error = "Member '" + step.name + "' of '" + key + "' is not an array nor a sequence";
+                return ReturnCode_t::RETCODE_BAD_PARAMETER;
+            }
+
+            if (layouts_[container.element].kind == TypeLayout::UNSUPPORTED)
+            {
+                error = "Elements of '" + step.name + "' cannot be skipped";
+                return ReturnCode_t::RETCODE_UNSUPPORTED;
+            }
+            emit_skip(field, cursor, container.element, step.index);
+            current = container.element;
+        }
+    }
+
+    const TypeLayout& layout = layouts_[current];
+    if (!is_comparable_layout(layout))
+    {
+        error = "Member '" + key + "' cannot be compared";
+        return layout.kind == TypeLayout::PRIMITIVE || layout.kind == TypeLayout::WSTRING ?
+               ReturnCode_t::RETCODE_UNSUPPORTED : ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    align(field, cursor, layout.alignment);
+    flush(field, cursor);
+    field.layout = current;
+
+    index = static_cast<uint16_t>(fields_.size());
+    fields_.push_back(std::move(field));
+    field_by_path_[key] = index;
+    return ReturnCode_t::RETCODE_OK;
+}
+
+void DDSFilterExpression::align(
+        Field& field,
+        Cursor& cursor,
+        uint32_t alignment) const
+{
+    if (alignment <= cursor.anchor_alignment)
+    {
+        cursor.offset = round_up(cursor.offset, alignment);
+    }
+    else
+    {
+        flush(field, cursor);
+        field.steps.push_back({FieldStep::ALIGN, 0, alignment});
+        cursor.anchor_alignment = alignment;
+    }
+}
+
+void DDSFilterExpression::flush(
+        Field& field,
+        Cursor& cursor) const
+{
+    if (cursor.offset > 0)
+    {
+        field.steps.push_back({FieldStep::ADVANCE, 0, cursor.offset});
+        while (cursor.offset % cursor.anchor_alignment != 0)
+        {
+            cursor.anchor_alignment /= 2;
+        }
+        cursor.offset = 0;
+    }
+}
+
+void DDSFilterExpression::emit_skip(
+        Field& field,
+        Cursor& cursor,
+        uint32_t layout_index,
+        uint64_t count) const
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    const TypeLayout& layout = layouts_[layout_index];
+    if (layout.kind == TypeLayout::PRIMITIVE ||
+            (layout.kind == TypeLayout::ARRAY && layouts_[layout.element].kind == TypeLayout::PRIMITIVE))
+    {
+        // The first byte is aligned as the whole type, so it can be aligned in advance
+        align(field, cursor, layout.alignment);
+    }
+
+    if (layout.fixed && layout.max_alignment <= cursor.anchor_alignment)
+    {
+        // Folded into a constant offset
+        static_skip(layout_index, count, cursor.offset);
+        return;
+    }
+
+    flush(field, cursor);
+    field.steps.push_back({FieldStep::SKIP, layout_index, count});
+    cursor.anchor_alignment = 1;
+}
+
+void DDSFilterExpression::static_skip(
+        uint32_t layout_index,
+        uint64_t count,
+        uint64_t& offset) const
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    const TypeLayout& layout = layouts_[layout_index];
+    switch (layout.kind)
+    {
+        case TypeLayout::PRIMITIVE:
+            offset = round_up(offset, layout.alignment) + count * layout.size;
+            break;
+
+        case TypeLayout::ARRAY:
+            static_skip(layout.element, count * layout.count, offset);
+            break;
+
+        case TypeLayout::STRUCT:
+        {
+            auto skip_one = [this, &layout](uint64_t& position)
+                    {
+                        for (const TypeLayout::Member& member : layout.members)
+                        {
+                            static_skip(member.layout, 1, position);
+                        }
+                    };
+
+            uint64_t first = offset;
+            skip_one(first);
+            if (count == 1)
+            {
+                offset = first;
+                break;
+            }
+
+            uint64_t second = first;
+            skip_one(second);
+            if (first % layout.max_alignment == second % layout.max_alignment)
+            {
+                // Once the alignment repeats, all the remaining elements take the same size
+                offset = first + (count - 1) * (second - first);
+            }
+            else
+            {
+                offset = second;
+                for (uint64_t i = 2; i < count; ++i)
+                {
+                    skip_one(offset);
+                }
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+ReturnCode_t DDSFilterExpression::resolve_operand(
+        const DDSFilterOperand& operand,
+        const std::vector<std::string>& parameters,
+        Operand& result,
+        std::string& error)
+{
+    if (operand.kind == DDSFilterOperand::PARAMETER)
+    {
+        if (operand.parameter >= parameters.size())
+        {
+            error = "Missing value for parameter %" + std::to_string(operand.parameter);
+            return ReturnCode_t::RETCODE_BAD_PARAMETER;
+        }
+
+        // Parameters that are not a single literal are taken as strings, i.e. enumerator names
+        if (!parse_literal(parameters[operand.parameter], result.literal))
+        {
+            result.literal = DDSFilterOperand();
+            result.literal.kind = DDSFilterOperand::STRING;
+            result.literal.text = parameters[operand.parameter];
+        }
+        return ReturnCode_t::RETCODE_OK;
+    }
+
+    if (operand.kind == DDSFilterOperand::FIELD)
+    {
+        // A single identifier that is not a member of the type may be an enumerator name
+        const DDSFilterFieldStep& first = operand.path.front();
+        if (operand.path.size() == 1 && first.index == DDSFilterFieldStep::no_index)
+        {
+            const std::vector<TypeLayout::Member>& members = layouts_[root_layout_].members;
+            if (std::none_of(members.begin(), members.end(), [&first](const TypeLayout::Member& member)
+                    {
+                        return member.name == first.name;
+                    }))
+            {
+                result.literal = operand;
+                return ReturnCode_t::RETCODE_OK;
+            }
+        }
+
+        result.is_field = true;
+        return add_field(operand.path, result.field, error);
+    }
+
+    result.literal = operand;
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t DDSFilterExpression::make_constant(
+        const DDSFilterOperand& literal,
+        const TypeLayout& field_layout,
+        uint16_t& index,
+        std::string& error)
+{
+    if (constants_.size() >= constant_flag)
+    {
+        error = "Too many constants";
+        return ReturnCode_t::RETCODE_UNSUPPORTED;
+    }
+
+    Value value;
+    if (is_string_layout(field_layout))
+    {
+        if (literal.kind != DDSFilterOperand::STRING)
+        {
+            error = "String members can only be compared with strings, not with '" + literal.text + "'";
+            return ReturnCode_t::RETCODE_BAD_PARAMETER;
+        }
+        constant_strings_.push_back(literal.text);
+        value.kind = Value::STRING;
+        value.string_value = constant_strings_.back().c_str();
+        value.string_length = static_cast<uint32_t>(constant_strings_.back().size());
+    }
+    else
+    {
+        switch (literal.kind)
+        {
+            case DDSFilterOperand::INTEGER:
+            {
+                const char* text = literal.text.c_str();
+                char* end = nullptr;
+                errno = 0;
+                if (text[0] == '-')
+                {
+                    value.kind = Value::SIGNED;
+                    value.signed_value = std::strtoll(text, &end, 0);
+                }
+                else
+                {
+                    value.kind = Value::UNSIGNED;
+                    value.unsigned_value = std::strtoull(text, &end, 0);
+                }
+                if (errno == ERANGE || *end != '\0')
+                {
+                    error = "Integer literal '" + literal.text + "' out of range";
+                    return ReturnCode_t::RETCODE_BAD_PARAMETER;
+                }
+                break;
+            }
+
+            case DDSFilterOperand::FLOAT:
+                value.kind = Value::FLOAT;
+                value.float_value = std::strtod(literal.text.c_str(), nullptr);
+                break;
+
+            case DDSFilterOperand::BOOLEAN:
+                value.kind = Value::UNSIGNED;
+                value.unsigned_value = std::toupper(static_cast<unsigned char>(literal.text[0])) == 'T' ? 1 : 0;
+                break;
+
+            default:
+            {
+                // Enumerator names, either as identifiers or as strings
+                if (field_layout.type_kind == TK_ENUM)
+                {
+                    std::map<std::string, DynamicTypeMember*> enumerators;
+                    field_layout.type->get_all_members_by_name(enumerators);
+                    auto it = enumerators.find(literal.text);
+                    if (it != enumerators.end())
+                    {
+                        value.kind = Value::UNSIGNED;
+                        value.unsigned_value = it->second->get_descriptor()->get_index();
+                        break;
+                    }
+                    error = "'" + literal.text + "' is not an enumerator of " + field_layout.type->get_name();
+                }
+                else
+                {
+                    error = "Numeric members cannot be compared with '" + literal.text + "'";
+                }
+                return ReturnCode_t::RETCODE_BAD_PARAMETER;
+            }
+        }
+    }
+
+    index = static_cast<uint16_t>(constants_.size()) | constant_flag;
+    constants_.push_back(value);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t DDSFilterExpression::compile_predicate(
+        const DDSFilterCondition& condition,
+        const std::vector<std::string>& parameters,
+        std::string& error)
+{
+    std::vector<Operand> operands(condition.operands.size());
+    for (size_t i = 0; i < operands.size(); ++i)
+    {
+        ReturnCode_t ret = resolve_operand(condition.operands[i], parameters, operands[i], error);
+        if (ret != ReturnCode_t::RETCODE_OK)
+        {
+            return ret;
+        }
+    }
+
+    // Literals take the type of the members they are compared with
+    auto reference = std::find_if(operands.begin(), operands.end(), [](const Operand& operand)
+                    {
+                        return operand.is_field;
+                    });
+    if (reference == operands.end())
+    {
+        error = "Predicates must reference at least one member";
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    const TypeLayout& reference_layout = layouts_[fields_[reference->field].layout];
+
+    const bool is_like = condition.kind == DDSFilterCondition::COMPARISON && condition.op == DDSFilterCondition::LIKE;
+    if (is_like && (!operands[0].is_field || !is_string_layout(reference_layout) || operands[1].is_field))
+    {
+        error = "LIKE can only match string members with a pattern";
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    Instruction instruction;
+    instruction.code = condition.kind == DDSFilterCondition::BETWEEN ? Instruction::BETWEEN : Instruction::COMPARE;
+    instruction.op = condition.op;
+    for (size_t i = 0; i < operands.size(); ++i)
+    {
+        if (operands[i].is_field)
+        {
+            if (is_string_layout(layouts_[fields_[operands[i].field].layout]) != is_string_layout(reference_layout))
+            {
+                error = "String members cannot be compared with numeric members";
+                return ReturnCode_t::RETCODE_BAD_PARAMETER;
+            }
+            instruction.operands[i] = operands[i].field;
+        }
+        else
+        {
+            ReturnCode_t ret = make_constant(operands[i].literal, reference_layout, instruction.operands[i], error);
+            if (ret != ReturnCode_t::RETCODE_OK)
+            {
+                return ret;
+            }
+        }
+    }
+
+    program_.push_back(instruction);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t DDSFilterExpression::compile_condition(
+        const DDSFilterCondition& condition,
+        const std::vector<std::string>& parameters,
+        std::string& error)
+{
+    switch (condition.kind)
+    {
+        case DDSFilterCondition::AND:
+        case DDSFilterCondition::OR:
+        {
+            ReturnCode_t ret = compile_condition(*condition.left, parameters, error);
+            if (ret != ReturnCode_t::RETCODE_OK)
+            {
+                return ret;
+            }
+
+            // Short-circuit: the result of the left condition is the result of the whole condition
+            size_t jump = program_.size();
+            Instruction instruction;
+            instruction.code = condition.kind == DDSFilterCondition::AND ?
+                    Instruction::JUMP_IF_FALSE : Instruction::JUMP_IF_TRUE;
+            program_.push_back(instruction);
+
+            ret = compile_condition(*condition.right, parameters, error);
+            program_[jump].target = static_cast<uint32_t>(program_.size());
+            return ret;
+        }
+
+        case DDSFilterCondition::NOT:
+        {
+            ReturnCode_t ret = compile_condition(*condition.left, parameters, error);
+            Instruction instruction;
+            instruction.code = Instruction::NOT;
+            program_.push_back(instruction);
+            return ret;
+        }
+
+        default:
+            return compile_predicate(condition, parameters, error);
+    }
+}
+
+bool DDSFilterExpression::read_field(
+        const Field& field,
+        CdrReader& reader,
+        Value& value,
+        bool& present) const
+{
+    present = true;
+    for (const FieldStep& step : field.steps)
+    {
+        switch (step.code)
+        {
+            case FieldStep::ALIGN:
+                if (!reader.align(step.argument))
+                {
+                    return false;
+                }
+                break;
+
+            case FieldStep::ADVANCE:
+                if (!reader.advance(step.argument))
+                {
+                    return false;
+                }
+                break;
+
+            case FieldStep::SKIP:
+                if (!skip(step.layout, reader, step.argument))
+                {
+                    return false;
+                }
+                break;
+
+            case FieldStep::SEQUENCE_INDEX:
+            {
+                uint32_t length = 0;
+                if (!reader.read_length(length))
+                {
+                    return false;
+                }
+                if (step.argument >= length)
+                {
+                    present = false;
+                    return true;
+                }
+                break;
+            }
+
+            case FieldStep::UNION_SELECT:
+            {
+                size_t selected = no_member;
+                if (!read_discriminator(step.layout, reader, selected))
+                {
+                    return false;
+                }
+                if (selected != step.argument)
+                {
+                    present = false;
+                    return true;
+                }
+                break;
+            }
+        }
+    }
+
+    return load(layouts_[field.layout], reader, value);
+}
+
+bool DDSFilterExpression::read_discriminator(
+        uint32_t layout_index,
+        CdrReader& reader,
+        size_t& selected) const
+{
+    const TypeLayout& layout = layouts_[layout_index];
+    Value discriminator;
+    if (!load(layouts_[layout.element], reader, discriminator))
+    {
+        return false;
+    }
+
+    uint64_t label = 0;
+    switch (discriminator.kind)
+    {
+        case Value::SIGNED:
+            label = static_cast<uint64_t>(discriminator.signed_value);
+            break;
+        case Value::STRING:
+            label = discriminator.string_length > 0 ? static_cast<uint8_t>(discriminator.string_value[0]) : 0;
+            break;
+        default:
+            label = discriminator.unsigned_value;
+            break;
+    }
+
+    selected = no_member;
+    for (size_t i = 0; i < layout.members.size() && selected == no_member; ++i)
+    {
+        const std::vector<uint64_t>& labels = layout.members[i].labels;
+        if (std::find(labels.begin(), labels.end(), label) != labels.end())
+        {
+            selected = i;
+        }
+    }
+    for (size_t i = 0; i < layout.members.size() && selected == no_member; ++i)
+    {
+        if (layout.members[i].is_default)
+        {
+            selected = i;
+        }
+    }
+    return true;
+}
+
+bool DDSFilterExpression::load(
+        const TypeLayout& layout,
+        CdrReader& reader,
+        Value& value) const
+{
+    if (layout.kind == TypeLayout::STRING)
+    {
+        uint32_t length = 0;
+        if (!reader.read_length(length))
+        {
+            return false;
+        }
+        const char* characters = reinterpret_cast<const char*>(reader.position());
+        if (!reader.advance(length))
+        {
+            return false;
+        }
+        // The length includes the null terminator
+        value.kind = Value::STRING;
+        value.string_value = characters;
+        value.string_length = (length > 0 && characters[length - 1] == '\0') ? length - 1 : length;
+        return true;
+    }
+
+    uint8_t buffer[16];
+    if (!reader.align(layout.alignment) || !reader.read(buffer, layout.size))
+    {
+        return false;
+    }
+
+    switch (layout.type_kind)
+    {
+        case TK_CHAR8:
+            value.kind = Value::STRING;
+            value.string_value = reinterpret_cast<const char*>(reader.position()) - 1;
+            value.string_length = 1;
+            break;
+        case TK_INT16:
+            value.kind = Value::SIGNED;
+            value.signed_value = from_bytes<int16_t>(buffer);
+            break;
+        case TK_INT32:
+            value.kind = Value::SIGNED;
+            value.signed_value = from_bytes<int32_t>(buffer);
+            break;
+        case TK_INT64:
+            value.kind = Value::SIGNED;
+            value.signed_value = from_bytes<int64_t>(buffer);
+            break;
+        case TK_FLOAT32:
+            value.kind = Value::FLOAT;
+            value.float_value = from_bytes<float>(buffer);
+            break;
+        case TK_FLOAT64:
+            value.kind = Value::FLOAT;
+            value.float_value = from_bytes<double>(buffer);
+            break;
+        default:
+            // Booleans, octets, unsigned integers, enumerations and bitmasks
+            value.kind = Value::UNSIGNED;
+            switch (layout.size)
+            {
+                case 1:
+                    value.unsigned_value = buffer[0];
+                    break;
+                case 2:
+                    value.unsigned_value = from_bytes<uint16_t>(buffer);
+                    break;
+                case 4:
+                    value.unsigned_value = from_bytes<uint32_t>(buffer);
+                    break;
+                default:
+                    value.unsigned_value = from_bytes<uint64_t>(buffer);
+                    break;
+            }
+            break;
+    }
+    return true;
+}
+
+bool DDSFilterExpression::skip(
+        uint32_t layout_index,
+        CdrReader& reader,
+        uint64_t count) const
+{
+    const TypeLayout& layout = layouts_[layout_index];
+    if (layout.fixed)
+    {
+        // The stream starts aligned to 8, so the absolute offset gives the exact padding
+        uint64_t offset = reader.offset();
+        static_skip(layout_index, count, offset);
+        return reader.advance(offset - reader.offset());
+    }
+
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        switch (layout.kind)
+        {
+            case TypeLayout::STRING:
+            case TypeLayout::WSTRING:
+            {
+                uint32_t length = 0;
+                if (!reader.read_length(length) ||
+                        !reader.advance(static_cast<uint64_t>(length) * (layout.kind == TypeLayout::WSTRING ? 4 : 1)))
+                {
+                    return false;
+                }
+                break;
+            }
+
+            case TypeLayout::STRUCT:
+                for (const TypeLayout::Member& member : layout.members)
+                {
+                    if (!skip(member.layout, reader, 1))
+                    {
+                        return false;
+                    }
+                }
+                break;
+
+            case TypeLayout::ARRAY:
+                if (!skip(layout.element, reader, layout.count))
+                {
+                    return false;
+                }
+                break;
+
+            case TypeLayout::SEQUENCE:
+            case TypeLayout::MAP:
+            {
+                uint32_t length = 0;
+                if (!reader.read_length(length))
+                {
+                    return false;
+                }
+
+                // Reject lengths that cannot fit on the payload before iterating over them
+                uint64_t element_size = layouts_[layout.element].min_size;
+                if (layout.kind == TypeLayout::MAP)
+                {
+                    element_size += layouts_[layout.key].min_size;
+                }
+                if (length > reader.remaining() / std::max<uint64_t>(element_size, 1))
+                {
+                    return false;
+                }
+
+                if (layout.kind == TypeLayout::SEQUENCE)
+                {
+                    if (!skip(layout.element, reader, length))
+                    {
+                        return false;
+                    }
+                }
+                else
+                {
+                    for (uint32_t n = 0; n < length; ++n)
+                    {
+                        if (!skip(layout.key, reader, 1) || !skip(layout.element, reader, 1))
+                        {
+                            return false;
+                        }
+                    }
+                }
+                break;
+            }
+
+            case TypeLayout::UNION:
+            {
+                size_t selected = no_member;
+                if (!read_discriminator(layout_index, reader, selected) ||
+                        (selected != no_member && !skip(layout.members[selected].layout, reader, 1)))
+                {
+                    return false;
+                }
+                break;
+            }
+
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+bool DDSFilterExpression::is_string_layout(
+        const TypeLayout& layout)
+{
+    return layout.kind == TypeLayout::STRING || layout.type_kind == TK_CHAR8;
+}
+
+bool DDSFilterExpression::is_comparable_layout(
+        const TypeLayout& layout)
+{
+    return layout.kind == TypeLayout::STRING ||
+           (layout.kind == TypeLayout::PRIMITIVE && layout.type_kind != TK_FLOAT128 &&
+           layout.type_kind != TK_CHAR16);
+}
+
+} // namespace DDSSQLFilter
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
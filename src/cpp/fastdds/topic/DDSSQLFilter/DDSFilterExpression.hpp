@@ -0,0 +1,348 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file DDSFilterExpression.hpp
+ */
+
+#ifndef _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTEREXPRESSION_HPP_
+#define _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTEREXPRESSION_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastrtps/types/DynamicTypePtr.h>
+#include <fastrtps/types/TypesBase.h>
+
+#include <fastdds/topic/DDSSQLFilter/DDSFilterParser.hpp>
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+using eprosima::fastrtps::types::ReturnCode_t;
+
+namespace DDSSQLFilter {
+
+class CdrReader;
+
+/*!
+ * A DDS-SQL filter expression compiled for a data type.
+ *
+ * The members referenced by the expression are resolved on the DynamicType of the topic when the
+ * expression is compiled, and translated into the sequence of alignment and skip operations needed
+ * to reach them on a CDR stream. The expression itself is compiled into a flat program with
+ * short-circuit jumps, so evaluating a sample reads only the referenced members straight from the
+ * serialized payload, without deserializing it.
+ */
+class DDSFilterExpression
+{
+public:
+
+    //! Name of the filter class implemented by this expression, as propagated through discovery
+    static constexpr const char* filter_class_name = "DDSSQL";
+
+    //! Maximum number of different members an expression may reference
+    static constexpr size_t max_fields = 32;
+
+    DDSFilterExpression() = default;
+
+    DDSFilterExpression(
+            const DDSFilterExpression&) = delete;
+
+    DDSFilterExpression& operator =(
+            const DDSFilterExpression&) = delete;
+
+    /*!
+     * Compiles a filter expression.
+     * @param type DynamicType describing the data type of the topic.
+     * @param expression Filter expression. An empty expression lets all the samples pass.
+     * @param parameters Values of the parameters referenced on the expression.
+     * @return RETCODE_OK if the expression was compiled, RETCODE_BAD_PARAMETER if the expression is not valid for
+     * the type, or RETCODE_UNSUPPORTED if it references members that cannot be filtered.
+     */
+    ReturnCode_t compile(
+            const fastrtps::types::DynamicType_ptr& type,
+            const std::string& expression,
+            const std::vector<std::string>& parameters);
+
+    /*!
+     * Evaluates the expression on a serialized sample.
+     * Samples that cannot be evaluated (not encoded with plain CDR, or truncated) pass the filter.
+     * @param payload Serialized sample, including its encapsulation.
+     * @return true if the sample passes the filter.
+     */
+    bool evaluate(
+            const fastrtps::rtps::SerializedPayload_t& payload) const;
+
+    /*!
+     * Gets the DynamicType describing the data type of a TypeSupport, either because the type is a dynamic type
+     * or from the TypeObject registered for it.
+     * @param type TypeSupport of the topic.
+     * @return The DynamicType, or nullptr if no type information is available.
+     */
+    static fastrtps::types::DynamicType_ptr get_dynamic_type(
+            const TypeSupport& type);
+
+    struct Value
+    {
+        enum Kind : uint8_t
+        {
+            SIGNED,
+            UNSIGNED,
+            FLOAT,
+            STRING
+        };
+
+        Kind kind = SIGNED;
+        union
+        {
+            int64_t signed_value;
+            uint64_t unsigned_value;
+            double float_value;
+        };
+
+        //! Characters of STRING values, not null-terminated
+        const char* string_value = nullptr;
+        uint32_t string_length = 0;
+
+        Value()
+            : signed_value(0)
+        {
+        }
+
+    };
+
+    //! Description of how a type is laid out on a CDR stream
+    struct TypeLayout
+    {
+        enum Kind : uint8_t
+        {
+            PRIMITIVE,
+            STRING,
+            WSTRING,
+            STRUCT,
+            ARRAY,
+            SEQUENCE,
+            MAP,
+            UNION,
+            //! Types that cannot be skipped nor compared, like bitsets
+            UNSUPPORTED
+        };
+
+        struct Member
+        {
+            std::string name;
+            uint32_t layout = 0;
+            std::vector<uint64_t> labels;
+            bool is_default = false;
+        };
+
+        Kind kind = UNSUPPORTED;
+        //! TypeKind of PRIMITIVE types, including TK_ENUM and TK_BITMASK
+        fastrtps::types::TypeKind type_kind = fastrtps::types::TK_NONE;
+        uint8_t size = 0;
+        uint8_t alignment = 1;
+        //! Largest alignment used inside the type
+        uint8_t max_alignment = 1;
+        //! Whether the size of the type only depends on the alignment it starts with
+        bool fixed = false;
+        //! Element layout of ARRAY, SEQUENCE and MAP types, discriminator layout of UNION types
+        uint32_t element = 0;
+        //! Key layout of MAP types
+        uint32_t key = 0;
+        //! Number of elements of ARRAY types
+        uint64_t count = 0;
+        //! Minimum number of bytes taken by an instance of the type
+        uint64_t min_size = 0;
+        //! Members of STRUCT (including the ones of the base type) and UNION types
+        std::vector<Member> members;
+        //! Type the layout was built from, used to resolve enumerator names
+        fastrtps::types::DynamicType_ptr type;
+    };
+
+private:
+
+    //! Operation to reach a member on the CDR stream
+    struct FieldStep
+    {
+        enum OpCode : uint8_t
+        {
+            //! Align to argument bytes
+            ALIGN,
+            //! Advance argument bytes
+            ADVANCE,
+            //! Skip argument instances of layout
+            SKIP,
+            //! Read the length of a sequence, the member is absent unless argument is a valid index
+            SEQUENCE_INDEX,
+            //! Read the discriminator of union layout, the member is absent unless argument is the selected member
+            UNION_SELECT
+        };
+
+        OpCode code;
+        uint32_t layout;
+        uint64_t argument;
+    };
+
+    struct Field
+    {
+        std::vector<FieldStep> steps;
+        uint32_t layout = 0;
+    };
+
+    //! Position on the CDR stream known while compiling a field
+    struct Cursor
+    {
+        //! Alignment guaranteed on the last position that is only known at runtime
+        uint32_t anchor_alignment = 8;
+        //! Bytes from that position
+        uint64_t offset = 0;
+    };
+
+    struct Instruction
+    {
+        enum OpCode : uint8_t
+        {
+            COMPARE,
+            BETWEEN,
+            NOT,
+            JUMP_IF_FALSE,
+            JUMP_IF_TRUE
+        };
+
+        OpCode code = COMPARE;
+        DDSFilterCondition::Operator op = DDSFilterCondition::EQUAL;
+        //! Operands, with constant_flag set for constants
+        uint16_t operands[3] = {0, 0, 0};
+        //! Target of jumps
+        uint32_t target = 0;
+    };
+
+    struct Operand
+    {
+        bool is_field = false;
+        uint16_t field = 0;
+        DDSFilterOperand literal;
+    };
+
+    static constexpr uint16_t constant_flag = 0x8000;
+
+    static constexpr size_t no_member = static_cast<size_t>(-1);
+
+    uint32_t add_layout(
+            const fastrtps::types::DynamicType_ptr& type);
+
+    void add_struct_members(
+            const fastrtps::types::DynamicType_ptr& type,
+            TypeLayout& layout);
+
+    ReturnCode_t add_field(
+            const std::vector<DDSFilterFieldStep>& path,
+            uint16_t& index,
+            std::string& error);
+
+    void align(
+            Field& field,
+            Cursor& cursor,
+            uint32_t alignment) const;
+
+    void flush(
+            Field& field,
+            Cursor& cursor) const;
+
+    void emit_skip(
+            Field& field,
+            Cursor& cursor,
+            uint32_t layout,
+            uint64_t count) const;
+
+    void static_skip(
+            uint32_t layout,
+            uint64_t count,
+            uint64_t& offset) const;
+
+    ReturnCode_t resolve_operand(
+            const DDSFilterOperand& operand,
+            const std::vector<std::string>& parameters,
+            Operand& result,
+            std::string& error);
+
+    ReturnCode_t make_constant(
+            const DDSFilterOperand& literal,
+            const TypeLayout& field_layout,
+            uint16_t& index,
+            std::string& error);
+
+    ReturnCode_t compile_predicate(
+            const DDSFilterCondition& condition,
+            const std::vector<std::string>& parameters,
+            std::string& error);
+
+    ReturnCode_t compile_condition(
+            const DDSFilterCondition& condition,
+            const std::vector<std::string>& parameters,
+            std::string& error);
+
+    bool read_field(
+            const Field& field,
+            CdrReader& reader,
+            Value& value,
+            bool& present) const;
+
+    bool read_discriminator(
+            uint32_t layout,
+            CdrReader& reader,
+            size_t& selected) const;
+
+    bool load(
+            const TypeLayout& layout,
+            CdrReader& reader,
+            Value& value) const;
+
+    bool skip(
+            uint32_t layout,
+            CdrReader& reader,
+            uint64_t count) const;
+
+    static bool is_string_layout(
+            const TypeLayout& layout);
+
+    static bool is_comparable_layout(
+            const TypeLayout& layout);
+
+    std::vector<TypeLayout> layouts_;
+    std::map<const void*, uint32_t> layout_by_type_;
+    uint32_t root_layout_ = 0;
+    std::vector<Field> fields_;
+    std::map<std::string, uint16_t> field_by_path_;
+    std::vector<Value> constants_;
+    //! Storage of the characters of string constants, stable when new constants are added
+    std::deque<std::string> constant_strings_;
+    std::vector<Instruction> program_;
+};
+
+} // namespace DDSSQLFilter
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTEREXPRESSION_HPP_
@@ -0,0 +1,642 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file DDSFilterParser.cpp
+ */
+
+#include <fastdds/topic/DDSSQLFilter/DDSFilterParser.hpp>
+
+#include <cctype>
+#include <cstdlib>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace DDSSQLFilter {
+
+constexpr uint32_t DDSFilterFieldStep::no_index;
+
+namespace {
+
+struct Token
+{
+    enum Kind
+    {
+        END,
+        IDENTIFIER,
+        INTEGER,
+        FLOAT,
+        STRING,
+        PARAMETER,
+        OPERATOR,
+        LEFT_PAREN,
+        RIGHT_PAREN,
+        LEFT_BRACKET,
+        RIGHT_BRACKET,
+        DOT,
+        KW_AND,
+        KW_OR,
+        KW_NOT,
+        KW_BETWEEN,
+        KW_LIKE,
+        KW_TRUE,
+        KW_FALSE
+    };
+
+    Kind kind = END;
+    std::string text;
+    DDSFilterCondition::Operator op = DDSFilterCondition::EQUAL;
+    size_t position = 0;
+};
+
+bool equals_no_case(
+        const std::string& text,
+        const char* keyword)
+{
+    size_t i = 0;
+    for (; i < text.size() && keyword[i] != '\0'; ++i)
+    {
+        if (std::toupper(static_cast<unsigned char>(text[i])) != keyword[i])
+        {
+            return false;
+        }
+    }
+    return i == text.size() && keyword[i] == '\0';
+}
+
+class Lexer
+{
+public:
+
+    explicit Lexer(
+            const std::string& input)
+        : input_(input)
+    {
+    }
+
+    //! Reads the next token, returning false on a lexical error
+    bool next(
+            Token& token,
+            std::string& error)
+    {
+        while (pos_ < input_.size() && std::isspace(static_cast<unsigned char>(input_[pos_])))
+        {
+            ++pos_;
+        }
+
+        token = Token();
+        token.position = pos_;
+        if (pos_ >= input_.size())
+        {
+            return true;
+        }
+
+        char c = input_[pos_];
+        if (std::isalpha(static_cast<unsigned char>(c)) || c == '_')
+        {
+            size_t start = pos_;
+            while (pos_ < input_.size() &&
+                    (std::isalnum(static_cast<unsigned char>(input_[pos_])) || input_[pos_] == '_'))
+            {
+                ++pos_;
+            }
+            token.text = input_.substr(start, pos_ - start);
+            token.kind = keyword(token.text);
+            return true;
+        }
+
+        if (std::isdigit(static_cast<unsigned char>(c)) ||
+                ((c == '-' || c == '+') && pos_ + 1 < input_.size() &&
+                std::isdigit(static_cast<unsigned char>(input_[pos_ + 1]))))
+        {
+            return number(token, error);
+        }
+
+        switch (c)
+        {
+            case '\'':
+            case '`':
+            {
+                // Both 'text' and `text' are accepted as string literals
+                size_t end = input_.find('\'', pos_ + 1);
+                if (end == std::string::npos)
+                {
+                    error = "Unterminated string literal at position " + std::to_string(pos_);
+                    return false;
+                }
+                token.kind = Token::STRING;
+                token.text = input_.substr(pos_ + 1, end - pos_ - 1);
+                pos_ = end + 1;
+                return true;
+            }
+            case '%':
+            {
+                size_t start = ++pos_;
+                while (pos_ < input_.size() && std::isdigit(static_cast<unsigned char>(input_[pos_])))
+                {
+                    ++pos_;
+                }
+                if (start == pos_ || pos_ - start > 2)
+                {
+                    error = "Invalid parameter reference at position " + std::to_string(start - 1);
+                    return false;
+                }
+                token.kind = Token::PARAMETER;
+                token.text = input_.substr(start, pos_ - start);
+                return true;
+            }
+            case '(':
+                token.kind = Token::LEFT_PAREN;
+                ++pos_;
+                return true;
+            case ')':
+                token.kind = Token::RIGHT_PAREN;
+                ++pos_;
+                return true;
+            case '[':
+                token.kind = Token::LEFT_BRACKET;
+                ++pos_;
+                return true;
+            case ']':
+                token.kind = Token::RIGHT_BRACKET;
+                ++pos_;
+                return true;
+            case '.':
+                token.kind = Token::DOT;
+                ++pos_;
+                return true;
+            case '=':
+                return relational(token, DDSFilterCondition::EQUAL, 1);
+            case '<':
+                if (follows('='))
+                {
+                    return relational(token, DDSFilterCondition::LESS_EQUAL, 2);
+                }
+                if (follows('>'))
+                {
+                    return relational(token, DDSFilterCondition::NOT_EQUAL, 2);
+                }
+                return relational(token, DDSFilterCondition::LESS, 1);
+            case '>':
+                if (follows('='))
+                {
+                    return relational(token, DDSFilterCondition::GREATER_EQUAL, 2);
+                }
+                return relational(token, DDSFilterCondition::GREATER, 1);
+            case '!':
+                if (follows('='))
+                {
+                    return relational(token, DDSFilterCondition::NOT_EQUAL, 2);
+                }
+                break;
+            default:
+                break;
+        }
+
+        error = std::string("Unexpected character '") + c + "' at position " + std::to_string(pos_);
+        return false;
+    }
+
+private:
+
+    static Token::Kind keyword(
+            const std::string& text)
+    {
+        if (equals_no_case(text, "AND"))
+        {
+            return Token::KW_AND;
+        }
+        if (equals_no_case(text, "OR"))
+        {
+            return Token::KW_OR;
+        }
+        if (equals_no_case(text, "NOT"))
+        {
+            return Token::KW_NOT;
+        }
+        if (equals_no_case(text, "BETWEEN"))
+        {
+            return Token::KW_BETWEEN;
+        }
+        if (equals_no_case(text, "LIKE"))
+        {
+            return Token::KW_LIKE;
+        }
+        if (equals_no_case(text, "TRUE"))
+        {
+            return Token::KW_TRUE;
+        }
+        if (equals_no_case(text, "FALSE"))
+        {
+            return Token::KW_FALSE;
+        }
+        return Token::IDENTIFIER;
+    }
+
+    bool follows(
+            char c) const
+    {
+        return pos_ + 1 < input_.size() && input_[pos_ + 1] == c;
+    }
+
+    bool relational(
+            Token& token,
+            DDSFilterCondition::Operator op,
+            size_t length)
+    {
+        token.kind = Token::OPERATOR;
+        token.op = op;
+        pos_ += length;
+        return true;
+    }
+
+    bool number(
+            Token& token,
+            std::string& error)
+    {
+        size_t start = pos_;
+        if (input_[pos_] == '-' || input_[pos_] == '+')
+        {
+            ++pos_;
+        }
+
+        token.kind = Token::INTEGER;
+        if (input_[pos_] == '0' && pos_ + 1 < input_.size() && (input_[pos_ + 1] == 'x' || input_[pos_ + 1] == 'X'))
+        {
+            pos_ += 2;
+            size_t digits = pos_;
+            while (pos_ < input_.size() && std::isxdigit(static_cast<unsigned char>(input_[pos_])))
+            {
+                ++pos_;
+            }
+            if (digits == pos_)
+            {
+                error = "Invalid hexadecimal literal at position " + std::to_string(start);
+                return false;
+            }
+        }
+        else
+        {
+            while (pos_ < input_.size() && std::isdigit(static_cast<unsigned char>(input_[pos_])))
+            {
+                ++pos_;
+            }
+            if (pos_ < input_.size() && input_[pos_] == '.')
+            {
+                token.kind = Token::FLOAT;
+                ++pos_;
+                while (pos_ < input_.size() && std::isdigit(static_cast<unsigned char>(input_[pos_])))
+                {
+                    ++pos_;
+                }
+            }
+            if (pos_ < input_.size() && (input_[pos_] == 'e' || input_[pos_] == 'E'))
+            {
+                token.kind = Token::FLOAT;
+                ++pos_;
+                if (pos_ < input_.size() && (input_[pos_] == '-' || input_[pos_] == '+'))
+                {
+                    ++pos_;
+                }
+                size_t digits = pos_;
+                while (pos_ < input_.size() && std::isdigit(static_cast<unsigned char>(input_[pos_])))
+                {
+                    ++pos_;
+                }
+                if (digits == pos_)
+                {
+                    error = "Invalid floating point literal at position " + std::to_string(start);
+                    return false;
+                }
+            }
+        }
+
+        token.text = input_.substr(start, pos_ - start);
+        return true;
+    }
+
+    const std::string& input_;
+    size_t pos_ = 0;
+};
+
+/*!
+ * Recursive descent parser with one token of lookahead.
+ *
+ * Condition  ::= AndCond { OR AndCond }
+ * AndCond    ::= NotCond { AND NotCond }
+ * NotCond    ::= NOT NotCond | '(' Condition ')' | Predicate
+ * Predicate  ::= Operand RelOp Operand | Operand [NOT] BETWEEN Operand AND Operand
+ */
+class Parser
+{
+public:
+
+    explicit Parser(
+            const std::string& input)
+        : lexer_(input)
+    {
+    }
+
+    std::unique_ptr<DDSFilterCondition> parse(
+            std::string& error)
+    {
+        std::unique_ptr<DDSFilterCondition> result;
+        if (advance() && (result = condition()) && current_.kind != Token::END)
+        {
+            fail("Unexpected '" + current_.text + "'");
+            result.reset();
+        }
+
+        error = error_;
+        return result;
+    }
+
+    bool literal(
+            DDSFilterOperand& operand)
+    {
+        return advance() && this->operand(operand) && operand.kind != DDSFilterOperand::FIELD &&
+               operand.kind != DDSFilterOperand::PARAMETER && current_.kind == Token::END;
+    }
+
+private:
+
+    bool advance()
+    {
+        if (!error_.empty())
+        {
+            return false;
+        }
+        return lexer_.next(current_, error_);
+    }
+
+    bool fail(
+            const std::string& message)
+    {
+        if (error_.empty())
+        {
+            error_ = message + " at position " + std::to_string(current_.position);
+        }
+        return false;
+    }
+
+    static std::unique_ptr<DDSFilterCondition> join(
+            DDSFilterCondition::Kind kind,
+            std::unique_ptr<DDSFilterCondition> left,
+            std::unique_ptr<DDSFilterCondition> right)
+    {
+        std::unique_ptr<DDSFilterCondition> node(new DDSFilterCondition());
+        node->kind = kind;
+        node->left = std::move(left);
+        node->right = std::move(right);
+        return node;
+    }
+
+    std::unique_ptr<DDSFilterCondition> condition()
+    {
+        std::unique_ptr<DDSFilterCondition> result = and_condition();
+        while (result && current_.kind == Token::KW_OR)
+        {
+            std::unique_ptr<DDSFilterCondition> right;
+            if (!advance() || !(right = and_condition()))
+            {
+                return nullptr;
+            }
+            result = join(DDSFilterCondition::OR, std::move(result), std::move(right));
+        }
+        return result;
+    }
+
+    std::unique_ptr<DDSFilterCondition> and_condition()
+    {
+        std::unique_ptr<DDSFilterCondition> result = not_condition();
+        while (result && current_.kind == Token::KW_AND)
+        {
+            std::unique_ptr<DDSFilterCondition> right;
+            if (!advance() || !(right = not_condition()))
+            {
+                return nullptr;
+            }
+            result = join(DDSFilterCondition::AND, std::move(result), std::move(right));
+        }
+        return result;
+    }
+
+    std::unique_ptr<DDSFilterCondition> not_condition()
+    {
+        if (current_.kind == Token::KW_NOT)
+        {
+            std::unique_ptr<DDSFilterCondition> operand;
+            if (!advance() || !(operand = not_condition()))
+            {
+                return nullptr;
+            }
+            return join(DDSFilterCondition::NOT, std::move(operand), nullptr);
+        }
+
+        if (current_.kind == Token::LEFT_PAREN)
+        {
+            std::unique_ptr<DDSFilterCondition> result;
+            if (!advance() || !(result = condition()))
+            {
+                return nullptr;
+            }
+            if (current_.kind != Token::RIGHT_PAREN)
+            {
+                fail("Expected ')'");
+                return nullptr;
+            }
+            return advance() ? std::move(result) : nullptr;
+        }
+
+        return predicate();
+    }
+
+    std::unique_ptr<DDSFilterCondition> predicate()
+    {
+        std::unique_ptr<DDSFilterCondition> node(new DDSFilterCondition());
+        node->operands.resize(1);
+        if (!operand(node->operands[0]))
+        {
+            return nullptr;
+        }
+
+        bool negated = false;
+        if (current_.kind == Token::KW_NOT)
+        {
+            negated = true;
+            if (!advance())
+            {
+                return nullptr;
+            }
+        }
+
+        if (current_.kind == Token::KW_BETWEEN)
+        {
+            node->kind = DDSFilterCondition::BETWEEN;
+            node->operands.resize(3);
+            if (!advance() || !operand(node->operands[1]))
+            {
+                return nullptr;
+            }
+            if (current_.kind != Token::KW_AND)
+            {
+                fail("Expected AND on BETWEEN predicate");
+                return nullptr;
+            }
+            if (!advance() || !operand(node->operands[2]))
+            {
+                return nullptr;
+            }
+        }
+        else
+        {
+            if (current_.kind == Token::KW_LIKE)
+            {
+                node->op = DDSFilterCondition::LIKE;
+            }
+            else if (current_.kind == Token::OPERATOR && !negated)
+            {
+                node->op = current_.op;
+            }
+            else
+            {
+                fail("Expected relational operator");
+                return nullptr;
+            }
+
+            node->operands.resize(2);
+            if (!advance() || !operand(node->operands[1]))
+            {
+                return nullptr;
+            }
+        }
+
+        return negated ? join(DDSFilterCondition::NOT, std::move(node), nullptr) : std::move(node);
+    }
+
+    bool operand(
+            DDSFilterOperand& result)
+    {
+        switch (current_.kind)
+        {
+            case Token::IDENTIFIER:
+                return field(result);
+            case Token::INTEGER:
+                result.kind = DDSFilterOperand::INTEGER;
+                break;
+            case Token::FLOAT:
+                result.kind = DDSFilterOperand::FLOAT;
+                break;
+            case Token::STRING:
+                result.kind = DDSFilterOperand::STRING;
+                break;
+            case Token::KW_TRUE:
+            case Token::KW_FALSE:
+                result.kind = DDSFilterOperand::BOOLEAN;
+                break;
+            case Token::PARAMETER:
+                result.kind = DDSFilterOperand::PARAMETER;
+                result.parameter = static_cast<uint32_t>(std::strtoul(current_.text.c_str(), nullptr, 10));
+                break;
+            default:
+                return fail("Expected field name or literal");
+        }
+
+        result.text = current_.text;
+        return advance();
+    }
+
+    bool field(
+            DDSFilterOperand& result)
+    {
+        result.kind = DDSFilterOperand::FIELD;
+        while (true)
+        {
+            if (current_.kind != Token::IDENTIFIER)
+            {
+                return fail("Expected member name");
+            }
+
+            DDSFilterFieldStep step;
+            step.name = current_.text;
+            if (!advance())
+            {
+                return false;
+            }
+
+            if (current_.kind == Token::LEFT_BRACKET)
+            {
+                if (!advance())
+                {
+                    return false;
+                }
+                if (current_.kind != Token::INTEGER || current_.text[0] == '-')
+                {
+                    return fail("Expected index");
+                }
+                step.index = static_cast<uint32_t>(std::strtoul(current_.text.c_str(), nullptr, 0));
+                if (!advance())
+                {
+                    return false;
+                }
+                if (current_.kind != Token::RIGHT_BRACKET)
+                {
+                    return fail("Expected ']'");
+                }
+                if (!advance())
+                {
+                    return false;
+                }
+            }
+
+            result.path.push_back(std::move(step));
+            if (current_.kind != Token::DOT)
+            {
+                return true;
+            }
+            if (!advance())
+            {
+                return false;
+            }
+        }
+    }
+
+    Lexer lexer_;
+    Token current_;
+    std::string error_;
+};
+
+} // namespace
+
+std::unique_ptr<DDSFilterCondition> parse_filter_expression(
+        const std::string& expression,
+        std::string& error)
+{
+    Parser parser(expression);
+    return parser.parse(error);
+}
+
+bool parse_literal(
+        const std::string& text,
+        DDSFilterOperand& operand)
+{
+    Parser parser(text);
+    return parser.literal(operand);
+}
+
+} // namespace DDSSQLFilter
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,132 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file DDSFilterParser.hpp
+ */
+
+#ifndef _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERPARSER_HPP_
+#define _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERPARSER_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace DDSSQLFilter {
+
+/*!
+ * One step on the path to a field: the name of a member, with an optional constant index
+ * when the member is an array or a sequence.
+ */
+struct DDSFilterFieldStep
+{
+    static constexpr uint32_t no_index = 0xFFFFFFFFu;
+
+    std::string name;
+    uint32_t index = no_index;
+};
+
+/*!
+ * Operand of a predicate, as written on the filter expression.
+ */
+struct DDSFilterOperand
+{
+    enum Kind
+    {
+        //! Member of the data type. A path with a single step may also be an enumerator name.
+        FIELD,
+        INTEGER,
+        FLOAT,
+        STRING,
+        BOOLEAN,
+        //! Reference to an expression parameter (%n)
+        PARAMETER
+    };
+
+    Kind kind = FIELD;
+    //! Steps of a FIELD operand
+    std::vector<DDSFilterFieldStep> path;
+    //! Text of a literal, with the quotes removed on STRING literals
+    std::string text;
+    //! Index of a PARAMETER operand
+    uint32_t parameter = 0;
+};
+
+/*!
+ * Node of the syntax tree of a filter expression.
+ */
+struct DDSFilterCondition
+{
+    enum Kind
+    {
+        AND,
+        OR,
+        NOT,
+        COMPARISON,
+        BETWEEN
+    };
+
+    enum Operator
+    {
+        EQUAL,
+        NOT_EQUAL,
+        LESS,
+        LESS_EQUAL,
+        GREATER,
+        GREATER_EQUAL,
+        LIKE
+    };
+
+    Kind kind = COMPARISON;
+    //! Operator of a COMPARISON node
+    Operator op = EQUAL;
+    //! Two operands on COMPARISON nodes, three (value, lower and upper limit) on BETWEEN nodes
+    std::vector<DDSFilterOperand> operands;
+    //! Child conditions of AND, OR and NOT nodes (only left on NOT)
+    std::unique_ptr<DDSFilterCondition> left;
+    std::unique_ptr<DDSFilterCondition> right;
+};
+
+/*!
+ * Parses a filter expression following the DDS-SQL grammar of the DDS specification (Annex B).
+ * @param expression Filter expression.
+ * @param error Human readable description of the first error found.
+ * @return Root of the syntax tree, or nullptr if the expression is not valid.
+ */
+std::unique_ptr<DDSFilterCondition> parse_filter_expression(
+        const std::string& expression,
+        std::string& error);
+
+/*!
+ * Parses an expression parameter as a single literal.
+ * @param text Value of the parameter.
+ * @param operand Operand where the literal is returned.
+ * @return false if the parameter is not a single literal.
+ */
+bool parse_literal(
+        const std::string& text,
+        DDSFilterOperand& operand);
+
+} // namespace DDSSQLFilter
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERPARSER_HPP_
@@ -21,6 +21,9 @@
 #define _FASTDDS_TOPICDESCRIPTIONIMPL_HPP_
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <atomic>
+#include <string>
+
 namespace eprosima {
 namespace fastdds {
 namespace dds {
@@ -41,6 +44,12 @@ public:
     {
     }
 
+    /**
+     * Get the name of the topic the endpoints of this TopicDescription use on the wire.
+     * For a ContentFilteredTopic, this is the name of the related topic.
+     * @return Name of the RTPS topic.
+     */
+    virtual const std::string& get_rtps_topic_name() const = 0;
 
     bool is_referenced() const
     {
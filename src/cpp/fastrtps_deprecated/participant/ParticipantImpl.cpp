@@ -186,6 +186,10 @@ Publisher* ParticipantImpl::createPublisher(
     watt.endpoint.remoteLocatorList = att.remoteLocatorList;
     watt.mode = att.qos.m_publishMode.kind ==
             eprosima::fastrtps::SYNCHRONOUS_PUBLISH_MODE ? SYNCHRONOUS_WRITER : ASYNCHRONOUS_WRITER;
+    watt.batch.enabled = att.qos.m_batch.enable;
+    watt.batch.max_samples = att.qos.m_batch.max_samples;
+    watt.batch.max_bytes = att.qos.m_batch.max_data_bytes;
+    watt.batch.max_flush_delay = att.qos.m_batch.max_flush_delay;
     watt.endpoint.properties = att.properties;
     if (att.getEntityID() > 0)
     {
@@ -332,6 +336,7 @@ Subscriber* ParticipantImpl::createSubscriber(
     }
     ratt.times = att.times;
     ratt.matched_writers_allocation = att.matched_publisher_allocation;
+    ratt.max_incomplete_samples_memory = att.max_incomplete_samples_memory;
     ratt.liveliness_kind_ = att.qos.m_liveliness.kind;
     ratt.liveliness_lease_duration = att.qos.m_liveliness.lease_duration;
 
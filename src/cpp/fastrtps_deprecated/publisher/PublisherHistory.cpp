@@ -309,7 +309,7 @@ bool PublisherHistory::remove_change_pub(
     std::lock_guard<RecursiveTimedMutex> guard(*this->mp_mutex);
     if (topic_att_.getTopicKind() == NO_KEY)
     {
-        if (remove_change(change))
+        if (WriterHistory::remove_change_g(change))
         {
             m_isHistoryFull = false;
             return true;
@@ -329,7 +329,7 @@ bool PublisherHistory::remove_change_pub(
         {
             if (((*chit)->sequenceNumber == change->sequenceNumber) && ((*chit)->writerGUID == change->writerGUID))
             {
-                if (remove_change(change))
+                if (WriterHistory::remove_change_g(change))
                 {
                     vit->second.cache_changes.erase(chit);
                     m_isHistoryFull = false;
@@ -376,7 +376,7 @@ bool PublisherHistory::remove_instance_changes(
 
     for (; chit != vit->second.cache_changes.end() && (*chit)->sequenceNumber <= seq_up_to; ++chit)
     {
-        if (remove_change(*chit))
+        if (WriterHistory::remove_change_g(*chit))
         {
             m_isHistoryFull = false;
         }
@@ -410,12 +410,13 @@ bool PublisherHistory::set_next_deadline(
     }
     else if (topic_att_.getTopicKind() == WITH_KEY)
     {
-        if (keyed_changes_.find(handle) == keyed_changes_.end())
+        t_m_Inst_Caches::iterator vit = keyed_changes_.find(handle);
+        if (vit == keyed_changes_.end())
         {
             return false;
         }
 
-        keyed_changes_[handle].next_deadline_us = next_deadline_us;
+        vit->second.next_deadline_us = next_deadline_us;
         return true;
     }
 
@@ -25,6 +25,7 @@
 
 #include <fastdds/dds/topic/TopicDataType.hpp>
 #include <fastdds/dds/log/Log.hpp>
+#include <fastdds/publisher/IntraprocessSample.hpp>
 
 #include <limits>
 #include <mutex>
@@ -35,6 +36,25 @@ namespace fastrtps {
 using namespace rtps;
 
 using eprosima::fastdds::dds::TopicDataType;
+using eprosima::fastdds::dds::IntraprocessSample;
+
+static bool get_sample(
+        TopicDataType* type,
+        CacheChange_t* change,
+        void* data)
+{
+    // Samples shared by a local writer are copied instead of deserialized
+    if (0 == change->serializedPayload.length && change->intraprocess_sample)
+    {
+        const IntraprocessSample* sample = dynamic_cast<const IntraprocessSample*>(change->intraprocess_sample.get());
+        if (sample != nullptr)
+        {
+            return sample->copy_to(type, data);
+        }
+    }
+
+    return type->deserialize(&change->serializedPayload, data);
+}
 
 static void get_sample_info(
         SampleInfo_t* info,
@@ -303,7 +323,7 @@ bool SubscriberHistory::find_key_for_change(
     if (!a_change->instanceHandle.isDefined() && type_ != nullptr)
     {
         logInfo(SUBSCRIBER, "Getting Key of change with no Key transmitted")
-        type_->deserialize(&a_change->serializedPayload, get_key_object_);
+        get_sample(type_, a_change, get_key_object_);
         bool is_key_protected = false;
 #if HAVE_SECURITY
         is_key_protected = mp_reader->getAttributes().security_attributes().is_key_protected;
@@ -331,7 +351,7 @@ bool SubscriberHistory::deserialize_change(
 {
     if (change->kind == ALIVE)
     {
-        if (!type_->deserialize(&change->serializedPayload, data))
+        if (!get_sample(type_, change, data))
         {
             logError(SUBSCRIBER, "Deserialization of data failed");
             return false;
@@ -477,17 +497,38 @@ bool SubscriberHistory::remove_change_sub(
     }
 
     std::lock_guard<RecursiveTimedMutex> guard(*mp_mutex);
+    return remove_change(change);
+}
+
+History::iterator SubscriberHistory::remove_change_nts(
+        const_iterator removal,
+        bool release)
+{
+    if (mp_reader == nullptr || mp_mutex == nullptr)
+    {
+        logError(SUBSCRIBER, "You need to create a Reader with this History before using it");
+        return changesEnd();
+    }
+
+    if (removal == changesEnd())
+    {
+        logInfo(SUBSCRIBER, "Trying to remove without a proper CacheChange_t referenced");
+        return changesEnd();
+    }
+
+    CacheChange_t* change = *removal;
     if (topic_att_.getTopicKind() == WITH_KEY)
     {
         bool found = false;
-        t_m_Inst_Caches::iterator vit;
-        if (find_key(change, &vit))
+        t_m_Inst_Caches::iterator vit = keyed_changes_.find(change->instanceHandle);
+        if (vit != keyed_changes_.end())
         {
-            for (auto chit = vit->second.cache_changes.begin(); chit != vit->second.cache_changes.end(); ++chit)
+            std::vector<CacheChange_t*>& instance_changes = vit->second.cache_changes;
+            for (auto chit = instance_changes.begin(); chit != instance_changes.end(); ++chit)
             {
                 if ((*chit)->sequenceNumber == change->sequenceNumber && (*chit)->writerGUID == change->writerGUID)
                 {
-                    vit->second.cache_changes.erase(chit);
+                    instance_changes.erase(chit);
                     found = true;
                     break;
                 }
@@ -499,13 +540,8 @@ bool SubscriberHistory::remove_change_sub(
         }
     }
 
-    if (remove_change(change))
-    {
-        m_isHistoryFull = false;
-        return true;
-    }
-
-    return false;
+    m_isHistoryFull = false;
+    return ReaderHistory::remove_change_nts(removal, release);
 }
 
 bool SubscriberHistory::set_next_deadline(
@@ -30,7 +30,6 @@
 #include <fastdds/rtps/transport/UDPv6Transport.h>
 #include <fastdds/rtps/transport/test_UDPv4Transport.h>
 
-#include <fastrtps/utils/IPFinder.h>
 #include <fastrtps/utils/IPLocator.h>
 #include <fastrtps/utils/System.h>
 #include <fastrtps/utils/md5.h>
@@ -166,8 +165,6 @@ RTPSParticipant* RTPSDomain::createParticipant(
     }
 
     PParam.participantID = ID;
-    LocatorList_t loc;
-    IPFinder::getIP4Address(&loc);
 
     // Generate a new GuidPrefix_t
     GuidPrefix_t guidP;
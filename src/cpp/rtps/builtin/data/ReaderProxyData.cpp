@@ -96,6 +96,7 @@ ReaderProxyData::ReaderProxyData(
     , m_type(nullptr)
     , m_type_information(nullptr)
     , m_properties(readerInfo.m_properties)
+    , content_filter_(readerInfo.content_filter_)
 {
     if (readerInfo.m_type_id)
     {
@@ -135,6 +136,7 @@ ReaderProxyData& ReaderProxyData::operator =(
     m_topicKind = readerInfo.m_topicKind;
     m_qos.setQos(readerInfo.m_qos, true);
     m_properties = readerInfo.m_properties;
+    content_filter_ = readerInfo.content_filter_;
 
     if (readerInfo.m_type_id)
     {
@@ -299,6 +301,13 @@ uint32_t ReaderProxyData::get_serialized_size(
         ret_val += fastdds::dds::ParameterSerializer<ParameterPropertyList_t>::cdr_serialized_size(m_properties);
     }
 
+    if (content_filter_.is_set())
+    {
+        // PID_CONTENT_FILTER_PROPERTY
+        ret_val += fastdds::dds::ParameterSerializer<fastdds::rtps::ContentFilterProperty>::cdr_serialized_size(
+            content_filter_);
+    }
+
 #if HAVE_SECURITY
     if ((this->security_attributes_ != 0UL) || (this->plugin_security_attributes_ != 0UL))
     {
@@ -574,6 +583,15 @@ bool ReaderProxyData::writeToCDRMessage(
         }
     }
 
+    if (content_filter_.is_set())
+    {
+        if (!fastdds::dds::ParameterSerializer<fastdds::rtps::ContentFilterProperty>::add_to_cdr_message(
+                    content_filter_, msg))
+        {
+            return false;
+        }
+    }
+
     return fastdds::dds::ParameterSerializer<Parameter_t>::add_parameter_sentinel(msg);
 }
 
@@ -905,6 +923,16 @@ bool ReaderProxyData::readFromCDRMessage(
                         break;
                     }
 
+                    case fastdds::dds::PID_CONTENT_FILTER_PROPERTY:
+                    {
+                        if (!fastdds::dds::ParameterSerializer<fastdds::rtps::ContentFilterProperty>::
+                                read_from_cdr_message(content_filter_, msg, plength))
+                        {
+                            return false;
+                        }
+                        break;
+                    }
+
                     case fastdds::dds::PID_DISABLE_POSITIVE_ACKS:
                     {
                         if (!fastdds::dds::QosPoliciesSerializer<DisablePositiveACKsQosPolicy>::read_from_cdr_message(
@@ -1006,6 +1034,7 @@ void ReaderProxyData::clear()
     m_qos.clear();
     m_properties.clear();
     m_properties.length = 0;
+    content_filter_ = fastdds::rtps::ContentFilterProperty();
 
     if (m_type_id)
     {
@@ -1045,6 +1074,7 @@ void ReaderProxyData::update(
     m_qos.setQos(rdata->m_qos, false);
     m_isAlive = rdata->m_isAlive;
     m_expectsInlineQos = rdata->m_expectsInlineQos;
+    content_filter_ = rdata->content_filter_;
 }
 
 void ReaderProxyData::copy(
@@ -1062,6 +1092,7 @@ void ReaderProxyData::copy(
     m_isAlive = rdata->m_isAlive;
     m_topicKind = rdata->m_topicKind;
     m_properties = rdata->m_properties;
+    content_filter_ = rdata->content_filter_;
 
     if (rdata->m_type_id)
     {
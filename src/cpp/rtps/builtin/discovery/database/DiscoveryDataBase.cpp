@@ -17,6 +17,7 @@
  *
  */
 
+#include <algorithm>
 #include <mutex>
 
 #include <fastdds/dds/log/Log.hpp>
@@ -27,6 +28,7 @@
 #include <rtps/builtin/discovery/database/DiscoveryDataBase.hpp>
 
 #include <json.hpp>
+#include <rtps/builtin/discovery/database/backup/BackupJournal.hpp>
 #include <rtps/builtin/discovery/database/backup/SharedBackupFunctions.hpp>
 
 namespace eprosima {
@@ -619,6 +621,7 @@ void DiscoveryDataBase::create_participant_from_change_(
             entities_updated_.store(true);
 
             logInfo(DISCOVERY_DATABASE, "New participant added: " << change_guid.guidPrefix);
+            track_backup_(ret.first->second, change_guid);
 
             // Manually set to 1 the relevant participants ACK status of the participant that sent the change. This way,
             // we avoid backprogation of the data.
@@ -768,6 +771,7 @@ void DiscoveryDataBase::create_writers_from_change_(
             return;
         }
         writer_it = ret.first;
+        track_backup_(writer_it->second, writer_guid);
 
         // New writer found
         entities_updated_.store(true);
@@ -885,6 +889,7 @@ void DiscoveryDataBase::create_readers_from_change_(
             return;
         }
         reader_it = ret.first;
+        track_backup_(reader_it->second, reader_guid);
 
         // New reader found
         entities_updated_.store(true);
@@ -1259,122 +1264,78 @@ bool DiscoveryDataBase::process_dirty_topics()
         return false;
     }
 
+    // Maximum number of writers of a topic matched by the same thread
+    constexpr size_t writers_per_partition = 16;
+
     // logInfo(DISCOVERY_DATABASE, "process_dirty_topics start");
     // Get shared lock
     std::unique_lock<std::recursive_mutex> lock(mutex_);
 
-    // Iterator objects are declared here because they are reused in each iteration of the loops
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator parts_reader_it;
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator parts_writer_it;
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator readers_it;
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator writers_it;
-
-    // Iterate over dirty_topics_
-    for (auto topic_it = dirty_topics_.begin(); topic_it != dirty_topics_.end();)
+    // Split the dirty topics in partitions of a few writers each
+    static const std::vector<fastrtps::rtps::GUID_t> no_endpoints;
+    std::vector<const std::vector<fastrtps::rtps::GUID_t>*> topic_writers;
+    std::vector<const std::vector<fastrtps::rtps::GUID_t>*> topic_readers;
+    std::vector<DirtyTopicPartition> partitions;
+    for (size_t topic = 0; topic < dirty_topics_.size(); ++topic)
     {
-        logInfo(DISCOVERY_DATABASE, "Processing topic: " << *topic_it);
-        // Flag to store whether a topic can be cleared.
-        bool is_clearable = true;
-
         // Get all the writers in the topic
-        std::vector<fastrtps::rtps::GUID_t> writers;
-        auto ret = writers_by_topic_.find(*topic_it);
-        if (ret != writers_by_topic_.end())
-        {
-            writers = ret->second;
-        }
+        auto ret = writers_by_topic_.find(dirty_topics_[topic]);
+        topic_writers.push_back(ret != writers_by_topic_.end() ? &ret->second : &no_endpoints);
         // Get all the readers in the topic
-        std::vector<fastrtps::rtps::GUID_t> readers;
-        ret = readers_by_topic_.find(*topic_it);
-        if (ret != readers_by_topic_.end())
+        ret = readers_by_topic_.find(dirty_topics_[topic]);
+        topic_readers.push_back(ret != readers_by_topic_.end() ? &ret->second : &no_endpoints);
+
+        size_t num_writers = topic_writers.back()->size();
+        size_t first_writer = 0;
+        do
         {
-            readers = ret->second;
+            DirtyTopicPartition partition;
+            partition.topic = topic;
+            partition.first_writer = first_writer;
+            partition.last_writer = std::min(first_writer + writers_per_partition, num_writers);
+            partition.is_clearable = true;
+            partitions.push_back(std::move(partition));
+            first_writer += writers_per_partition;
         }
+        while (first_writer < num_writers);
+    }
 
-        for (fastrtps::rtps::GUID_t writer: writers)
-        // Iterate over writers in the topic:
-        {
-            logInfo(DISCOVERY_DATABASE, "[" << *topic_it << "]" << " Processing writer: " << writer);
-            // Iterate over readers in the topic:
-            for (fastrtps::rtps::GUID_t reader : readers)
+    // The partitions only read the database, which is not modified while the lock is held
+    workers_.run(partitions.size(), [&](size_t index)
             {
-                logInfo(DISCOVERY_DATABASE, "[" << *topic_it << "]" << " Processing reader: " << reader);
-                // Find participants with writer info and participant with reader info in participants_
-                parts_reader_it = participants_.find(reader.guidPrefix);
-                parts_writer_it = participants_.find(writer.guidPrefix);
-                // Find reader info in readers_
-                readers_it = readers_.find(reader);
-                // Find writer info in writers_
-                writers_it = writers_.find(writer);
+                DirtyTopicPartition& partition = partitions[index];
+                const std::vector<fastrtps::rtps::GUID_t>& writers = *topic_writers[partition.topic];
+                const std::vector<fastrtps::rtps::GUID_t>& readers = *topic_readers[partition.topic];
+                process_dirty_topic_partition_(writers, readers, partition);
+            });
 
-                // Check in `participants_` whether the client with the reader has acknowledge the PDP of the client
-                // with the writer.
-                if (parts_reader_it != participants_.end())
-                {
-                    if (parts_reader_it->second.is_matched(writer.guidPrefix))
-                    {
-                        // Check the status of the writer in `readers_[reader]::relevant_participants_builtin_ack_status`.
-                        if (readers_it != readers_.end() &&
-                                readers_it->second.is_relevant_participant(writer.guidPrefix) &&
-                                !readers_it->second.is_matched(writer.guidPrefix))
-                        {
-                            // If the status is 0, add DATA(r) to a `edp_publications_to_send_` (if it's not there).
-                            if (add_edp_subscriptions_to_send_(readers_it->second.change()))
-                            {
-                                logInfo(DISCOVERY_DATABASE, "Addind DATA(r) to send: "
-                                        << readers_it->second.change()->instanceHandle);
-                            }
-                        }
-                    }
-                    else if (parts_reader_it->second.is_relevant_participant(writer.guidPrefix))
-                    {
-                        // Add DATA(p) of the client with the writer to `pdp_to_send_` (if it's not there).
-                        if (add_pdp_to_send_(parts_reader_it->second.change()))
-                        {
-                            logInfo(DISCOVERY_DATABASE, "Addind readers' DATA(p) to send: "
-                                    << parts_reader_it->second.change()->instanceHandle);
-                        }
-                        // Set topic as not-clearable.
-                        is_clearable = false;
-                    }
-                }
-
-                // Check in `participants_` whether the client with the writer has acknowledge the PDP of the client
-                // with the reader.
-                if (parts_writer_it != participants_.end())
-                {
-                    if (parts_writer_it->second.is_matched(reader.guidPrefix))
-                    {
-                        // Check the status of the reader in `writers_[writer]::relevant_participants_builtin_ack_status`.
-                        if (writers_it != writers_.end() &&
-                                writers_it->second.is_relevant_participant(reader.guidPrefix) &&
-                                !writers_it->second.is_matched(reader.guidPrefix))
-                        {
-                            // If the status is 0, add DATA(w) to a `edp_subscriptions_to_send_` (if it's not there).
-                            if (add_edp_publications_to_send_(writers_it->second.change()))
-                            {
-                                logInfo(DISCOVERY_DATABASE, "Addind DATA(w) to send: "
-                                        << writers_it->second.change()->instanceHandle);
-                            }
-                        }
-                    }
-                    else if (parts_writer_it->second.is_relevant_participant(reader.guidPrefix))
-                    {
-                        // Add DATA(p) of the client with the reader to `pdp_to_send_` (if it's not there).
-                        if (add_pdp_to_send_(parts_writer_it->second.change()))
-                        {
-                            logInfo(DISCOVERY_DATABASE, "Addind writers' DATA(p) to send: "
-                                    << parts_writer_it->second.change()->instanceHandle);
-                        }
-                        // Set topic as not-clearable.
-                        is_clearable = false;
-                    }
-                }
-            }
+    // Merge the partitions in order, so the changes to send are added as if they had been processed sequentially
+    std::vector<bool> is_clearable(dirty_topics_.size(), true);
+    for (const DirtyTopicPartition& partition : partitions)
+    {
+        for (eprosima::fastrtps::rtps::CacheChange_t* change : partition.pdp_to_send)
+        {
+            add_pdp_to_send_(change);
+        }
+        for (eprosima::fastrtps::rtps::CacheChange_t* change : partition.edp_publications_to_send)
+        {
+            add_edp_publications_to_send_(change);
+        }
+        for (eprosima::fastrtps::rtps::CacheChange_t* change : partition.edp_subscriptions_to_send)
+        {
+            add_edp_subscriptions_to_send_(change);
         }
+        if (!partition.is_clearable)
+        {
+            is_clearable[partition.topic] = false;
+        }
+    }
 
-        // Check whether the topic is still dirty or it can be cleared
-        if (is_clearable)
+    // Check whether each topic is still dirty or it can be cleared
+    size_t topic = 0;
+    for (auto topic_it = dirty_topics_.begin(); topic_it != dirty_topics_.end(); ++topic)
+    {
+        if (is_clearable[topic])
         {
             // Delete topic from dirty_topics_
             logInfo(DISCOVERY_DATABASE, "Topic " << *topic_it << " has been cleaned");
@@ -1394,6 +1355,102 @@ bool DiscoveryDataBase::process_dirty_topics()
     return !dirty_topics_.empty();
 }
 
+void DiscoveryDataBase::start_workers(
+        uint32_t num_threads)
+{
+    workers_.start(num_threads);
+}
+
+void DiscoveryDataBase::process_dirty_topic_partition_(
+        const std::vector<fastrtps::rtps::GUID_t>& writers,
+        const std::vector<fastrtps::rtps::GUID_t>& readers,
+        DirtyTopicPartition& partition) const
+{
+    logInfo(DISCOVERY_DATABASE, "Processing topic: " << dirty_topics_[partition.topic]);
+
+    // Iterator objects are declared here because they are reused in each iteration of the loops
+    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::const_iterator parts_reader_it;
+    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::const_iterator parts_writer_it;
+    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::const_iterator readers_it;
+    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::const_iterator writers_it;
+
+    for (size_t w = partition.first_writer; w < partition.last_writer; ++w)
+    // Iterate over writers in the partition:
+    {
+        const fastrtps::rtps::GUID_t& writer = writers[w];
+        logInfo(DISCOVERY_DATABASE, "[" << dirty_topics_[partition.topic] << "]" << " Processing writer: " << writer);
+        // Iterate over readers in the topic:
+        for (const fastrtps::rtps::GUID_t& reader : readers)
+        {
+            logInfo(DISCOVERY_DATABASE,
+                    "[" << dirty_topics_[partition.topic] << "]" << " Processing reader: " << reader);
+            // Find participants with writer info and participant with reader info in participants_
+            parts_reader_it = participants_.find(reader.guidPrefix);
+            parts_writer_it = participants_.find(writer.guidPrefix);
+            // Find reader info in readers_
+            readers_it = readers_.find(reader);
+            // Find writer info in writers_
+            writers_it = writers_.find(writer);
+
+            // Check in `participants_` whether the client with the reader has acknowledge the PDP of the client
+            // with the writer.
+            if (parts_reader_it != participants_.end())
+            {
+                if (parts_reader_it->second.is_matched(writer.guidPrefix))
+                {
+                    // Check the status of the writer in `readers_[reader]::relevant_participants_builtin_ack_status`.
+                    if (readers_it != readers_.end() &&
+                            readers_it->second.is_relevant_participant(writer.guidPrefix) &&
+                            !readers_it->second.is_matched(writer.guidPrefix))
+                    {
+                        // If the status is 0, add DATA(r) to a `edp_publications_to_send_` (if it's not there).
+                        logInfo(DISCOVERY_DATABASE, "Addind DATA(r) to send: "
+                                << readers_it->second.change()->instanceHandle);
+                        partition.edp_subscriptions_to_send.push_back(readers_it->second.change());
+                    }
+                }
+                else if (parts_reader_it->second.is_relevant_participant(writer.guidPrefix))
+                {
+                    // Add DATA(p) of the client with the writer to `pdp_to_send_` (if it's not there).
+                    logInfo(DISCOVERY_DATABASE, "Addind readers' DATA(p) to send: "
+                            << parts_reader_it->second.change()->instanceHandle);
+                    partition.pdp_to_send.push_back(parts_reader_it->second.change());
+                    // Set topic as not-clearable.
+                    partition.is_clearable = false;
+                }
+            }
+
+            // Check in `participants_` whether the client with the writer has acknowledge the PDP of the client
+            // with the reader.
+            if (parts_writer_it != participants_.end())
+            {
+                if (parts_writer_it->second.is_matched(reader.guidPrefix))
+                {
+                    // Check the status of the reader in `writers_[writer]::relevant_participants_builtin_ack_status`.
+                    if (writers_it != writers_.end() &&
+                            writers_it->second.is_relevant_participant(reader.guidPrefix) &&
+                            !writers_it->second.is_matched(reader.guidPrefix))
+                    {
+                        // If the status is 0, add DATA(w) to a `edp_subscriptions_to_send_` (if it's not there).
+                        logInfo(DISCOVERY_DATABASE, "Addind DATA(w) to send: "
+                                << writers_it->second.change()->instanceHandle);
+                        partition.edp_publications_to_send.push_back(writers_it->second.change());
+                    }
+                }
+                else if (parts_writer_it->second.is_relevant_participant(reader.guidPrefix))
+                {
+                    // Add DATA(p) of the client with the reader to `pdp_to_send_` (if it's not there).
+                    logInfo(DISCOVERY_DATABASE, "Addind writers' DATA(p) to send: "
+                            << parts_writer_it->second.change()->instanceHandle);
+                    partition.pdp_to_send.push_back(parts_writer_it->second.change());
+                    // Set topic as not-clearable.
+                    partition.is_clearable = false;
+                }
+            }
+        }
+    }
+}
+
 bool DiscoveryDataBase::delete_entity_of_change(
         fastrtps::rtps::CacheChange_t* change)
 {
@@ -2099,6 +2156,10 @@ DiscoveryDataBase::delete_participant_entity_(
         return participants_.end();
     }
     changes_to_release_.push_back(it->second.change());
+    if (is_persistent_ && it->first != server_guid_prefix_)
+    {
+        backup_removals_.emplace_back("participants", ddb::object_to_string(it->first));
+    }
     return participants_.erase(it);
 }
 
@@ -2147,6 +2208,11 @@ std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator Disc
         changes_to_release_.push_back(it->second.change());
     }
 
+    if (is_persistent_ && it->first.guidPrefix != server_guid_prefix_)
+    {
+        backup_removals_.emplace_back("readers", ddb::object_to_string(it->first));
+    }
+
     // Remove entity in readers_ map
     return readers_.erase(it);
 }
@@ -2196,6 +2262,11 @@ std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator Disc
         changes_to_release_.push_back(it->second.change());
     }
 
+    if (is_persistent_ && it->first.guidPrefix != server_guid_prefix_)
+    {
+        backup_removals_.emplace_back("writers", ddb::object_to_string(it->first));
+    }
+
     // Remove entity in writers_ map
     return writers_.erase(it);
 }
@@ -2492,6 +2563,79 @@ bool DiscoveryDataBase::from_json(
     return true;
 }
 
+void DiscoveryDataBase::track_backup_(
+        DiscoverySharedInfo& entity,
+        const eprosima::fastrtps::rtps::GUID_t& guid)
+{
+    if (is_persistent_)
+    {
+        entity.backup_dirty_entities(&backup_dirty_entities_);
+        backup_dirty_entities_.insert(guid);
+    }
+}
+
+bool DiscoveryDataBase::backup_changes(
+        BackupJournal& journal)
+{
+    // Removals first, as an entity could have been removed and created again
+    for (const auto& removal : backup_removals_)
+    {
+        journal.remove(removal.first, removal.second);
+    }
+    backup_removals_.clear();
+
+    // Only the entities changed since the last backup are visited. The removed ones are no longer found
+    for (const eprosima::fastrtps::rtps::GUID_t& guid : backup_dirty_entities_)
+    {
+        if (guid.guidPrefix == server_guid_prefix_)
+        {
+            continue;
+        }
+
+        nlohmann::json j_entity;
+        if (guid.entityId == eprosima::fastrtps::rtps::c_EntityId_RTPSParticipant)
+        {
+            auto pit = participants_.find(guid.guidPrefix);
+            if (pit != participants_.end())
+            {
+                pit->second.to_json(j_entity);
+                journal.update("participants", ddb::object_to_string(guid.guidPrefix), j_entity);
+            }
+            continue;
+        }
+
+        auto wit = writers_.find(guid);
+        if (wit != writers_.end())
+        {
+            wit->second.to_json(j_entity);
+            journal.update("writers", ddb::object_to_string(guid), j_entity);
+            continue;
+        }
+
+        auto rit = readers_.find(guid);
+        if (rit != readers_.end())
+        {
+            rit->second.to_json(j_entity);
+            journal.update("readers", ddb::object_to_string(guid), j_entity);
+        }
+    }
+    backup_dirty_entities_.clear();
+
+    return journal.commit();
+}
+
+bool DiscoveryDataBase::backup_snapshot(
+        BackupJournal& journal)
+{
+    nlohmann::json j;
+    to_json(j);
+
+    backup_removals_.clear();
+    backup_dirty_entities_.clear();
+
+    return journal.write_snapshot(j);
+}
+
 void DiscoveryDataBase::clean_backup()
 {
     logInfo(DISCOVERY_DATABASE, "Restoring queue DDB in json backup");
@@ -2506,6 +2650,20 @@ void DiscoveryDataBase::persistence_enable(
 {
     is_persistent_ = true;
     backup_file_name_ = backup_file_name;
+
+    // The entities already known are in the backup, so they are only stored again once they change
+    for (auto& participant : participants_)
+    {
+        participant.second.backup_dirty_entities(&backup_dirty_entities_);
+    }
+    for (auto& writer : writers_)
+    {
+        writer.second.backup_dirty_entities(&backup_dirty_entities_);
+    }
+    for (auto& reader : readers_)
+    {
+        reader.second.backup_dirty_entities(&backup_dirty_entities_);
+    }
     // It opens the file in append mode because the info in it has not been yet
     backup_file_.open(backup_file_name_, std::ios::app);
 }
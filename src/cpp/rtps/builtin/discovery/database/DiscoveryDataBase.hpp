@@ -23,6 +23,7 @@
 #include <vector>
 #include <map>
 #include <mutex>
+#include <set>
 #include <iostream>
 #include <fstream>
 
@@ -35,6 +36,7 @@
 #include <rtps/builtin/discovery/database/DiscoveryParticipantInfo.hpp>
 #include <rtps/builtin/discovery/database/DiscoveryEndpointInfo.hpp>
 #include <rtps/builtin/discovery/database/DiscoveryDataQueueInfo.hpp>
+#include <rtps/builtin/discovery/database/DiscoveryWorkerPool.hpp>
 
 #include <json.hpp>
 
@@ -43,6 +45,8 @@ namespace fastdds {
 namespace rtps {
 namespace ddb {
 
+class BackupJournal;
+
 /**
  * Class to manage the discovery data base
  *@ingroup DISCOVERY_MODULE
@@ -207,6 +211,14 @@ public:
     // Functions to process_dirty_topics()
     bool process_dirty_topics();
 
+    /* Process the dirty topics on a pool of threads besides the one of the server routine
+     * The topics are split in partitions of a few writers each, whose results are merged in order,
+     * so the changes to send are the same as when processing them sequentially.
+     * @param num_threads: Number of threads of the pool. Zero processes the dirty topics sequentially.
+     */
+    void start_workers(
+            uint32_t num_threads);
+
     ////////////
     // Functions to process_disposals()
     const std::vector<eprosima::fastrtps::rtps::CacheChange_t*> changes_to_dispose();
@@ -305,6 +317,16 @@ public:
             nlohmann::json& j,
             std::map<eprosima::fastrtps::rtps::InstanceHandle_t, fastrtps::rtps::CacheChange_t*>& changes_map);
 
+    // Store in the backup journal the entities updated or removed since the last backup
+    // This function must be called with the incoming datas blocked
+    bool backup_changes(
+            BackupJournal& journal);
+
+    // Store the whole database as the new snapshot of the backup journal, compacting it
+    // This function must be called with the incoming datas blocked
+    bool backup_snapshot(
+            BackupJournal& journal);
+
     // This function erase the last backup and all the changes that has arrived since then and create
     // a new backup that shows the actual state of the database
     // This way we can simulate the state of the database from a clean state of json backup, or from
@@ -425,6 +447,11 @@ protected:
     std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator delete_reader_entity_(
             std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it);
 
+    // make a new entity note its changes for the backup, which has not stored it yet
+    void track_backup_(
+            DiscoverySharedInfo& entity,
+            const eprosima::fastrtps::rtps::GUID_t& guid);
+
     // return if there are more than one writer in the participant in the same topic
     bool repeated_writer_topic_(
             const eprosima::fastrtps::rtps::GuidPrefix_t& participant,
@@ -455,6 +482,32 @@ protected:
             const eprosima::fastrtps::rtps::GUID_t& reader_guid,
             const std::string& topic_name);
 
+    //! Part of a dirty topic processed by the same thread: a range of its writers against all its readers
+    struct DirtyTopicPartition
+    {
+        //! Index of the topic in dirty_topics_
+        size_t topic;
+
+        //! Range [first_writer, last_writer) of writers in writers_by_topic_
+        size_t first_writer;
+        size_t last_writer;
+
+        //! Whether the topic can be cleared as far as these writers are concerned
+        bool is_clearable;
+
+        //! Changes to add to pdp_to_send_, edp_publications_to_send_ and edp_subscriptions_to_send_, in order
+        std::vector<eprosima::fastrtps::rtps::CacheChange_t*> pdp_to_send;
+        std::vector<eprosima::fastrtps::rtps::CacheChange_t*> edp_publications_to_send;
+        std::vector<eprosima::fastrtps::rtps::CacheChange_t*> edp_subscriptions_to_send;
+    };
+
+    // Match the writers of a partition with all the readers of its topic
+    // Only reads the database, so partitions of the same or other topics can be processed in parallel
+    void process_dirty_topic_partition_(
+            const std::vector<eprosima::fastrtps::rtps::GUID_t>& writers,
+            const std::vector<eprosima::fastrtps::rtps::GUID_t>& readers,
+            DirtyTopicPartition& partition) const;
+
     //! Add a topic to the list of dirty topics, unless it's already present
     // Return true if added, false if already there
     bool set_dirty_topic_(
@@ -553,6 +606,15 @@ protected:
     // This file will keep open to write it fast every time a new cache arrives
     // It needs a flush every time a new change is added
     std::ofstream backup_file_;
+
+    // Section and key of the entities removed since the last backup
+    std::vector<std::pair<const char*, std::string>> backup_removals_;
+
+    // Entities changed since the last backup. The GUID of a participant has the participant entity id
+    std::set<eprosima::fastrtps::rtps::GUID_t> backup_dirty_entities_;
+
+    //! Threads processing the dirty topics. Destroyed first, so they stop before the database is cleared
+    DiscoveryWorkerPool workers_;
 };
 
 
@@ -51,6 +51,7 @@ eprosima::fastrtps::rtps::CacheChange_t* DiscoverySharedInfo::update(
 {
     eprosima::fastrtps::rtps::CacheChange_t* old_change = change_;
     change_ = change;
+    backup_pending_();
     return old_change;
 }
 
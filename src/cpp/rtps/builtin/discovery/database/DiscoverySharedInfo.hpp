@@ -28,6 +28,8 @@
 
 #include <json.hpp>
 
+#include <set>
+
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
@@ -62,12 +64,17 @@ public:
     {
         logInfo(DISCOVERY_DATABASE, "Adding relevant participant " << guid_p << " with status " << status << " to " <<
                 fastrtps::rtps::iHandle2GUID(change_->instanceHandle));
+        if (!is_relevant_participant(guid_p) || is_matched(guid_p) != status)
+        {
+            backup_pending_();
+        }
         relevant_participants_builtin_ack_status_.add_or_update_participant(guid_p, status);
     }
 
     void remove_participant(
             const eprosima::fastrtps::rtps::GuidPrefix_t& guid_p)
     {
+        backup_pending_();
         relevant_participants_builtin_ack_status_.remove_participant(guid_p);
     }
 
@@ -101,8 +108,29 @@ public:
     virtual void to_json(
             nlohmann::json& j) const;
 
+    //! Set where the entity notes its GUID whenever it changes, so the backup only stores the changed entities
+    void backup_dirty_entities(
+            std::set<eprosima::fastrtps::rtps::GUID_t>* dirty_entities)
+    {
+        backup_dirty_entities_ = dirty_entities;
+    }
+
+protected:
+
+    //! Note the entity has changed since it was last stored in the backup
+    void backup_pending_()
+    {
+        if (backup_dirty_entities_ != nullptr)
+        {
+            backup_dirty_entities_->insert(fastrtps::rtps::iHandle2GUID(change_->instanceHandle));
+        }
+    }
+
 private:
 
+    // null while the database is not persistent
+    std::set<eprosima::fastrtps::rtps::GUID_t>* backup_dirty_entities_ = nullptr;
+
     eprosima::fastrtps::rtps::CacheChange_t* change_;
 
     // new class is used in order to could change it in the future for a more efficient implementation
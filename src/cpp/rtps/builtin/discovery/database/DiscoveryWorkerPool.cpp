@@ -0,0 +1,141 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryWorkerPool.cpp
+ *
+ */
+
+#include <rtps/builtin/discovery/database/DiscoveryWorkerPool.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+DiscoveryWorkerPool::~DiscoveryWorkerPool()
+{
+    stop();
+}
+
+void DiscoveryWorkerPool::start(
+        uint32_t num_threads)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!threads_.empty() || stop_)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < num_threads; ++i)
+    {
+        threads_.emplace_back([this]()
+                {
+                    worker();
+                });
+    }
+}
+
+void DiscoveryWorkerPool::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+
+    for (std::thread& thread : threads_)
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+}
+
+void DiscoveryWorkerPool::run(
+        size_t num_partitions,
+        const Task& task)
+{
+    if (threads_.empty() || num_partitions < 2)
+    {
+        for (size_t i = 0; i < num_partitions; ++i)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &task;
+        num_partitions_ = num_partitions;
+        next_partition_ = 0;
+        busy_threads_ = threads_.size();
+        ++run_id_;
+    }
+    cv_.notify_all();
+
+    process_partitions();
+
+    // The task must outlive every thread working on it
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]()
+            {
+                return busy_threads_ == 0;
+            });
+    task_ = nullptr;
+}
+
+void DiscoveryWorkerPool::process_partitions()
+{
+    size_t partition = next_partition_.fetch_add(1);
+    while (partition < num_partitions_)
+    {
+        (*task_)(partition);
+        partition = next_partition_.fetch_add(1);
+    }
+}
+
+void DiscoveryWorkerPool::worker()
+{
+    uint64_t last_run_id = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        cv_.wait(lock, [this, last_run_id]()
+                {
+                    return stop_ || run_id_ != last_run_id;
+                });
+        if (stop_)
+        {
+            return;
+        }
+        last_run_id = run_id_;
+
+        lock.unlock();
+        process_partitions();
+        lock.lock();
+
+        if (--busy_threads_ == 0)
+        {
+            cv_.notify_all();
+        }
+    }
+}
+
+} /* namespace ddb */
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
@@ -0,0 +1,114 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryWorkerPool.hpp
+ *
+ */
+
+#ifndef _FASTDDS_RTPS_DISCOVERY_WORKER_POOL_H_
+#define _FASTDDS_RTPS_DISCOVERY_WORKER_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+/**
+ * Pool of threads where the DiscoveryDataBase splits the processing of its partitions.
+ * The thread calling run() works on the partitions too, and returns once all of them are processed, so the
+ * partitions can read the database while the caller holds its lock.
+ *@ingroup DISCOVERY_MODULE
+ */
+class DiscoveryWorkerPool
+{
+
+public:
+
+    typedef std::function<void(size_t)> Task;
+
+    DiscoveryWorkerPool() = default;
+
+    ~DiscoveryWorkerPool();
+
+    /**
+     * Start the threads of the pool.
+     * @param num_threads Number of threads besides the one calling run(). Zero runs every partition on the caller.
+     */
+    void start(
+            uint32_t num_threads);
+
+    //! Stop the threads of the pool
+    void stop();
+
+    //! Number of threads processing the partitions of a run, including the caller
+    size_t concurrency() const
+    {
+        return threads_.size() + 1;
+    }
+
+    /**
+     * Process a number of partitions, blocking until all of them have been processed.
+     * Partitions are taken in order by the first thread available.
+     * @param num_partitions Number of partitions
+     * @param task Function processing the partition with the index passed as argument
+     */
+    void run(
+            size_t num_partitions,
+            const Task& task);
+
+private:
+
+    //! Process partitions of the current run until there are none left
+    void process_partitions();
+
+    void worker();
+
+    std::vector<std::thread> threads_;
+
+    std::mutex mutex_;
+
+    //! Notifies the threads of a new run, and the caller of run() that a thread has finished it
+    std::condition_variable cv_;
+
+    //! Identifies each run, so a thread processes it only once
+    uint64_t run_id_ = 0;
+
+    //! Threads that have not finished the current run
+    size_t busy_threads_ = 0;
+
+    bool stop_ = false;
+
+    const Task* task_ = nullptr;
+
+    size_t num_partitions_ = 0;
+
+    std::atomic<size_t> next_partition_{0};
+};
+
+} /* namespace ddb */
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif /* _FASTDDS_RTPS_DISCOVERY_WORKER_POOL_H_ */
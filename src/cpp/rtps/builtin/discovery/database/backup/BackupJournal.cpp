@@ -0,0 +1,441 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BackupJournal.cpp
+ *
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+
+#include <fastdds/dds/log/Log.hpp>
+
+#include <rtps/builtin/discovery/database/backup/BackupJournal.hpp>
+
+#include <json.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+namespace {
+
+// FILE FORMAT
+/*
+   Both files start with a header:
+    <magic: 4 bytes> <version: uint32> <generation: uint64>
+
+   followed by records:
+    <size: uint32> <checksum: uint32> <kind: uint8> <section length: uint8> <section>
+    <key length: uint16> <key> <entity json in CBOR, only for UPDATE records>
+
+   Integers are stored in little endian. The size counts the bytes following the checksum,
+   which is the FNV-1a hash of those bytes.
+ */
+
+const char* const snapshot_magic = "FDSS";
+const char* const journal_magic = "FDSJ";
+constexpr uint32_t backup_version = 1;
+constexpr size_t header_size = 16;
+constexpr size_t record_header_size = 8;
+
+const char* const sections[] = {"participants", "writers", "readers"};
+
+void write_uint(
+        std::vector<uint8_t>& buffer,
+        uint64_t value,
+        size_t bytes)
+{
+    for (size_t i = 0; i < bytes; ++i)
+    {
+        buffer.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+void write_uint_at(
+        std::vector<uint8_t>& buffer,
+        size_t position,
+        uint64_t value,
+        size_t bytes)
+{
+    for (size_t i = 0; i < bytes; ++i)
+    {
+        buffer[position + i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+uint64_t read_uint(
+        const uint8_t* data,
+        size_t bytes)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < bytes; ++i)
+    {
+        value |= static_cast<uint64_t>(data[i]) << (8 * i);
+    }
+    return value;
+}
+
+uint32_t checksum(
+        const uint8_t* data,
+        size_t size)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+nlohmann::json empty_database()
+{
+    nlohmann::json j;
+    for (const char* section : sections)
+    {
+        j[section] = nlohmann::json::object();
+    }
+    return j;
+}
+
+} // namespace
+
+constexpr uint64_t BackupJournal::min_compaction_size;
+
+BackupJournal::BackupJournal(
+        const std::string& snapshot_file_name,
+        const std::string& journal_file_name)
+    : snapshot_file_name_(snapshot_file_name)
+    , journal_file_name_(journal_file_name)
+    , generation_(0)
+    , snapshot_size_(0)
+    , journal_size_(0)
+{
+}
+
+BackupJournal::~BackupJournal()
+{
+    if (journal_.is_open())
+    {
+        journal_.close();
+    }
+}
+
+bool BackupJournal::load(
+        nlohmann::json& ddb_json)
+{
+    ddb_json = empty_database();
+
+    uint64_t generation = 0;
+    bool complete = true;
+    if (!read_file(snapshot_file_name_, snapshot_magic, generation, ddb_json, complete))
+    {
+        return false;
+    }
+    if (!complete)
+    {
+        // Snapshots are written in a temporary file and then renamed, so this is not an interrupted write
+        logError(DISCOVERY_DATABASE, "Discovery database snapshot " << snapshot_file_name_ << " is corrupted");
+        ddb_json = empty_database();
+        return false;
+    }
+    generation_ = generation;
+
+    // The journal of a previous snapshot must not be replayed, as its records are older than the snapshot
+    uint64_t journal_generation = generation;
+    if (!read_file(journal_file_name_, journal_magic, journal_generation, ddb_json, complete))
+    {
+        logInfo(DISCOVERY_DATABASE, "No valid journal for discovery database snapshot " << snapshot_file_name_);
+    }
+    else if (!complete)
+    {
+        logWarning(DISCOVERY_DATABASE, "Discarding the last incomplete record of journal " << journal_file_name_);
+    }
+
+    return true;
+}
+
+bool BackupJournal::migrate_legacy(
+        const std::string& legacy_file_name,
+        nlohmann::json& ddb_json)
+{
+    std::ifstream legacy_file(legacy_file_name, std::ios_base::in);
+    if (!legacy_file.is_open())
+    {
+        return false;
+    }
+
+    try
+    {
+        legacy_file >> ddb_json;
+    }
+    catch (const std::exception& e)
+    {
+        logWarning(DISCOVERY_DATABASE, "Invalid discovery database backup " << legacy_file_name << ": " << e.what());
+        ddb_json = empty_database();
+        return false;
+    }
+    legacy_file.close();
+
+    // The json file is kept until its content is safe in the snapshot
+    if (write_snapshot(ddb_json))
+    {
+        logInfo(DISCOVERY_DATABASE, "Discovery database backup " << legacy_file_name << " moved to " <<
+                snapshot_file_name_);
+        std::remove(legacy_file_name.c_str());
+    }
+
+    return true;
+}
+
+void BackupJournal::update(
+        const std::string& section,
+        const std::string& key,
+        const nlohmann::json& entity)
+{
+    append_record(pending_, UPDATE, section, key, entity);
+}
+
+void BackupJournal::remove(
+        const std::string& section,
+        const std::string& key)
+{
+    append_record(pending_, REMOVE, section, key, nlohmann::json());
+}
+
+bool BackupJournal::commit()
+{
+    if (pending_.empty())
+    {
+        return true;
+    }
+
+    if (!journal_.is_open())
+    {
+        logError(DISCOVERY_DATABASE, "Storing changes in the discovery database journal before any snapshot");
+        return false;
+    }
+
+    journal_.write(reinterpret_cast<const char*>(pending_.data()), static_cast<std::streamsize>(pending_.size()));
+    journal_.flush();
+    journal_size_ += pending_.size();
+    pending_.clear();
+
+    if (!journal_.good())
+    {
+        // The records may be lost, so the next backup will be a whole snapshot
+        logError(DISCOVERY_DATABASE, "Error writing discovery database journal " << journal_file_name_);
+        journal_.close();
+        return false;
+    }
+    return true;
+}
+
+bool BackupJournal::write_snapshot(
+        const nlohmann::json& ddb_json)
+{
+    pending_.clear();
+
+    std::vector<uint8_t> buffer;
+    append_header(buffer, snapshot_magic, generation_ + 1);
+    for (const char* section : sections)
+    {
+        auto sit = ddb_json.find(section);
+        if (sit == ddb_json.end())
+        {
+            continue;
+        }
+        for (auto it = sit->begin(); it != sit->end(); ++it)
+        {
+            append_record(buffer, UPDATE, section, it.key(), it.value());
+        }
+    }
+
+    // Write the snapshot aside, so the current one remains valid until the new one is complete
+    std::string tmp_file_name = snapshot_file_name_ + ".tmp";
+    std::ofstream snapshot(tmp_file_name, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    snapshot.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    snapshot.close();
+    if (!snapshot.good())
+    {
+        logError(DISCOVERY_DATABASE, "Error writing discovery database snapshot " << tmp_file_name);
+        return false;
+    }
+
+#ifdef _WIN32
+    // rename does not replace existing files on Windows
+    std::remove(snapshot_file_name_.c_str());
+#endif // ifdef _WIN32
+    if (0 != std::rename(tmp_file_name.c_str(), snapshot_file_name_.c_str()))
+    {
+        logError(DISCOVERY_DATABASE, "Error replacing discovery database snapshot " << snapshot_file_name_);
+        return false;
+    }
+    ++generation_;
+    snapshot_size_ = buffer.size();
+
+    // Start the journal of the new snapshot
+    buffer.clear();
+    append_header(buffer, journal_magic, generation_);
+    if (journal_.is_open())
+    {
+        journal_.close();
+    }
+    journal_.clear();
+    journal_.open(journal_file_name_, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    journal_.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    journal_.flush();
+    journal_size_ = buffer.size();
+
+    if (!journal_.good())
+    {
+        logError(DISCOVERY_DATABASE, "Error creating discovery database journal " << journal_file_name_);
+        journal_.close();
+        return false;
+    }
+    return true;
+}
+
+void BackupJournal::append_record(
+        std::vector<uint8_t>& buffer,
+        RecordKind kind,
+        const std::string& section,
+        const std::string& key,
+        const nlohmann::json& entity)
+{
+    size_t start = buffer.size();
+    // Size and checksum are filled once the record is complete
+    buffer.resize(start + record_header_size);
+
+    write_uint(buffer, kind, 1);
+    write_uint(buffer, section.size(), 1);
+    buffer.insert(buffer.end(), section.begin(), section.end());
+    write_uint(buffer, key.size(), 2);
+    buffer.insert(buffer.end(), key.begin(), key.end());
+    if (UPDATE == kind)
+    {
+        nlohmann::json::to_cbor(entity, buffer);
+    }
+
+    size_t body = start + record_header_size;
+    write_uint_at(buffer, start, buffer.size() - body, 4);
+    write_uint_at(buffer, start + 4, checksum(buffer.data() + body, buffer.size() - body), 4);
+}
+
+void BackupJournal::append_header(
+        std::vector<uint8_t>& buffer,
+        const char* magic,
+        uint64_t generation)
+{
+    buffer.insert(buffer.end(), magic, magic + 4);
+    write_uint(buffer, backup_version, 4);
+    write_uint(buffer, generation, 8);
+}
+
+bool BackupJournal::read_file(
+        const std::string& file_name,
+        const char* magic,
+        uint64_t& generation,
+        nlohmann::json& ddb_json,
+        bool& complete)
+{
+    std::ifstream file(file_name, std::ios_base::in | std::ios_base::binary);
+    if (!file.is_open())
+    {
+        return false;
+    }
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+
+    if (data.size() < header_size ||
+            0 != std::memcmp(data.data(), magic, 4) ||
+            backup_version != read_uint(data.data() + 4, 4))
+    {
+        logWarning(DISCOVERY_DATABASE, "Discovery database backup " << file_name << " has an unknown format");
+        return false;
+    }
+
+    // A generation different from zero is the one expected
+    uint64_t file_generation = read_uint(data.data() + 8, 8);
+    if (0 != generation && generation != file_generation)
+    {
+        return false;
+    }
+    generation = file_generation;
+
+    complete = true;
+    size_t position = header_size;
+    while (position < data.size())
+    {
+        if (data.size() - position < record_header_size)
+        {
+            complete = false;
+            break;
+        }
+        size_t size = static_cast<size_t>(read_uint(data.data() + position, 4));
+        uint32_t expected_checksum = static_cast<uint32_t>(read_uint(data.data() + position + 4, 4));
+        const uint8_t* body = data.data() + position + record_header_size;
+        if (data.size() - position - record_header_size < size || size < 4 ||
+                checksum(body, size) != expected_checksum)
+        {
+            complete = false;
+            break;
+        }
+        position += record_header_size + size;
+
+        RecordKind kind = static_cast<RecordKind>(body[0]);
+        size_t section_size = body[1];
+        size_t key_position = 2 + section_size + 2;
+        if (key_position > size)
+        {
+            complete = false;
+            break;
+        }
+        std::string section(reinterpret_cast<const char*>(body + 2), section_size);
+        size_t key_size = static_cast<size_t>(read_uint(body + 2 + section_size, 2));
+        if (key_position + key_size > size)
+        {
+            complete = false;
+            break;
+        }
+        std::string key(reinterpret_cast<const char*>(body + key_position), key_size);
+
+        if (UPDATE == kind)
+        {
+            nlohmann::json entity = nlohmann::json::from_cbor(
+                body + key_position + key_size, body + size, true, false);
+            if (entity.is_discarded())
+            {
+                complete = false;
+                break;
+            }
+            ddb_json[section][key] = std::move(entity);
+        }
+        else
+        {
+            ddb_json[section].erase(key);
+        }
+    }
+
+    return true;
+}
+
+} /* namespace ddb */
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
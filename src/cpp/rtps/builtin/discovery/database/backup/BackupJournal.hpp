@@ -0,0 +1,180 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BackupJournal.hpp
+ *
+ */
+
+#ifndef _FASTDDS_RTPS_DISCOVERY_BACKUP_JOURNAL_H_
+#define _FASTDDS_RTPS_DISCOVERY_BACKUP_JOURNAL_H_
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <json.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+/**
+ * Persistent backup of the DiscoveryDataBase, made of a snapshot file and an append-only journal file.
+ *
+ * Both files store binary records with the json object of an entity, as produced by its to_json method,
+ * encoded in CBOR. The snapshot holds every entity of the database when it was taken, and the journal the
+ * entities updated or removed since then, so each backup only writes the entities that have changed.
+ * Once the journal grows bigger than the snapshot, a new snapshot is taken and the journal is emptied.
+ *
+ * Both files start with the generation of the snapshot, so a journal is never replayed over a snapshot
+ * newer than itself. A record which has not been completely written, e.g. if the server was killed
+ * while storing it, finishes the replay of the journal.
+ *@ingroup DISCOVERY_MODULE
+ */
+class BackupJournal
+{
+
+public:
+
+    //! Journal size under which no snapshot is taken, even if it is bigger than the snapshot
+    static constexpr uint64_t min_compaction_size = 64 * 1024;
+
+    BackupJournal(
+            const std::string& snapshot_file_name,
+            const std::string& journal_file_name);
+
+    ~BackupJournal();
+
+    /**
+     * Read the backup files, replaying the journal over the snapshot.
+     * @param ddb_json json object where the database is restored, with the format of DiscoveryDataBase::to_json
+     * @return false if there is no valid snapshot
+     */
+    bool load(
+            nlohmann::json& ddb_json);
+
+    /**
+     * Read a backup of a previous version, stored as a single json file, and make it the snapshot.
+     * The json file is removed once the snapshot is written, so it is only read once.
+     * @param legacy_file_name Name of the json backup file
+     * @param ddb_json json object where the database is restored, with the format of DiscoveryDataBase::to_json
+     * @return false if there is no valid json backup
+     */
+    bool migrate_legacy(
+            const std::string& legacy_file_name,
+            nlohmann::json& ddb_json);
+
+    /**
+     * Add an updated entity to the records pending to store.
+     * @param section Section of the entity in the database json object: participants, writers or readers
+     * @param key Key of the entity in its section
+     * @param entity json object of the entity
+     */
+    void update(
+            const std::string& section,
+            const std::string& key,
+            const nlohmann::json& entity);
+
+    /**
+     * Add a removed entity to the records pending to store.
+     * @param section Section of the entity in the database json object: participants, writers or readers
+     * @param key Key of the entity in its section
+     */
+    void remove(
+            const std::string& section,
+            const std::string& key);
+
+    //! Append the pending records to the journal
+    bool commit();
+
+    //! Whether the next backup should be a snapshot, because there is none or the journal is too big
+    bool snapshot_needed() const
+    {
+        return !journal_.is_open() ||
+               (journal_size_ > min_compaction_size && journal_size_ > snapshot_size_);
+    }
+
+    /**
+     * Replace the snapshot with the whole database and empty the journal.
+     * The records pending to store are discarded, as the database already contains them.
+     * @param ddb_json json object of the database, with the format of DiscoveryDataBase::to_json
+     */
+    bool write_snapshot(
+            const nlohmann::json& ddb_json);
+
+    //! Size of the snapshot in bytes
+    uint64_t snapshot_size() const
+    {
+        return snapshot_size_;
+    }
+
+    //! Size of the journal in bytes
+    uint64_t journal_size() const
+    {
+        return journal_size_;
+    }
+
+private:
+
+    enum RecordKind : uint8_t
+    {
+        UPDATE = 0,
+        REMOVE = 1
+    };
+
+    static void append_record(
+            std::vector<uint8_t>& buffer,
+            RecordKind kind,
+            const std::string& section,
+            const std::string& key,
+            const nlohmann::json& entity);
+
+    static void append_header(
+            std::vector<uint8_t>& buffer,
+            const char* magic,
+            uint64_t generation);
+
+    static bool read_file(
+            const std::string& file_name,
+            const char* magic,
+            uint64_t& generation,
+            nlohmann::json& ddb_json,
+            bool& complete);
+
+    std::string snapshot_file_name_;
+
+    std::string journal_file_name_;
+
+    std::ofstream journal_;
+
+    //! Records not yet written in the journal
+    std::vector<uint8_t> pending_;
+
+    //! Generation of the current snapshot
+    uint64_t generation_;
+
+    uint64_t snapshot_size_;
+
+    uint64_t journal_size_;
+};
+
+} /* namespace ddb */
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif /* _FASTDDS_RTPS_DISCOVERY_BACKUP_JOURNAL_H_ */
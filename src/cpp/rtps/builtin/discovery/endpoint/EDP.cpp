@@ -97,11 +97,12 @@ EDP::~EDP()
 bool EDP::newLocalReaderProxyData(
         RTPSReader* reader,
         const TopicAttributes& att,
-        const ReaderQos& rqos)
+        const ReaderQos& rqos,
+        const fastdds::rtps::ContentFilterProperty* content_filter)
 {
     logInfo(RTPS_EDP, "Adding " << reader->getGuid().entityId << " in topic " << att.topicName);
 
-    auto init_fun = [this, reader, &att, &rqos](
+    auto init_fun = [this, reader, &att, &rqos, content_filter](
         ReaderProxyData* rpd,
         bool updating,
         const ParticipantProxyData& participant_data)
@@ -145,6 +146,10 @@ bool EDP::newLocalReaderProxyData(
                     rpd->type_information(att.type_information);
                 }
                 rpd->m_qos.setQos(rqos, true);
+                if (content_filter != nullptr)
+                {
+                    rpd->content_filter(*content_filter);
+                }
                 rpd->userDefinedId(reader->getAttributes().getUserDefinedID());
 #if HAVE_SECURITY
                 if (mp_RTPSParticipant->is_secure())
@@ -354,9 +359,10 @@ bool EDP::newLocalWriterProxyData(
 bool EDP::updatedLocalReader(
         RTPSReader* reader,
         const TopicAttributes& att,
-        const ReaderQos& rqos)
+        const ReaderQos& rqos,
+        const fastdds::rtps::ContentFilterProperty* content_filter)
 {
-    auto init_fun = [this, reader, &rqos, &att](
+    auto init_fun = [this, reader, &rqos, &att, content_filter](
         ReaderProxyData* rdata,
         bool updating,
         const ParticipantProxyData& participant_data)
@@ -379,6 +385,10 @@ bool EDP::updatedLocalReader(
                 rdata->m_qos.setQos(rqos, false);
                 rdata->isAlive(true);
                 rdata->m_expectsInlineQos = reader->expectsInlineQos();
+                if (content_filter != nullptr)
+                {
+                    rdata->content_filter(*content_filter);
+                }
 
                 if (att.auto_fill_type_information)
                 {
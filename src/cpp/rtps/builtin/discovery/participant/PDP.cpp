@@ -236,6 +236,11 @@ ParticipantProxyData* PDP::add_participant_proxy_data(
     ret_val->m_guid = participant_guid;
     participant_proxies_.push_back(ret_val);
 
+    if (participant_guid != mp_RTPSParticipant->getGuid())
+    {
+        mp_RTPSParticipant->statistics().on_participant_discovered();
+    }
+
     return ret_val;
 }
 
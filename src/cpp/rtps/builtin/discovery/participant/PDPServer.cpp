@@ -17,17 +17,23 @@
  *
  */
 
+#include <algorithm>
+#include <cstdlib>
 #include <iostream>
 #include <fstream>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 #include <fastrtps/utils/TimedMutex.hpp>
 
 #include <fastdds/rtps/builtin/BuiltinProtocols.h>
 #include <fastdds/rtps/builtin/liveliness/WLP.h>
 
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 #include <fastdds/rtps/participant/RTPSParticipantListener.h>
 #include <fastdds/rtps/reader/StatefulReader.h>
+#include <fastdds/rtps/writer/ReaderProxy.h>
 #include <fastdds/rtps/writer/StatefulWriter.h>
 
 #include <fastdds/rtps/history/WriterHistory.h>
@@ -48,6 +54,7 @@
 #include <rtps/builtin/discovery/endpoint/EDPServer.hpp>
 #include <rtps/builtin/discovery/endpoint/EDPServerListeners.hpp>
 
+#include <rtps/builtin/discovery/database/backup/BackupJournal.hpp>
 #include <rtps/builtin/discovery/database/backup/SharedBackupFunctions.hpp>
 
 namespace eprosima {
@@ -65,6 +72,7 @@ PDPServer::PDPServer(
     , ping_(nullptr)
     , discovery_db_(builtin->mp_participantImpl->getGuid().guidPrefix,
             servers_prefixes())
+    , backup_journal_(nullptr)
     , durability_ (durability_kind)
 {
 }
@@ -84,6 +92,8 @@ PDPServer::~PDPServer()
 
     // Clear ddb and release its changes
     process_changes_release_(discovery_db_.clear());
+
+    delete(backup_journal_);
 }
 
 bool PDPServer::init(
@@ -105,6 +115,10 @@ bool PDPServer::init(
     std::vector<nlohmann::json> backup_queue;
     if (durability_ == TRANSIENT)
     {
+        backup_journal_ = new ddb::BackupJournal(
+            get_ddb_persistence_file_name(),
+            get_ddb_journal_persistence_file_name());
+
         nlohmann::json backup_json;
         // If the DS is BACKUP, try to restore DDB from file
         discovery_db().backup_in_progress(true);
@@ -139,6 +153,20 @@ bool PDPServer::init(
     // Initialize server dedicated thread.
     resource_event_thread_.init_thread();
 
+    // Threads helping the server one to process the database
+    const std::string* server_threads = PropertyPolicyHelper::find_property(
+        mp_RTPSParticipant->getAttributes().properties, "fastdds.discovery.server_threads");
+    if (nullptr != server_threads)
+    {
+        uint32_t num_threads = static_cast<uint32_t>(std::strtoul(server_threads->c_str(), nullptr, 10));
+        uint32_t max_threads = std::thread::hardware_concurrency();
+        if (max_threads > 0 && num_threads >= max_threads)
+        {
+            num_threads = max_threads - 1;
+        }
+        discovery_db_.start_workers(num_threads);
+    }
+
     /*
         Given the fact that a participant is either a client or a server the
         discoveryServer_client_syncperiod parameter has a context defined meaning.
@@ -498,7 +526,6 @@ std::ostringstream PDPServer::get_persistence_file_name_() const
     prefix = filename.str();
     std::replace(prefix.begin(), prefix.end(), '.', '-');
     filename.str(std::move(prefix));
-    //filename << ".json";
 
     return filename;
 }
@@ -518,6 +545,20 @@ std::string PDPServer::get_reader_persistence_file_name() const
 }
 
 std::string PDPServer::get_ddb_persistence_file_name() const
+{
+    std::ostringstream filename = get_persistence_file_name_();
+    filename << "_ddb.snapshot";
+    return filename.str();
+}
+
+std::string PDPServer::get_ddb_journal_persistence_file_name() const
+{
+    std::ostringstream filename = get_persistence_file_name_();
+    filename << "_ddb.journal";
+    return filename.str();
+}
+
+std::string PDPServer::get_ddb_legacy_persistence_file_name() const
 {
     std::ostringstream filename = get_persistence_file_name_();
     filename << ".json";
@@ -882,32 +923,77 @@ bool PDPServer::process_writers_acknowledgements()
 
     /* EDP Subscriptions Writer's History */
     EDPServer* edp = static_cast<EDPServer*>(mp_EDP);
-    bool pending = process_history_acknowledgement(edp->subscriptions_writer_.first, edp->subscriptions_writer_.second);
+    bool pending = process_history_acknowledgement(edp->subscriptions_writer_.first, edp->subscriptions_writer_.second,
+                    edp_subscriptions_ack_state_);
 
     /* EDP Publications Writer's History */
-    pending |= process_history_acknowledgement(edp->publications_writer_.first, edp->publications_writer_.second);
+    pending |= process_history_acknowledgement(edp->publications_writer_.first, edp->publications_writer_.second,
+                    edp_publications_ack_state_);
 
     /* PDP Writer's History */
     pending |= process_history_acknowledgement(
-        static_cast<fastrtps::rtps::StatefulWriter*>(mp_PDPWriter), mp_PDPWriterHistory);
+        static_cast<fastrtps::rtps::StatefulWriter*>(mp_PDPWriter), mp_PDPWriterHistory, pdp_ack_state_);
 
     return pending;
 }
 
 bool PDPServer::process_history_acknowledgement(
         fastrtps::rtps::StatefulWriter* writer,
-        fastrtps::rtps::WriterHistory* writer_history)
+        fastrtps::rtps::WriterHistory* writer_history,
+        WriterAckState& ack_state)
 {
+    using fastrtps::rtps::GUID_t;
+    using fastrtps::rtps::ReaderProxy;
+    using fastrtps::rtps::SequenceNumber_t;
+
     std::unique_lock<fastrtps::RecursiveTimedMutex> lock(writer->getMutex());
 
-    // Iterate over changes in writer's history
-    for (auto it = writer_history->changesBegin(); it != writer_history->changesEnd();)
+    std::map<GUID_t, SequenceNumber_t> low_marks;
+    writer->for_each_reader_proxy(
+        [&low_marks](
+            const ReaderProxy* reader_proxy)
+        {
+            low_marks.emplace(reader_proxy->guid(), reader_proxy->changes_low_mark());
+        });
+
+    // Ranges [first, last) of sequence numbers whose changes must be checked
+    std::vector<WriterAckState::Range> to_check = ack_state.update(low_marks, writer_history->next_sequence_number());
+
+    // The server's DATA(p) is checked until the database knows it has been acked by all
+    if (writer_history == mp_PDPWriterHistory && !discovery_db_.server_acked_by_all())
+    {
+        for (auto it = writer_history->changesBegin(); it != writer_history->changesEnd(); ++it)
+        {
+            if (discovery_db_.is_participant(*it) &&
+                    discovery_db_.guid_from_change(*it) == mp_builtin->mp_participantImpl->getGuid())
+            {
+                to_check.emplace_back((*it)->sequenceNumber, (*it)->sequenceNumber + 1);
+                std::sort(to_check.begin(), to_check.end());
+                break;
+            }
+        }
+    }
+
+    // Iterate over the changes of writer's history in the ranges to check
+    auto it = writer_history->changesBegin();
+    for (const auto& range : to_check)
     {
-        it = process_change_acknowledgement(
-            it,
-            writer,
-            writer_history);
+        it = std::lower_bound(it, writer_history->changesEnd(), range.first,
+                        [](
+                            const fastrtps::rtps::CacheChange_t* change,
+                            const SequenceNumber_t& sequence_number)
+                        {
+                            return change->sequenceNumber < sequence_number;
+                        });
+        while (it != writer_history->changesEnd() && (*it)->sequenceNumber < range.second)
+        {
+            it = process_change_acknowledgement(
+                it,
+                writer,
+                writer_history);
+        }
     }
+
     return writer_history->getHistorySize() > 1;
 }
 
@@ -1397,18 +1483,12 @@ bool PDPServer::read_backup(
         nlohmann::json& ddb_json,
         std::vector<nlohmann::json>& /* new_changes */)
 {
-    std::ifstream myfile;
-    bool ret = true;
-    try
-    {
-        myfile.open(get_ddb_persistence_file_name(), std::ios_base::in);
-        // read json object
-        myfile >> ddb_json;
-        myfile.close();
-    }
-    catch (const std::exception& /* e */)
+    // Snapshot with the journal replayed over it
+    bool ret = backup_journal_->load(ddb_json);
+    if (!ret)
     {
-        ret = false;
+        // Servers of previous versions stored the backup in a json file, which becomes the snapshot
+        ret = backup_journal_->migrate_legacy(get_ddb_legacy_persistence_file_name(), ddb_json);
     }
 
     // TODO uncomment this part when recover queues is finish
@@ -1711,18 +1791,17 @@ bool PDPServer::process_backup_restore_queue(
 
 void PDPServer::process_backup_store()
 {
-    logInfo(DISCOVERY_DATABASE, "Dump DDB in json backup");
-
-    // This will erase the last backup stored
-    std::ofstream backup_json_file;
-    backup_json_file.open(get_ddb_persistence_file_name(), std::ios_base::out);
-
-    // Set j with the json from database dump
-    nlohmann::json j;
-    discovery_db().to_json(j);
-    // setw makes pretty print for json
-    backup_json_file << std::setw(4) << j << std::endl;
-    backup_json_file.close();
+    // Only the entities changed since the last backup are stored, until the journal needs a compaction
+    if (backup_journal_->snapshot_needed())
+    {
+        logInfo(DISCOVERY_DATABASE, "Store DDB snapshot in backup");
+        discovery_db_.backup_snapshot(*backup_journal_);
+    }
+    else
+    {
+        logInfo(DISCOVERY_DATABASE, "Store DDB changes in backup journal");
+        discovery_db_.backup_changes(*backup_journal_);
+    }
 
     // Clear queue ddb backup
     discovery_db_.clean_backup();
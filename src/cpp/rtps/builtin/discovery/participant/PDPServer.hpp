@@ -21,12 +21,15 @@
 #define _FASTDDS_RTPS_PDPSERVER2_H_
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <map>
+
 #include <fastdds/rtps/builtin/discovery/participant/PDP.h>
 #include <fastdds/rtps/history/History.h>
 #include <fastdds/rtps/resources/ResourceEvent.h>
 
 #include <rtps/builtin/discovery/database/DiscoveryDataFilter.hpp>
 #include <rtps/builtin/discovery/database/DiscoveryDataBase.hpp>
+#include <rtps/builtin/discovery/participant/WriterAckState.hpp>
 #include <rtps/builtin/discovery/participant/timedevent/DServerEvent.hpp>
 
 namespace eprosima {
@@ -136,9 +139,15 @@ public:
     //! Get filename for reader persistence database file
     std::string get_reader_persistence_file_name() const;
 
-    //! Get filename for discovery database file
+    //! Get filename for discovery database snapshot file
     std::string get_ddb_persistence_file_name() const;
 
+    //! Get filename for discovery database journal file
+    std::string get_ddb_journal_persistence_file_name() const;
+
+    //! Get filename for discovery database json file, used as backup by previous versions
+    std::string get_ddb_legacy_persistence_file_name() const;
+
     //! Get filename for discovery database file
     std::string get_ddb_queue_persistence_file_name() const;
 
@@ -181,7 +190,8 @@ protected:
 
     bool process_history_acknowledgement(
             fastrtps::rtps::StatefulWriter* writer,
-            fastrtps::rtps::WriterHistory* writer_history);
+            fastrtps::rtps::WriterHistory* writer_history,
+            WriterAckState& ack_state);
 
     fastrtps::rtps::History::iterator process_change_acknowledgement(
             fastrtps::rtps::History::iterator c,
@@ -242,8 +252,8 @@ protected:
     bool process_backup_restore_queue(
             std::vector<nlohmann::json>& new_changes);
 
-    // Reads the two backup files and stores each json objects in both arguments
-    // The first argument has the json object to restore the DDB
+    // Reads the backup files and stores each json objects in both arguments
+    // The first argument has the json object to restore the DDB, from the snapshot and its journal
     // The second argument has the json vector object to restore the changes that must be sent again to the queue
     bool read_backup(
             nlohmann::json& ddb_json,
@@ -254,7 +264,8 @@ protected:
     // General file name for the prefix of every backup file
     std::ostringstream get_persistence_file_name_() const;
 
-    // Erase the last file and store the backup info of the actual state of the DDB
+    // Store in the backup journal the entities of the DDB that have changed since the last call, or a new
+    // snapshot of the whole DDB once the journal has grown bigger than the last snapshot
     // Erase the content of the file with the changes in the queues
     // This method must be called after the whole DDB routine process has been finished and with the DDB
     // queues empty. If not, there will be some information that could be lost. For this, the lock_incoming_data()
@@ -279,6 +290,18 @@ private:
     //! Discovery database
     fastdds::rtps::ddb::DiscoveryDataBase discovery_db_;
 
+    //! Backup of the discovery database, only for TRANSIENT durability
+    fastdds::rtps::ddb::BackupJournal* backup_journal_;
+
+    //! Acknowledgement state of the PDP writer
+    WriterAckState pdp_ack_state_;
+
+    //! Acknowledgement state of the EDP publications writer
+    WriterAckState edp_publications_ack_state_;
+
+    //! Acknowledgement state of the EDP subscriptions writer
+    WriterAckState edp_subscriptions_ack_state_;
+
     //! TRANSIENT or TRANSIENT_LOCAL durability;
     fastrtps::rtps::DurabilityKind_t durability_;
 
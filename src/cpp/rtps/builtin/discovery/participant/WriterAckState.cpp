@@ -0,0 +1,77 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WriterAckState.cpp
+ *
+ */
+
+#include <algorithm>
+
+#include <rtps/builtin/discovery/participant/WriterAckState.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+using fastrtps::rtps::GUID_t;
+using fastrtps::rtps::SequenceNumber_t;
+
+std::vector<WriterAckState::Range> WriterAckState::update(
+        std::map<GUID_t, SequenceNumber_t>& low_marks,
+        const SequenceNumber_t& end_sequence_number)
+{
+    std::vector<Range> to_check;
+
+    // Changes added to the history since the last check
+    to_check.emplace_back(next_sequence_number_, end_sequence_number);
+
+    // Both maps are sorted by GUID, so they are merged in a single pass
+    auto old_it = low_marks_.begin();
+    for (const auto& low_mark : low_marks)
+    {
+        for (; old_it != low_marks_.end() && old_it->first < low_mark.first; ++old_it)
+        {
+            // Unmatched reader
+            to_check.emplace_back(old_it->second + 1, end_sequence_number);
+        }
+
+        // A new reader may have acknowledged changes before being seen here
+        SequenceNumber_t old_low_mark;
+        if (old_it != low_marks_.end() && old_it->first == low_mark.first)
+        {
+            old_low_mark = old_it->second;
+            ++old_it;
+        }
+        if (old_low_mark < low_mark.second)
+        {
+            to_check.emplace_back(old_low_mark + 1, low_mark.second + 1);
+        }
+    }
+    for (; old_it != low_marks_.end(); ++old_it)
+    {
+        to_check.emplace_back(old_it->second + 1, end_sequence_number);
+    }
+
+    std::sort(to_check.begin(), to_check.end());
+
+    low_marks_.swap(low_marks);
+    next_sequence_number_ = end_sequence_number;
+
+    return to_check;
+}
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,76 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WriterAckState.hpp
+ *
+ */
+
+#ifndef _FASTDDS_RTPS_WRITER_ACK_STATE_H_
+#define _FASTDDS_RTPS_WRITER_ACK_STATE_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/SequenceNumber.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Acknowledgement state of a server writer as seen on the last acknowledgement processing, used to only
+ * check the changes whose acknowledgement could have changed since then.
+ *@ingroup DISCOVERY_MODULE
+ */
+class WriterAckState
+{
+
+public:
+
+    //! Range [first, second) of sequence numbers
+    typedef std::pair<fastrtps::rtps::SequenceNumber_t, fastrtps::rtps::SequenceNumber_t> Range;
+
+    /**
+     * Compute the ranges of changes whose acknowledgement could have changed since the last call, and keep the
+     * given state for the next one.
+     * The acknowledgement status of a change only varies when a reader acknowledges it, or when a reader that had
+     * not acknowledged it goes away. Changes whose relevance increases are sent again by the database, so they
+     * are new changes in the history.
+     * @param low_marks Changes low mark of each matched reader. Its content is moved to the state.
+     * @param end_sequence_number Next sequence number of the writer history.
+     * @return Ranges to check, sorted by their first sequence number. They may overlap.
+     */
+    std::vector<Range> update(
+            std::map<fastrtps::rtps::GUID_t, fastrtps::rtps::SequenceNumber_t>& low_marks,
+            const fastrtps::rtps::SequenceNumber_t& end_sequence_number);
+
+private:
+
+    //! Changes low mark of each matched reader
+    std::map<fastrtps::rtps::GUID_t, fastrtps::rtps::SequenceNumber_t> low_marks_;
+
+    //! Changes from this sequence number on have not been checked yet
+    fastrtps::rtps::SequenceNumber_t next_sequence_number_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif /* _FASTDDS_RTPS_WRITER_ACK_STATE_H_ */
@@ -35,10 +35,13 @@ CacheChangePool::~CacheChangePool()
 {
     logInfo(RTPS_UTILS, "ChangePool destructor");
 
-    // Deletion process does not depend on the memory management policy
-    for (CacheChange_t* cache : all_caches_)
+    // Cache changes allocated in groups are owned by blocks_
+    if (memory_mode_ == DYNAMIC_RESERVE_MEMORY_MODE || memory_mode_ == DYNAMIC_REUSABLE_MEMORY_MODE)
     {
-        delete(cache);
+        for (CacheChange_t* cache : all_caches_)
+        {
+            delete(cache);
+        }
     }
 }
 
@@ -102,6 +105,8 @@ void CacheChangePool::return_cache_to_pool(
     ch->sourceTimestamp.seconds(0);
     ch->sourceTimestamp.fraction(0);
     ch->setFragmentSize(0);
+    ch->intraprocess_sample.reset();
+    ch->payload_is_shared(false);
     free_caches_.push_back(ch);
 }
 
@@ -130,13 +135,20 @@ bool CacheChangePool::allocateGroup(
     all_caches_.reserve(desired_size);
     free_caches_.reserve(free_caches_.size() + group_size);
 
-    while (current_pool_size_ < desired_size)
+    // The whole group is allocated as a single array, so traversing the history keeps locality
+    CacheChange_t* block = new CacheChange_t[group_size];
+    blocks_.emplace_back(block);
+
+    // Free caches are taken from the back, so push them in reverse order to hand them out sequentially
+    for (uint32_t i = 0; i < group_size; ++i)
     {
-        CacheChange_t* ch = new CacheChange_t();
-        all_caches_.push_back(ch);
-        free_caches_.push_back(ch);
-        ++current_pool_size_;
+        all_caches_.push_back(&block[i]);
     }
+    for (uint32_t i = group_size; i > 0; --i)
+    {
+        free_caches_.push_back(&block[i - 1]);
+    }
+    current_pool_size_ = desired_size;
 
     return true;
 }
@@ -210,6 +222,62 @@ bool CacheChangePool::reserve_cache(
     return true;
 }
 
+bool CacheChangePool::reserve_caches(
+        CacheChange_t** cache_changes,
+        size_t count)
+{
+    switch (memory_mode_)
+    {
+        case PREALLOCATED_MEMORY_MODE:
+        case PREALLOCATED_WITH_REALLOC_MEMORY_MODE:
+            if (free_caches_.size() < count)
+            {
+                // Grow once for the whole request, keeping the usual growth margin
+                uint32_t missing = static_cast<uint32_t>(count - free_caches_.size());
+                uint32_t growth = static_cast<uint32_t>(ceil((float)current_pool_size_ / 10) + 10);
+                if ((max_pool_size_ - current_pool_size_ < missing) || !allocateGroup(missing + growth) ||
+                        free_caches_.size() < count)
+                {
+                    return false;
+                }
+            }
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                cache_changes[i] = free_caches_.back();
+                free_caches_.pop_back();
+            }
+            return true;
+
+        case DYNAMIC_RESERVE_MEMORY_MODE:
+        case DYNAMIC_REUSABLE_MEMORY_MODE:
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (!reserve_cache(cache_changes[i]))
+                {
+                    release_caches(cache_changes, i);
+                    return false;
+                }
+            }
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+bool CacheChangePool::release_caches(
+        CacheChange_t* const* cache_changes,
+        size_t count)
+{
+    bool ret_val = true;
+    for (size_t i = 0; i < count; ++i)
+    {
+        ret_val &= release_cache(cache_changes[i]);
+    }
+    return ret_val;
+}
+
 bool CacheChangePool::release_cache(
         CacheChange_t* cache_change)
 {
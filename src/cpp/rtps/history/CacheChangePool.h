@@ -29,6 +29,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstddef>
+#include <memory>
 
 namespace eprosima {
 namespace fastrtps {
@@ -72,6 +73,32 @@ public:
     bool release_cache(
             CacheChange_t* cache_change) override;
 
+    /**
+     * @brief Get several cache changes from the pool at once.
+     *
+     * On preallocated modes, the pool grows at most once to fulfill the whole request.
+     *
+     * @param [out] cache_changes  Array where the pointers to the new cache changes are stored.
+     * @param [in]  count          Number of cache changes to get.
+     *
+     * @returns whether the operation succeeded or not. On failure, no cache change is taken from the pool.
+     */
+    bool reserve_caches(
+            CacheChange_t** cache_changes,
+            size_t count);
+
+    /**
+     * @brief Return several cache changes to the pool at once.
+     *
+     * @param [in] cache_changes  Array with the pointers to the cache changes to release.
+     * @param [in] count          Number of cache changes to release.
+     *
+     * @returns whether all the cache changes were released.
+     */
+    bool release_caches(
+            CacheChange_t* const* cache_changes,
+            size_t count);
+
     //!Get the size of the cache vector; all of them (reserved and not reserved).
     size_t get_allCachesSize()
     {
@@ -93,6 +120,9 @@ private:
     std::vector<CacheChange_t*> free_caches_;
     std::vector<CacheChange_t*> all_caches_;
 
+    //! Contiguous arrays holding the cache changes allocated on preallocated modes
+    std::vector<std::unique_ptr<CacheChange_t[]>> blocks_;
+
     bool allocateGroup(
             uint32_t num_caches);
 
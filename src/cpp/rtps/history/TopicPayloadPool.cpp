@@ -24,12 +24,113 @@
 #include "./TopicPayloadPool_impl/Dynamic.hpp"
 #include "./TopicPayloadPool_impl/DynamicReusable.hpp"
 
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
 #include <memory>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif // if defined(__linux__)
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+#if defined(__linux__)
+static bool env_flag_enabled(
+        const char* name)
+{
+    const char* value = std::getenv(name);
+    return value != nullptr && value[0] == '1';
+}
+
+static bool slab_huge_pages_enabled()
+{
+    static const bool enabled = env_flag_enabled("FASTDDS_PAYLOAD_POOL_HUGE_PAGES");
+    return enabled;
+}
+
+static bool slab_lock_memory_enabled()
+{
+    static const bool enabled = env_flag_enabled("FASTDDS_PAYLOAD_POOL_LOCK_MEMORY");
+    return enabled;
+}
+
+#endif // if defined(__linux__)
+
+TopicPayloadPool::PayloadSlab::PayloadSlab(
+        size_t size)
+    : size_(size)
+{
+#if defined(__linux__)
+    if (slab_huge_pages_enabled())
+    {
+        // Explicit huge pages need a size multiple of the huge page size
+        constexpr size_t huge_page_size = 2u * 1024u * 1024u;
+        size_t huge_size = (size + huge_page_size - 1) & ~(huge_page_size - 1);
+        void* memory = mmap(nullptr, huge_size, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (memory != MAP_FAILED)
+        {
+            size_ = huge_size;
+        }
+        else
+        {
+            // No huge pages reserved on the system. Ask for transparent huge pages instead.
+            memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (memory == MAP_FAILED)
+            {
+                throw std::bad_alloc();
+            }
+#if defined(MADV_HUGEPAGE)
+            madvise(memory, size, MADV_HUGEPAGE);
+#endif // if defined(MADV_HUGEPAGE)
+        }
+        memory_ = static_cast<octet*>(memory);
+        mapped_ = true;
+    }
+#endif // if defined(__linux__)
+
+    if (memory_ == nullptr)
+    {
+        memory_ = (octet*)calloc(size_, sizeof(octet));
+        if (memory_ == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+    }
+
+#if defined(__linux__)
+    if (slab_lock_memory_enabled())
+    {
+        locked_ = (mlock(memory_, size_) == 0);
+        if (!locked_)
+        {
+            logWarning(RTPS_HISTORY, "Could not lock payload pool memory: " << strerror(errno));
+        }
+    }
+#endif // if defined(__linux__)
+}
+
+TopicPayloadPool::PayloadSlab::~PayloadSlab()
+{
+#if defined(__linux__)
+    if (locked_)
+    {
+        munlock(memory_, size_);
+    }
+
+    if (mapped_)
+    {
+        munmap(memory_, size_);
+        return;
+    }
+#endif // if defined(__linux__)
+
+    free(memory_);
+}
+
 bool TopicPayloadPool::get_payload(
         uint32_t size,
         CacheChange_t& cache_change)
@@ -45,7 +146,8 @@ bool TopicPayloadPool::do_get_payload(
     PayloadNode* payload = nullptr;
 
     std::unique_lock<std::mutex> lock(mutex_);
-    if (free_payloads_.empty())
+    payload = pop_free_payload();
+    if (payload == nullptr)
     {
         payload = allocate(size); //Allocates a single payload
         if (payload == nullptr)
@@ -57,11 +159,6 @@ bool TopicPayloadPool::do_get_payload(
             return false;
         }
     }
-    else
-    {
-        payload = free_payloads_.back();
-        free_payloads_.pop_back();
-    }
 
     // Resize if needed
     if (resizeable && size > payload->data_size())
@@ -69,7 +166,7 @@ bool TopicPayloadPool::do_get_payload(
         if (!payload->resize(size))
         {
             // Failed to resize, but we can still keep it for later.
-            free_payloads_.push_back(payload);
+            push_free_payload(payload);
             lock.unlock();
             logError(RTPS_HISTORY, "Failed to resize the payload");
 
@@ -140,7 +237,15 @@ bool TopicPayloadPool::release_payload(
     {
         std::lock_guard<std::mutex> lock(mutex_);
         PayloadNode* payload = all_payloads_.at(PayloadNode::data_index(cache_change.serializedPayload.data));
-        free_payloads_.push_back(payload);
+        if (all_payloads_.size() > max_pool_size_)
+        {
+            // The pool was shrunk while this payload was in use
+            delete_payload(payload);
+        }
+        else
+        {
+            push_free_payload(payload);
+        }
     }
 
     cache_change.serializedPayload.length = 0;
@@ -244,34 +349,76 @@ void TopicPayloadPool::update_maximum_size(
     }
 }
 
-void TopicPayloadPool::reserve (
+bool TopicPayloadPool::reserve (
         uint32_t min_num_payloads,
         uint32_t size)
 {
     assert (min_num_payloads <= max_pool_size_);
 
-    for (size_t i = all_payloads_.size(); i < min_num_payloads; ++i)
+    if (all_payloads_.size() >= min_num_payloads)
     {
-        PayloadNode* payload = do_allocate(size);
-        free_payloads_.push_back(payload);
+        return true;
     }
+
+    // All the new payloads are placed on a single slab
+    size_t num_payloads = min_num_payloads - all_payloads_.size();
+    size_t node_size = PayloadNode::buffer_size(size);
+    std::shared_ptr<PayloadSlab> slab;
+    try
+    {
+        slab = std::make_shared<PayloadSlab>(num_payloads * node_size);
+    }
+    catch (std::bad_alloc& exception)
+    {
+        logWarning(RTPS_HISTORY, "Failure to create a slab for " << num_payloads << " payloads "
+                                                                 << exception.what());
+    }
+
+    all_payloads_.reserve(min_num_payloads);
+    for (size_t i = 0; i < num_payloads; ++i)
+    {
+        PayloadNode* payload = nullptr;
+        if (slab)
+        {
+            try
+            {
+                payload = new PayloadNode(slab, slab->memory() + i * node_size, size);
+            }
+            catch (std::bad_alloc& exception)
+            {
+                logWarning(RTPS_HISTORY, "Failure to create a new payload " << exception.what());
+                return false;
+            }
+            payload->data_index(static_cast<uint32_t>(all_payloads_.size()));
+            all_payloads_.push_back(payload);
+        }
+        else
+        {
+            payload = do_allocate(size);
+            if (payload == nullptr)
+            {
+                return false;
+            }
+        }
+        push_free_payload(payload);
+    }
+
+    return true;
 }
 
 bool TopicPayloadPool::shrink (
         uint32_t max_num_payloads)
 {
-    assert(payload_pool_allocated_size() - payload_pool_available_size() <= max_num_payloads);
-
+    // Payloads still in use, e.g. by the reassembly buffer of a MessageReceiver, are deleted when released
     while (max_num_payloads < all_payloads_.size())
     {
-        PayloadNode* payload = free_payloads_.back();
-        free_payloads_.pop_back();
-
-        // Find data in allPayloads, remove element, then delete it
-        all_payloads_.at(payload->data_index()) = all_payloads_.back();
-        all_payloads_.back()->data_index(payload->data_index());
-        all_payloads_.pop_back();
-        delete payload;
+        PayloadNode* payload = pop_free_payload();
+        if (payload == nullptr)
+        {
+            break;
+        }
+
+        delete_payload(payload);
     }
 
     return true;
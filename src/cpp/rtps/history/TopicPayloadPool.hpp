@@ -124,7 +124,7 @@ public:
 
     size_t payload_pool_available_size() const override
     {
-        return free_payloads_.size();
+        return free_payloads_count_;
     }
 
     static std::unique_ptr<ITopicPayloadPool> get(
@@ -132,6 +132,46 @@ public:
 
 protected:
 
+    /**
+     * Contiguous block of memory holding the buffers of several payloads.
+     *
+     * Used when payloads are preallocated in bulk, so the buffers of a history are close to each other.
+     * On Linux, the block can be backed by huge pages (FASTDDS_PAYLOAD_POOL_HUGE_PAGES=1) and locked in
+     * physical memory (FASTDDS_PAYLOAD_POOL_LOCK_MEMORY=1).
+     * The block is freed when the last payload living on it is destroyed or reallocated.
+     */
+    class PayloadSlab
+    {
+    public:
+
+        /**
+         * @param [IN] size  Number of bytes of the block. The block is zero-initialized.
+         * @throw std::bad_alloc if the memory could not be allocated.
+         */
+        explicit PayloadSlab(
+                size_t size);
+
+        ~PayloadSlab();
+
+        octet* memory() const
+        {
+            return memory_;
+        }
+
+    private:
+
+        PayloadSlab(
+                const PayloadSlab&) = delete;
+
+        PayloadSlab& operator =(
+                const PayloadSlab&) = delete;
+
+        octet* memory_ = nullptr;
+        size_t size_ = 0;
+        bool mapped_ = false;
+        bool locked_ = false;
+    };
+
     class PayloadNode
     {
     public:
@@ -152,10 +192,41 @@ protected:
             data_size(size);
         }
 
+        /**
+         * Creates a node whose buffer lives on a slab.
+         *
+         * @param [IN] slab    Slab holding the buffer. It will be kept alive while the node uses it.
+         * @param [IN] memory  Address inside the slab with room for at least @c buffer_size(size) bytes.
+         * @param [IN] size    Size of the payload data.
+         */
+        PayloadNode(
+                const std::shared_ptr<PayloadSlab>& slab,
+                octet* memory,
+                uint32_t size)
+            : buffer(memory)
+            , slab_(slab)
+        {
+            assert(size > 0);
+
+            new (buffer) NodeInfo();
+            data_size(size);
+        }
+
         ~PayloadNode()
         {
             info().~NodeInfo();
-            free(buffer);
+            if (!slab_)
+            {
+                free(buffer);
+            }
+        }
+
+        //! Number of bytes required to hold a payload of @c size bytes, including the metadata.
+        static size_t buffer_size(
+                uint32_t size)
+        {
+            // Round up to a cache line, so reference counters of neighbour nodes do not share it
+            return (data_offset + size + 63u) & ~static_cast<size_t>(63u);
         }
 
         bool resize (
@@ -163,6 +234,26 @@ protected:
         {
             assert(size > data_size());
 
+            if (slab_)
+            {
+                // Buffers on a slab cannot be reallocated. Move to a buffer of its own.
+                octet* new_buffer = (octet*)calloc(size + data_offset, sizeof(octet));
+                if (!new_buffer)
+                {
+                    return false;
+                }
+                new (new_buffer) NodeInfo();
+                reinterpret_cast<NodeInfo*>(new_buffer)->ref_counter.store(
+                    info().ref_counter.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                reinterpret_cast<NodeInfo*>(new_buffer)->data_index = data_index();
+                memcpy(new_buffer + data_offset, data(), data_size());
+                info().~NodeInfo();
+                buffer = new_buffer;
+                slab_.reset();
+                data_size(size);
+                return true;
+            }
+
             octet* old_buffer = buffer;
             buffer = (octet*)realloc(buffer, size + data_offset);
             if (!buffer)
@@ -248,6 +339,9 @@ protected:
 
         octet* buffer = nullptr;
 
+        // Slab holding the buffer, if any
+        std::shared_ptr<PayloadSlab> slab_;
+
         // Payload data comes after the metadata
         static constexpr size_t data_offset = offsetof(NodeInfo, data);
 
@@ -262,6 +356,10 @@ protected:
             return *reinterpret_cast<NodeInfo*>(data - data_offset);
         }
 
+        // Intrusive link on the list of free payloads
+        PayloadNode* next_free_ = nullptr;
+
+        friend class TopicPayloadPool;
     };
 
     /**
@@ -280,6 +378,38 @@ protected:
     PayloadNode* do_allocate(
             uint32_t size);
 
+    //! Adds a payload to the list of free payloads. The mutex should be locked by the caller.
+    void push_free_payload(
+            PayloadNode* payload)
+    {
+        payload->next_free_ = free_payloads_;
+        free_payloads_ = payload;
+        ++free_payloads_count_;
+    }
+
+    //! Takes a payload from the list of free payloads. The mutex should be locked by the caller.
+    PayloadNode* pop_free_payload()
+    {
+        PayloadNode* payload = free_payloads_;
+        if (payload != nullptr)
+        {
+            free_payloads_ = payload->next_free_;
+            payload->next_free_ = nullptr;
+            --free_payloads_count_;
+        }
+        return payload;
+    }
+
+    //! Removes a payload that is not in use from the pool and deletes it. The mutex should be locked by the caller.
+    void delete_payload(
+            PayloadNode* payload)
+    {
+        all_payloads_.at(payload->data_index()) = all_payloads_.back();
+        all_payloads_.back()->data_index(payload->data_index());
+        all_payloads_.pop_back();
+        delete payload;
+    }
+
     virtual void update_maximum_size(
             const PoolConfig& config,
             bool is_reserve);
@@ -292,10 +422,12 @@ protected:
      *
      * @pre
      *   - @c min_num_payloads <= @c max_pool_size_
+     * @return true on success, false if the memory for some payloads could not be allocated.
+     *
      * @post
-     *   - @c payload_pool_allocated_size() >= @c min_num_payloads
+     *   - On success, @c payload_pool_allocated_size() >= @c min_num_payloads
      */
-    virtual void reserve (
+    virtual bool reserve (
             uint32_t min_num_payloads,
             uint32_t size);
 
@@ -307,7 +439,8 @@ protected:
      * @return @c true on success, @c false otherwise
      *
      * @post
-     *   - On success, payload_pool_allocated_size() <= max_num_payloads
+     *   - On success, payload_pool_allocated_size() <= max_num_payloads, except for the payloads still in use,
+     *     which are deleted when released
      *   - On failure, memory for some payloads may have been released, but payload_pool_allocated_size() > min_num_payloads
      */
     bool shrink (
@@ -347,7 +480,8 @@ protected:
     uint32_t infinite_histories_count_  = 0;  //< Number of infinite histories reserved
     uint32_t finite_max_pool_size_      = 0;  //< Maximum size of the pool if no infinite histories were reserved
 
-    std::vector<PayloadNode*> free_payloads_; //< Payloads that are free
+    PayloadNode* free_payloads_ = nullptr;    //< Payloads that are free (intrusive list)
+    size_t free_payloads_count_ = 0;          //< Number of payloads that are free
     std::vector<PayloadNode*> all_payloads_;  //< All payloads
 
     std::mutex mutex_;
@@ -53,9 +53,15 @@ public:
             return false;
         }
 
-        std::lock_guard<std::mutex> lock(mutex_);
+        std::unique_lock<std::mutex> lock(mutex_);
         minimum_pool_size_ += config.initial_size;
-        reserve(minimum_pool_size_, payload_size_);
+        if (!reserve(minimum_pool_size_, payload_size_))
+        {
+            // Undo the reservation, so the pool keeps the limits of the other histories
+            lock.unlock();
+            release_history(config, is_reader);
+            return false;
+        }
         return true;
     }
 
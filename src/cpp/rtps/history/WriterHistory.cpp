@@ -22,6 +22,7 @@
 #include <fastdds/rtps/writer/RTPSWriter.h>
 #include <fastdds/rtps/common/WriteParams.h>
 
+#include <algorithm>
 #include <mutex>
 
 namespace eprosima {
@@ -138,6 +139,24 @@ bool WriterHistory::matches_change(
     return inner_change->sequenceNumber == outer_change->sequenceNumber;
 }
 
+History::const_iterator WriterHistory::find_change_nts(
+        const SequenceNumber_t& sequence_number)
+{
+    const_iterator it = std::lower_bound(m_changes.cbegin(), m_changes.cend(), sequence_number,
+                    [](
+                        const CacheChange_t* change,
+                        const SequenceNumber_t& seq)
+                    {
+                        return change->sequenceNumber < seq;
+                    });
+    if (it != m_changes.cend() && (*it)->sequenceNumber == sequence_number)
+    {
+        return it;
+    }
+
+    return m_changes.cend();
+}
+
 History::iterator WriterHistory::remove_change_nts(
         const_iterator removal,
         bool release)
@@ -174,7 +193,27 @@ History::iterator WriterHistory::remove_change_nts(
 bool WriterHistory::remove_change_g(
         CacheChange_t* a_change)
 {
-    return remove_change(a_change);
+    if (mp_writer == nullptr || mp_mutex == nullptr)
+    {
+        logError(RTPS_WRITER_HISTORY, "You need to create a Writer with this History before removing any changes");
+        return false;
+    }
+
+    std::lock_guard<RecursiveTimedMutex> guard(*mp_mutex);
+    const_iterator it = changesEnd();
+    if (nullptr != a_change && a_change->writerGUID == mp_writer->getGuid())
+    {
+        it = find_change_nts(a_change->sequenceNumber);
+    }
+
+    if (it == changesEnd())
+    {
+        logInfo(RTPS_WRITER_HISTORY, "Trying to remove a change not in history");
+        return false;
+    }
+
+    remove_change_nts(it);
+    return true;
 }
 
 bool WriterHistory::remove_change(
@@ -200,12 +239,8 @@ CacheChange_t* WriterHistory::remove_change_and_reuse(
         return nullptr;
     }
 
-    // Create a temporary reference change associated to the sequence number
-    CacheChange_t ch;
-    ch.sequenceNumber = sequence_number;
-    ch.writerGUID = mp_writer->getGuid();
-
-    auto it = find_change(&ch);
+    std::lock_guard<RecursiveTimedMutex> guard(*mp_mutex);
+    auto it = find_change_nts(sequence_number);
 
     if ( it == changesEnd())
     {
@@ -214,7 +249,7 @@ CacheChange_t* WriterHistory::remove_change_and_reuse(
     }
 
     CacheChange_t* removal = *it;
-    remove_change(it, false);
+    remove_change_nts(it, false);
 
     return removal;
 }
@@ -0,0 +1,131 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DataBatchReader.cpp
+ *
+ */
+
+#include <rtps/messages/DataBatchReader.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/messages/CDRMessage.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+DataBatchReader::DataBatchReader(
+        CDRMessage_t* msg,
+        const SubmessageHeader_t& smh)
+    : msg_(msg)
+    , submessage_end_(msg->pos + smh.submessageLength)
+    , with_key_((smh.flags & BIT(1)) != 0)
+{
+    msg_->msg_endian = (smh.flags & BIT(0)) != 0 ? LITTLEEND : BIGEND;
+}
+
+bool DataBatchReader::read_header()
+{
+    if (submessage_end_ > msg_->length || submessage_end_ - msg_->pos < RTPSMESSAGE_DATA_BATCH_MIN_LENGTH)
+    {
+        logInfo(RTPS_MSG_IN, "Too short DataBatch submessage received, ignoring");
+        return false;
+    }
+
+    bool valid = true;
+    uint16_t extra_flags = 0;
+    int16_t octets_to_inline_qos = 0;
+    valid &= CDRMessage::readUInt16(msg_, &extra_flags);
+    valid &= CDRMessage::readInt16(msg_, &octets_to_inline_qos);
+
+    // The samples should start after the fields this version knows, and before the end of the submessage
+    uint32_t first_sample_pos = msg_->pos + static_cast<uint16_t>(octets_to_inline_qos);
+    if (!valid || octets_to_inline_qos < RTPSMESSAGE_OCTETSTOINLINEQOS_DATABATCHSUBMSG ||
+            first_sample_pos > submessage_end_)
+    {
+        logWarning(RTPS_MSG_IN, "Invalid DataBatch submessage, bad octetsToInlineQos " << octets_to_inline_qos);
+        return false;
+    }
+
+    valid &= CDRMessage::readEntityId(msg_, &reader_id_);
+    valid &= CDRMessage::readEntityId(msg_, &writer_id_);
+    valid &= CDRMessage::readSequenceNumber(msg_, &first_sn_);
+    valid &= CDRMessage::readUInt32(msg_, &sample_count_);
+    if (!valid)
+    {
+        return false;
+    }
+
+    if (first_sn_ <= SequenceNumber_t())
+    {
+        logWarning(RTPS_MSG_IN, "Invalid DataBatch submessage, bad sequence Number");
+        return false;
+    }
+
+    msg_->pos = first_sample_pos;
+
+    uint32_t sample_header_size = RTPSMESSAGE_DATA_BATCH_SAMPLE_HEADER_SIZE + (with_key_ ? 16u : 0u);
+    if (sample_count_ == 0 || sample_count_ > (submessage_end_ - msg_->pos) / sample_header_size)
+    {
+        logWarning(RTPS_MSG_IN, "Invalid DataBatch submessage, bad sample count " << sample_count_);
+        return false;
+    }
+
+    return true;
+}
+
+bool DataBatchReader::read_sample(
+        CacheChange_t& change)
+{
+    uint32_t sample_header_size = RTPSMESSAGE_DATA_BATCH_SAMPLE_HEADER_SIZE + (with_key_ ? 16u : 0u);
+    if (msg_->pos > submessage_end_ || submessage_end_ - msg_->pos < sample_header_size)
+    {
+        logWarning(RTPS_MSG_IN, "Invalid DataBatch submessage, truncated sample info");
+        return false;
+    }
+
+    change.kind = ALIVE;
+    change.instanceHandle = c_InstanceHandle_Unknown;
+
+    bool valid = true;
+    uint32_t sn_offset = 0;
+    valid &= CDRMessage::readUInt32(msg_, &sn_offset);
+    change.sequenceNumber = first_sn_ + sn_offset;
+    valid &= CDRMessage::readTimestamp(msg_, &change.sourceTimestamp);
+    if (with_key_)
+    {
+        valid &= CDRMessage::readData(msg_, change.instanceHandle.value, 16);
+    }
+
+    uint32_t payload_size = 0;
+    valid &= CDRMessage::readUInt32(msg_, &payload_size);
+    uint64_t next_pos = static_cast<uint64_t>(msg_->pos) + ((static_cast<uint64_t>(payload_size) + 3u) & ~3ull);
+    if (!valid || payload_size == 0 || next_pos > submessage_end_)
+    {
+        logWarning(RTPS_MSG_IN, "Serialized Payload value invalid or larger than maximum allowed size"
+                "(" << payload_size << "/" << (submessage_end_ - msg_->pos) << ")");
+        return false;
+    }
+
+    change.serializedPayload.data = &msg_->buffer[msg_->pos];
+    change.serializedPayload.length = payload_size;
+    change.serializedPayload.max_size = payload_size;
+    msg_->pos = static_cast<uint32_t>(next_pos);
+    return true;
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
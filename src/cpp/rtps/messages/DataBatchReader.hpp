@@ -0,0 +1,101 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DataBatchReader.hpp
+ *
+ */
+
+#ifndef DATABATCHREADER_HPP
+#define DATABATCHREADER_HPP
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/CDRMessage_t.h>
+#include <fastdds/rtps/common/EntityId_t.hpp>
+#include <fastdds/rtps/common/SequenceNumber.h>
+#include <fastdds/rtps/messages/RTPS_messages.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * A helper class to parse a DATA_BATCH submessage, checking every field against the submessage length.
+ * @ingroup READER_MODULE
+ */
+class DataBatchReader
+{
+public:
+
+    /**
+     * DataBatchReader constructor.
+     *
+     * @param msg Message positioned just after the submessage header.
+     * @param smh Header of the DATA_BATCH submessage.
+     */
+    DataBatchReader(
+            CDRMessage_t* msg,
+            const SubmessageHeader_t& smh);
+
+    /**
+     * Reads the fields of the submessage preceding the samples.
+     *
+     * @return false if the header is malformed.
+     */
+    bool read_header();
+
+    /**
+     * Reads the next sample of the batch. Should only be called, at most sample_count() times, after a successful
+     * read_header().
+     *
+     * @param change Change where the sample is read. Its payload points to the message buffer.
+     * @return false if the sample is malformed.
+     */
+    bool read_sample(
+            CacheChange_t& change);
+
+    const EntityId_t& reader_id() const
+    {
+        return reader_id_;
+    }
+
+    const EntityId_t& writer_id() const
+    {
+        return writer_id_;
+    }
+
+    uint32_t sample_count() const
+    {
+        return sample_count_;
+    }
+
+private:
+
+    CDRMessage_t* msg_;
+    uint32_t submessage_end_;
+    bool with_key_;
+
+    EntityId_t reader_id_;
+    EntityId_t writer_id_;
+    SequenceNumber_t first_sn_;
+    uint32_t sample_count_ = 0;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // DATABATCHREADER_HPP
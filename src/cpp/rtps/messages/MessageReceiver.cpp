@@ -25,8 +25,11 @@
 #include <fastdds/rtps/writer/RTPSWriter.h>
 
 #include <fastdds/core/policy/ParameterList.hpp>
+#include <rtps/history/ITopicPayloadPool.h>
+#include <rtps/messages/DataBatchReader.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
 
+#include <algorithm>
 #include <cassert>
 #include <limits>
 #include <mutex>
@@ -41,6 +44,11 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+//! Time without new fragments after which a sample is no longer reassembled on a shared buffer
+static const std::chrono::seconds fragment_assembly_timeout(10);
+//! Minimum time between checks of the samples being reassembled on shared buffers
+static const std::chrono::seconds fragment_assemblies_check_period(1);
+
 MessageReceiver::MessageReceiver(
         RTPSParticipantImpl* participant,
         uint32_t rec_buffer_size)
@@ -105,6 +113,13 @@ MessageReceiver::~MessageReceiver()
     logInfo(RTPS_MSG_IN, "");
     assert(associated_writers_.empty());
     assert(associated_readers_.empty());
+
+    for (CacheChange_t* change : batch_changes_)
+    {
+        // Payloads always point to the reception buffer
+        change->serializedPayload.data = nullptr;
+        delete change;
+    }
 }
 
  #if HAVE_SECURITY
@@ -208,12 +223,155 @@ void MessageReceiver::process_data_fragment_message_without_security(
         uint32_t fragment_starting_num,
         uint16_t fragments_in_submessage)
 {
-    auto process_message = [&change, sample_size, fragment_starting_num, fragments_in_submessage](RTPSReader* reader)
+    octet* fragment_data = change.serializedPayload.data;
+    auto process_message =
+            [this, &change, fragment_data, sample_size, fragment_starting_num, fragments_in_submessage](
+        RTPSReader* reader)
             {
+                // Readers using the same payload pool get the fragments on a reassembly buffer they can share
+                FragmentAssembly* assembly =
+                        assemble_fragments(reader, change, sample_size, fragment_starting_num, fragments_in_submessage);
+                if (assembly != nullptr)
+                {
+                    uint32_t offset = (fragment_starting_num - 1) * change.getFragmentSize();
+                    change.serializedPayload.data = &assembly->change.serializedPayload.data[offset];
+                    change.payload_owner(assembly->pool.get());
+                }
+
                 reader->processDataFragMsg(&change, sample_size, fragment_starting_num, fragments_in_submessage);
+
+                change.serializedPayload.data = fragment_data;
+                change.payload_owner(nullptr);
             };
 
     findAllReaders(reader_id, process_message);
+
+    // Readers keep their references to the buffers of completed samples
+    fragment_assemblies_.erase(
+        std::remove_if(fragment_assemblies_.begin(), fragment_assemblies_.end(),
+        [](const std::unique_ptr<FragmentAssembly>& assembly)
+        {
+            return assembly->change.is_fully_assembled();
+        }),
+        fragment_assemblies_.end());
+}
+
+MessageReceiver::FragmentAssembly* MessageReceiver::assemble_fragments(
+        RTPSReader* reader,
+        const CacheChange_t& change,
+        uint32_t sample_size,
+        uint32_t fragment_starting_num,
+        uint16_t fragments_in_submessage)
+{
+    // Only topic pools reference the same buffer from several changes
+    const std::shared_ptr<IPayloadPool>& pool = reader->payload_pool_;
+    if (dynamic_cast<ITopicPayloadPool*>(pool.get()) == nullptr ||
+            fragment_starting_num == 0 || change.getFragmentSize() == 0)
+    {
+        return nullptr;
+    }
+
+    auto it = std::find_if(fragment_assemblies_.begin(), fragment_assemblies_.end(),
+                    [&change, &pool](const std::unique_ptr<FragmentAssembly>& assembly)
+                    {
+                        return assembly->change.writerGUID == change.writerGUID && assembly->pool == pool;
+                    });
+
+    FragmentAssembly* assembly = nullptr;
+    if (it != fragment_assemblies_.end())
+    {
+        assembly = it->get();
+        if (change.sequenceNumber < assembly->change.sequenceNumber)
+        {
+            // Late fragments of an older sample are reassembled by the readers on their own
+            return nullptr;
+        }
+    }
+    else
+    {
+        fragment_assemblies_.emplace_back(new FragmentAssembly());
+        assembly = fragment_assemblies_.back().get();
+        assembly->pool = pool;
+    }
+
+    CacheChange_t& assembly_change = assembly->change;
+    if (assembly_change.payload_owner() == nullptr || change.sequenceNumber != assembly_change.sequenceNumber)
+    {
+        // A new sample of the writer supersedes the one being reassembled
+        if (assembly_change.payload_owner() != nullptr)
+        {
+            assembly_change.payload_owner()->release_payload(assembly_change);
+        }
+
+        if (!pool->get_payload(sample_size, assembly_change) ||
+                assembly_change.serializedPayload.max_size < sample_size)
+        {
+            fragment_assemblies_.erase(std::find_if(fragment_assemblies_.begin(), fragment_assemblies_.end(),
+                    [assembly](const std::unique_ptr<FragmentAssembly>& entry)
+                    {
+                        return entry.get() == assembly;
+                    }));
+            return nullptr;
+        }
+
+        assembly_change.writerGUID = change.writerGUID;
+        assembly_change.sequenceNumber = change.sequenceNumber;
+        assembly_change.serializedPayload.length = sample_size;
+        assembly_change.setFragmentSize(change.getFragmentSize(), true);
+    }
+
+    if (sample_size != assembly_change.serializedPayload.length ||
+            change.getFragmentSize() != assembly_change.getFragmentSize() ||
+            fragment_starting_num + fragments_in_submessage - 1 > assembly_change.getFragmentCount())
+    {
+        return nullptr;
+    }
+
+    // Each fragment is only copied the first time it is received
+    assembly_change.add_fragments(change.serializedPayload, fragment_starting_num, fragments_in_submessage);
+    assembly->last_fragment_time = std::chrono::steady_clock::now();
+    return assembly;
+}
+
+void MessageReceiver::check_fragment_assemblies_nts()
+{
+    if (fragment_assemblies_.empty())
+    {
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    if (now < next_fragment_assemblies_check_)
+    {
+        return;
+    }
+    next_fragment_assemblies_check_ = now + fragment_assemblies_check_period;
+
+    auto writer_is_matched = [this](const FragmentAssembly& assembly)
+            {
+                for (const auto& readers : associated_readers_)
+                {
+                    for (RTPSReader* reader : readers.second)
+                    {
+                        if (reader->payload_pool_ == assembly.pool &&
+                                reader->matched_writer_is_matched(assembly.change.writerGUID))
+                        {
+                            return true;
+                        }
+                    }
+                }
+                return false;
+            };
+
+    fragment_assemblies_.erase(
+        std::remove_if(fragment_assemblies_.begin(), fragment_assemblies_.end(),
+        [&now, &writer_is_matched](const std::unique_ptr<FragmentAssembly>& assembly)
+        {
+            return assembly->change.is_fully_assembled() ||
+            now - assembly->last_fragment_time > fragment_assembly_timeout ||
+            !writer_is_matched(*assembly);
+        }),
+        fragment_assemblies_.end());
 }
 
 void MessageReceiver::associateEndpoint(
@@ -295,6 +453,15 @@ void MessageReceiver::removeEndpoint(
                     break;
                 }
             }
+
+            // Release the reassembly buffers taken from its pool before the reader releases its history
+            fragment_assemblies_.erase(
+                std::remove_if(fragment_assemblies_.begin(), fragment_assemblies_.end(),
+                [var](const std::unique_ptr<FragmentAssembly>& assembly)
+                {
+                    return assembly->pool == var->payload_pool_;
+                }),
+                fragment_assemblies_.end());
         }
     }
 }
@@ -321,8 +488,20 @@ void MessageReceiver::processCDRMsg(
         return;
     }
 
+    fastdds::statistics::ParticipantStatistics* statistics = participant_->statistics().participant_statistics();
+    if (nullptr != statistics)
+    {
+        statistics->received_packets.add();
+        statistics->received_bytes.add(msg->length);
+    }
+
     reset();
 
+    {
+        std::lock_guard<std::mutex> guard(mtx_);
+        check_fragment_assemblies_nts();
+    }
+
     GuidPrefix_t participantGuidPrefix = participant_->getGuid().guidPrefix;
     dest_guid_prefix_ = participantGuidPrefix;
 
@@ -411,6 +590,19 @@ void MessageReceiver::processCDRMsg(
                     valid = proc_Submsg_DataFrag(submessage, &submsgh);
                 }
                 break;
+            case DATA_BATCH:
+            {
+                if (dest_guid_prefix_ != participantGuidPrefix)
+                {
+                    logInfo(RTPS_MSG_IN, IDSTRING "DataBatch Submsg ignored, DST is another RTPSParticipant");
+                }
+                else
+                {
+                    logInfo(RTPS_MSG_IN, IDSTRING "DataBatch Submsg received, processing.");
+                    valid = proc_Submsg_DataBatch(submessage, &submsgh);
+                }
+                break;
+            }
             case GAP:
             {
                 if (dest_guid_prefix_ != participantGuidPrefix)
@@ -825,6 +1017,89 @@ bool MessageReceiver::proc_Submsg_Data(
     return true;
 }
 
+bool MessageReceiver::proc_Submsg_DataBatch(
+        CDRMessage_t* msg,
+        SubmessageHeader_t* smh)
+{
+    std::lock_guard<std::mutex> guard(mtx_);
+
+    // DATA_BATCH is a vendor specific submessage. Its id could mean something else for other vendors.
+    if (source_vendor_id_ != c_VendorId_eProsima)
+    {
+        logInfo(RTPS_MSG_IN, IDSTRING "DataBatch Submsg from another vendor, ignoring");
+        return true;
+    }
+
+    //READ and PROCESS
+    DataBatchReader batch(msg, *smh);
+    if (!batch.read_header())
+    {
+        return false;
+    }
+
+    //WE KNOW THE READER THAT THE MESSAGE IS DIRECTED TO SO WE LOOK FOR IT:
+    RTPSReader* first_reader = nullptr;
+    EntityId_t readerID = batch.reader_id();
+    if (!willAReaderAcceptMsgDirectedTo(readerID, first_reader))
+    {
+        return false;
+    }
+
+    GUID_t writerGUID;
+    writerGUID.guidPrefix = source_guid_prefix_;
+    writerGUID.entityId = batch.writer_id();
+
+    // Changes are kept between messages, so their payloads only point to the reception buffer
+    uint32_t sample_count = batch.sample_count();
+    while (batch_changes_.size() < sample_count)
+    {
+        batch_changes_.push_back(new CacheChange_t());
+    }
+
+    for (uint32_t i = 0; i < sample_count; ++i)
+    {
+        CacheChange_t* ch = batch_changes_[i];
+        ch->writerGUID = writerGUID;
+        if (!batch.read_sample(*ch))
+        {
+            return false;
+        }
+    }
+
+    logInfo(RTPS_MSG_IN, IDSTRING "from Writer " << writerGUID << "; " << sample_count <<
+            " samples; possible RTPSReader entities: " << associated_readers_.size());
+
+    //Look for the correct readers to add the changes
+    auto process_batch = [this, sample_count](RTPSReader* reader)
+            {
+#if HAVE_SECURITY
+                // Writers never batch samples with protected payloads
+                if (reader->getAttributes().security_attributes().is_payload_protected)
+                {
+                    logWarning(RTPS_MSG_IN, IDSTRING "DataBatch Submsg ignored by payload protected reader "
+                            << reader->getGuid());
+                    return;
+                }
+#endif // if HAVE_SECURITY
+                reader->processDataBatchMsg(batch_changes_.data(), sample_count);
+            };
+    findAllReaders(readerID, process_batch);
+
+    for (uint32_t i = 0; i < sample_count; ++i)
+    {
+        CacheChange_t* ch = batch_changes_[i];
+        IPayloadPool* payload_pool = ch->payload_owner();
+        if (payload_pool)
+        {
+            payload_pool->release_payload(*ch);
+        }
+        ch->serializedPayload.data = nullptr;
+    }
+
+    logInfo(RTPS_MSG_IN, IDSTRING "Sub Message DATA_BATCH processed");
+    return true;
+}
+
 bool MessageReceiver::proc_Submsg_DataFrag(
         CDRMessage_t* msg,
         SubmessageHeader_t* smh)
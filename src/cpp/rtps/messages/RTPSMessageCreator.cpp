@@ -184,6 +184,7 @@ bool RTPSMessageCreator::addSubmessageInfoTS_Now(
 
 
 #include <rtps/messages/submessages/DataMsg.hpp>
+#include <rtps/messages/submessages/DataBatchMsg.hpp>
 #include <rtps/messages/submessages/HeartbeatMsg.hpp>
 #include <rtps/messages/submessages/AckNackMsg.hpp>
 #include <rtps/messages/submessages/GapMsg.hpp>
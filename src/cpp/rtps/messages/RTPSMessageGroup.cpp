@@ -24,6 +24,7 @@
 #include <rtps/flowcontrol/FlowController.h>
 #include "RTPSGapBuilder.hpp"
 #include "RTPSMessageGroup_t.hpp"
+#include <statistics/rtps/StatisticsCounters.hpp>
 
 #include <fastdds/dds/log/Log.hpp>
 
@@ -131,6 +132,12 @@ RTPSMessageGroup::RTPSMessageGroup(
     , encrypt_msg_(nullptr)
 #endif // if HAVE_SECURITY
     , max_blocking_time_point_(max_blocking_time_point)
+    , batch_max_samples_(0)
+    , batch_max_bytes_(0)
+    , batch_max_submessage_size_(0)
+    , batch_samples_(0)
+    , batch_bytes_(0)
+    , batch_header_pos_(0)
     , send_buffer_(participant->get_send_buffer())
 {
     // Avoid warning when neither SECURITY nor DEBUG is used
@@ -154,12 +161,36 @@ RTPSMessageGroup::RTPSMessageGroup(
         CDRMessage::initCDRMsg(encrypt_msg_);
     }
 #endif // if HAVE_SECURITY
+
+    if (endpoint->getAttributes().endpointKind == WRITER)
+    {
+        const WriterBatchAttributes& batch = static_cast<RTPSWriter*>(endpoint)->batch_;
+        if (batch.enabled)
+        {
+            batch_max_samples_ = batch.max_samples;
+            batch_max_bytes_ = batch.max_bytes;
+
+            // Leave room for the RTPS header and an INFO_SRC submessage (24 octets)
+            uint32_t max_size = full_msg_->max_size - RTPSMESSAGE_HEADER_SIZE - 24;
+            batch_max_submessage_size_ = (std::min)(max_size, submessage_msg_->max_size);
+        }
+
+#if HAVE_SECURITY
+        // Protected submessages and payloads are encoded one by one
+        const security::EndpointSecurityAttributes& sec_attr = endpoint->getAttributes().security_attributes();
+        if (sec_attr.is_submessage_protected || sec_attr.is_payload_protected)
+        {
+            batch_max_bytes_ = 0;
+        }
+#endif // if HAVE_SECURITY
+    }
 }
 
 RTPSMessageGroup::~RTPSMessageGroup() noexcept(false)
 {
     try
     {
+        close_batch();
         send();
     }
     catch (...)
@@ -180,6 +211,7 @@ void RTPSMessageGroup::reset_to_header()
 
 void RTPSMessageGroup::flush()
 {
+    close_batch();
     send();
 
     reset_to_header();
@@ -231,6 +263,9 @@ void RTPSMessageGroup::flush_and_reset()
 void RTPSMessageGroup::check_and_maybe_flush(
         const GuidPrefix_t& destination_guid_prefix)
 {
+    // Any other submessage ends the batch being built
+    close_batch();
+
     CDRMessage::initCDRMsg(submessage_msg_);
 
     if (sender_.destinations_have_changed())
@@ -347,6 +382,11 @@ bool RTPSMessageGroup::add_data(
 {
     logInfo(RTPS_WRITER, "Sending relevant changes as DATA/DATA_FRAG messages");
 
+    if (can_be_batched(change))
+    {
+        return add_data_to_batch(change);
+    }
+
     // Check preconditions. If fail flush and reset.
     check_and_maybe_flush();
     add_info_ts_in_buffer(change.sourceTimestamp);
@@ -428,6 +468,12 @@ bool RTPSMessageGroup::add_data(
     }
 #endif // if HAVE_SECURITY
 
+    fastdds::statistics::EndpointStatistics* statistics = endpoint_->statistics();
+    if (nullptr != statistics)
+    {
+        statistics->on_data_sent(change.serializedPayload.length);
+    }
+
     return insert_submessage(is_big_submessage);
 }
 
@@ -525,6 +571,12 @@ bool RTPSMessageGroup::add_data_frag(
     }
 #endif // if HAVE_SECURITY
 
+    fastdds::statistics::EndpointStatistics* statistics = endpoint_->statistics();
+    if (nullptr != statistics)
+    {
+        statistics->on_data_sent(fragment_size);
+    }
+
     return insert_submessage(false);
 }
 
@@ -576,6 +628,12 @@ bool RTPSMessageGroup::add_heartbeat(
     }
 #endif // if HAVE_SECURITY
 
+    fastdds::statistics::EndpointStatistics* statistics = endpoint_->statistics();
+    if (nullptr != statistics)
+    {
+        statistics->heartbeats.add();
+    }
+
     return insert_submessage(false);
 }
 
@@ -672,9 +730,139 @@ bool RTPSMessageGroup::create_gap_submessage(
     }
 #endif // if HAVE_SECURITY
 
+    fastdds::statistics::EndpointStatistics* statistics = endpoint_->statistics();
+    if (nullptr != statistics)
+    {
+        statistics->gaps.add();
+    }
+
+    return true;
+}
+
+bool RTPSMessageGroup::can_be_batched(
+        const CacheChange_t& change) const
+{
+    if (0 == batch_max_bytes_ ||
+            ALIVE != change.kind ||
+            0 == change.serializedPayload.length ||
+            nullptr == change.serializedPayload.data ||
+            0 < change.getFragmentCount() ||
+            change.serializedPayload.length > batch_max_bytes_ ||
+            change.write_params.related_sample_identity() != SampleIdentity::unknown())
+    {
+        return false;
+    }
+
+    // The sample should fit on an empty batch preceded by an INFO_DST
+    uint32_t sample_size = RTPSMESSAGE_DATA_BATCH_SAMPLE_HEADER_SIZE +
+            (WITH_KEY == endpoint_->getAttributes().topicKind ? 16u : 0u) +
+            ((change.serializedPayload.length + 3u) & ~3u);
+    uint32_t batch_size = RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + RTPSMESSAGE_DATA_BATCH_MIN_LENGTH + sample_size;
+    if (batch_size > std::numeric_limits<uint16_t>::max() ||
+            RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + 12u + batch_size > batch_max_submessage_size_)
+    {
+        return false;
+    }
+
+    return destinations_support_batches();
+}
+
+bool RTPSMessageGroup::destinations_support_batches() const
+{
+    // Only Fast DDS participants understand DATA_BATCH. Their GUID prefix starts with the vendor id.
+    const std::vector<GuidPrefix_t>& participants = sender_.remote_participants();
+    if (participants.empty())
+    {
+        return false;
+    }
+
+    for (const GuidPrefix_t& prefix : participants)
+    {
+        if (prefix.value[0] != c_VendorId_eProsima[0] || prefix.value[1] != c_VendorId_eProsima[1])
+        {
+            return false;
+        }
+    }
+
     return true;
 }
 
+bool RTPSMessageGroup::add_data_to_batch(
+        const CacheChange_t& change)
+{
+    bool with_key = WITH_KEY == endpoint_->getAttributes().topicKind;
+    uint32_t sample_size = RTPSMESSAGE_DATA_BATCH_SAMPLE_HEADER_SIZE + (with_key ? 16u : 0u) +
+            ((change.serializedPayload.length + 3u) & ~3u);
+
+    if (batch_samples_ > 0)
+    {
+        uint32_t batch_size = submessage_msg_->pos + sample_size - batch_header_pos_;
+        bool fits = !sender_.destinations_have_changed() &&
+                (0 == batch_max_samples_ || batch_samples_ < batch_max_samples_) &&
+                batch_bytes_ + change.serializedPayload.length <= batch_max_bytes_ &&
+                change.sequenceNumber > batch_first_sn_ &&
+                (change.sequenceNumber.to64long() - batch_first_sn_.to64long()) <=
+                std::numeric_limits<uint32_t>::max() &&
+                batch_size <= std::numeric_limits<uint16_t>::max() &&
+                submessage_msg_->pos + sample_size <= batch_max_submessage_size_;
+        if (!fits)
+        {
+            close_batch();
+        }
+    }
+
+    if (0 == batch_samples_)
+    {
+        // Check preconditions. If fail flush and reset.
+        check_and_maybe_flush();
+
+        batch_dst_ = sender_.destination_guid_prefix();
+        batch_header_pos_ = submessage_msg_->pos;
+        batch_first_sn_ = change.sequenceNumber;
+        batch_bytes_ = 0;
+        const EntityId_t& readerId = get_entity_id(sender_.remote_guids());
+        if (!RTPSMessageCreator::addSubmessageDataBatchHeader(submessage_msg_, readerId,
+                endpoint_->getGuid().entityId, batch_first_sn_, with_key))
+        {
+            logError(RTPS_WRITER, "Cannot add DATA_BATCH submsg to the CDRMessage. Buffer too small");
+            return false;
+        }
+    }
+
+    uint32_t sample_pos = submessage_msg_->pos;
+    if (!RTPSMessageCreator::addDataBatchSample(submessage_msg_, &change, batch_first_sn_, with_key))
+    {
+        logError(RTPS_WRITER, "Cannot add sample to DATA_BATCH submsg. Buffer too small");
+        // Discard the partially added sample
+        submessage_msg_->pos = sample_pos;
+        submessage_msg_->length = sample_pos;
+        return false;
+    }
+
+    ++batch_samples_;
+    batch_bytes_ += change.serializedPayload.length;
+    fastdds::statistics::EndpointStatistics* statistics = endpoint_->statistics();
+    if (nullptr != statistics)
+    {
+        statistics->on_data_sent(change.serializedPayload.length);
+    }
+
+    return true;
+}
+
+void RTPSMessageGroup::close_batch()
+{
+    if (0 == batch_samples_)
+    {
+        return;
+    }
+
+    RTPSMessageCreator::finishSubmessageDataBatch(submessage_msg_, batch_header_pos_, batch_samples_);
+    batch_samples_ = 0;
+    batch_bytes_ = 0;
+    insert_submessage(batch_dst_, false);
+}
+
 bool RTPSMessageGroup::add_acknack(
         const SequenceNumberSet_t& SNSet,
         int32_t count,
@@ -727,6 +915,12 @@ bool RTPSMessageGroup::add_acknack(
     }
 #endif // if HAVE_SECURITY
 
+    fastdds::statistics::EndpointStatistics* statistics = endpoint_->statistics();
+    if (nullptr != statistics)
+    {
+        statistics->acknacks.add();
+    }
+
     return insert_submessage(false);
 }
 
@@ -777,6 +971,12 @@ bool RTPSMessageGroup::add_nackfrag(
     }
 #endif // if HAVE_SECURITY
 
+    fastdds::statistics::EndpointStatistics* statistics = endpoint_->statistics();
+    if (nullptr != statistics)
+    {
+        statistics->nackfrags.add();
+    }
+
     return insert_submessage(false);
 }
 
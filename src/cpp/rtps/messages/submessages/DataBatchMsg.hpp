@@ -0,0 +1,132 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * DataBatchMsg.hpp
+ *
+ * DATA_BATCH is a vendor specific submessage carrying several consecutive samples of the same writer:
+ *
+ *   0...2...........8...............16..............24..............32
+ *   |  DATA_BATCH   |X|X|X|X|X|X|K|E|      octetsToNextHeader       |
+ *   |          extraFlags           |      octetsToInlineQos        |
+ *   |                       readerId                                |
+ *   |                       writerId                                |
+ *   |                  firstSN (SequenceNumber_t)                   |
+ *   |                       sampleCount                             |
+ *   |  sampleCount times:                                           |
+ *   |      offset from firstSN (uint32)                             |
+ *   |      source timestamp (Time_t)                                |
+ *   |      instance handle (16 octets, only when K is set)          |
+ *   |      payload length (uint32)                                  |
+ *   |      serialized payload, padded to 4 octets                   |
+ *
+ * As on DATA, octetsToInlineQos counts the octets from the end of that field to the first sample, so the header
+ * can be extended. The samples are read by DataBatchReader.
+ */
+
+#include <cstring>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+bool RTPSMessageCreator::addSubmessageDataBatchHeader(
+        CDRMessage_t* msg,
+        const EntityId_t& readerId,
+        const EntityId_t& writerId,
+        const SequenceNumber_t& first_sn,
+        bool with_key)
+{
+    octet flags = 0x0;
+    Endianness_t old_endianess = msg->msg_endian;
+#if FASTDDS_IS_BIG_ENDIAN_TARGET
+    msg->msg_endian = BIGEND;
+#else
+    flags = flags | BIT(0);
+    msg->msg_endian = LITTLEEND;
+#endif // if FASTDDS_IS_BIG_ENDIAN_TARGET
+
+    if (with_key)
+    {
+        flags = flags | BIT(1);
+    }
+
+    bool added_no_error = true;
+    added_no_error &= CDRMessage::addOctet(msg, DATA_BATCH);
+    added_no_error &= CDRMessage::addOctet(msg, flags);
+    // Length and sample count are written by finishSubmessageDataBatch
+    added_no_error &= CDRMessage::addUInt16(msg, 0);
+    // extraFlags and octetsToInlineQos
+    added_no_error &= CDRMessage::addUInt16(msg, 0);
+    added_no_error &= CDRMessage::addUInt16(msg, RTPSMESSAGE_OCTETSTOINLINEQOS_DATABATCHSUBMSG);
+    added_no_error &= CDRMessage::addEntityId(msg, &readerId);
+    added_no_error &= CDRMessage::addEntityId(msg, &writerId);
+    added_no_error &= CDRMessage::addSequenceNumber(msg, &first_sn);
+    added_no_error &= CDRMessage::addUInt32(msg, 0);
+
+    msg->msg_endian = old_endianess;
+    return added_no_error;
+}
+
+bool RTPSMessageCreator::addDataBatchSample(
+        CDRMessage_t* msg,
+        const CacheChange_t* change,
+        const SequenceNumber_t& first_sn,
+        bool with_key)
+{
+    Endianness_t old_endianess = msg->msg_endian;
+#if FASTDDS_IS_BIG_ENDIAN_TARGET
+    msg->msg_endian = BIGEND;
+#else
+    msg->msg_endian = LITTLEEND;
+#endif // if FASTDDS_IS_BIG_ENDIAN_TARGET
+
+    bool added_no_error = true;
+    uint32_t offset = static_cast<uint32_t>(change->sequenceNumber.to64long() - first_sn.to64long());
+    added_no_error &= CDRMessage::addUInt32(msg, offset);
+    added_no_error &= CDRMessage::addInt32(msg, change->sourceTimestamp.seconds());
+    added_no_error &= CDRMessage::addUInt32(msg, change->sourceTimestamp.fraction());
+    if (with_key)
+    {
+        added_no_error &= CDRMessage::addData(msg, change->instanceHandle.value, 16);
+    }
+    added_no_error &= CDRMessage::addUInt32(msg, change->serializedPayload.length);
+    added_no_error &= CDRMessage::addData(msg, change->serializedPayload.data, change->serializedPayload.length);
+
+    // Keep every sample aligned to 4
+    uint32_t align = (4 - msg->pos % 4) & 3;
+    for (uint32_t count = 0; count < align; ++count)
+    {
+        added_no_error &= CDRMessage::addOctet(msg, 0);
+    }
+
+    msg->msg_endian = old_endianess;
+    return added_no_error;
+}
+
+void RTPSMessageCreator::finishSubmessageDataBatch(
+        CDRMessage_t* msg,
+        uint32_t header_pos,
+        uint32_t sample_count)
+{
+    // Both fields are serialized with the native endianness, as signaled by the E flag
+    uint16_t submessage_size = static_cast<uint16_t>(msg->pos - header_pos - RTPSMESSAGE_SUBMESSAGEHEADER_SIZE);
+    memcpy(&msg->buffer[header_pos + 2], &submessage_size, sizeof(submessage_size));
+    memcpy(&msg->buffer[header_pos + RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + RTPSMESSAGE_DATA_BATCH_MIN_LENGTH - 4],
+            &sample_count, sizeof(sample_count));
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
@@ -114,6 +114,7 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     , mp_ResourceSemaphore(new Semaphore(0))
     , IdCounter(0)
     , type_check_fn_(nullptr)
+    , statistics_(this, PParam.properties)
 #if HAVE_SECURITY
     , m_security_manager(this)
 #endif // if HAVE_SECURITY
@@ -377,6 +378,8 @@ void RTPSParticipantImpl::enable()
         logError(RTPS_PARTICIPANT, "The builtin protocols were not correctly initialized");
     }
 
+    statistics_.enable();
+
     //Start reception
     for (auto& receiver : m_receiverResourcelist)
     {
@@ -386,6 +389,8 @@ void RTPSParticipantImpl::enable()
 
 void RTPSParticipantImpl::disable()
 {
+    statistics_.disable();
+
     // Ensure that other participants will not accidentally discover this one
     if (mp_builtinProtocols && mp_builtinProtocols->mp_PDP)
     {
@@ -610,11 +615,17 @@ bool RTPSParticipantImpl::create_writer(
     }
 #endif // if HAVE_SECURITY
 
+    if (!is_builtin)
+    {
+        SWriter->statistics_ = statistics_.register_endpoint(SWriter->getGuid(), false);
+    }
+
     createSendResources(SWriter);
     if (param.endpoint.reliabilityKind == RELIABLE)
     {
         if (!createAndAssociateReceiverswithEndpoint(SWriter))
         {
+            statistics_.unregister_endpoint(SWriter->getGuid());
             delete(SWriter);
             return false;
         }
@@ -715,6 +726,11 @@ bool RTPSParticipantImpl::create_reader(
     }
 #endif // if HAVE_SECURITY
 
+    if (!is_builtin)
+    {
+        SReader->statistics_ = statistics_.register_endpoint(SReader->getGuid(), true);
+    }
+
     if (param.endpoint.reliabilityKind == RELIABLE)
     {
         createSendResources(SReader);
@@ -729,6 +745,7 @@ bool RTPSParticipantImpl::create_reader(
     {
         if (!createAndAssociateReceiverswithEndpoint(SReader))
         {
+            statistics_.unregister_endpoint(SReader->getGuid());
             delete(SReader);
             return false;
         }
@@ -989,9 +1006,10 @@ bool RTPSParticipantImpl::registerWriter(
 bool RTPSParticipantImpl::registerReader(
         RTPSReader* reader,
         const TopicAttributes& topicAtt,
-        const ReaderQos& rqos)
+        const ReaderQos& rqos,
+        const fastdds::rtps::ContentFilterProperty* content_filter)
 {
-    return this->mp_builtinProtocols->addLocalReader(reader, topicAtt, rqos);
+    return this->mp_builtinProtocols->addLocalReader(reader, topicAtt, rqos, content_filter);
 }
 
 bool RTPSParticipantImpl::updateLocalWriter(
@@ -1005,9 +1023,10 @@ bool RTPSParticipantImpl::updateLocalWriter(
 bool RTPSParticipantImpl::updateLocalReader(
         RTPSReader* reader,
         const TopicAttributes& topicAtt,
-        const ReaderQos& rqos)
+        const ReaderQos& rqos,
+        const fastdds::rtps::ContentFilterProperty* content_filter)
 {
-    return this->mp_builtinProtocols->updateLocalReader(reader, topicAtt, rqos);
+    return this->mp_builtinProtocols->updateLocalReader(reader, topicAtt, rqos, content_filter);
 }
 
 /*
@@ -1314,6 +1333,8 @@ bool RTPSParticipantImpl::deleteUserEndpoint(
 #endif // if HAVE_SECURITY
         }
     }
+    statistics_.unregister_endpoint(p_endpoint->getGuid());
+
     //	std::lock_guard<std::recursive_mutex> guardEndpoint(*p_endpoint->getMutex());
     delete(p_endpoint);
     return true;
@@ -53,6 +53,7 @@
 #if HAVE_SECURITY
 #include <fastdds/rtps/Endpoint.h>
 #include <fastdds/rtps/security/accesscontrol/ParticipantSecurityAttributes.h>
+#include <statistics/rtps/StatisticsParticipant.hpp>
 #include <rtps/security/SecurityManager.h>
 #endif // if HAVE_SECURITY
 
@@ -275,6 +276,13 @@ public:
                 send_resource->send(msg->buffer, msg->length, &locators_begin, &locators_end,
                         max_blocking_time_point);
             }
+
+            fastdds::statistics::ParticipantStatistics* statistics = statistics_.participant_statistics();
+            if (nullptr != statistics)
+            {
+                statistics->sent_packets.add();
+                statistics->sent_bytes.add(msg->length);
+            }
         }
 
         return ret_code;
@@ -400,6 +408,12 @@ public:
         return async_thread_;
     }
 
+    //!Get the statistics module of this participant
+    fastdds::statistics::StatisticsParticipant& statistics()
+    {
+        return statistics_;
+    }
+
     /***
      * @returns A pointer to a local reader given its endpoint guid, or nullptr if not found.
      */
@@ -483,6 +497,9 @@ private:
     //!Pool of send buffers
     std::unique_ptr<SendBuffersManager> send_buffers_;
 
+    //!Statistics module
+    fastdds::statistics::StatisticsParticipant statistics_;
+
 #if HAVE_SECURITY
     // Security manager
     security::SecurityManager m_security_manager;
@@ -752,12 +769,14 @@ public:
      * @param Reader Pointer to the RTPSReader.
      * @param topicAtt TopicAttributes of the Reader.
      * @param rqos ReaderQos.
+     * @param content_filter Optional content filter announced for the reader.
      * @return  True if correctly registered.
      */
     bool registerReader(
             RTPSReader* Reader,
             const TopicAttributes& topicAtt,
-            const ReaderQos& rqos);
+            const ReaderQos& rqos,
+            const fastdds::rtps::ContentFilterProperty* content_filter = nullptr);
 
     /**
      * Update local writer QoS
@@ -774,12 +793,14 @@ public:
      * Update local reader QoS
      * @param Reader Reader to update
      * @param rqos New QoS for the reader
+     * @param content_filter Optional new content filter for the reader. When nullptr the filter is not modified.
      * @return True on success
      */
     bool updateLocalReader(
             RTPSReader* Reader,
             const TopicAttributes& topicAtt,
-            const ReaderQos& rqos);
+            const ReaderQos& rqos,
+            const fastdds::rtps::ContentFilterProperty* content_filter = nullptr);
 
     /**
      * Get the participant attributes
@@ -171,6 +171,18 @@ void RTPSReader::releaseCache(
     change_pool_->release_cache(change);
 }
 
+bool RTPSReader::processDataBatchMsg(
+        CacheChange_t* const* changes,
+        uint32_t count)
+{
+    bool ret_val = false;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        ret_val |= processDataMsg(changes[i]);
+    }
+    return ret_val;
+}
+
 ReaderListener* RTPSReader::getListener() const
 {
     return mp_listener;
@@ -199,6 +211,106 @@ History::const_iterator RTPSReader::findCacheInFragmentedProcess(
     return ret_val;
 }
 
+bool RTPSReader::reserve_fragmented_change(
+        const CacheChange_t* incoming_change,
+        uint32_t sample_size,
+        uint32_t fragment_starting_num,
+        CacheChange_t** change)
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+
+    *change = nullptr;
+
+    uint32_t offset = (fragment_starting_num - 1) * incoming_change->getFragmentSize();
+    bool shareable = incoming_change->payload_owner() == payload_pool_.get() &&
+            fragment_starting_num > 0 && offset < sample_size;
+
+    CacheChange_t* reserved_change = nullptr;
+    if (shareable)
+    {
+        if (!change_pool_->reserve_cache(reserved_change))
+        {
+            logWarning(RTPS_READER, "Problem reserving cache from pool");
+            return false;
+        }
+
+        // The fragments are on a reassembly buffer taken from our payload pool, so it is referenced
+        reserved_change->copy_not_memcpy(incoming_change);
+        SerializedPayload_t shared_payload;
+        shared_payload.data = incoming_change->serializedPayload.data - offset;
+        shared_payload.length = sample_size;
+        IPayloadPool* payload_owner = payload_pool_.get();
+        bool got_payload = payload_pool_->get_payload(shared_payload, payload_owner, *reserved_change);
+        reserved_change->payload_is_shared(got_payload &&
+                reserved_change->serializedPayload.data == shared_payload.data);
+        shared_payload.data = nullptr;
+
+        if (!got_payload)
+        {
+            change_pool_->release_cache(reserved_change);
+            logWarning(RTPS_READER, "Problem reserving payload from pool");
+            return false;
+        }
+    }
+    else
+    {
+        if (!reserveCache(&reserved_change, sample_size))
+        {
+            return false;
+        }
+        reserved_change->copy_not_memcpy(incoming_change);
+    }
+
+    if (reserved_change->serializedPayload.max_size < sample_size)
+    {
+        releaseCache(reserved_change);
+        return false;
+    }
+
+    reserved_change->serializedPayload.length = sample_size;
+    reserved_change->setFragmentSize(incoming_change->getFragmentSize(), true);
+    *change = reserved_change;
+    return true;
+}
+
+bool RTPSReader::add_fragments(
+        CacheChange_t* change,
+        const CacheChange_t* incoming_change,
+        uint32_t fragment_starting_num,
+        uint16_t fragments_in_submessage)
+{
+    uint32_t sample_size = change->serializedPayload.length;
+    uint32_t offset = (fragment_starting_num - 1) * change->getFragmentSize();
+    bool in_place = offset < sample_size &&
+            incoming_change->serializedPayload.data == &change->serializedPayload.data[offset];
+
+    if (change->payload_is_shared() && !in_place)
+    {
+        // Copy on write, as other readers may be using the shared buffer
+        CacheChange_t copy;
+        uint32_t payload_size = fixed_payload_size_ ? fixed_payload_size_ : sample_size;
+        if (!payload_pool_->get_payload(payload_size, copy) || copy.serializedPayload.max_size < sample_size)
+        {
+            logWarning(RTPS_READER, "Problem reserving payload from pool");
+            return false;
+        }
+
+        change->copy_received_fragments(copy.serializedPayload.data);
+        change->payload_owner()->release_payload(*change);
+        change->serializedPayload.data = copy.serializedPayload.data;
+        change->serializedPayload.max_size = copy.serializedPayload.max_size;
+        change->serializedPayload.length = sample_size;
+        change->payload_owner(copy.payload_owner());
+        change->payload_is_shared(false);
+
+        copy.serializedPayload.data = nullptr;
+        copy.payload_owner(nullptr);
+    }
+
+    return change->add_fragments(incoming_change->serializedPayload, fragment_starting_num,
+                   fragments_in_submessage);
+}
+
 void RTPSReader::add_persistence_guid(
         const GUID_t& guid,
         const GUID_t& persistence_guid)
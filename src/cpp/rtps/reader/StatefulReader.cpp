@@ -33,6 +33,7 @@
 
 #include "rtps/RTPSDomainImpl.hpp"
 
+#include <algorithm>
 #include <mutex>
 #include <thread>
 
@@ -79,6 +80,8 @@ StatefulReader::StatefulReader(
     , proxy_changes_config_(resource_limits_from_history(hist->m_att, 0))
     , disable_positive_acks_(att.disable_positive_acks)
     , is_alive_(true)
+    , max_incomplete_samples_memory_(att.max_incomplete_samples_memory)
+    , incomplete_samples_memory_(0)
 {
     init(pimpl, att);
 }
@@ -99,6 +102,8 @@ StatefulReader::StatefulReader(
     , proxy_changes_config_(resource_limits_from_history(hist->m_att, 0))
     , disable_positive_acks_(att.disable_positive_acks)
     , is_alive_(true)
+    , max_incomplete_samples_memory_(att.max_incomplete_samples_memory)
+    , incomplete_samples_memory_(0)
 {
     init(pimpl, att);
 }
@@ -120,6 +125,8 @@ StatefulReader::StatefulReader(
     , proxy_changes_config_(resource_limits_from_history(hist->m_att, 0))
     , disable_positive_acks_(att.disable_positive_acks)
     , is_alive_(true)
+    , max_incomplete_samples_memory_(att.max_incomplete_samples_memory)
+    , incomplete_samples_memory_(0)
 {
     init(pimpl, att);
 }
@@ -357,67 +364,117 @@ bool StatefulReader::processDataMsg(
 
     if (acceptMsgFrom(change->writerGUID, &pWP))
     {
-        if (liveliness_lease_duration_ < c_TimeInfinite)
+        assert_writer_liveliness(change->writerGUID);
+        return add_received_change(change, pWP);
+    }
+
+    return false;
+}
+
+bool StatefulReader::processDataBatchMsg(
+        CacheChange_t* const* changes,
+        uint32_t count)
+{
+    WriterProxy* pWP = nullptr;
+
+    assert(changes && count > 0);
+
+    std::lock_guard<RecursiveTimedMutex> lock(mp_mutex);
+    if (!is_alive_)
+    {
+        return false;
+    }
+
+    // All the samples in a batch come from the same writer, so liveliness is only asserted once.
+    if (acceptMsgFrom(changes[0]->writerGUID, &pWP))
+    {
+        assert_writer_liveliness(changes[0]->writerGUID);
+        for (uint32_t i = 0; i < count; ++i)
         {
-            auto wlp = this->mp_RTPSParticipant->wlp();
-            if (wlp != nullptr)
+            // The proxy may have been removed while notifying the previous sample.
+            if (i > 0 && pWP != nullptr && !acceptMsgFrom(changes[i]->writerGUID, &pWP))
             {
-                wlp->sub_liveliness_manager_->assert_liveliness(
-                    change->writerGUID,
-                    liveliness_kind_,
-                    liveliness_lease_duration_);
+                break;
             }
-            else
+
+            if (!add_received_change(changes[i], pWP))
             {
-                logError(RTPS_LIVELINESS, "Finite liveliness lease duration but WLP not enabled");
+                break;
             }
         }
+        return true;
+    }
 
-        // Check if CacheChange was received or is framework data
-        if (!pWP || !pWP->change_was_received(change->sequenceNumber))
+    return false;
+}
+
+void StatefulReader::assert_writer_liveliness(
+        const GUID_t& writer_guid)
+{
+    if (liveliness_lease_duration_ < c_TimeInfinite)
+    {
+        auto wlp = this->mp_RTPSParticipant->wlp();
+        if (wlp != nullptr)
         {
-            logInfo(RTPS_MSG_IN,
-                    IDSTRING "Trying to add change " << change->sequenceNumber << " TO reader: " << getGuid().entityId);
+            wlp->sub_liveliness_manager_->assert_liveliness(
+                writer_guid,
+                liveliness_kind_,
+                liveliness_lease_duration_);
+        }
+        else
+        {
+            logError(RTPS_LIVELINESS, "Finite liveliness lease duration but WLP not enabled");
+        }
+    }
+}
 
-            // Ask the pool for a cache change
-            CacheChange_t* change_to_add = nullptr;
-            if (!change_pool_->reserve_cache(change_to_add))
-            {
-                logError(RTPS_MSG_IN, IDSTRING "Problem reserving CacheChange in reader: " << m_guid);
-                return false;
-            }
+bool StatefulReader::add_received_change(
+        CacheChange_t* change,
+        WriterProxy* pWP)
+{
+    // Check if CacheChange was received or is framework data
+    if (!pWP || !pWP->change_was_received(change->sequenceNumber))
+    {
+        logInfo(RTPS_MSG_IN,
+                IDSTRING "Trying to add change " << change->sequenceNumber << " TO reader: " << getGuid().entityId);
 
-            // Copy metadata to reserved change
-            change_to_add->copy_not_memcpy(change);
+        // Ask the pool for a cache change
+        CacheChange_t* change_to_add = nullptr;
+        if (!change_pool_->reserve_cache(change_to_add))
+        {
+            logError(RTPS_MSG_IN, IDSTRING "Problem reserving CacheChange in reader: " << m_guid);
+            return false;
+        }
 
-            // Ask payload pool to copy the payload
-            IPayloadPool* payload_owner = change->payload_owner();
-            if (payload_pool_->get_payload(change->serializedPayload, payload_owner, *change_to_add))
-            {
-                change->payload_owner(payload_owner);
-            }
-            else
-            {
-                logWarning(RTPS_MSG_IN, IDSTRING "Problem copying CacheChange, received data is: "
-                        << change->serializedPayload.length << " bytes and max size in reader "
-                        << m_guid << " is "
-                        << (fixed_payload_size_ > 0 ? fixed_payload_size_ : std::numeric_limits<uint32_t>::max()));
-                change_pool_->release_cache(change_to_add);
-                return false;
-            }
+        // Copy metadata to reserved change
+        change_to_add->copy_not_memcpy(change);
 
-            // Perform reception of cache change
-            if (!change_received(change_to_add, pWP))
-            {
-                logInfo(RTPS_MSG_IN, IDSTRING "MessageReceiver not add change " << change_to_add->sequenceNumber);
-                payload_pool_->release_payload(*change_to_add);
-                change_pool_->release_cache(change_to_add);
-            }
+        // Ask payload pool to copy the payload
+        IPayloadPool* payload_owner = change->payload_owner();
+        if (payload_pool_->get_payload(change->serializedPayload, payload_owner, *change_to_add))
+        {
+            change->payload_owner(payload_owner);
+        }
+        else
+        {
+            logWarning(RTPS_MSG_IN, IDSTRING "Problem copying CacheChange, received data is: "
+                    << change->serializedPayload.length << " bytes and max size in reader "
+                    << m_guid << " is "
+                    << (fixed_payload_size_ > 0 ? fixed_payload_size_ : std::numeric_limits<uint32_t>::max()));
+            change_pool_->release_cache(change_to_add);
+            return false;
+        }
+
+        // Perform reception of cache change
+        if (!change_received(change_to_add, pWP))
+        {
+            logInfo(RTPS_MSG_IN, IDSTRING "MessageReceiver not add change " << change_to_add->sequenceNumber);
+            payload_pool_->release_payload(*change_to_add);
+            change_pool_->release_cache(change_to_add);
         }
-        return true;
     }
 
-    return false;
+    return true;
 }
 
 bool StatefulReader::processDataFragMsg(
@@ -466,30 +523,29 @@ bool StatefulReader::processDataFragMsg(
 
             CacheChange_t* change_created = nullptr;
             CacheChange_t* work_change = nullptr;
-            if (!mp_history->get_change(change_to_add->sequenceNumber, change_to_add->writerGUID, &work_change))
+            bool was_incomplete = false;
+            if (mp_history->get_change(change_to_add->sequenceNumber, change_to_add->writerGUID, &work_change))
             {
-                // A new change should be reserved
-                if (reserveCache(&work_change, sampleSize))
+                was_incomplete = !work_change->is_fully_assembled();
+            }
+            else
+            {
+                // A new change should be reserved, making room for it if needed
+                if (make_room_for_incomplete_sample_nts(pWP, change_to_add->sequenceNumber, sampleSize) &&
+                        reserve_fragmented_change(change_to_add, sampleSize, fragmentStartingNum, &work_change))
                 {
-                    if (work_change->serializedPayload.max_size < sampleSize)
-                    {
-                        releaseCache(work_change);
-                        work_change = nullptr;
-                    }
-                    else
-                    {
-                        work_change->copy_not_memcpy(change_to_add);
-                        work_change->serializedPayload.length = sampleSize;
-                        work_change->setFragmentSize(change_to_add->getFragmentSize(), true);
-                        change_created = work_change;
-                    }
+                    change_created = work_change;
+                }
+                else if (pWP->change_was_received(change_to_add->sequenceNumber))
+                {
+                    // The sample was dropped for good, so the following ones may be notified now
+                    NotifyChanges(pWP);
                 }
             }
 
             if (work_change != nullptr)
             {
-                work_change->add_fragments(change_to_add->serializedPayload, fragmentStartingNum,
-                        fragmentsInSubmessage);
+                add_fragments(work_change, change_to_add, fragmentStartingNum, fragmentsInSubmessage);
             }
 
             // If this is the first time we have received fragments for this change, add it to history
@@ -504,11 +560,19 @@ bool StatefulReader::processDataFragMsg(
                     releaseCache(change_created);
                     work_change = nullptr;
                 }
+                else if (!change_created->is_fully_assembled())
+                {
+                    incomplete_samples_memory_ += change_created->serializedPayload.max_size;
+                }
             }
 
             // If change has been fully reassembled, mark as received and add notify user
             if (work_change != nullptr && work_change->is_fully_assembled())
             {
+                if (was_incomplete)
+                {
+                    incomplete_samples_memory_ -= work_change->serializedPayload.max_size;
+                }
                 pWP->received_change_set(work_change->sequenceNumber);
                 NotifyChanges(pWP);
             }
@@ -518,6 +582,66 @@ bool StatefulReader::processDataFragMsg(
     return true;
 }
 
+bool StatefulReader::make_room_for_incomplete_sample_nts(
+        WriterProxy* writer,
+        const SequenceNumber_t& sequence_number,
+        uint32_t sample_size)
+{
+    if (max_incomplete_samples_memory_ == 0 ||
+            incomplete_samples_memory_ + sample_size <= max_incomplete_samples_memory_)
+    {
+        return true;
+    }
+
+    if (sample_size > max_incomplete_samples_memory_)
+    {
+        // It would never fit, so it is dropped for good instead of being requested again forever
+        logWarning(RTPS_MSG_IN, IDSTRING "Fragmented sample " << sequence_number << " of " << sample_size <<
+                " bytes exceeds the limit for incomplete samples on reader " << getGuid().entityId);
+        writer->irrelevant_change_set(sequence_number);
+        return false;
+    }
+
+    // Evict oldest incomplete samples first. A reliable reader keeps the ones its writer would send again, so two
+    // samples never keep evicting each other. A best-effort reader marks the evicted ones as irrelevant, so their
+    // pending fragments are discarded.
+    bool is_reliable = m_att.reliabilityKind == RELIABLE;
+    History::iterator it = mp_history->changesBegin();
+    while (incomplete_samples_memory_ + sample_size > max_incomplete_samples_memory_ &&
+            it != mp_history->changesEnd())
+    {
+        CacheChange_t* change = *it;
+        if (!change->is_fully_assembled())
+        {
+            WriterProxy* change_writer = nullptr;
+            bool is_matched = matched_writer_lookup(change->writerGUID, &change_writer);
+            if (!is_reliable || !is_matched || change_writer->change_was_received(change->sequenceNumber))
+            {
+                logInfo(RTPS_MSG_IN, IDSTRING "Evicting incomplete change " << change->sequenceNumber <<
+                        " from writer " << change->writerGUID);
+                if (!is_reliable && is_matched)
+                {
+                    change_writer->irrelevant_change_set(change->sequenceNumber);
+                }
+                // Use the history override, so the bookkeeping of derived histories is kept up to date.
+                // The memory of the change is discounted on change_removed_by_history.
+                it = mp_history->remove_change_nts(it);
+                continue;
+            }
+        }
+        ++it;
+    }
+
+    if (incomplete_samples_memory_ + sample_size > max_incomplete_samples_memory_)
+    {
+        logInfo(RTPS_MSG_IN, IDSTRING "No room for fragmented sample " << sequence_number <<
+                " on reader " << getGuid().entityId << ", it will be requested again");
+        return false;
+    }
+
+    return true;
+}
+
 bool StatefulReader::processHeartbeatMsg(
         const GUID_t& writerGUID,
         uint32_t hbCount,
@@ -602,8 +726,7 @@ bool StatefulReader::processGapMsg(
                 auto ret_iterator = findCacheInFragmentedProcess(auxSN, pWP->guid(), &to_remove, history_iterator);
                 if (to_remove != nullptr)
                 {
-                    // we called the History version to avoid callbacks
-                    history_iterator = mp_history->History::remove_change_nts(ret_iterator);
+                    history_iterator = mp_history->remove_change_nts(ret_iterator);
                 }
                 else if (ret_iterator != mp_history->changesEnd())
                 {
@@ -619,11 +742,10 @@ bool StatefulReader::processGapMsg(
                 {
                     CacheChange_t* to_remove = nullptr;
                     auto ret_iterator =
-                    findCacheInFragmentedProcess(auxSN, pWP->guid(), &to_remove, history_iterator);
+                    findCacheInFragmentedProcess(it, pWP->guid(), &to_remove, history_iterator);
                     if (to_remove != nullptr)
                     {
-                        // we called the History version to avoid callbacks
-                        history_iterator = mp_history->History::remove_change_nts(ret_iterator);
+                        history_iterator = mp_history->remove_change_nts(ret_iterator);
                     }
                     else if (ret_iterator != mp_history->changesEnd())
                     {
@@ -676,6 +798,12 @@ bool StatefulReader::change_removed_by_history(
 
     if (is_alive_)
     {
+        if (!a_change->is_fully_assembled())
+        {
+            incomplete_samples_memory_ -= std::min<uint64_t>(incomplete_samples_memory_,
+                            a_change->serializedPayload.max_size);
+        }
+
         if (wp != nullptr || matched_writer_lookup(a_change->writerGUID, &wp))
         {
             if (a_change->is_fully_assembled())
@@ -759,6 +887,13 @@ bool StatefulReader::change_received(
         Time_t::now(a_change->receptionTimestamp);
         GUID_t proxGUID = prox->guid();
 
+        fastdds::statistics::EndpointStatistics* statistics = this->statistics();
+        if (nullptr != statistics)
+        {
+            statistics->on_sample_received(a_change->sourceTimestamp, a_change->receptionTimestamp,
+                    a_change->serializedPayload.length);
+        }
+
         // If KEEP_LAST and history full, make older changes as lost.
         CacheChange_t* aux_change = nullptr;
         if (mp_history->isFull() && mp_history->get_min_change_from(&aux_change, proxGUID))
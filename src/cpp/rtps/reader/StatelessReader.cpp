@@ -187,6 +187,13 @@ bool StatelessReader::change_received(
         {
             Time_t::now(change->receptionTimestamp);
             update_last_notified(change->writerGUID, change->sequenceNumber);
+
+            fastdds::statistics::EndpointStatistics* statistics = this->statistics();
+            if (nullptr != statistics)
+            {
+                statistics->on_sample_received(change->sourceTimestamp, change->receptionTimestamp,
+                        change->serializedPayload.length);
+            }
             ++total_unread_;
 
             if (getListener() != nullptr)
@@ -283,49 +290,80 @@ bool StatelessReader::processDataMsg(
 
     if (acceptMsgFrom(change->writerGUID, change->kind))
     {
-        logInfo(RTPS_MSG_IN, IDSTRING "Trying to add change " << change->sequenceNumber << " TO reader: " << m_guid);
-
         assert_writer_liveliness(change->writerGUID);
+        return add_received_change(change);
+    }
 
-        // Ask the pool for a cache change
-        CacheChange_t* change_to_add = nullptr;
-        if (!change_pool_->reserve_cache(change_to_add))
-        {
-            logError(RTPS_MSG_IN, IDSTRING "Problem reserving CacheChange in reader: " << m_guid);
-            return false;
-        }
+    return true;
+}
 
-        // Copy metadata to reserved change
-        change_to_add->copy_not_memcpy(change);
+bool StatelessReader::processDataBatchMsg(
+        CacheChange_t* const* changes,
+        uint32_t count)
+{
+    assert(changes && count > 0);
 
-        // Ask payload pool to copy the payload
-        IPayloadPool* payload_owner = change->payload_owner();
-        if (payload_pool_->get_payload(change->serializedPayload, payload_owner, *change_to_add))
-        {
-            change->payload_owner(payload_owner);
-        }
-        else
-        {
-            logWarning(RTPS_MSG_IN, IDSTRING "Problem copying CacheChange, received data is: "
-                    << change->serializedPayload.length << " bytes and max size in reader "
-                    << m_guid << " is "
-                    << (fixed_payload_size_ > 0 ? fixed_payload_size_ : std::numeric_limits<uint32_t>::max()));
-            change_pool_->release_cache(change_to_add);
-            return false;
-        }
+    std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
 
-        // Perform reception of cache change
-        if (!change_received(change_to_add))
+    // All the samples in a batch come from the same writer and are ALIVE, so the writer is only checked once.
+    if (acceptMsgFrom(changes[0]->writerGUID, changes[0]->kind))
+    {
+        assert_writer_liveliness(changes[0]->writerGUID);
+        for (uint32_t i = 0; i < count; ++i)
         {
-            logInfo(RTPS_MSG_IN, IDSTRING "MessageReceiver not add change " << change_to_add->sequenceNumber);
-            payload_pool_->release_payload(*change_to_add);
-            change_pool_->release_cache(change_to_add);
+            if (!add_received_change(changes[i]))
+            {
+                break;
+            }
         }
     }
 
     return true;
 }
 
+bool StatelessReader::add_received_change(
+        CacheChange_t* change)
+{
+    logInfo(RTPS_MSG_IN, IDSTRING "Trying to add change " << change->sequenceNumber << " TO reader: " << m_guid);
+
+    // Ask the pool for a cache change
+    CacheChange_t* change_to_add = nullptr;
+    if (!change_pool_->reserve_cache(change_to_add))
+    {
+        logError(RTPS_MSG_IN, IDSTRING "Problem reserving CacheChange in reader: " << m_guid);
+        return false;
+    }
+
+    // Copy metadata to reserved change
+    change_to_add->copy_not_memcpy(change);
+
+    // Ask payload pool to copy the payload
+    IPayloadPool* payload_owner = change->payload_owner();
+    if (payload_pool_->get_payload(change->serializedPayload, payload_owner, *change_to_add))
+    {
+        change->payload_owner(payload_owner);
+    }
+    else
+    {
+        logWarning(RTPS_MSG_IN, IDSTRING "Problem copying CacheChange, received data is: "
+                << change->serializedPayload.length << " bytes and max size in reader "
+                << m_guid << " is "
+                << (fixed_payload_size_ > 0 ? fixed_payload_size_ : std::numeric_limits<uint32_t>::max()));
+        change_pool_->release_cache(change_to_add);
+        return false;
+    }
+
+    // Perform reception of cache change
+    if (!change_received(change_to_add))
+    {
+        logInfo(RTPS_MSG_IN, IDSTRING "MessageReceiver not add change " << change_to_add->sequenceNumber);
+        payload_pool_->release_payload(*change_to_add);
+        change_pool_->release_cache(change_to_add);
+    }
+
+    return true;
+}
+
 bool StatelessReader::processDataFragMsg(
         CacheChange_t* incomingChange,
         uint32_t sampleSize,
@@ -363,8 +401,11 @@ bool StatelessReader::processDataFragMsg(
                 {
                     if (work_change->sequenceNumber < change_to_add->sequenceNumber)
                     {
-                        // Pending change should be dropped. Check if it can be reused
-                        if (sampleSize <= work_change->serializedPayload.max_size)
+                        // Pending change should be dropped. Check if it can be reused, which is not worth when
+                        // the fragments come on a reassembly buffer it could share
+                        if (!work_change->payload_is_shared() &&
+                                change_to_add->payload_owner() != payload_pool_.get() &&
+                                sampleSize <= work_change->serializedPayload.max_size)
                         {
                             // Sample fits inside pending change. Reuse it.
                             work_change->copy_not_memcpy(change_to_add);
@@ -383,28 +424,14 @@ bool StatelessReader::processDataFragMsg(
                 // Check if a new change should be reserved
                 if (work_change == nullptr)
                 {
-                    if (reserveCache(&work_change, sampleSize))
-                    {
-                        if (work_change->serializedPayload.max_size < sampleSize)
-                        {
-                            releaseCache(work_change);
-                            work_change = nullptr;
-                        }
-                        else
-                        {
-                            work_change->copy_not_memcpy(change_to_add);
-                            work_change->serializedPayload.length = sampleSize;
-                            work_change->setFragmentSize(change_to_add->getFragmentSize(), true);
-                        }
-                    }
+                    reserve_fragmented_change(change_to_add, sampleSize, fragmentStartingNum, &work_change);
                 }
 
                 // Process fragment and set change_completed if it is fully reassembled
                 CacheChange_t* change_completed = nullptr;
                 if (work_change != nullptr)
                 {
-                    if (work_change->add_fragments(change_to_add->serializedPayload, fragmentStartingNum,
-                            fragmentsInSubmessage))
+                    if (add_fragments(work_change, change_to_add, fragmentStartingNum, fragmentsInSubmessage))
                     {
                         change_completed = work_change;
                         work_change = nullptr;
@@ -0,0 +1,137 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file HandshakeWorkerPool.cpp
+ */
+
+#include <rtps/security/HandshakeWorkerPool.h>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastrtps::rtps::security;
+
+HandshakeWorkerPool::~HandshakeWorkerPool()
+{
+    stop();
+}
+
+void HandshakeWorkerPool::start(
+        uint32_t num_threads,
+        size_t max_pending_tasks)
+{
+    if (!workers_.empty())
+    {
+        return;
+    }
+
+    max_pending_tasks_ = max_pending_tasks > 0 ? max_pending_tasks : 1;
+
+    for (uint32_t i = 0; i < num_threads; ++i)
+    {
+        workers_.emplace_back(new Worker());
+    }
+
+    for (auto& worker : workers_)
+    {
+        Worker* worker_ptr = worker.get();
+        worker->thread = std::thread([this, worker_ptr]()
+                        {
+                            run(*worker_ptr);
+                        });
+    }
+
+    running_ = num_threads > 0;
+}
+
+void HandshakeWorkerPool::stop()
+{
+    running_ = false;
+
+    for (auto& worker : workers_)
+    {
+        {
+            std::lock_guard<std::mutex> guard(worker->mutex);
+            worker->stop = true;
+            worker->tasks.clear();
+        }
+        worker->cv.notify_all();
+    }
+
+    for (auto& worker : workers_)
+    {
+        if (worker->thread.joinable())
+        {
+            worker->thread.join();
+        }
+    }
+}
+
+bool HandshakeWorkerPool::post(
+        const GUID_t& remote_participant_key,
+        const Task& task)
+{
+    if (!is_running())
+    {
+        return false;
+    }
+
+    // FNV-1a on the prefix, which identifies the remote participant
+    uint32_t hash = 2166136261u;
+    for (octet byte : remote_participant_key.guidPrefix.value)
+    {
+        hash = (hash ^ byte) * 16777619u;
+    }
+    Worker& worker = *workers_[hash % workers_.size()];
+
+    std::unique_lock<std::mutex> lock(worker.mutex);
+    worker.cv.wait(lock, [&]()
+            {
+                return worker.stop || worker.tasks.size() < max_pending_tasks_;
+            });
+
+    if (worker.stop)
+    {
+        return true;
+    }
+
+    worker.tasks.push_back(task);
+    lock.unlock();
+    worker.cv.notify_all();
+    return true;
+}
+
+void HandshakeWorkerPool::run(
+        Worker& worker)
+{
+    std::unique_lock<std::mutex> lock(worker.mutex);
+
+    while (!worker.stop)
+    {
+        if (worker.tasks.empty())
+        {
+            worker.cv.wait(lock);
+            continue;
+        }
+
+        Task task = std::move(worker.tasks.front());
+        worker.tasks.pop_front();
+
+        // Wake up a thread waiting for room on the queue
+        worker.cv.notify_all();
+
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+}
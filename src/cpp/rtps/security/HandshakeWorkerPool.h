@@ -0,0 +1,110 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file HandshakeWorkerPool.h
+ */
+#ifndef _RTPS_SECURITY_HANDSHAKEWORKERPOOL_H_
+#define _RTPS_SECURITY_HANDSHAKEWORKERPOOL_H_
+
+#include <fastdds/rtps/common/Guid.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+namespace security {
+
+/*!
+ * Bounded pool of threads where the SecurityManager runs the authentication handshakes.
+ * Tasks are distributed by remote participant, so all the tasks of a remote participant run on the same
+ * thread in the order they were posted, and its handshake state machine advances sequentially.
+ */
+class HandshakeWorkerPool
+{
+public:
+
+    typedef std::function<void()> Task;
+
+    HandshakeWorkerPool() = default;
+
+    ~HandshakeWorkerPool();
+
+    /*!
+     * Starts the threads of the pool.
+     * @param num_threads Number of threads. Zero leaves the pool stopped.
+     * @param max_pending_tasks Maximum number of tasks waiting on each thread.
+     */
+    void start(
+            uint32_t num_threads,
+            size_t max_pending_tasks);
+
+    /*!
+     * Stops the threads of the pool. Tasks not yet started are discarded.
+     * The pool cannot be started again afterwards.
+     */
+    void stop();
+
+    bool is_running() const
+    {
+        return running_;
+    }
+
+    /*!
+     * Queues a task on the thread of a remote participant.
+     * Blocks while that thread has max_pending_tasks waiting.
+     * @param remote_participant_key GUID of the remote participant the task belongs to.
+     * @param task Task to run.
+     * @return false when the pool is not running, so the task was not queued.
+     */
+    bool post(
+            const GUID_t& remote_participant_key,
+            const Task& task);
+
+private:
+
+    struct Worker
+    {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::deque<Task> tasks;
+        std::thread thread;
+        bool stop = false;
+    };
+
+    void run(
+            Worker& worker);
+
+    //! Workers are kept until destruction, so threads posting while the pool stops find them
+    std::vector<std::unique_ptr<Worker>> workers_;
+    size_t max_pending_tasks_ = 0;
+    std::atomic<bool> running_{false};
+};
+
+} //namespace security
+} //namespace rtps
+} //namespace fastrtps
+} //namespace eprosima
+
+#endif // _RTPS_SECURITY_HANDSHAKEWORKERPOOL_H_
@@ -49,6 +49,7 @@
 
 #include <cassert>
 #include <chrono>
+#include <cstdlib>
 #include <thread>
 #include <mutex>
 
@@ -360,6 +361,8 @@ bool SecurityManager::init(
             if ((access_plugin_ == nullptr || local_permissions_handle_ != nullptr) &&
                     (crypto_plugin_ == nullptr || local_participant_crypto_handle_ != nullptr))
             {
+                start_handshake_workers(participant_properties);
+
                 // Should be activated here, to enable encription buffer on created entities
                 security_activated = true;
                 return true;
@@ -393,6 +396,29 @@ bool SecurityManager::init(
     return true;
 }
 
+void SecurityManager::start_handshake_workers(
+        const PropertyPolicy& participant_properties)
+{
+    // Maximum number of handshake tasks waiting on each worker before discovery blocks.
+    constexpr size_t max_pending_handshakes = 256;
+
+    const std::string* property_value = PropertyPolicyHelper::find_property(participant_properties,
+                    "dds.sec.auth.handshake_threads");
+    if (property_value == nullptr)
+    {
+        return;
+    }
+
+    uint32_t num_threads = static_cast<uint32_t>(std::strtoul(property_value->c_str(), nullptr, 10));
+    uint32_t max_threads = std::thread::hardware_concurrency();
+    if (max_threads > 0 && num_threads > max_threads)
+    {
+        num_threads = max_threads;
+    }
+
+    handshake_workers_.start(num_threads, max_pending_handshakes);
+}
+
 void SecurityManager::cancel_init()
 {
     SecurityException exception;
@@ -423,6 +449,9 @@ void SecurityManager::destroy()
 {
     if (authentication_plugin_ != nullptr)
     {
+        // Handshakes in progress use the plugins and the discovered participants.
+        handshake_workers_.stop();
+
         mutex_.lock();
 
         for (auto& local_reader : reader_handles_)
@@ -690,19 +719,58 @@ bool SecurityManager::discovered_participant(
     }
 
     bool returnedValue = true;
+    bool request_pending = remote_participant_info->auth_status_ == AUTHENTICATION_REQUEST_NOT_SEND;
 
-    if (remote_participant_info->auth_status_ == AUTHENTICATION_REQUEST_NOT_SEND)
+    if (request_pending && !handshake_workers_.is_running())
     {
         // Maybe send request.
         returnedValue = on_process_handshake(participant_data, remote_participant_info,
                         MessageIdentity(), HandshakeMessageToken());
+        request_pending = false;
     }
 
     restore_discovered_participant_info(participant_data.m_guid, remote_participant_info);
 
+    if (request_pending)
+    {
+        // The request is generated on the handshake worker, so discovery is not delayed by it.
+        const GUID_t remote_participant_key = participant_data.m_guid;
+        handshake_workers_.post(remote_participant_key, [this, remote_participant_key]()
+                {
+                    begin_handshake_request(remote_participant_key);
+                });
+    }
+
     return returnedValue;
 }
 
+void SecurityManager::begin_handshake_request(
+        const GUID_t& remote_participant_key)
+{
+    DiscoveredParticipantInfo::AuthUniquePtr remote_participant_info;
+    const ParticipantProxyData* participant_data = nullptr;
+
+    mutex_.lock();
+    auto dp_it = discovered_participants_.find(remote_participant_key);
+    if (dp_it != discovered_participants_.end())
+    {
+        remote_participant_info = dp_it->second.get_auth();
+        participant_data = &(dp_it->second.participant_data());
+    }
+    mutex_.unlock();
+
+    if (remote_participant_info && participant_data)
+    {
+        if (remote_participant_info->auth_status_ == AUTHENTICATION_REQUEST_NOT_SEND)
+        {
+            on_process_handshake(*participant_data, remote_participant_info,
+                    MessageIdentity(), HandshakeMessageToken());
+        }
+
+        restore_discovered_participant_info(remote_participant_key, remote_participant_info);
+    }
+}
+
 void SecurityManager::remove_participant(
         const ParticipantProxyData& participant_data)
 {
@@ -1407,125 +1475,79 @@ void SecurityManager::process_participant_stateless_message(
 
         const GUID_t remote_participant_key(message.message_identity().source_guid().guidPrefix,
                 c_EntityId_RTPSParticipant);
-        DiscoveredParticipantInfo::AuthUniquePtr remote_participant_info;
-        const ParticipantProxyData* participant_data = nullptr;
 
-        mutex_.lock();
-        auto dp_it = discovered_participants_.find(remote_participant_key);
-        if (dp_it != discovered_participants_.end())
+        if (handshake_workers_.is_running())
         {
-            remote_participant_info = dp_it->second.get_auth();
-            participant_data = &(dp_it->second.participant_data());
+            // The change is released when this returns, so the message is moved to the task.
+            std::shared_ptr<ParticipantGenericMessage> shared_message =
+                    std::make_shared<ParticipantGenericMessage>(std::move(message));
+            handshake_workers_.post(remote_participant_key, [this, remote_participant_key, shared_message]()
+                    {
+                        process_handshake_message(remote_participant_key, *shared_message);
+                    });
         }
-        mutex_.unlock();
-
-        if (remote_participant_info && participant_data)
+        else
         {
-            if (remote_participant_info->auth_status_ == AUTHENTICATION_WAITING_REQUEST)
-            {
-                assert(!remote_participant_info->handshake_handle_);
-
-                // Preconditions
-                if (message.related_message_identity().source_guid() != GUID_t::unknown())
-                {
-                    logInfo(SECURITY,
-                            "Bad ParticipantGenericMessage. related_message_identity.source_guid is not GUID_t::unknown()");
-                    restore_discovered_participant_info(remote_participant_key, remote_participant_info);
-                    return;
-                }
-                if (message.message_data().size() != 1)
-                {
-                    logInfo(SECURITY, "Bad ParticipantGenericMessage. message_data size is not 1");
-                    restore_discovered_participant_info(remote_participant_key, remote_participant_info);
-                    return;
-                }
-            }
-            else if (remote_participant_info->auth_status_ == AUTHENTICATION_WAITING_REPLY ||
-                    remote_participant_info->auth_status_ == AUTHENTICATION_WAITING_FINAL)
-            {
-                assert(remote_participant_info->handshake_handle_);
+            process_handshake_message(remote_participant_key, message);
+        }
+    }
+    else
+    {
+        logInfo(SECURITY, "Discarted ParticipantGenericMessage with class id " << message.message_class_id());
+    }
+}
 
-                if (message.related_message_identity().source_guid() == GUID_t::unknown() &&
-                        remote_participant_info->auth_status_ == AUTHENTICATION_WAITING_FINAL)
-                {
-                    // Maybe the reply was missed. Resent.
-                    if (remote_participant_info->change_sequence_number_ != SequenceNumber_t::unknown())
-                    {
-                        // Remove previous change and send a new one.
-                        CacheChange_t* p_change =
-                                participant_stateless_message_writer_history_->remove_change_and_reuse(
-                            remote_participant_info->change_sequence_number_);
-                        remote_participant_info->change_sequence_number_ = SequenceNumber_t::unknown();
+void SecurityManager::process_handshake_message(
+        const GUID_t& remote_participant_key,
+        ParticipantGenericMessage& message)
+{
+    DiscoveredParticipantInfo::AuthUniquePtr remote_participant_info;
+    const ParticipantProxyData* participant_data = nullptr;
 
-                        if (p_change != nullptr)
-                        {
-                            if (participant_stateless_message_writer_history_->add_change(p_change))
-                            {
-                                remote_participant_info->change_sequence_number_ = p_change->sequenceNumber;
-                            }
-                            //TODO (Ricardo) What to do if not added?
-                        }
+    mutex_.lock();
+    auto dp_it = discovered_participants_.find(remote_participant_key);
+    if (dp_it != discovered_participants_.end())
+    {
+        remote_participant_info = dp_it->second.get_auth();
+        participant_data = &(dp_it->second.participant_data());
+    }
+    mutex_.unlock();
 
-                        restore_discovered_participant_info(remote_participant_key, remote_participant_info);
-                        return;
-                    }
-                }
+    if (remote_participant_info && participant_data)
+    {
+        if (remote_participant_info->auth_status_ == AUTHENTICATION_WAITING_REQUEST)
+        {
+            assert(!remote_participant_info->handshake_handle_);
 
-                // Preconditions
-                if (message.related_message_identity().source_guid()
-                        != participant_stateless_message_writer_->getGuid())
-                {
-                    logInfo(SECURITY,
-                            "Bad ParticipantGenericMessage. related_message_identity.source_guid is not mine");
-                    restore_discovered_participant_info(remote_participant_key, remote_participant_info);
-                    return;
-                }
-                if (message.related_message_identity().sequence_number()
-                        != remote_participant_info->expected_sequence_number_)
-                {
-                    logInfo(SECURITY,
-                            "Bad ParticipantGenericMessage. related_message_identity.sequence_number is not expected");
-                    restore_discovered_participant_info(remote_participant_key, remote_participant_info);
-                    return;
-                }
-                if (message.message_data().size() != 1)
-                {
-                    logInfo(SECURITY, "Bad ParticipantGenericMessage. message_data size is not 1");
-                    restore_discovered_participant_info(remote_participant_key, remote_participant_info);
-                    return;
-                }
+            // Preconditions
+            if (message.related_message_identity().source_guid() != GUID_t::unknown())
+            {
+                logInfo(SECURITY,
+                        "Bad ParticipantGenericMessage. related_message_identity.source_guid is not GUID_t::unknown()");
+                restore_discovered_participant_info(remote_participant_key, remote_participant_info);
+                return;
             }
-            else if (remote_participant_info->auth_status_ == AUTHENTICATION_OK)
+            if (message.message_data().size() != 1)
             {
-                // Preconditions
-                if (message.related_message_identity().source_guid()
-                        != participant_stateless_message_writer_->getGuid())
-                {
-                    logInfo(SECURITY,
-                            "Bad ParticipantGenericMessage. related_message_identity.source_guid is not mine");
-                    restore_discovered_participant_info(remote_participant_key, remote_participant_info);
-                    return;
-                }
-                if (message.related_message_identity().sequence_number()
-                        != remote_participant_info->expected_sequence_number_)
-                {
-                    logInfo(SECURITY,
-                            "Bad ParticipantGenericMessage. related_message_identity.sequence_number is not expected");
-                    restore_discovered_participant_info(remote_participant_key, remote_participant_info);
-                    return;
-                }
-                if (message.message_data().size() != 1)
-                {
-                    logInfo(SECURITY, "Bad ParticipantGenericMessage. message_data size is not 1");
-                    restore_discovered_participant_info(remote_participant_key, remote_participant_info);
-                    return;
-                }
+                logInfo(SECURITY, "Bad ParticipantGenericMessage. message_data size is not 1");
+                restore_discovered_participant_info(remote_participant_key, remote_participant_info);
+                return;
+            }
+        }
+        else if (remote_participant_info->auth_status_ == AUTHENTICATION_WAITING_REPLY ||
+                remote_participant_info->auth_status_ == AUTHENTICATION_WAITING_FINAL)
+        {
+            assert(remote_participant_info->handshake_handle_);
 
-                // Maybe final message was missed. Resent.
+            if (message.related_message_identity().source_guid() == GUID_t::unknown() &&
+                    remote_participant_info->auth_status_ == AUTHENTICATION_WAITING_FINAL)
+            {
+                // Maybe the reply was missed. Resent.
                 if (remote_participant_info->change_sequence_number_ != SequenceNumber_t::unknown())
                 {
                     // Remove previous change and send a new one.
-                    CacheChange_t* p_change = participant_stateless_message_writer_history_->remove_change_and_reuse(
+                    CacheChange_t* p_change =
+                            participant_stateless_message_writer_history_->remove_change_and_reuse(
                         remote_participant_info->change_sequence_number_);
                     remote_participant_info->change_sequence_number_ = SequenceNumber_t::unknown();
 
@@ -1542,25 +1564,92 @@ void SecurityManager::process_participant_stateless_message(
                     return;
                 }
             }
-            else
+
+            // Preconditions
+            if (message.related_message_identity().source_guid()
+                    != participant_stateless_message_writer_->getGuid())
+            {
+                logInfo(SECURITY,
+                        "Bad ParticipantGenericMessage. related_message_identity.source_guid is not mine");
+                restore_discovered_participant_info(remote_participant_key, remote_participant_info);
+                return;
+            }
+            if (message.related_message_identity().sequence_number()
+                    != remote_participant_info->expected_sequence_number_)
             {
+                logInfo(SECURITY,
+                        "Bad ParticipantGenericMessage. related_message_identity.sequence_number is not expected");
+                restore_discovered_participant_info(remote_participant_key, remote_participant_info);
+                return;
+            }
+            if (message.message_data().size() != 1)
+            {
+                logInfo(SECURITY, "Bad ParticipantGenericMessage. message_data size is not 1");
+                restore_discovered_participant_info(remote_participant_key, remote_participant_info);
+                return;
+            }
+        }
+        else if (remote_participant_info->auth_status_ == AUTHENTICATION_OK)
+        {
+            // Preconditions
+            if (message.related_message_identity().source_guid()
+                    != participant_stateless_message_writer_->getGuid())
+            {
+                logInfo(SECURITY,
+                        "Bad ParticipantGenericMessage. related_message_identity.source_guid is not mine");
+                restore_discovered_participant_info(remote_participant_key, remote_participant_info);
+                return;
+            }
+            if (message.related_message_identity().sequence_number()
+                    != remote_participant_info->expected_sequence_number_)
+            {
+                logInfo(SECURITY,
+                        "Bad ParticipantGenericMessage. related_message_identity.sequence_number is not expected");
+                restore_discovered_participant_info(remote_participant_key, remote_participant_info);
+                return;
+            }
+            if (message.message_data().size() != 1)
+            {
+                logInfo(SECURITY, "Bad ParticipantGenericMessage. message_data size is not 1");
                 restore_discovered_participant_info(remote_participant_key, remote_participant_info);
                 return;
             }
 
-            on_process_handshake(*participant_data, remote_participant_info,
-                    std::move(message.message_identity()), std::move(message.message_data().at(0)));
+            // Maybe final message was missed. Resent.
+            if (remote_participant_info->change_sequence_number_ != SequenceNumber_t::unknown())
+            {
+                // Remove previous change and send a new one.
+                CacheChange_t* p_change = participant_stateless_message_writer_history_->remove_change_and_reuse(
+                    remote_participant_info->change_sequence_number_);
+                remote_participant_info->change_sequence_number_ = SequenceNumber_t::unknown();
 
-            restore_discovered_participant_info(remote_participant_key, remote_participant_info);
+                if (p_change != nullptr)
+                {
+                    if (participant_stateless_message_writer_history_->add_change(p_change))
+                    {
+                        remote_participant_info->change_sequence_number_ = p_change->sequenceNumber;
+                    }
+                    //TODO (Ricardo) What to do if not added?
+                }
+
+                restore_discovered_participant_info(remote_participant_key, remote_participant_info);
+                return;
+            }
         }
         else
         {
-            logInfo(SECURITY, "Received Authentication message but not found related remote_participant_key");
+            restore_discovered_participant_info(remote_participant_key, remote_participant_info);
+            return;
         }
+
+        on_process_handshake(*participant_data, remote_participant_info,
+                std::move(message.message_identity()), std::move(message.message_data().at(0)));
+
+        restore_discovered_participant_info(remote_participant_key, remote_participant_info);
     }
     else
     {
-        logInfo(SECURITY, "Discarted ParticipantGenericMessage with class id " << message.message_class_id());
+        logInfo(SECURITY, "Received Authentication message but not found related remote_participant_key");
     }
 }
 
@@ -19,6 +19,7 @@
 #define _RTPS_SECURITY_SECURITYMANAGER_H_
 
 #include <rtps/security/SecurityPluginFactory.h>
+#include <rtps/security/HandshakeWorkerPool.h>
 
 #include <fastdds/rtps/security/authentication/Handshake.h>
 #include <fastdds/rtps/security/common/ParticipantGenericMessage.h>
@@ -417,6 +418,9 @@ private:
 
     void cancel_init();
 
+    void start_handshake_workers(
+            const PropertyPolicy& participant_properties);
+
     void remove_discovered_participant_info(
             DiscoveredParticipantInfo::AuthUniquePtr&& auth_ptr);
 
@@ -476,6 +480,21 @@ private:
     void process_participant_stateless_message(
             const CacheChange_t* const change);
 
+    /*!
+     * Advances the handshake with a remote participant with a received authentication message.
+     * Runs on the handshake worker of the remote participant, when there are handshake workers.
+     */
+    void process_handshake_message(
+            const GUID_t& remote_participant_key,
+            ParticipantGenericMessage& message);
+
+    /*!
+     * Sends the handshake request to a remote participant, if it was not sent yet.
+     * Runs on the handshake worker of the remote participant.
+     */
+    void begin_handshake_request(
+            const GUID_t& remote_participant_key);
+
     void process_participant_volatile_message_secure(
             const CacheChange_t* const change);
 
@@ -547,6 +566,9 @@ private:
 
     std::mutex mutex_;
 
+    //! Threads where the handshakes run, when enabled with dds.sec.auth.handshake_threads
+    HandshakeWorkerPool handshake_workers_;
+
     std::atomic<int64_t> auth_last_sequence_number_;
 
     std::atomic<int64_t> crypto_last_sequence_number_;
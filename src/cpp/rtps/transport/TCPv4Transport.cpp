@@ -259,9 +259,11 @@ bool TCPv4Transport::is_local_locator(const Locator_t& locator) const
     }
 
     /*
-     * Check case: Address is one of our addresses.
+     * Check case: Address is one of our addresses, taken from the shared snapshot so changes after init are followed.
      */
-    for (const IPFinder::info_IP& localInterface : current_interfaces_)
+    std::vector<IPFinder::info_IP> local_interfaces;
+    get_ipv4s(local_interfaces);
+    for (const IPFinder::info_IP& localInterface : local_interfaces)
     {
         if (IPLocator::compareAddress(locator, localInterface.locator))
         {
@@ -237,7 +237,10 @@ bool TCPv6Transport::is_local_locator(const Locator_t& locator) const
         return true;
     }
 
-    for (const IPFinder::info_IP& localInterface : current_interfaces_)
+    // The interfaces are taken from the shared snapshot, so changes after init are followed
+    std::vector<IPFinder::info_IP> local_interfaces;
+    get_ipv6s(local_interfaces);
+    for (const IPFinder::info_IP& localInterface : local_interfaces)
     {
         if (IPLocator::compareAddress(locator, localInterface.locator))
         {
@@ -25,6 +25,10 @@
 #include <algorithm>
 #include <chrono>
 
+#ifndef _WIN32
+#include <poll.h>
+#endif // ifndef _WIN32
+
 using namespace std;
 using namespace asio;
 
@@ -67,6 +71,7 @@ UDPTransportDescriptor::UDPTransportDescriptor(
         const UDPTransportDescriptor& t)
     : SocketTransportDescriptor(t)
     , m_output_udp_socket(t.m_output_udp_socket)
+    , non_blocking_send(t.non_blocking_send)
 {
 }
 
@@ -75,11 +80,30 @@ UDPTransportInterface::UDPTransportInterface(
     : TransportInterface(transport_kind)
     , mSendBufferSize(0)
     , mReceiveBufferSize(0)
+    , would_block_count_(0)
+    , queued_bytes_(0)
+    , dropped_datagrams_count_(0)
 {
 }
 
 UDPTransportInterface::~UDPTransportInterface()
 {
+    shutdown();
+}
+
+void UDPTransportInterface::shutdown()
+{
+    std::thread flush_thread;
+    {
+        std::lock_guard<std::mutex> lock(pending_queues_mutex_);
+        pending_flush_stop_ = true;
+        flush_thread = std::move(pending_flush_thread_);
+    }
+    pending_flush_cv_.notify_all();
+    if (flush_thread.joinable())
+    {
+        flush_thread.join();
+    }
 }
 
 void UDPTransportInterface::clean()
@@ -118,6 +142,27 @@ bool UDPTransportInterface::CloseInputChannel(
 void UDPTransportInterface::CloseOutputChannel(
         eProsimaUDPSocket& socket)
 {
+    std::shared_ptr<PendingQueue> queue;
+    {
+        std::lock_guard<std::mutex> lock(pending_queues_mutex_);
+        auto it = pending_queues_.find(getSocketPtr(socket)->native_handle());
+        if (it != pending_queues_.end())
+        {
+            queue = it->second;
+            pending_queues_.erase(it);
+        }
+    }
+
+    if (queue)
+    {
+        // The flush thread may still hold the queue, so it must not use the socket anymore
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        queue->socket = nullptr;
+        queued_bytes_ -= queue->bytes;
+        queue->bytes = 0;
+        queue->datagrams.clear();
+    }
+
     socket.cancel();
     socket.close();
 }
@@ -514,6 +559,11 @@ bool UDPTransportInterface::send(
     {
         auto destinationEndpoint = generate_endpoint(remote_locator, IPLocator::getPhysicalPort(remote_locator));
 
+        if (configuration()->non_blocking_send)
+        {
+            return send_non_blocking(send_buffer, send_buffer_size, socket, destinationEndpoint, timeout);
+        }
+
         size_t bytesSent = 0;
 
         try
@@ -558,6 +608,224 @@ bool UDPTransportInterface::send(
     return success;
 }
 
+#ifdef _WIN32
+using PollFd = WSAPOLLFD;
+static const short poll_writable_event = POLLWRNORM;
+#else
+using PollFd = struct pollfd;
+static const short poll_writable_event = POLLOUT;
+#endif // ifdef _WIN32
+
+//! Period of the flush thread when no pending socket becomes writable.
+static const std::chrono::milliseconds pending_flush_period(10);
+
+/**
+ * Wait until any of the sockets is writable.
+ * @return true when some socket became writable before the timeout.
+ */
+static bool wait_writable(
+        std::vector<PollFd>& poll_fds,
+        const std::chrono::microseconds& timeout)
+{
+    int timeout_ms = timeout.count() > 0 ? static_cast<int>((timeout.count() + 999) / 1000) : 0;
+#ifdef _WIN32
+    return WSAPoll(poll_fds.data(), static_cast<ULONG>(poll_fds.size()), timeout_ms) > 0;
+#else
+    return ::poll(poll_fds.data(), static_cast<nfds_t>(poll_fds.size()), timeout_ms) > 0;
+#endif // ifdef _WIN32
+}
+
+static PollFd writable_poll_fd(
+        asio::ip::udp::socket::native_handle_type handle)
+{
+    PollFd poll_fd;
+    poll_fd.fd = handle;
+    poll_fd.events = poll_writable_event;
+    poll_fd.revents = 0;
+    return poll_fd;
+}
+
+void UDPTransportInterface::send_datagram(
+        asio::ip::udp::socket& socket,
+        const octet* data,
+        uint32_t size,
+        const ip::udp::endpoint& destination,
+        asio::error_code& ec)
+{
+    size_t bytesSent = socket.send_to(asio::buffer(data, size), destination, 0, ec);
+    if (!ec)
+    {
+        (void)bytesSent;
+        logInfo(RTPS_MSG_OUT, "UDPTransport: " << bytesSent << " bytes TO endpoint: " << destination
+                                               << " FROM " << socket.local_endpoint());
+    }
+}
+
+std::shared_ptr<UDPTransportInterface::PendingQueue> UDPTransportInterface::get_pending_queue(
+        eProsimaUDPSocket& socket)
+{
+    std::lock_guard<std::mutex> lock(pending_queues_mutex_);
+    std::shared_ptr<PendingQueue>& queue = pending_queues_[getSocketPtr(socket)->native_handle()];
+    if (!queue)
+    {
+        queue = std::make_shared<PendingQueue>();
+        queue->socket = &*getSocketPtr(socket);
+    }
+    return queue;
+}
+
+bool UDPTransportInterface::send_non_blocking(
+        const octet* send_buffer,
+        uint32_t send_buffer_size,
+        eProsimaUDPSocket& socket,
+        const ip::udp::endpoint& destination,
+        const std::chrono::microseconds& timeout)
+{
+    uint32_t max_pending_bytes = mSendBufferSize != 0 ? mSendBufferSize : configuration()->sendBufferSize;
+
+    std::shared_ptr<PendingQueue> queue = get_pending_queue(socket);
+    std::unique_lock<std::mutex> lock(queue->mutex);
+
+    // Pending datagrams should leave before this one to keep the order
+    bool queue_empty = flush_pending_queue_nts(*queue);
+    if (!queue_empty && queue->bytes + send_buffer_size > max_pending_bytes)
+    {
+        // Backpressure: throttle the sender until the socket drains or the blocking time expires.
+        // The queue is unlocked meanwhile, so the flush thread can keep draining it.
+        lock.unlock();
+        std::vector<PollFd> poll_fds(1, writable_poll_fd(getSocketPtr(socket)->native_handle()));
+        wait_writable(poll_fds, timeout);
+        lock.lock();
+        queue_empty = flush_pending_queue_nts(*queue);
+    }
+
+    if (queue_empty)
+    {
+        asio::error_code ec;
+        send_datagram(*getSocketPtr(socket), send_buffer, send_buffer_size, destination, ec);
+        if (!ec)
+        {
+            return true;
+        }
+
+        if ((ec.value() != asio::error::would_block) &&
+                (ec.value() != asio::error::try_again))
+        {
+            logWarning(RTPS_MSG_OUT, ec.message());
+            return false;
+        }
+
+        ++would_block_count_;
+    }
+
+    if (queue->bytes + send_buffer_size > max_pending_bytes)
+    {
+        // Same as a datagram lost on the network: best-effort writers ignore it and reliable ones repair it
+        ++dropped_datagrams_count_;
+        logInfo(RTPS_MSG_OUT, "UDP send would have blocked and pending queue is full. Packet is dropped.");
+        return true;
+    }
+
+    queue->datagrams.push_back({ std::vector<octet>(send_buffer, send_buffer + send_buffer_size), destination });
+    queue->bytes += send_buffer_size;
+    queued_bytes_ += send_buffer_size;
+    lock.unlock();
+
+    if (queue_empty)
+    {
+        notify_pending_datagrams();
+    }
+    return true;
+}
+
+bool UDPTransportInterface::flush_pending_queue_nts(
+        PendingQueue& queue)
+{
+    while (!queue.datagrams.empty() && queue.socket != nullptr)
+    {
+        PendingDatagram& datagram = queue.datagrams.front();
+
+        asio::error_code ec;
+        send_datagram(*queue.socket, datagram.data.data(), static_cast<uint32_t>(datagram.data.size()),
+                datagram.destination, ec);
+        if (!!ec)
+        {
+            if ((ec.value() == asio::error::would_block) ||
+                    (ec.value() == asio::error::try_again))
+            {
+                ++would_block_count_;
+                return false;
+            }
+
+            logWarning(RTPS_MSG_OUT, ec.message());
+        }
+
+        uint32_t size = static_cast<uint32_t>(datagram.data.size());
+        queue.bytes -= size;
+        queued_bytes_ -= size;
+        queue.datagrams.pop_front();
+    }
+
+    return queue.datagrams.empty();
+}
+
+void UDPTransportInterface::notify_pending_datagrams()
+{
+    std::lock_guard<std::mutex> lock(pending_queues_mutex_);
+    if (!pending_flush_stop_ && !pending_flush_thread_.joinable())
+    {
+        pending_flush_thread_ = std::thread(&UDPTransportInterface::run_pending_flush, this);
+    }
+    pending_flush_cv_.notify_one();
+}
+
+void UDPTransportInterface::run_pending_flush()
+{
+    std::vector<std::shared_ptr<PendingQueue>> queues;
+    std::vector<PollFd> poll_fds;
+
+    std::unique_lock<std::mutex> lock(pending_queues_mutex_);
+    while (!pending_flush_stop_)
+    {
+        queues.clear();
+        poll_fds.clear();
+        for (auto& entry : pending_queues_)
+        {
+            std::lock_guard<std::mutex> queue_lock(entry.second->mutex);
+            if (!entry.second->datagrams.empty())
+            {
+                queues.push_back(entry.second);
+                poll_fds.push_back(writable_poll_fd(entry.first));
+            }
+        }
+
+        if (queues.empty())
+        {
+            pending_flush_cv_.wait(lock);
+            continue;
+        }
+
+        // Wait for any of the sockets to become writable, retrying all of them at least every period
+        lock.unlock();
+        bool writable = wait_writable(poll_fds, pending_flush_period);
+        bool drained = false;
+        for (auto& queue : queues)
+        {
+            std::lock_guard<std::mutex> queue_lock(queue->mutex);
+            uint32_t bytes = queue->bytes;
+            flush_pending_queue_nts(*queue);
+            drained |= queue->bytes < bytes;
+        }
+        lock.lock();
+
+        if (writable && !drained && !pending_flush_stop_)
+        {
+            // Reported writable but still full: do not spin, retry on the next period
+            pending_flush_cv_.wait_for(lock, pending_flush_period);
+        }
+    }
+}
+
 /**
  * Invalidate all selector entries containing certain multicast locator.
  *
@@ -130,6 +130,8 @@ UDPv4Transport::UDPv4Transport()
 
 UDPv4Transport::~UDPv4Transport()
 {
+    // The flush thread sends through this transport, so it is stopped before destroying it
+    UDPTransportInterface::shutdown();
     clean();
 }
 
@@ -523,7 +525,10 @@ bool UDPv4Transport::is_local_locator(
         return true;
     }
 
-    for (const IPFinder::info_IP& localInterface : currentInterfaces)
+    // The interfaces are taken from the shared snapshot, so changes after init are followed
+    std::vector<IPFinder::info_IP> local_interfaces;
+    get_ipv4s(local_interfaces);
+    for (const IPFinder::info_IP& localInterface : local_interfaces)
     {
         if (IPLocator::compareAddress(locator, localInterface.locator))
         {
@@ -115,6 +115,8 @@ UDPv6Transport::UDPv6Transport()
 
 UDPv6Transport::~UDPv6Transport()
 {
+    // The flush thread sends through this transport, so it is stopped before destroying it
+    UDPTransportInterface::shutdown();
     clean();
 }
 
@@ -488,7 +490,10 @@ bool UDPv6Transport::is_local_locator(
         return true;
     }
 
-    for (const IPFinder::info_IP& localInterface : currentInterfaces)
+    // The interfaces are taken from the shared snapshot, so changes after init are followed
+    std::vector<IPFinder::info_IP> local_interfaces;
+    get_ipv6s(local_interfaces);
+    for (const IPFinder::info_IP& localInterface : local_interfaces)
     {
         if (IPLocator::compareAddress(localInterface.locator, locator))
         {
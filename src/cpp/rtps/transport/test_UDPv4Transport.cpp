@@ -14,6 +14,9 @@
 
 #include <asio.hpp>
 #include <fastdds/rtps/transport/test_UDPv4Transport.h>
+#include <fastdds/dds/log/Log.hpp>
+#include <fastrtps/utils/IPLocator.h>
+#include <algorithm>
 #include <cstdlib>
 #include <functional>
 
@@ -29,12 +32,15 @@ using CDRMessage_t = fastrtps::rtps::CDRMessage_t;
 using SubmessageHeader_t = fastrtps::rtps::SubmessageHeader_t;
 using SequenceNumber_t = fastrtps::rtps::SequenceNumber_t;
 using EntityId_t = fastrtps::rtps::EntityId_t;
+using GUID_t = fastrtps::rtps::GUID_t;
+using IPLocator = fastrtps::rtps::IPLocator;
 
 std::vector<std::vector<octet>> test_UDPv4Transport::test_UDPv4Transport_DropLog;
 uint32_t test_UDPv4Transport::test_UDPv4Transport_DropLogLength = 0;
 bool test_UDPv4Transport::test_UDPv4Transport_ShutdownAllNetwork = false;
 bool test_UDPv4Transport::always_drop_participant_builtin_topic_data = false;
 bool test_UDPv4Transport::simulate_no_interfaces = false;
+test_UDPv4Transport::UserTraffic test_UDPv4Transport::user_traffic;
 
 test_UDPv4Transport::test_UDPv4Transport(
         const test_UDPv4TransportDescriptor& descriptor)
@@ -54,7 +60,33 @@ test_UDPv4Transport::test_UDPv4Transport(
     , percentage_of_messages_to_drop_(descriptor.percentageOfMessagesToDrop)
     , messages_filter_(descriptor.messages_filter_)
     , sequence_number_data_messages_to_drop_(descriptor.sequenceNumberDataMessagesToDrop)
+    , random_(descriptor.impairmentsSeed)
+    , track_user_traffic_(descriptor.trackUserTraffic)
+    , delayed_stop_(false)
 {
+    for (const auto& impairment : descriptor.impairments)
+    {
+        ImpairmentState& state = impairments_[impairment.first];
+        state.config = impairment.second;
+
+        // Two-state (Gilbert-Elliott) model: every datagram is lost while on a burst, none otherwise.
+        // The probabilities of the transitions keep the mean burst length and the overall loss percentage.
+        uint8_t loss = state.config.lossPercentage;
+        if (loss > 0 && loss < 100)
+        {
+            state.leave_burst = 100.0 / std::max(state.config.meanBurstLength, 1u);
+            state.enter_burst = state.leave_burst * loss / (100.0 - loss);
+            if (state.enter_burst > 100.0)
+            {
+                // Bursts this short cannot reach the loss percentage, so they are made longer
+                state.enter_burst = 100.0;
+                state.leave_burst = 100.0 * (100.0 - loss) / loss;
+                logWarning(RTPS_MSG_OUT, "Mean burst length " << state.config.meanBurstLength << " of port " <<
+                        impairment.first << " is too short for a loss of " << static_cast<uint32_t>(loss) <<
+                        "%, using " << 100.0 / state.leave_burst);
+            }
+        }
+    }
     test_UDPv4Transport_DropLogLength = 0;
     test_UDPv4Transport_ShutdownAllNetwork = false;
     UDPv4Transport::mSendBufferSize = descriptor.sendBufferSize;
@@ -67,6 +99,32 @@ test_UDPv4Transport::test_UDPv4Transport(
     test_UDPv4Transport_DropLogLength = descriptor.dropLogLength;
 }
 
+test_UDPv4Transport::~test_UDPv4Transport()
+{
+    {
+        std::lock_guard<std::mutex> lock(delayed_mutex_);
+        delayed_stop_ = true;
+    }
+    delayed_cv_.notify_all();
+
+    if (delayed_thread_.joinable())
+    {
+        delayed_thread_.join();
+    }
+}
+
+void test_UDPv4Transport::UserTraffic::reset()
+{
+    datas = 0;
+    data_bytes = 0;
+    repair_datas = 0;
+    repair_bytes = 0;
+    heartbeats = 0;
+    acknacks = 0;
+    gaps = 0;
+    impaired_drops = 0;
+}
+
 test_UDPv4TransportDescriptor::test_UDPv4TransportDescriptor()
     : SocketTransportDescriptor(s_maximumMessageSize, s_maximumInitialPeersRange)
     , dropDataMessagesPercentage(0)
@@ -103,7 +161,10 @@ test_UDPv4TransportDescriptor::test_UDPv4TransportDescriptor()
                 return false;
             }),
     sequenceNumberDataMessagesToDrop(),
-    dropLogLength(0)
+    dropLogLength(0),
+    impairments(),
+    impairmentsSeed(0),
+    trackUserTraffic(false)
 {
 }
 
@@ -181,15 +242,134 @@ bool test_UDPv4Transport::send(
         bool only_multicast_purpose,
         const std::chrono::microseconds& timeout)
 {
+    if (track_user_traffic_)
+    {
+        account_user_traffic(send_buffer, send_buffer_size, remote_locator);
+    }
+
     if (packet_should_drop(send_buffer, send_buffer_size))
     {
         log_drop(send_buffer, send_buffer_size);
         return true;
     }
-    else
+
+    if (!impairments_.empty())
+    {
+        std::chrono::microseconds delay(0);
+        if (apply_impairment(remote_locator, delay))
+        {
+            ++user_traffic.impaired_drops;
+            log_drop(send_buffer, send_buffer_size);
+            return true;
+        }
+
+        if (delay.count() > 0)
+        {
+            delay_datagram(send_buffer, send_buffer_size, remote_locator, delay);
+            return true;
+        }
+    }
+
+    return UDPv4Transport::send(send_buffer, send_buffer_size, socket, remote_locator, only_multicast_purpose,
+                   timeout);
+}
+
+bool test_UDPv4Transport::apply_impairment(
+        const Locator_t& remote_locator,
+        std::chrono::microseconds& delay)
+{
+    std::lock_guard<std::mutex> lock(impairments_mutex_);
+
+    auto it = impairments_.find(IPLocator::getPhysicalPort(remote_locator));
+    if (it == impairments_.end())
+    {
+        it = impairments_.find(0);
+        if (it == impairments_.end())
+        {
+            return false;
+        }
+    }
+
+    ImpairmentState& state = it->second;
+    const test_UDPv4TransportDescriptor::Impairment& config = state.config;
+    std::uniform_real_distribution<double> percentage(0.0, 100.0);
+
+    if (config.lossPercentage >= 100)
+    {
+        return true;
+    }
+    if (config.lossPercentage > 0)
+    {
+        state.in_burst = state.in_burst ?
+                percentage(random_) >= state.leave_burst : percentage(random_) < state.enter_burst;
+        if (state.in_burst)
+        {
+            return true;
+        }
+    }
+
+    delay = config.delay;
+    if (config.reorderPercentage > 0 && percentage(random_) < config.reorderPercentage)
+    {
+        delay += config.reorderDelay;
+    }
+
+    return false;
+}
+
+void test_UDPv4Transport::delay_datagram(
+        const octet* send_buffer,
+        uint32_t send_buffer_size,
+        const Locator_t& remote_locator,
+        const std::chrono::microseconds& delay)
+{
+    std::lock_guard<std::mutex> lock(delayed_mutex_);
+
+    if (!delayed_thread_.joinable())
+    {
+        delayed_socket_.reset(new eProsimaUDPSocket(createUDPSocket(io_service_)));
+        getSocketPtr(*delayed_socket_)->open(generate_protocol());
+        delayed_thread_ = std::thread(&test_UDPv4Transport::send_delayed_datagrams, this);
+    }
+
+    DelayedDatagram datagram;
+    datagram.data.assign(send_buffer, send_buffer + send_buffer_size);
+    datagram.destination = remote_locator;
+    delayed_datagrams_.emplace(std::chrono::steady_clock::now() + delay, std::move(datagram));
+    delayed_cv_.notify_one();
+}
+
+void test_UDPv4Transport::send_delayed_datagrams()
+{
+    std::unique_lock<std::mutex> lock(delayed_mutex_);
+    while (!delayed_stop_)
     {
-        return UDPv4Transport::send(send_buffer, send_buffer_size, socket, remote_locator, only_multicast_purpose,
-                       timeout);
+        if (delayed_datagrams_.empty())
+        {
+            delayed_cv_.wait(lock);
+            continue;
+        }
+
+        auto first = delayed_datagrams_.begin();
+        if (std::chrono::steady_clock::now() < first->first)
+        {
+            delayed_cv_.wait_until(lock, first->first);
+            continue;
+        }
+
+        DelayedDatagram datagram = std::move(first->second);
+        delayed_datagrams_.erase(first);
+        lock.unlock();
+
+        asio::error_code ec;
+        getSocketPtr(*delayed_socket_)->send_to(asio::buffer(datagram.data.data(), datagram.data.size()),
+                generate_endpoint(datagram.destination, IPLocator::getPhysicalPort(datagram.destination)), 0, ec);
+        if (!!ec)
+        {
+            logWarning(RTPS_MSG_OUT, ec.message());
+        }
+
+        lock.lock();
     }
 }
 
@@ -388,6 +568,110 @@ bool test_UDPv4Transport::packet_should_drop(
     return false;
 }
 
+static bool is_user_entity(
+        const EntityId_t& entity_id)
+{
+    // Builtin and vendor specific entities have any of the two upper bits of their kind set
+    return 0 == (entity_id.value[3] & 0xC0);
+}
+
+void test_UDPv4Transport::account_user_traffic(
+        const octet* send_buffer,
+        uint32_t send_buffer_size,
+        const Locator_t& remote_locator)
+{
+    if (send_buffer_size < RTPSMESSAGE_HEADER_SIZE || send_buffer[0] != 'R' || send_buffer[1] != 'T' ||
+            send_buffer[2] != 'P' || send_buffer[3] != 'S')
+    {
+        return;
+    }
+
+    CDRMessage_t cdrMessage(send_buffer_size);
+    memcpy(cdrMessage.buffer, send_buffer, send_buffer_size);
+    cdrMessage.length = send_buffer_size;
+
+    GUID_t writer_guid;
+    memcpy(writer_guid.guidPrefix.value, &send_buffer[8], fastrtps::rtps::GuidPrefix_t::size);
+    cdrMessage.pos = RTPSMESSAGE_HEADER_SIZE;
+
+    uint32_t port = IPLocator::getPhysicalPort(remote_locator);
+    SubmessageHeader_t header;
+    while (cdrMessage.pos < cdrMessage.length && ReadSubmessageHeader(cdrMessage, header))
+    {
+        uint32_t next_pos = cdrMessage.pos + header.submessageLength;
+        uint64_t bytes = header.submessageLength + RTPSMESSAGE_SUBMESSAGEHEADER_SIZE;
+        EntityId_t reader_id;
+        SequenceNumber_t sequence_number;
+
+        switch (header.submessageId)
+        {
+            case fastrtps::rtps::DATA:
+            case fastrtps::rtps::DATA_FRAG:
+                cdrMessage.pos += 8;
+                fastrtps::rtps::CDRMessage::readEntityId(&cdrMessage, &writer_guid.entityId);
+                fastrtps::rtps::CDRMessage::readInt32(&cdrMessage, &sequence_number.high);
+                fastrtps::rtps::CDRMessage::readUInt32(&cdrMessage, &sequence_number.low);
+                if (is_user_entity(writer_guid.entityId))
+                {
+                    ++user_traffic.datas;
+                    user_traffic.data_bytes += bytes;
+
+                    // Fragments of the same sample share its sequence number, so they are told apart by their
+                    // numbers, which start at 1. A DATA carries the whole sample.
+                    uint32_t first_fragment = 1;
+                    uint32_t last_fragment = 1;
+                    if (header.submessageId == fastrtps::rtps::DATA_FRAG)
+                    {
+                        uint16_t fragments = 0;
+                        fastrtps::rtps::CDRMessage::readUInt32(&cdrMessage, &first_fragment);
+                        fastrtps::rtps::CDRMessage::readUInt16(&cdrMessage, &fragments);
+                        last_fragment = first_fragment + std::max<uint16_t>(fragments, 1u) - 1;
+                    }
+
+                    std::lock_guard<std::mutex> lock(user_traffic_mutex_);
+                    std::pair<SequenceNumber_t, uint32_t>& highest = highest_sent_[std::make_pair(port, writer_guid)];
+                    if (std::make_pair(sequence_number, first_fragment) <= highest)
+                    {
+                        ++user_traffic.repair_datas;
+                        user_traffic.repair_bytes += bytes;
+                    }
+                    else
+                    {
+                        highest = std::make_pair(sequence_number, last_fragment);
+                    }
+                }
+                break;
+
+            case fastrtps::rtps::HEARTBEAT:
+            case fastrtps::rtps::GAP:
+                cdrMessage.pos += 4;
+                fastrtps::rtps::CDRMessage::readEntityId(&cdrMessage, &writer_guid.entityId);
+                if (is_user_entity(writer_guid.entityId))
+                {
+                    ++(header.submessageId == fastrtps::rtps::HEARTBEAT ? user_traffic.heartbeats : user_traffic.gaps);
+                }
+                break;
+
+            case fastrtps::rtps::ACKNACK:
+                fastrtps::rtps::CDRMessage::readEntityId(&cdrMessage, &reader_id);
+                if (is_user_entity(reader_id))
+                {
+                    ++user_traffic.acknacks;
+                }
+                break;
+
+            default:
+                break;
+        }
+
+        if (header.is_last)
+        {
+            break;
+        }
+        cdrMessage.pos = next_pos;
+    }
+}
+
 bool test_UDPv4Transport::log_drop(
         const octet* buffer,
         uint32_t size)
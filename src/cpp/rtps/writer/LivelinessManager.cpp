@@ -28,6 +28,11 @@ LivelinessManager::LivelinessManager(
             },
         0)
 {
+    for (size_t i = 0; i < num_kind_assertions; ++i)
+    {
+        kind_alive_[i].store(false, std::memory_order_relaxed);
+        kind_assertion_[i].store(0, std::memory_order_relaxed);
+    }
 }
 
 LivelinessManager::~LivelinessManager()
@@ -61,6 +66,7 @@ bool LivelinessManager::add_writer(
         }
     }
     writers_.emplace_back(guid, kind, lease_duration);
+    update_kind_alive(kind);
     return true;
 }
 
@@ -80,6 +86,7 @@ bool LivelinessManager::remove_writer(
             if (--writer.count == 0)
             {
                 writers_.remove(writer);
+                update_kind_alive(kind);
 
                 if (callback_ != nullptr)
                 {
@@ -110,10 +117,7 @@ bool LivelinessManager::remove_writer(
                         return true;
                     }
 
-                    // Some times the interval could be negative if a writer expired during the call to this function
-                    // Once in this situation there is not much we can do but let asio timers expire inmediately
-                    auto interval = timer_owner_->time - steady_clock::now();
-                    timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
+                    update_timer_interval();
                     timer_.restart_timer();
                 }
                 return true;
@@ -129,6 +133,16 @@ bool LivelinessManager::assert_liveliness(
         LivelinessQosPolicyKind kind,
         Duration_t lease_duration)
 {
+    if (!manage_automatic_ && kind == LivelinessQosPolicyKind::AUTOMATIC_LIVELINESS_QOS)
+    {
+        return false;
+    }
+
+    if (record_kind_assertion(kind))
+    {
+        return true;
+    }
+
     std::unique_lock<std::mutex> lock(mutex_);
 
     ResourceLimitedVector<LivelinessData>::iterator wit;
@@ -141,6 +155,14 @@ bool LivelinessManager::assert_liveliness(
         return false;
     }
 
+    if (wit->kind == LivelinessQosPolicyKind::MANUAL_BY_TOPIC_LIVELINESS_QOS &&
+            wit->status == LivelinessData::WriterStatus::ALIVE)
+    {
+        // Its deadline is only delayed, so the timer will be re-armed when it expires
+        wit->time = steady_clock::now() + nanoseconds(wit->lease_duration.to_ns());
+        return true;
+    }
+
     timer_.cancel_timer();
 
     if (wit->kind == LivelinessQosPolicyKind::MANUAL_BY_PARTICIPANT_LIVELINESS_QOS ||
@@ -158,6 +180,7 @@ bool LivelinessManager::assert_liveliness(
     {
         assert_writer_liveliness(*wit);
     }
+    update_kind_alive(wit->kind);
 
     // Updates the timer owner
     if (!calculate_next())
@@ -166,10 +189,7 @@ bool LivelinessManager::assert_liveliness(
         return false;
     }
 
-    // Some times the interval could be negative if a writer expired during the call to this function
-    // Once in this situation there is not much we can do but let asio timers expire inmediately
-    auto interval = timer_owner_->time - steady_clock::now();
-    timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
+    update_timer_interval();
     timer_.restart_timer();
 
     return true;
@@ -178,14 +198,19 @@ bool LivelinessManager::assert_liveliness(
 bool LivelinessManager::assert_liveliness(
         LivelinessQosPolicyKind kind)
 {
-    std::unique_lock<std::mutex> lock(mutex_);
-
     if (!manage_automatic_ && kind == LivelinessQosPolicyKind::AUTOMATIC_LIVELINESS_QOS)
     {
         logWarning(RTPS_WRITER, "Liveliness manager not managing automatic writers, writer not added");
         return false;
     }
 
+    if (record_kind_assertion(kind))
+    {
+        return true;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
     if (writers_.empty())
     {
         return true;
@@ -200,6 +225,7 @@ bool LivelinessManager::assert_liveliness(
             assert_writer_liveliness(writer);
         }
     }
+    update_kind_alive(kind);
 
     // Updates the timer owner
     if (!calculate_next())
@@ -210,10 +236,7 @@ bool LivelinessManager::assert_liveliness(
         return false;
     }
 
-    // Some times the interval could be negative if a writer expired during the call to this function
-    // Once in this situation there is not much we can do but let asio timers expire inmediately
-    auto interval = timer_owner_->time - steady_clock::now();
-    timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
+    update_timer_interval();
     timer_.restart_timer();
 
     return true;
@@ -232,6 +255,7 @@ bool LivelinessManager::calculate_next()
     {
         if (it->status == LivelinessData::WriterStatus::ALIVE)
         {
+            apply_kind_assertion(*it);
             if (it->time < min_time)
             {
                 min_time = it->time;
@@ -253,22 +277,47 @@ bool LivelinessManager::timer_expired()
         return false;
     }
 
+    // Writers may have been asserted since the timer was armed, so the owner could have changed
+    if (!calculate_next())
+    {
+        return false;
+    }
+
+    LivelinessData* owner = timer_owner_;
+    steady_clock::time_point now = steady_clock::now();
+    if (owner->time > now)
+    {
+        update_timer_interval();
+        return true;
+    }
+
+    if (owner->kind != LivelinessQosPolicyKind::MANUAL_BY_TOPIC_LIVELINESS_QOS)
+    {
+        // Stop recording assertions of this kind without the mutex, and check none was recorded meanwhile
+        kind_alive_[owner->kind].store(false, std::memory_order_seq_cst);
+        apply_kind_assertion(*owner);
+        if (owner->time > now)
+        {
+            update_kind_alive(owner->kind);
+            calculate_next();
+            update_timer_interval();
+            return true;
+        }
+    }
+
     if (callback_ != nullptr)
     {
-        callback_(timer_owner_->guid,
-                timer_owner_->kind,
-                timer_owner_->lease_duration,
+        callback_(owner->guid,
+                owner->kind,
+                owner->lease_duration,
                 -1,
                 1);
     }
-    timer_owner_->status = LivelinessData::WriterStatus::NOT_ALIVE;
+    owner->status = LivelinessData::WriterStatus::NOT_ALIVE;
 
     if (calculate_next())
     {
-        // Some times the interval could be negative if a writer expired during the call to this function
-        // Once in this situation there is not much we can do but let asio timers expire inmediately
-        auto interval = timer_owner_->time - steady_clock::now();
-        timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
+        update_timer_interval();
         return true;
     }
 
@@ -336,6 +385,72 @@ void LivelinessManager::assert_writer_liveliness(
     writer.time = steady_clock::now() + nanoseconds(writer.lease_duration.to_ns());
 }
 
+void LivelinessManager::apply_kind_assertion(
+        LivelinessData& writer)
+{
+    if (writer.kind == LivelinessQosPolicyKind::MANUAL_BY_TOPIC_LIVELINESS_QOS)
+    {
+        return;
+    }
+
+    steady_clock::time_point asserted(duration_cast<steady_clock::duration>(
+                nanoseconds(kind_assertion_[writer.kind].load(std::memory_order_seq_cst))));
+    steady_clock::time_point time = asserted + duration_cast<steady_clock::duration>(
+        nanoseconds(writer.lease_duration.to_ns()));
+    if (time > writer.time)
+    {
+        writer.time = time;
+    }
+}
+
+bool LivelinessManager::record_kind_assertion(
+        LivelinessQosPolicyKind kind)
+{
+    if (kind == LivelinessQosPolicyKind::MANUAL_BY_TOPIC_LIVELINESS_QOS ||
+            !kind_alive_[kind].load(std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    // The store must be ordered before the second load, as the timer stops this path before reading the assertion
+    kind_assertion_[kind].store(
+        duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count(),
+        std::memory_order_seq_cst);
+    return kind_alive_[kind].load(std::memory_order_seq_cst);
+}
+
+void LivelinessManager::update_kind_alive(
+        LivelinessQosPolicyKind kind)
+{
+    if (kind == LivelinessQosPolicyKind::MANUAL_BY_TOPIC_LIVELINESS_QOS)
+    {
+        return;
+    }
+
+    bool all_alive = false;
+    for (const LivelinessData& writer : writers_)
+    {
+        if (writer.kind == kind)
+        {
+            if (writer.status != LivelinessData::WriterStatus::ALIVE)
+            {
+                all_alive = false;
+                break;
+            }
+            all_alive = true;
+        }
+    }
+    kind_alive_[kind].store(all_alive, std::memory_order_seq_cst);
+}
+
+void LivelinessManager::update_timer_interval()
+{
+    // Some times the interval could be negative if a writer expired during the call to this function
+    // Once in this situation there is not much we can do but let asio timers expire inmediately
+    auto interval = timer_owner_->time - steady_clock::now();
+    timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
+}
+
 const ResourceLimitedVector<LivelinessData>& LivelinessManager::get_liveliness_data() const
 {
     return writers_;
@@ -23,6 +23,9 @@
 
 #include <fastdds/rtps/history/WriterHistory.h>
 #include <fastdds/rtps/messages/RTPSMessageCreator.h>
+#include <fastdds/rtps/resources/AsyncWriterThread.h>
+#include <fastdds/rtps/resources/TimedEvent.h>
+#include <fastrtps/utils/TimeConversion.h>
 
 #include <rtps/history/BasicPayloadPool.hpp>
 #include <rtps/history/CacheChangePool.h>
@@ -44,13 +47,14 @@ RTPSWriter::RTPSWriter(
     : Endpoint(impl, guid, att.endpoint)
     , mp_history(hist)
     , mp_listener(listen)
-    , is_async_(att.mode == SYNCHRONOUS_WRITER ? false : true)
+    , is_async_(att.mode == SYNCHRONOUS_WRITER ? att.batch.enabled : true)
     , locator_selector_(att.matched_readers_allocation)
     , all_remote_readers_(att.matched_readers_allocation)
     , all_remote_participants_(att.matched_readers_allocation)
     , liveliness_kind_(att.liveliness_kind)
     , liveliness_lease_duration_(att.liveliness_lease_duration)
     , liveliness_announcement_period_(att.liveliness_announcement_period)
+    , batch_(att.batch)
 {
     PoolConfig cfg = PoolConfig::from_history_attributes(hist->m_att);
     std::shared_ptr<IChangePool> change_pool;
@@ -85,13 +89,14 @@ RTPSWriter::RTPSWriter(
     : Endpoint(impl, guid, att.endpoint)
     , mp_history(hist)
     , mp_listener(listen)
-    , is_async_(att.mode == SYNCHRONOUS_WRITER ? false : true)
+    , is_async_(att.mode == SYNCHRONOUS_WRITER ? att.batch.enabled : true)
     , locator_selector_(att.matched_readers_allocation)
     , all_remote_readers_(att.matched_readers_allocation)
     , all_remote_participants_(att.matched_readers_allocation)
     , liveliness_kind_(att.liveliness_kind)
     , liveliness_lease_duration_(att.liveliness_lease_duration)
     , liveliness_announcement_period_(att.liveliness_announcement_period)
+    , batch_(att.batch)
 {
     init(payload_pool, change_pool);
 }
@@ -111,11 +116,23 @@ void RTPSWriter::init(
     mp_history->mp_writer = this;
     mp_history->mp_mutex = &mp_mutex;
 
+    if (batch_.enabled && batch_.max_flush_delay < c_TimeInfinite)
+    {
+        batch_flush_event_ = new TimedEvent(mp_RTPSParticipant->getEventResource(), [&]() -> bool
+                        {
+                            flush_batch();
+                            return false;
+                        },
+                        TimeConv::Duration_t2MilliSecondsDouble(batch_.max_flush_delay));
+    }
+
     logInfo(RTPS_WRITER, "RTPSWriter created");
 }
 
 RTPSWriter::~RTPSWriter()
 {
+    assert(batch_flush_event_ == nullptr);
+
     logInfo(RTPS_WRITER, "RTPSWriter destructor");
 
     // Deletion of the events has to be made in child destructor.
@@ -129,6 +146,86 @@ RTPSWriter::~RTPSWriter()
     mp_history->mp_mutex = nullptr;
 }
 
+void RTPSWriter::wake_up_async_thread(
+        CacheChange_t* change,
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+{
+    if (batch_.enabled && change->getFragmentCount() == 0)
+    {
+        ++batch_pending_samples_;
+        batch_pending_bytes_ += change->serializedPayload.length;
+
+        bool batch_is_full = (batch_.max_samples > 0 && batch_pending_samples_ >= batch_.max_samples) ||
+                batch_pending_bytes_ >= batch_.max_bytes;
+        if (!batch_is_full)
+        {
+            // The delay counts from the first change of the batch
+            if (1 == batch_pending_samples_ && batch_flush_event_ != nullptr)
+            {
+                batch_flush_event_->restart_timer(max_blocking_time);
+            }
+            return;
+        }
+    }
+
+    pending_batch_sent_nts();
+    mp_RTPSParticipant->async_thread().wake_up(this, max_blocking_time);
+}
+
+void RTPSWriter::pending_batch_sent_nts()
+{
+    if (batch_pending_samples_ > 0)
+    {
+        batch_pending_samples_ = 0;
+        batch_pending_bytes_ = 0;
+        if (batch_flush_event_ != nullptr)
+        {
+            batch_flush_event_->cancel_timer();
+        }
+    }
+}
+
+void RTPSWriter::flush_batch()
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+
+    if (batch_pending_samples_ > 0)
+    {
+        pending_batch_sent_nts();
+        mp_RTPSParticipant->async_thread().wake_up(this);
+    }
+}
+
+void RTPSWriter::destroy_batch_flush_event()
+{
+    if (batch_flush_event_ != nullptr)
+    {
+        delete(batch_flush_event_);
+        batch_flush_event_ = nullptr;
+    }
+}
+
+bool RTPSWriter::serialize_intraprocess_sample(
+        CacheChange_t* change)
+{
+    if (!is_serialized(change) && !change->intraprocess_sample->serialize(*change))
+    {
+        logError(RTPS_WRITER, "Cannot serialize change " << change->sequenceNumber << " of writer " << m_guid <<
+                ", it will not be sent to remote destinations");
+        return false;
+    }
+
+    return true;
+}
+
+void RTPSWriter::serialize_intraprocess_samples()
+{
+    for (History::iterator it = mp_history->changesBegin(); it != mp_history->changesEnd(); ++it)
+    {
+        serialize_intraprocess_sample(*it);
+    }
+}
+
 CacheChange_t* RTPSWriter::new_change(
         const std::function<uint32_t()>& dataCdrSerializedSize,
         ChangeKind_t changeKind,
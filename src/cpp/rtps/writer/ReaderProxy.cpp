@@ -80,6 +80,12 @@ ReaderProxy::ReaderProxy(
 bool ReaderProxy::rtps_is_relevant(
         CacheChange_t* change) const
 {
+    // Changes whose shared sample could not be serialized are only delivered to local readers
+    if (!locator_info_.is_local_reader() && !RTPSWriter::is_serialized(change))
+    {
+        return false;
+    }
+
     if (nullptr != writer_->reader_data_filter())
     {
         bool ret = writer_->reader_data_filter()->is_relevant(*change, guid());
@@ -398,7 +404,7 @@ bool ReaderProxy::process_initial_acknack()
 {
     if (is_local_reader())
     {
-        return convert_status_on_all_changes(UNACKNOWLEDGED, UNSENT);
+        return 0 < convert_status_on_all_changes(UNACKNOWLEDGED, UNSENT);
     }
 
     return true;
@@ -495,15 +501,37 @@ bool ReaderProxy::mark_fragment_as_sent_for_change(
 
 bool ReaderProxy::perform_nack_supression()
 {
-    return convert_status_on_all_changes(UNDERWAY, UNACKNOWLEDGED);
+    return 0 < convert_status_on_all_changes(UNDERWAY, UNACKNOWLEDGED);
 }
 
-bool ReaderProxy::perform_acknack_response()
+bool ReaderProxy::perform_acknack_response(
+        std::vector<SequenceNumber_t>* repairs)
 {
-    return convert_status_on_all_changes(REQUESTED, UNSENT);
+    if (nullptr != repairs)
+    {
+        for (const ChangeForReader_t& change : changes_for_reader_)
+        {
+            if (REQUESTED == change.getStatus() && change.isRelevant() && change.isValid())
+            {
+                repairs->push_back(change.getSequenceNumber());
+            }
+        }
+    }
+
+    uint32_t n_requested = convert_status_on_all_changes(REQUESTED, UNSENT);
+    if (0 < n_requested)
+    {
+        fastdds::statistics::EndpointStatistics* statistics = writer_->statistics();
+        if (nullptr != statistics)
+        {
+            statistics->resent_datas.add(n_requested);
+        }
+    }
+
+    return 0 < n_requested;
 }
 
-bool ReaderProxy::convert_status_on_all_changes(
+uint32_t ReaderProxy::convert_status_on_all_changes(
         ChangeForReaderStatus_t previous,
         ChangeForReaderStatus_t next)
 {
@@ -512,17 +540,17 @@ bool ReaderProxy::convert_status_on_all_changes(
     // NOTE: This is only called for REQUESTED=>UNSENT (acknack response) or
     //       UNDERWAY=>UNACKNOWLEDGED (nack supression)
 
-    bool at_least_one_modified = false;
+    uint32_t modified = 0;
     for (ChangeForReader_t& change : changes_for_reader_)
     {
         if (change.getStatus() == previous)
         {
-            at_least_one_modified = true;
+            ++modified;
             change.setStatus(next);
         }
     }
 
-    return at_least_one_modified;
+    return modified;
 }
 
 void ReaderProxy::change_has_been_removed(
@@ -49,6 +49,7 @@
 
 #include "../builtin/discovery/database/DiscoveryDataBase.hpp"
 
+#include <algorithm>
 #include <mutex>
 #include <vector>
 #include <stdexcept>
@@ -210,6 +211,7 @@ void StatefulWriter::init(
                         return send_periodic_heartbeat();
                     },
                     TimeConv::Time_t2MilliSecondsDouble(m_times.heartbeatPeriod));
+    set_heartbeat_period_nts_(TimeConv::Time_t2MilliSecondsDouble(m_times.heartbeatPeriod));
 
     nack_response_event_ = new TimedEvent(pimpl->getEventResource(), [&]() -> bool
                     {
@@ -254,6 +256,8 @@ StatefulWriter::~StatefulWriter()
         nack_response_event_ = nullptr;
     }
 
+    destroy_batch_flush_event();
+
     mp_RTPSParticipant->async_thread().unregister_writer(this);
 
     // After unregistering writer from AsyncWriterThread, delete all flow_controllers because they register the writer in
@@ -297,6 +301,17 @@ void StatefulWriter::unsent_change_added_to_history(
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
 
+    if (there_are_remote_readers_)
+    {
+        serialize_intraprocess_sample(change);
+    }
+
+    fastdds::statistics::EndpointStatistics* statistics = this->statistics();
+    if (nullptr != statistics)
+    {
+        statistics->on_sample(change->serializedPayload.length);
+    }
+
     if (liveliness_lease_duration_ < c_TimeInfinite)
     {
         mp_RTPSParticipant->wlp()->assert_liveliness(
@@ -368,7 +383,11 @@ void StatefulWriter::unsent_change_added_to_history(
                                     }
                                 };
 
-                        send_data_or_fragments(group, change, expectsInlineQos, sent_fun);
+                        // Remote readers get a GAP for a change that could not be serialized
+                        if (is_serialized(change))
+                        {
+                            send_data_or_fragments(group, change, expectsInlineQos, sent_fun);
+                        }
                         send_heartbeat_nts_(all_remote_readers_.size(), group, disable_positive_acks_);
                     }
 
@@ -407,7 +426,7 @@ void StatefulWriter::unsent_change_added_to_history(
                             {
                                 logError(RTPS_WRITER, "Cannot send large messages on separate sending mode");
                             }
-                            else
+                            else if (is_serialized(change))
                             {
                                 if (!group.add_data(*change, it->expects_inline_qos()))
                                 {
@@ -458,7 +477,7 @@ void StatefulWriter::unsent_change_added_to_history(
 
             if (m_pushMode)
             {
-                mp_RTPSParticipant->async_thread().wake_up(this, max_blocking_time);
+                wake_up_async_thread(change, max_blocking_time);
             }
         }
 
@@ -585,6 +604,9 @@ void StatefulWriter::send_any_unsent_changes()
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
 
+    // Every unsent change is sent now, including the ones waiting for their batch to be flushed
+    pending_batch_sent_nts();
+
     bool activateHeartbeatPeriod = false;
     SequenceNumber_t max_sequence = mp_history->next_sequence_number();
 
@@ -614,6 +636,9 @@ void StatefulWriter::send_any_unsent_changes()
         periodic_hb_event_->restart_timer();
     }
 
+    // Repairs not coalesced on this round have already been sent separately
+    pending_repairs_.clear();
+
     // On VOLATILE writers, remove auto-acked (best effort readers) changes
     check_acked_status();
 
@@ -669,6 +694,8 @@ void StatefulWriter::send_changes_separatedly(
     // c) there is at least one matched reader
     // d) separate sending is enabled
 
+    send_coalesced_repairs(activateHeartbeatPeriod);
+
     for (ReaderProxy* remoteReader : matched_readers_)
     {
         // If there are no changes for this reader, simply jump to the next one
@@ -793,6 +820,127 @@ void StatefulWriter::send_changes_separatedly(
     } // Readers loop
 }
 
+void StatefulWriter::send_coalesced_repairs(
+        bool& activateHeartbeatPeriod)
+{
+    if (pending_repairs_.empty())
+    {
+        return;
+    }
+
+    // Group the requesting readers of each change
+    std::sort(pending_repairs_.begin(), pending_repairs_.end());
+
+    NetworkFactory& network = mp_RTPSParticipant->network_factory();
+    RTPSMessageGroup group(mp_RTPSParticipant, this, *this);
+    History::const_iterator hint = mp_history->changesBegin();
+    std::vector<ReaderProxy*> readers;
+
+    auto repair = pending_repairs_.begin();
+    while (repair != pending_repairs_.end())
+    {
+        SequenceNumber_t seq = repair->first;
+
+        // Readers still waiting for the change
+        readers.clear();
+        for (; repair != pending_repairs_.end() && repair->first == seq; ++repair)
+        {
+            for (ReaderProxy* remote_reader : matched_readers_)
+            {
+                bool is_irrelevant = false;
+                if (remote_reader->guid() == repair->second &&
+                        remote_reader->change_is_unsent(seq, is_irrelevant))
+                {
+                    readers.push_back(remote_reader);
+                    break;
+                }
+            }
+        }
+
+        if (readers.size() < 2)
+        {
+            continue;
+        }
+
+        // Look for the multicast locator shared by most of the readers
+        const Locator_t* shared_locator = nullptr;
+        size_t shared_count = 1;
+        for (ReaderProxy* remote_reader : readers)
+        {
+            for (const Locator_t& locator : remote_reader->locator_selector_entry()->multicast)
+            {
+                size_t count = std::count_if(readers.begin(), readers.end(),
+                                [&locator](
+                                    ReaderProxy* reader)
+                                {
+                                    const auto& multicast = reader->locator_selector_entry()->multicast;
+                                    return std::find(multicast.begin(), multicast.end(), locator) != multicast.end();
+                                });
+                if (count > shared_count)
+                {
+                    shared_locator = &locator;
+                    shared_count = count;
+                }
+            }
+        }
+
+        if (nullptr == shared_locator)
+        {
+            continue;
+        }
+
+        // Fragmented changes are left to each reader, as their repairs only include the requested fragments
+        CacheChange_t* change = nullptr;
+        hint = mp_history->get_change_nts(seq, getGuid(), &change, hint);
+        if (nullptr == change || change->getFragmentSize() != 0)
+        {
+            continue;
+        }
+
+        Locator_t locator = *shared_locator;
+        readers.erase(std::remove_if(readers.begin(), readers.end(),
+                [&locator](
+                    ReaderProxy* reader)
+                {
+                    const auto& multicast = reader->locator_selector_entry()->multicast;
+                    return std::find(multicast.begin(), multicast.end(), locator) == multicast.end();
+                }), readers.end());
+
+        locator_selector_.reset(false);
+        bool inline_qos = false;
+        for (ReaderProxy* remote_reader : readers)
+        {
+            locator_selector_.enable(remote_reader->guid());
+            inline_qos |= remote_reader->expects_inline_qos();
+        }
+
+        if (locator_selector_.state_has_changed())
+        {
+            group.flush_and_reset();
+            network.select_locators(locator_selector_);
+            compute_selected_guids();
+        }
+
+        if (send_data_or_fragments(group, change, inline_qos, null_sent_fun))
+        {
+            for (ReaderProxy* remote_reader : readers)
+            {
+                remote_reader->set_change_to_status(seq, UNDERWAY, true);
+            }
+            activateHeartbeatPeriod = true;
+            ++coalesced_repairs_count_;
+            saved_retransmissions_count_ += readers.size() - 1;
+        }
+    }
+
+    pending_repairs_.clear();
+    group.flush_and_reset();
+
+    locator_selector_.reset(true);
+    network.select_locators(locator_selector_);
+    compute_selected_guids();
+}
+
 void StatefulWriter::send_all_intraprocess_changes(
         SequenceNumber_t max_sequence)
 {
@@ -1307,6 +1455,10 @@ bool StatefulWriter::matched_reader_add(
             {
                 update_reader_info(true);
             }
+            if (nullptr != mp_listener)
+            {
+                mp_listener->on_reader_discovery(this, ReaderDiscoveryInfo::CHANGED_QOS_READER, rdata.guid(), &rdata);
+            }
             return false;
         }
     }
@@ -1340,6 +1492,18 @@ bool StatefulWriter::matched_reader_add(
     matched_readers_.push_back(rp);
     update_reader_info(true);
 
+    // Remote readers need the serialized payload of the changes shared with local readers
+    if (!rp->is_local_reader())
+    {
+        serialize_intraprocess_samples();
+    }
+
+    // Let the listener know about the reader before evaluating the relevance of the history for it
+    if (nullptr != mp_listener)
+    {
+        mp_listener->on_reader_discovery(this, ReaderDiscoveryInfo::DISCOVERED_READER, rdata.guid(), &rdata);
+    }
+
     RTPSMessageGroup group(mp_RTPSParticipant, this, rp->message_sender());
 
     // Add initial heartbeat to message group
@@ -1529,6 +1693,11 @@ bool StatefulWriter::matched_reader_remove(
         rproxy->stop();
         matched_readers_pool_.push_back(rproxy);
 
+        if (nullptr != mp_listener)
+        {
+            mp_listener->on_reader_discovery(this, ReaderDiscoveryInfo::REMOVED_READER, reader_guid, nullptr);
+        }
+
         lock.unlock();
         check_acked_status();
 
@@ -1569,6 +1738,11 @@ bool StatefulWriter::matched_reader_lookup(
     return false;
 }
 
+bool StatefulWriter::matched_readers_are_local() const
+{
+    return there_are_local_readers_ && !there_are_remote_readers_;
+}
+
 bool StatefulWriter::is_acked_by_all(
         const CacheChange_t* change) const
 {
@@ -1827,10 +2001,10 @@ void StatefulWriter::updateTimes(
         const WriterTimes& times)
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
-    if (m_times.heartbeatPeriod != times.heartbeatPeriod)
-    {
-        periodic_hb_event_->update_interval(times.heartbeatPeriod);
-    }
+    bool heartbeat_changed = m_times.heartbeatPeriod != times.heartbeatPeriod ||
+            m_times.adaptiveHeartbeat != times.adaptiveHeartbeat ||
+            m_times.minHeartbeatPeriod != times.minHeartbeatPeriod ||
+            m_times.maxHeartbeatPeriod != times.maxHeartbeatPeriod;
     if (m_times.nackResponseDelay != times.nackResponseDelay)
     {
         if (nack_response_event_ != nullptr)
@@ -1850,6 +2024,13 @@ void StatefulWriter::updateTimes(
         }
     }
     m_times = times;
+
+    if (heartbeat_changed)
+    {
+        // Restart the adaptation from the configured period
+        last_announced_seq_ = c_SequenceNumber_Unknown;
+        set_heartbeat_period_nts_(TimeConv::Time_t2MilliSecondsDouble(m_times.heartbeatPeriod));
+    }
 }
 
 void StatefulWriter::add_flow_controller(
@@ -1904,15 +2085,47 @@ bool StatefulWriter::send_periodic_heartbeat(
 
             if (unacked_changes)
             {
+                size_t number_of_readers = all_remote_readers_.size();
+                if (m_times.adaptiveHeartbeat)
+                {
+                    // Only the readers lagging behind are sent the heartbeat
+                    locator_selector_.reset(false);
+                    number_of_readers = 0;
+                    for (ReaderProxy* remote_reader : matched_readers_)
+                    {
+                        if (!remote_reader->is_local_reader() && remote_reader->has_unacknowledged())
+                        {
+                            locator_selector_.enable(remote_reader->guid());
+                            ++number_of_readers;
+                        }
+                    }
+
+                    if (locator_selector_.state_has_changed())
+                    {
+                        mp_RTPSParticipant->network_factory().select_locators(locator_selector_);
+                        compute_selected_guids();
+                    }
+                }
+
                 try
                 {
                     RTPSMessageGroup group(mp_RTPSParticipant, this, *this);
-                    send_heartbeat_nts_(all_remote_readers_.size(), group, disable_positive_acks_, liveliness);
+                    send_heartbeat_nts_(number_of_readers, group, disable_positive_acks_, liveliness);
                 }
                 catch (const RTPSMessageGroup::timeout&)
                 {
                     logError(RTPS_WRITER, "Max blocking time reached");
                 }
+
+                if (m_times.adaptiveHeartbeat)
+                {
+                    locator_selector_.reset(true);
+                    if (locator_selector_.state_has_changed())
+                    {
+                        mp_RTPSParticipant->network_factory().select_locators(locator_selector_);
+                        compute_selected_guids();
+                    }
+                }
             }
         }
     }
@@ -1938,9 +2151,100 @@ bool StatefulWriter::send_periodic_heartbeat(
         }
     }
 
+    if (m_times.adaptiveHeartbeat && !liveliness)
+    {
+        adapt_heartbeat_period_nts_();
+    }
+
     return unacked_changes;
 }
 
+void StatefulWriter::adapt_heartbeat_period_nts_()
+{
+    bool unacked_changes = false;
+    // Acknowledgement low mark of the slowest remote reliable reader
+    SequenceNumber_t slowest_low_mark = c_SequenceNumber_Unknown;
+    SequenceNumber_t max_seq = get_seq_num_max();
+    if (max_seq != c_SequenceNumber_Unknown)
+    {
+        for (ReaderProxy* remote_reader : matched_readers_)
+        {
+            SequenceNumber_t low_mark = remote_reader->changes_low_mark();
+            if (remote_reader->is_remote_and_reliable() && low_mark < max_seq)
+            {
+                if (!unacked_changes || low_mark < slowest_low_mark)
+                {
+                    slowest_low_mark = low_mark;
+                }
+                unacked_changes = true;
+            }
+        }
+    }
+
+    if (!unacked_changes)
+    {
+        // All readers are in sync, so the periodic heartbeat stops. The next one starts from the configured period.
+        last_announced_seq_ = c_SequenceNumber_Unknown;
+        set_heartbeat_period_nts_(TimeConv::Time_t2MilliSecondsDouble(m_times.heartbeatPeriod));
+    }
+    else
+    {
+        if (last_announced_seq_ != c_SequenceNumber_Unknown && !heartbeat_period_shortened_)
+        {
+            if (slowest_low_mark < last_announced_seq_)
+            {
+                // Readers did not acknowledge what the last heartbeat announced, so they are asked more often
+                set_heartbeat_period_nts_(heartbeat_period_ms_ / 2);
+            }
+            else
+            {
+                // Readers keep up with the data without repairs, so they are asked less often
+                set_heartbeat_period_nts_(heartbeat_period_ms_ * 2);
+            }
+        }
+
+        last_announced_seq_ = max_seq;
+    }
+
+    heartbeat_period_shortened_ = false;
+}
+
+void StatefulWriter::shorten_heartbeat_period_on_nack_nts_()
+{
+    // Samples are being lost, so their recovery is sped up once per periodic heartbeat
+    if (m_times.adaptiveHeartbeat && !heartbeat_period_shortened_)
+    {
+        heartbeat_period_shortened_ = true;
+        set_heartbeat_period_nts_(heartbeat_period_ms_ / 2);
+    }
+}
+
+void StatefulWriter::set_heartbeat_period_nts_(
+        double period_ms)
+{
+    if (m_times.adaptiveHeartbeat)
+    {
+        period_ms = std::max(period_ms, TimeConv::Time_t2MilliSecondsDouble(m_times.minHeartbeatPeriod));
+        period_ms = std::min(period_ms, TimeConv::Time_t2MilliSecondsDouble(m_times.maxHeartbeatPeriod));
+    }
+
+    if (period_ms != heartbeat_period_ms_)
+    {
+        double previous_period_ms = heartbeat_period_ms_;
+        heartbeat_period_ms_ = period_ms;
+        periodic_hb_event_->update_interval_millisec(period_ms);
+
+        // An armed timer keeps its previous expiration, so it is rearmed when the new period makes it expire
+        // earlier. A stopped timer is left stopped, as its expiration lies beyond the previous period.
+        double remaining_ms = periodic_hb_event_->getRemainingTimeMilliSec();
+        if (period_ms < remaining_ms && remaining_ms <= previous_period_ms)
+        {
+            periodic_hb_event_->cancel_timer();
+            periodic_hb_event_->restart_timer();
+        }
+    }
+}
+
 void StatefulWriter::send_heartbeat_to_nts(
         ReaderProxy& remoteReaderProxy,
         bool liveliness,
@@ -2007,6 +2311,15 @@ void StatefulWriter::send_heartbeat_nts_(
     message_group.add_heartbeat(firstSeq, lastSeq, m_heartbeatCount, final, liveliness);
     // Update calculate of heartbeat piggyback.
     currentUsageSendBufferSize_ = static_cast<int32_t>(sendBufferSize_);
+    if (m_times.adaptiveHeartbeat)
+    {
+        // Piggyback heartbeats are placed more often while the period is shortened
+        double ratio = heartbeat_period_ms_ / TimeConv::Time_t2MilliSecondsDouble(m_times.heartbeatPeriod);
+        if (ratio < 1.0)
+        {
+            currentUsageSendBufferSize_ = static_cast<int32_t>(sendBufferSize_ * ratio);
+        }
+    }
 
     logInfo(RTPS_WRITER, getGuid().entityId << " Sending Heartbeat (" << firstSeq << " - " << lastSeq << ")" );
 }
@@ -2051,12 +2364,25 @@ void StatefulWriter::perform_nack_response()
     std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
     bool must_wake_up_async_thread = false;
 
+    // With separate sending, keep track of the repairs requested by each reader, so the ones requested by several
+    // readers sharing a multicast locator are sent only once.
+    std::vector<SequenceNumber_t> repairs;
+    bool coalesce_repairs = m_separateSendingEnabled && m_pushMode && all_remote_readers_.size() > 1;
+
     for (ReaderProxy* remote_reader : matched_readers_)
     {
-        if (remote_reader->perform_acknack_response() || remote_reader->are_there_gaps())
+        bool track_repairs = coalesce_repairs && remote_reader->is_remote_and_reliable();
+        repairs.clear();
+        if (remote_reader->perform_acknack_response(track_repairs ? &repairs : nullptr) ||
+                remote_reader->are_there_gaps())
         {
             must_wake_up_async_thread = true;
         }
+
+        for (const SequenceNumber_t& seq : repairs)
+        {
+            pending_repairs_.emplace_back(seq, remote_reader->guid());
+        }
     }
 
     if (must_wake_up_async_thread)
@@ -2110,6 +2436,7 @@ bool StatefulWriter::process_acknack(
                             if (remote_reader->requested_changes_set(sn_set) || remote_reader->are_there_gaps())
                             {
                                 nack_response_event_->restart_timer();
+                                shorten_heartbeat_period_on_nack_nts_();
                             }
                             else if (!final_flag)
                             {
@@ -2176,6 +2503,7 @@ bool StatefulWriter::process_nack_frag(
                 if (remote_reader->process_nack_frag(reader_guid, ack_count, seq_num, fragments_state))
                 {
                     nack_response_event_->restart_timer();
+                    shorten_heartbeat_period_on_nack_nts_();
                 }
                 break;
             }
@@ -152,6 +152,8 @@ StatelessWriter::~StatelessWriter()
         controller->disable();
     }
 
+    destroy_batch_flush_event();
+
     mp_RTPSParticipant->async_thread().unregister_writer(this);
 
     // After unregistering writer from AsyncWriterThread, delete all flow_controllers because they register the writer in
@@ -229,6 +231,12 @@ void StatelessWriter::unsent_change_added_to_history(
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
 
+    fastdds::statistics::EndpointStatistics* statistics = this->statistics();
+    if (nullptr != statistics)
+    {
+        statistics->on_sample(change->serializedPayload.length);
+    }
+
     if (liveliness_lease_duration_ < c_TimeInfinite)
     {
         mp_RTPSParticipant->wlp()->assert_liveliness(
@@ -237,6 +245,13 @@ void StatelessWriter::unsent_change_added_to_history(
             liveliness_lease_duration_);
     }
 
+    // Remote destinations are skipped when the shared sample cannot be serialized
+    bool serialized = true;
+    if (there_are_remote_readers_ || !fixed_locators_.empty())
+    {
+        serialized = serialize_intraprocess_sample(change);
+    }
+
     if (!fixed_locators_.empty() || matched_readers_.size() > 0)
     {
         if (!isAsync())
@@ -252,7 +267,7 @@ void StatelessWriter::unsent_change_added_to_history(
                         {
                             intraprocess_delivery(change, it);
                         }
-                        else
+                        else if (serialized)
                         {
                             RTPSMessageGroup group(mp_RTPSParticipant, this, it, max_blocking_time);
 
@@ -288,7 +303,7 @@ void StatelessWriter::unsent_change_added_to_history(
                         }
                     }
 
-                    if (there_are_remote_readers_ || !fixed_locators_.empty())
+                    if (serialized && (there_are_remote_readers_ || !fixed_locators_.empty()))
                     {
                         RTPSMessageGroup group(mp_RTPSParticipant, this, *this, max_blocking_time);
 
@@ -327,7 +342,7 @@ void StatelessWriter::unsent_change_added_to_history(
         else
         {
             unsent_changes_.push_back(ChangeForReader_t(change));
-            mp_RTPSParticipant->async_thread().wake_up(this, max_blocking_time);
+            wake_up_async_thread(change, max_blocking_time);
         }
     }
     else
@@ -376,6 +391,11 @@ bool StatelessWriter::change_removed_by_history(
     return true;
 }
 
+bool StatelessWriter::matched_readers_are_local() const
+{
+    return !matched_readers_.empty() && !there_are_remote_readers_ && fixed_locators_.empty();
+}
+
 bool StatelessWriter::is_acked_by_all(
         const CacheChange_t* change) const
 {
@@ -458,6 +478,9 @@ void StatelessWriter::send_any_unsent_changes()
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
 
+    // Every unsent change is sent now, including the ones waiting for their batch to be flushed
+    pending_batch_sent_nts();
+
     bool remote_destinations = there_are_remote_readers_ || !fixed_locators_.empty();
     bool no_flow_controllers = flow_controllers_.empty() && mp_RTPSParticipant->getFlowControllers().empty();
     if (!remote_destinations || no_flow_controllers)
@@ -541,7 +564,7 @@ void StatelessWriter::send_all_unsent_changes()
             }
         }
 
-        if (remote_destinations)
+        if (remote_destinations && is_serialized(cache_change))
         {
             if (!add_change_to_rtps_group(group, &unsentChange, is_inline_qos_expected_))
             {
@@ -666,7 +689,11 @@ void StatelessWriter::send_unsent_changes_with_flow_control()
                 // Notify the controllers
                 FlowController::NotifyControllersChangeSent(changeToSend.cacheChange);
 
-                if (changeToSend.fragmentNumber != 0)
+                if (!is_serialized(changeToSend.cacheChange))
+                {
+                    // The shared sample could not be serialized, so the change is only delivered to local readers
+                }
+                else if (changeToSend.fragmentNumber != 0)
                 {
                     if (!group.add_data_frag(*changeToSend.cacheChange, changeToSend.fragmentNumber,
                             is_inline_qos_expected_))
@@ -774,6 +801,12 @@ bool StatelessWriter::matched_reader_add(
 
     update_reader_info(true);
 
+    // Remote readers need the serialized payload of the changes shared with local readers
+    if (!new_reader->is_local_reader())
+    {
+        serialize_intraprocess_samples();
+    }
+
     if ((mp_history->getHistorySize() > 0) &&
             (data.m_qos.m_durability.kind >= TRANSIENT_LOCAL_DURABILITY_QOS))
     {
@@ -807,6 +840,7 @@ bool StatelessWriter::set_fixed_locators(
 
     fixed_locators_.push_back(locator_list);
     mp_RTPSParticipant->createSenderResources(fixed_locators_);
+    serialize_intraprocess_samples();
 
     return true;
 }
@@ -1121,6 +1121,14 @@ XMLP_ret XMLParser::getXMLWriterQosPolicies(
                 return XMLP_ret::XML_ERROR;
             }
         }
+        else if (strcmp(name, BATCH) == 0)
+        {
+            // batch
+            if (XMLP_ret::XML_OK != getXMLBatchQos(p_aux0, qos.m_batch, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else if (strcmp(name, DEADLINE) == 0)
         {
             // deadline
@@ -2219,6 +2227,68 @@ XMLP_ret XMLParser::getXMLPublishModeQos(
     return XMLP_ret::XML_OK;
 }
 
+XMLP_ret XMLParser::getXMLBatchQos(
+        tinyxml2::XMLElement* elem,
+        BatchQosPolicy& batch,
+        uint8_t ident)
+{
+    /*
+        <xs:complexType name="batchQosPolicyType">
+            <xs:all minOccurs="0">
+                <xs:element name="enabled" type="boolType" minOccurs="0"/>
+                <xs:element name="max_samples" type="uint32Type" minOccurs="0"/>
+                <xs:element name="max_data_bytes" type="uint32Type" minOccurs="0"/>
+                <xs:element name="max_flush_delay" type="durationType" minOccurs="0"/>
+            </xs:all>
+        </xs:complexType>
+     */
+    tinyxml2::XMLElement* p_aux0 = nullptr;
+    const char* name = nullptr;
+    for (p_aux0 = elem->FirstChildElement(); p_aux0 != NULL; p_aux0 = p_aux0->NextSiblingElement())
+    {
+        name = p_aux0->Name();
+        if (strcmp(name, ENABLED) == 0)
+        {
+            // enabled - boolType
+            if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &batch.enable, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, MAX_SAMPLES) == 0)
+        {
+            // max_samples - uint32Type
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &batch.max_samples, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, MAX_DATA_BYTES) == 0)
+        {
+            // max_data_bytes - uint32Type
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &batch.max_data_bytes, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, MAX_FLUSH_DELAY) == 0)
+        {
+            // max_flush_delay - durationType
+            if (XMLP_ret::XML_OK != getXMLDuration(p_aux0, batch.max_flush_delay, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else
+        {
+            logError(XMLPARSER, "Invalid element found into 'batchQosPolicyType'. Name: " << name);
+            return XMLP_ret::XML_ERROR;
+        }
+    }
+
+    return XMLP_ret::XML_OK;
+}
+
 XMLP_ret XMLParser::getXMLDuration(
         tinyxml2::XMLElement* elem,
         Duration_t& duration,
@@ -2373,6 +2443,9 @@ XMLP_ret XMLParser::getXMLWriterTimes(
                 <xs:element name="heartbeatPeriod" type="durationType" minOccurs="0"/>
                 <xs:element name="nackResponseDelay" type="durationType" minOccurs="0"/>
                 <xs:element name="nackSupressionDuration" type="durationType" minOccurs="0"/>
+                <xs:element name="adaptiveHeartbeat" type="boolType" minOccurs="0"/>
+                <xs:element name="minHeartbeatPeriod" type="durationType" minOccurs="0"/>
+                <xs:element name="maxHeartbeatPeriod" type="durationType" minOccurs="0"/>
             </xs:all>
         </xs:complexType>
      */
@@ -2413,6 +2486,30 @@ XMLP_ret XMLParser::getXMLWriterTimes(
                 return XMLP_ret::XML_ERROR;
             }
         }
+        else if (strcmp(name, ADAPTIVE_HEARTB) == 0)
+        {
+            // adaptiveHeartbeat
+            if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &times.adaptiveHeartbeat, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, MIN_HEARTB_PERIOD) == 0)
+        {
+            // minHeartbeatPeriod
+            if (XMLP_ret::XML_OK != getXMLDuration(p_aux0, times.minHeartbeatPeriod, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, MAX_HEARTB_PERIOD) == 0)
+        {
+            // maxHeartbeatPeriod
+            if (XMLP_ret::XML_OK != getXMLDuration(p_aux0, times.maxHeartbeatPeriod, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else
         {
             logError(XMLPARSER, "Invalid element found into 'writerTimesType'. Name: " << name);
@@ -3641,6 +3738,16 @@ XMLP_ret XMLParser::getXMLSubscriberAttributes(
                 return XMLP_ret::XML_ERROR;
             }
         }
+        else if (strcmp(name, MAX_INCOMPLETE_SAMPLES_MEMORY) == 0)
+        {
+            // maxIncompleteSamplesMemory - uint32Type
+            unsigned int max_memory = 0;
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &max_memory, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+            subscriber.max_incomplete_samples_memory = static_cast<uint32_t>(max_memory);
+        }
         else
         {
             logError(XMLPARSER, "Invalid element found into 'subscriberProfileType'. Name: " << name);
@@ -127,6 +127,7 @@ const char* USER_DEF_ID = "userDefinedID";
 const char* ENTITY_ID = "entityID";
 const char* MATCHED_SUBSCRIBERS_ALLOCATION = "matchedSubscribersAllocation";
 const char* MATCHED_PUBLISHERS_ALLOCATION = "matchedPublishersAllocation";
+const char* MAX_INCOMPLETE_SAMPLES_MEMORY = "maxIncompleteSamplesMemory";
 
 ///
 const char* PROPERTIES = "properties";
@@ -159,6 +160,9 @@ const char* INIT_HEARTB_DELAY = "initialHeartbeatDelay";
 const char* HEARTB_PERIOD = "heartbeatPeriod";
 const char* NACK_RESP_DELAY = "nackResponseDelay";
 const char* NACK_SUPRESSION = "nackSupressionDuration";
+const char* ADAPTIVE_HEARTB = "adaptiveHeartbeat";
+const char* MIN_HEARTB_PERIOD = "minHeartbeatPeriod";
+const char* MAX_HEARTB_PERIOD = "maxHeartbeatPeriod";
 const char* BY_NAME = "durationbyname";
 const char* BY_VAL = "durationbyval";
 const char* SECONDS = "sec";
@@ -190,6 +194,9 @@ const char* TOPIC_DATA = "topicData";
 const char* GROUP_DATA = "groupData";
 const char* PUB_MODE = "publishMode";
 const char* DISABLE_POSITIVE_ACKS = "disablePositiveAcks";
+const char* BATCH = "batch";
+const char* MAX_DATA_BYTES = "max_data_bytes";
+const char* MAX_FLUSH_DELAY = "max_flush_delay";
 
 const char* SYNCHRONOUS = "SYNCHRONOUS";
 const char* ASYNCHRONOUS = "ASYNCHRONOUS";
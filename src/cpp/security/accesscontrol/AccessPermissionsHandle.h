@@ -21,6 +21,7 @@
 #include <fastdds/rtps/security/common/Handle.h>
 #include <fastdds/rtps/common/Token.h>
 #include <security/accesscontrol/PermissionsTypes.h>
+#include <security/accesscontrol/AccessRulesIndex.h>
 #include <fastdds/rtps/security/accesscontrol/ParticipantSecurityAttributes.h>
 #include <fastdds/rtps/security/accesscontrol/EndpointSecurityAttributes.h>
 
@@ -53,6 +54,16 @@ public:
 
     static const char* const class_id_;
 
+    //! Compiles the grant rules and governance topic rules into the lookup indexes.
+    void build_indexes()
+    {
+        publishes_index_.build(grant.rules, &Rule::publishes);
+        subscribes_index_.build(grant.rules, &Rule::subscribes);
+        relays_index_.build(grant.rules, &Rule::relays);
+        governance_index_.build(governance_topic_rules_);
+        decisions_.clear();
+    }
+
     X509_STORE* store_;
     std::string sn;
     std::string algo;
@@ -62,6 +73,12 @@ public:
     ParticipantSecurityAttributes governance_rule_;
     std::vector<std::pair<std::string, EndpointSecurityAttributes>> governance_topic_rules_;
     Grant grant;
+    TopicRulesIndex publishes_index_;
+    TopicRulesIndex subscribes_index_;
+    TopicRulesIndex relays_index_;
+    GovernanceTopicIndex governance_index_;
+    //! Decisions taken on remote endpoints of this subject
+    mutable AccessDecisionCache decisions_;
 };
 
 typedef HandleImpl<AccessPermissions> AccessPermissionsHandle;
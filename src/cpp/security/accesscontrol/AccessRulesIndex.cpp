@@ -0,0 +1,264 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file AccessRulesIndex.cpp
+ */
+
+#include <security/accesscontrol/AccessRulesIndex.h>
+#include <fastrtps/utils/StringMatching.h>
+
+#include <cstring>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastrtps::rtps::security;
+
+constexpr size_t TopicRulesIndex::npos;
+constexpr size_t AccessDecisionCache::max_entries;
+
+static bool has_wildcards(
+        const char* name)
+{
+    return strpbrk(name, "*?[") != nullptr;
+}
+
+// Iterative matching of '*' and '?' wildcards, with the same semantics fnmatch has without flags
+static bool match_simple_glob(
+        const char* pattern,
+        const char* name)
+{
+    const char* star_pattern = nullptr;
+    const char* star_name = nullptr;
+
+    while (*name != '\0')
+    {
+        if (*pattern == '*')
+        {
+            star_pattern = ++pattern;
+            star_name = name;
+        }
+        else if (*pattern == '?' || *pattern == *name)
+        {
+            ++pattern;
+            ++name;
+        }
+        else if (star_pattern != nullptr)
+        {
+            pattern = star_pattern;
+            name = ++star_name;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    while (*pattern == '*')
+    {
+        ++pattern;
+    }
+
+    return *pattern == '\0';
+}
+
+GlobPattern::GlobPattern(
+        const std::string& expression)
+    : expression_(expression)
+    , kind_(COMPLEX_GLOB)
+{
+#if !defined(_WIN32)
+    // On Windows matching is delegated to PathMatchSpec, which is not case sensitive
+    if (expression_.find('[') == std::string::npos)
+    {
+        kind_ = has_wildcards(expression_.c_str()) ? SIMPLE_GLOB : LITERAL;
+    }
+#endif // if !defined(_WIN32)
+}
+
+bool GlobPattern::matches(
+        const char* name) const
+{
+    switch (kind_)
+    {
+        case LITERAL:
+            return expression_.compare(name) == 0;
+        case SIMPLE_GLOB:
+            return match_simple_glob(expression_.c_str(), name);
+        default:
+            return StringMatching::matchPattern(expression_.c_str(), name);
+    }
+}
+
+void TopicRulesIndex::build(
+        const std::vector<Rule>& rules,
+        std::vector<Criteria> Rule::* criteria)
+{
+    exact_names_.clear();
+    globs_.clear();
+
+    for (size_t rule_index = 0; rule_index < rules.size(); ++rule_index)
+    {
+        for (const Criteria& criterion : rules[rule_index].*criteria)
+        {
+            for (const std::string& topic : criterion.topics)
+            {
+                GlobPattern pattern(topic);
+                if (pattern.is_literal())
+                {
+                    std::vector<size_t>& indexes = exact_names_[topic];
+                    if (indexes.empty() || indexes.back() != rule_index)
+                    {
+                        indexes.push_back(rule_index);
+                    }
+                }
+                else
+                {
+                    globs_.emplace_back(rule_index, std::move(pattern));
+                }
+            }
+        }
+    }
+}
+
+void GovernanceTopicIndex::build(
+        const TopicRules& rules)
+{
+    exact_names_.clear();
+    globs_.clear();
+
+    for (size_t rule_index = 0; rule_index < rules.size(); ++rule_index)
+    {
+        GlobPattern pattern(rules[rule_index].first);
+        if (pattern.is_literal())
+        {
+            // Only the first rule for a name is relevant
+            exact_names_.emplace(rules[rule_index].first, rule_index);
+        }
+        else
+        {
+            globs_.emplace_back(rule_index, std::move(pattern));
+        }
+    }
+}
+
+const EndpointSecurityAttributes* GovernanceTopicIndex::find(
+        const char* topic_name,
+        const TopicRules& rules) const
+{
+    // Topic names with wildcards may also match the rules the other way round
+    if (has_wildcards(topic_name))
+    {
+        for (const auto& rule : rules)
+        {
+            if (StringMatching::matchString(rule.first.c_str(), topic_name))
+            {
+                return &rule.second;
+            }
+        }
+
+        return nullptr;
+    }
+
+    size_t found = TopicRulesIndex::npos;
+
+    auto exact = exact_names_.find(topic_name);
+    if (exact != exact_names_.end())
+    {
+        found = exact->second;
+    }
+
+    for (const auto& glob : globs_)
+    {
+        if (glob.first >= found)
+        {
+            break;
+        }
+
+        if (glob.second.matches(topic_name))
+        {
+            found = glob.first;
+            break;
+        }
+    }
+
+    return found < rules.size() ? &rules[found].second : nullptr;
+}
+
+std::string AccessDecisionCache::make_key(
+        char check,
+        uint32_t domain_id,
+        const char* topic_name,
+        const std::vector<std::string>& partitions)
+{
+    std::string key(1, check);
+    key.append(reinterpret_cast<const char*>(&domain_id), sizeof(domain_id));
+    key.append(topic_name);
+
+    // Separators cannot be part of topic or partition names
+    for (const std::string& partition : partitions)
+    {
+        key.push_back('\0');
+        key.append(partition);
+    }
+
+    return key;
+}
+
+bool AccessDecisionCache::get(
+        const std::string& key,
+        AccessDecision& decision)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    auto it = index_.find(key);
+    if (it == index_.end())
+    {
+        return false;
+    }
+
+    entries_.splice(entries_.begin(), entries_, it->second);
+    decision = it->second->second;
+    return true;
+}
+
+void AccessDecisionCache::put(
+        const std::string& key,
+        const AccessDecision& decision)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    auto it = index_.find(key);
+    if (it != index_.end())
+    {
+        it->second->second = decision;
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return;
+    }
+
+    if (entries_.size() >= max_entries)
+    {
+        index_.erase(entries_.back().first);
+        entries_.pop_back();
+    }
+
+    entries_.emplace_front(key, decision);
+    index_.emplace(key, entries_.begin());
+}
+
+void AccessDecisionCache::clear()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    index_.clear();
+    entries_.clear();
+}
@@ -0,0 +1,235 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file AccessRulesIndex.h
+ */
+#ifndef __SECURITY_ACCESSCONTROL_ACCESSRULESINDEX_H__
+#define __SECURITY_ACCESSCONTROL_ACCESSRULESINDEX_H__
+
+#include <security/accesscontrol/PermissionsTypes.h>
+#include <fastdds/rtps/security/accesscontrol/EndpointSecurityAttributes.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+namespace security {
+
+/*!
+ * Topic or partition expression compiled when the permissions and governance documents are validated.
+ * Expressions without wildcards are matched by plain comparison, and expressions using only '*' and '?' are
+ * matched without calling fnmatch. Any other expression falls back to StringMatching.
+ */
+class GlobPattern
+{
+public:
+
+    explicit GlobPattern(
+            const std::string& expression);
+
+    bool is_literal() const
+    {
+        return kind_ == LITERAL;
+    }
+
+    const std::string& expression() const
+    {
+        return expression_;
+    }
+
+    /*!
+     * Checks whether a name matches this expression.
+     * Equivalent to StringMatching::matchPattern(expression(), name).
+     */
+    bool matches(
+            const char* name) const;
+
+private:
+
+    enum Kind
+    {
+        LITERAL,
+        SIMPLE_GLOB,
+        COMPLEX_GLOB
+    };
+
+    std::string expression_;
+    Kind kind_;
+};
+
+/*!
+ * Index of the topic expressions of one kind of criteria (publish, subscribe or relay) of a list of rules.
+ * Finds the first rule whose criteria contains an expression matching a topic name, as the linear search on
+ * the rules does.
+ */
+class TopicRulesIndex
+{
+public:
+
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    void build(
+            const std::vector<Rule>& rules,
+            std::vector<Criteria> Rule::* criteria);
+
+    /*!
+     * Finds the first rule with an expression matching the topic name.
+     * @param topic_name Name of the topic.
+     * @param rule_filter Functor receiving a rule index, returning whether that rule should be considered.
+     * @return Index of the rule, or npos if none was found.
+     */
+    template<class RuleFilter>
+    size_t find(
+            const char* topic_name,
+            RuleFilter rule_filter) const
+    {
+        size_t found = npos;
+
+        auto exact = exact_names_.find(topic_name);
+        if (exact != exact_names_.end())
+        {
+            for (size_t rule_index : exact->second)
+            {
+                if (rule_filter(rule_index))
+                {
+                    found = rule_index;
+                    break;
+                }
+            }
+        }
+
+        // Globs are sorted by rule index, so only those on previous rules need to be checked
+        for (const auto& glob : globs_)
+        {
+            if (glob.first >= found)
+            {
+                break;
+            }
+
+            if (glob.second.matches(topic_name) && rule_filter(glob.first))
+            {
+                found = glob.first;
+                break;
+            }
+        }
+
+        return found;
+    }
+
+private:
+
+    //! Rule indexes for each literal topic name, in ascending order
+    std::unordered_map<std::string, std::vector<size_t>> exact_names_;
+    //! Topic expressions with wildcards, with the index of their rule, in ascending rule order
+    std::vector<std::pair<size_t, GlobPattern>> globs_;
+};
+
+/*!
+ * Index of the topic rules of a governance document.
+ */
+class GovernanceTopicIndex
+{
+public:
+
+    using TopicRules = std::vector<std::pair<std::string, EndpointSecurityAttributes>>;
+
+    void build(
+            const TopicRules& rules);
+
+    /*!
+     * Finds the attributes of the first topic rule matching a topic name.
+     * @param topic_name Name of the topic.
+     * @param rules Topic rules this index was built from.
+     * @return Attributes of the topic rule, or nullptr if none was found.
+     */
+    const EndpointSecurityAttributes* find(
+            const char* topic_name,
+            const TopicRules& rules) const;
+
+private:
+
+    //! Index of the first rule for each literal topic expression
+    std::unordered_map<std::string, size_t> exact_names_;
+    //! Topic expressions with wildcards, with the index of their rule, in ascending rule order
+    std::vector<std::pair<size_t, GlobPattern>> globs_;
+};
+
+/*!
+ * Result of an access control check, as stored on the AccessDecisionCache.
+ */
+struct AccessDecision
+{
+    bool allowed = false;
+    bool relay_only = false;
+    std::string error;
+};
+
+/*!
+ * Bounded LRU cache of access control decisions taken for a subject.
+ */
+class AccessDecisionCache
+{
+public:
+
+    static constexpr size_t max_entries = 1024;
+
+    /*!
+     * Builds the key of a decision.
+     * @param check Character identifying the kind of check.
+     * @param domain_id Domain where the check applies.
+     * @param topic_name Name of the topic.
+     * @param partitions Partitions of the endpoint.
+     */
+    static std::string make_key(
+            char check,
+            uint32_t domain_id,
+            const char* topic_name,
+            const std::vector<std::string>& partitions);
+
+    bool get(
+            const std::string& key,
+            AccessDecision& decision);
+
+    void put(
+            const std::string& key,
+            const AccessDecision& decision);
+
+    void clear();
+
+private:
+
+    using Entry = std::pair<std::string, AccessDecision>;
+
+    std::mutex mutex_;
+    //! Most recently used entries first
+    std::list<Entry> entries_;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+};
+
+} //namespace security
+} //namespace rtps
+} //namespace fastrtps
+} //namespace eprosima
+
+#endif // __SECURITY_ACCESSCONTROL_ACCESSRULESINDEX_H__
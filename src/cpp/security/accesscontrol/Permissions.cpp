@@ -61,7 +61,7 @@ static bool is_domain_in_set(
 {
     bool returned_value = false;
 
-    for (auto range : domains.ranges)
+    for (const auto& range : domains.ranges)
     {
         if (range.second == 0)
         {
@@ -85,46 +85,6 @@ static bool is_domain_in_set(
     return returned_value;
 }
 
-static const EndpointSecurityAttributes* is_topic_in_sec_attributes(
-        const char* topic_name,
-        const std::vector<std::pair<std::string, EndpointSecurityAttributes>>& attributes)
-{
-    const EndpointSecurityAttributes* returned_value = nullptr;
-
-    for (auto& topic : attributes)
-    {
-        if (StringMatching::matchString(topic.first.c_str(), topic_name))
-        {
-            returned_value = &topic.second;
-            break;
-        }
-    }
-
-    return returned_value;
-}
-
-static bool is_topic_in_criterias(
-        const char* topic_name,
-        const std::vector<Criteria>& criterias)
-{
-    bool returned_value = false;
-
-    for (auto criteria_it = criterias.begin(); !returned_value &&
-            criteria_it != criterias.end(); ++criteria_it)
-    {
-        for (auto topic : (*criteria_it).topics)
-        {
-            if (StringMatching::matchPattern(topic.c_str(), topic_name))
-            {
-                returned_value = true;
-                break;
-            }
-        }
-    }
-
-    return returned_value;
-}
-
 static bool is_partition_in_criterias(
         const std::string& partition,
         const std::vector<Criteria>& criterias)
@@ -134,7 +94,7 @@ static bool is_partition_in_criterias(
     for (auto criteria_it = criterias.begin(); !returned_value &&
             criteria_it != criterias.end(); ++criteria_it)
     {
-        for (auto part : (*criteria_it).partitions)
+        for (const auto& part : (*criteria_it).partitions)
         {
             if (StringMatching::matchPattern(part.c_str(), partition.c_str()))
             {
@@ -679,7 +639,7 @@ static bool check_subject_name(
 
     if (!lih.nil())
     {
-        for (auto grant : permissions.grants)
+        for (auto& grant : permissions.grants)
         {
             if (is_validation_in_time(grant.validity))
             {
@@ -710,7 +670,7 @@ static bool check_subject_name(
         if (returned_value)
         {
             // Retry governance info.
-            for (auto rule : governance.rules)
+            for (const auto& rule : governance.rules)
             {
                 if (is_domain_in_set(domain_id, rule.domains))
                 {
@@ -735,7 +695,7 @@ static bool check_subject_name(
 
                     ah->governance_rule_.plugin_participant_attributes = plug_part_attr.mask();
 
-                    for (auto topic_rule : rule.topic_rules)
+                    for (const auto& topic_rule : rule.topic_rules)
                     {
                         std::string topic_expression = topic_rule.topic_expression;
                         EndpointSecurityAttributes security_attributes;
@@ -908,6 +868,8 @@ PermissionsHandle* Permissions::validate_local_permissions(
                 // Check subject name.
                 if (check_subject_name(identity, *ah, domain_id, rules, permissions_data, exception))
                 {
+                    (*ah)->build_indexes();
+
                     if (generate_permissions_token(*ah))
                     {
                         if (generate_credentials_token(*ah, *permissions, exception))
@@ -1061,7 +1023,7 @@ PermissionsHandle* Permissions::validate_remote_permissions(
     }
 
     Grant remote_grant;
-    for (auto grant : data.grants)
+    for (auto& grant : data.grants)
     {
         if (is_validation_in_time(grant.validity))
         {
@@ -1085,6 +1047,7 @@ PermissionsHandle* Permissions::validate_remote_permissions(
     (*handle)->grant = std::move(remote_grant);
     (*handle)->governance_rule_ = lph->governance_rule_;
     (*handle)->governance_topic_rules_ = lph->governance_topic_rules_;
+    (*handle)->build_indexes();
 
     return handle;
 }
@@ -1106,7 +1069,7 @@ bool Permissions::check_create_participant(
     }
 
     //Search an allow rule with my domain
-    for (auto rule : lah->grant.rules)
+    for (const auto& rule : lah->grant.rules)
     {
         if (rule.allow)
         {
@@ -1146,7 +1109,7 @@ bool Permissions::check_remote_participant(
     }
 
     //Search an allow rule with my domain
-    for (auto rule : rah->grant.rules)
+    for (const auto& rule : rah->grant.rules)
     {
         if (rule.allow)
         {
@@ -1186,7 +1149,7 @@ bool Permissions::check_create_datawriter(
 
     const EndpointSecurityAttributes* attributes = nullptr;
 
-    if ((attributes = is_topic_in_sec_attributes(topic_name.c_str(), lah->governance_topic_rules_)) != nullptr)
+    if ((attributes = lah->governance_index_.find(topic_name.c_str(), lah->governance_topic_rules_)) != nullptr)
     {
         if (!attributes->is_write_protected)
         {
@@ -1201,13 +1164,14 @@ bool Permissions::check_create_datawriter(
     }
 
     // Search topic
-    for (auto rule : lah->grant.rules)
+    size_t rule_index = lah->publishes_index_.find(topic_name.c_str(), [](size_t)
+                    {
+                        return true;
+                    });
+    if (rule_index != TopicRulesIndex::npos)
     {
-        if (is_topic_in_criterias(topic_name.c_str(), rule.publishes))
-        {
-            returned_value = check_rule(topic_name.c_str(), rule, partitions, rule.publishes, exception);
-            break;
-        }
+        const Rule& rule = lah->grant.rules[rule_index];
+        returned_value = check_rule(topic_name.c_str(), rule, partitions, rule.publishes, exception);
     }
 
     if (!returned_value)
@@ -1241,7 +1205,7 @@ bool Permissions::check_create_datareader(
 
     const EndpointSecurityAttributes* attributes = nullptr;
 
-    if ((attributes = is_topic_in_sec_attributes(topic_name.c_str(), lah->governance_topic_rules_)) != nullptr)
+    if ((attributes = lah->governance_index_.find(topic_name.c_str(), lah->governance_topic_rules_)) != nullptr)
     {
         if (!attributes->is_read_protected)
         {
@@ -1255,13 +1219,14 @@ bool Permissions::check_create_datareader(
         return false;
     }
 
-    for (auto rule : lah->grant.rules)
+    size_t rule_index = lah->subscribes_index_.find(topic_name.c_str(), [](size_t)
+                    {
+                        return true;
+                    });
+    if (rule_index != TopicRulesIndex::npos)
     {
-        if (is_topic_in_criterias(topic_name.c_str(), rule.subscribes))
-        {
-            returned_value = check_rule(topic_name.c_str(), rule, partitions, rule.subscribes, exception);
-            break;
-        }
+        const Rule& rule = lah->grant.rules[rule_index];
+        returned_value = check_rule(topic_name.c_str(), rule, partitions, rule.subscribes, exception);
     }
 
     if (!returned_value)
@@ -1295,7 +1260,7 @@ bool Permissions::check_remote_datawriter(
 
     const EndpointSecurityAttributes* attributes = nullptr;
 
-    if ((attributes = is_topic_in_sec_attributes(topic_name, rah->governance_topic_rules_))
+    if ((attributes = rah->governance_index_.find(topic_name, rah->governance_topic_rules_))
             != nullptr)
     {
         if (!attributes->is_write_protected)
@@ -1311,25 +1276,42 @@ bool Permissions::check_remote_datawriter(
         return false;
     }
 
-    for (auto rule : rah->grant.rules)
+    const std::vector<std::string>& partitions = publication_data.m_qos.m_partition.getNames();
+    std::string cache_key = AccessDecisionCache::make_key('w', domain_id, topic_name, partitions);
+    AccessDecision decision;
+
+    if (!rah->decisions_.get(cache_key, decision))
     {
-        if (is_domain_in_set(domain_id, rule.domains))
+        size_t rule_index = rah->publishes_index_.find(topic_name, [&](size_t index)
+                        {
+                            return is_domain_in_set(domain_id, rah->grant.rules[index].domains);
+                        });
+        if (rule_index != TopicRulesIndex::npos)
+        {
+            const Rule& rule = rah->grant.rules[rule_index];
+            decision.allowed = check_rule(topic_name, rule, partitions, rule.publishes, exception);
+        }
+
+        if (!decision.allowed)
         {
-            if (is_topic_in_criterias(topic_name, rule.publishes))
+            if (strlen(exception.what()) == 0)
             {
-                returned_value = check_rule(topic_name, rule, publication_data.m_qos.m_partition.getNames(),
-                                rule.publishes, exception);
-                break;
+                exception = _SecurityException_(topic_name + std::string(" topic not found in allow rule."));
             }
+            decision.error = exception.what();
         }
+
+        rah->decisions_.put(cache_key, decision);
+    }
+    else if (!decision.allowed)
+    {
+        exception = SecurityException(decision.error);
     }
 
+    returned_value = decision.allowed;
+
     if (!returned_value)
     {
-        if (strlen(exception.what()) == 0)
-        {
-            exception = _SecurityException_(topic_name + std::string(" topic not found in allow rule."));
-        }
         EMERGENCY_SECURITY_LOGGING("Permissions", exception.what());
     }
 
@@ -1358,7 +1340,7 @@ bool Permissions::check_remote_datareader(
 
     const EndpointSecurityAttributes* attributes = nullptr;
 
-    if ((attributes = is_topic_in_sec_attributes(topic_name, rah->governance_topic_rules_))
+    if ((attributes = rah->governance_index_.find(topic_name, rah->governance_topic_rules_))
             != nullptr)
     {
         if (!attributes->is_read_protected)
@@ -1374,36 +1356,54 @@ bool Permissions::check_remote_datareader(
         return false;
     }
 
-    for (auto rule : rah->grant.rules)
+    const std::vector<std::string>& partitions = subscription_data.m_qos.m_partition.getNames();
+    std::string cache_key = AccessDecisionCache::make_key('r', domain_id, topic_name, partitions);
+    AccessDecision decision;
+
+    if (!rah->decisions_.get(cache_key, decision))
     {
-        if (is_domain_in_set(domain_id, rule.domains))
+        auto rule_in_domain = [&](size_t index)
+                {
+                    return is_domain_in_set(domain_id, rah->grant.rules[index].domains);
+                };
+
+        // On the same rule, subscribe criteria take precedence over relay criteria
+        size_t subscribe_index = rah->subscribes_index_.find(topic_name, rule_in_domain);
+        size_t relay_index = rah->relays_index_.find(topic_name, rule_in_domain);
+
+        if (subscribe_index != TopicRulesIndex::npos && subscribe_index <= relay_index)
         {
-            const std::vector<std::string>& partitions = subscription_data.m_qos.m_partition.getNames();
-            if (is_topic_in_criterias(topic_name, rule.subscribes))
-            {
-                returned_value = check_rule(topic_name, rule, partitions, rule.subscribes, exception);
-                break;
-            }
+            const Rule& rule = rah->grant.rules[subscribe_index];
+            decision.allowed = check_rule(topic_name, rule, partitions, rule.subscribes, exception);
+        }
+        else if (relay_index != TopicRulesIndex::npos)
+        {
+            const Rule& rule = rah->grant.rules[relay_index];
+            decision.allowed = check_rule(topic_name, rule, partitions, rule.relays, exception);
+            decision.relay_only = decision.allowed;
+        }
 
-            if (is_topic_in_criterias(topic_name, rule.relays))
+        if (!decision.allowed)
+        {
+            if (strlen(exception.what()) == 0)
             {
-                returned_value = check_rule(topic_name, rule, partitions, rule.relays, exception);
-                if (returned_value)
-                {
-                    relay_only = true;
-                }
-
-                break;
+                exception = _SecurityException_(topic_name + std::string(" topic not found in allow rule."));
             }
+            decision.error = exception.what();
         }
+
+        rah->decisions_.put(cache_key, decision);
     }
+    else if (!decision.allowed)
+    {
+        exception = SecurityException(decision.error);
+    }
+
+    returned_value = decision.allowed;
+    relay_only = decision.relay_only;
 
     if (!returned_value)
     {
-        if (strlen(exception.what()) == 0)
-        {
-            exception = _SecurityException_(topic_name + std::string(" topic not found in allow rule."));
-        }
         EMERGENCY_SECURITY_LOGGING("Permissions", exception.what());
     }
 
@@ -1438,7 +1438,7 @@ bool Permissions::get_datawriter_sec_attributes(
     const AccessPermissionsHandle& lah = AccessPermissionsHandle::narrow(permissions_handle);
     const EndpointSecurityAttributes* attr = nullptr;
 
-    if ((attr = is_topic_in_sec_attributes(topic_name.c_str(), lah->governance_topic_rules_))
+    if ((attr = lah->governance_index_.find(topic_name.c_str(), lah->governance_topic_rules_))
             != nullptr)
     {
         attributes = *attr;
@@ -1463,7 +1463,7 @@ bool Permissions::get_datareader_sec_attributes(
     const AccessPermissionsHandle& lah = AccessPermissionsHandle::narrow(permissions_handle);
     const EndpointSecurityAttributes* attr = nullptr;
 
-    if ((attr = is_topic_in_sec_attributes(topic_name.c_str(), lah->governance_topic_rules_))
+    if ((attr = lah->governance_index_.find(topic_name.c_str(), lah->governance_topic_rules_))
             != nullptr)
     {
         attributes = *attr;
@@ -0,0 +1,171 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file DHKeyPool.cpp
+ */
+
+#include <security/authentication/DHKeyPool.h>
+#include <fastdds/dds/log/Log.hpp>
+
+#include <cassert>
+
+using namespace eprosima::fastrtps::rtps::security;
+
+DHKeyPool::DHKeyPool(
+        Generator generator)
+    : generator_(generator)
+{
+    assert(generator_ != nullptr);
+}
+
+DHKeyPool::~DHKeyPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+
+    for (auto& entry : keys_)
+    {
+        for (EVP_PKEY* key : entry.second.ready)
+        {
+            EVP_PKEY_free(key);
+        }
+    }
+}
+
+void DHKeyPool::reserve(
+        int type,
+        size_t size)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    Keys& keys = keys_[type];
+    keys.target = size;
+
+    while (keys.ready.size() > size)
+    {
+        EVP_PKEY_free(keys.ready.back());
+        keys.ready.pop_back();
+    }
+
+    if (size > 0 && !thread_.joinable())
+    {
+        thread_ = std::thread(&DHKeyPool::run, this);
+    }
+
+    cv_.notify_one();
+}
+
+EVP_PKEY* DHKeyPool::take(
+        int type,
+        SecurityException& exception)
+{
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        auto it = keys_.find(type);
+        if (it != keys_.end() && !it->second.ready.empty())
+        {
+            EVP_PKEY* key = it->second.ready.back();
+            it->second.ready.pop_back();
+            cv_.notify_one();
+            return key;
+        }
+    }
+
+    return generator_(type, exception);
+}
+
+size_t DHKeyPool::available(
+        int type)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    auto it = keys_.find(type);
+    return it != keys_.end() ? it->second.ready.size() : 0;
+}
+
+size_t DHKeyPool::reserved()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    size_t size = 0;
+    for (const auto& entry : keys_)
+    {
+        size += entry.second.target;
+    }
+    return size;
+}
+
+bool DHKeyPool::running()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return thread_.joinable();
+}
+
+void DHKeyPool::run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (!stop_)
+    {
+        int type = 0;
+        bool pending = false;
+        for (const auto& entry : keys_)
+        {
+            if (entry.second.ready.size() < entry.second.target)
+            {
+                type = entry.first;
+                pending = true;
+                break;
+            }
+        }
+
+        if (!pending)
+        {
+            cv_.wait(lock);
+            continue;
+        }
+
+        // Key generation is the expensive part, so it is done without holding the lock
+        lock.unlock();
+        SecurityException exception;
+        EVP_PKEY* key = generator_(type, exception);
+        lock.lock();
+
+        Keys& keys = keys_[type];
+        if (key == nullptr)
+        {
+            // Stop trying, so a broken configuration does not keep this thread spinning.
+            logWarning(SECURITY_AUTHENTICATION, "Cannot preallocate key agreement keys: " << exception.what());
+            keys.target = 0;
+        }
+        else if (stop_ || keys.ready.size() >= keys.target)
+        {
+            EVP_PKEY_free(key);
+        }
+        else
+        {
+            keys.ready.push_back(key);
+        }
+    }
+}
@@ -0,0 +1,110 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file DHKeyPool.h
+ */
+#ifndef _SECURITY_AUTHENTICATION_DHKEYPOOL_H_
+#define _SECURITY_AUTHENTICATION_DHKEYPOOL_H_
+
+#include <fastdds/rtps/security/exceptions/SecurityException.h>
+
+#include <openssl/evp.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+namespace security {
+
+/*!
+ * Pool of ephemeral key agreement keys, generated in advance by a background thread.
+ * Each key is handed out only once, so handshakes keep using a fresh key, but the cost of
+ * generating it is moved out of the thread processing the handshake.
+ */
+class DHKeyPool
+{
+public:
+
+    //! Function generating a new key of the given EVP_PKEY type
+    typedef EVP_PKEY* (* Generator)(
+            int type,
+            SecurityException& exception);
+
+    explicit DHKeyPool(
+            Generator generator);
+
+    ~DHKeyPool();
+
+    /*!
+     * Keeps a number of keys of a type ready to be taken.
+     * The background thread is started the first time this is called with a non-zero size.
+     * @param type EVP_PKEY type of the keys.
+     * @param size Number of keys to keep ready. Zero stops preallocating keys of this type.
+     */
+    void reserve(
+            int type,
+            size_t size);
+
+    /*!
+     * Takes a key of a type from the pool, generating it on the calling thread when there is none available.
+     * Ownership of the key is transferred to the caller.
+     * @param type EVP_PKEY type of the key.
+     * @param exception Filled when the key cannot be generated.
+     * @return The key, or nullptr on error.
+     */
+    EVP_PKEY* take(
+            int type,
+            SecurityException& exception);
+
+    //! Number of keys of a type currently ready on the pool
+    size_t available(
+            int type);
+
+    //! Number of keys of any type the pool keeps ready
+    size_t reserved();
+
+    //! Whether the background thread generating the keys has been started
+    bool running();
+
+private:
+
+    struct Keys
+    {
+        size_t target = 0;
+        std::vector<EVP_PKEY*> ready;
+    };
+
+    void run();
+
+    Generator generator_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::map<int, Keys> keys_;
+    std::thread thread_;
+    bool stop_ = false;
+};
+
+} //namespace security
+} //namespace rtps
+} //namespace fastrtps
+} //namespace eprosima
+
+#endif // _SECURITY_AUTHENTICATION_DHKEYPOOL_H_
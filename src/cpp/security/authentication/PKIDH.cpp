@@ -46,6 +46,7 @@
 #include <openssl/obj_mac.h>
 
 #include <cassert>
+#include <cstdlib>
 #include <algorithm>
 
 #define S1(x) #x
@@ -59,6 +60,10 @@ using namespace eprosima::fastrtps::rtps::security;
 
 using ParameterList = eprosima::fastdds::dds::ParameterList;
 
+//! Number of key agreement keys kept ready when dds.sec.auth.builtin.PKI-DH.dh_key_pool_size is not set.
+//! The pool is opt-in, so no background thread is started unless it is configured.
+static constexpr size_t default_dh_key_pool_size = 0;
+
 static const unsigned char* BN_deserialize_raw(
         BIGNUM** bn,
         const unsigned char* raw_pointer,
@@ -1129,6 +1134,11 @@ static bool generate_identity_token(
     return true;
 }
 
+PKIDH::PKIDH()
+    : dh_key_pool_(generate_dh_key)
+{
+}
+
 ValidationResult_t PKIDH::validate_local_identity(
         IdentityHandle** local_identity_handle,
         GUID_t& adjusted_participant_key,
@@ -1186,6 +1196,15 @@ ValidationResult_t PKIDH::validate_local_identity(
         password = &empty_password;
     }
 
+    size_t dh_key_pool_size = default_dh_key_pool_size;
+    std::string* dh_key_pool_size_property = PropertyPolicyHelper::find_property(auth_properties,
+                    "dh_key_pool_size");
+
+    if (dh_key_pool_size_property != nullptr)
+    {
+        dh_key_pool_size = static_cast<size_t>(std::strtoul(dh_key_pool_size_property->c_str(), nullptr, 10));
+    }
+
     PKIIdentityHandle* ih = new PKIIdentityHandle();
 
     (*ih)->store_ = load_identity_ca(*identity_ca, (*ih)->there_are_crls_, (*ih)->sn, (*ih)->algo,
@@ -1254,6 +1273,10 @@ ValidationResult_t PKIDH::validate_local_identity(
                                     (*ih)->participant_key_ = adjusted_participant_key;
                                     *local_identity_handle = ih;
 
+                                    // Requests use the local key agreement algorithm, so its keys are
+                                    // generated in advance.
+                                    dh_key_pool_.reserve(get_dh_type((*ih)->kagree_alg_), dh_key_pool_size);
+
                                     return ValidationResult_t::VALIDATION_OK;
                                 }
                             }
@@ -1429,7 +1452,7 @@ ValidationResult_t PKIDH::begin_handshake_request(
     int kagree_kind = get_dh_type((*handshake_handle_aux)->kagree_alg_);
 
     // dh1
-    if (((*handshake_handle_aux)->dhkeys_ = generate_dh_key(kagree_kind, exception)) != nullptr)
+    if (((*handshake_handle_aux)->dhkeys_ = dh_key_pool_.take(kagree_kind, exception)) != nullptr)
     {
         bproperty.name("dh1");
         bproperty.propagate(true);
@@ -1790,7 +1813,7 @@ ValidationResult_t PKIDH::begin_handshake_reply(
     (*handshake_handle_aux)->handshake_message_.binary_properties().push_back(std::move(bproperty));
 
     // dh2
-    if (((*handshake_handle_aux)->dhkeys_ = generate_dh_key(kagree_kind, exception)) != nullptr)
+    if (((*handshake_handle_aux)->dhkeys_ = dh_key_pool_.take(kagree_kind, exception)) != nullptr)
     {
         bproperty.name("dh2");
         bproperty.propagate(true);
@@ -22,6 +22,7 @@
 #include <fastdds/rtps/security/authentication/Authentication.h>
 #include <fastdds/rtps/attributes/PropertyPolicy.h>
 #include <security/authentication/PKIHandshakeHandle.h>
+#include <security/authentication/DHKeyPool.h>
 
 namespace eprosima {
 namespace fastrtps {
@@ -32,6 +33,8 @@ class PKIDH : public Authentication
 {
     public:
 
+        PKIDH();
+
         ValidationResult_t validate_local_identity(IdentityHandle** local_identity_handle,
                 GUID_t& adjusted_participant_key,
                 const uint32_t domain_id,
@@ -97,6 +100,12 @@ class PKIDH : public Authentication
         bool return_authenticated_peer_credential_token(PermissionsCredentialToken* token,
                 SecurityException& ex) override;
 
+        //! Pool of the ephemeral keys, sized by dds.sec.auth.builtin.PKI-DH.dh_key_pool_size
+        DHKeyPool& dh_key_pool()
+        {
+            return dh_key_pool_;
+        }
+
     private:
 
         ValidationResult_t process_handshake_request(HandshakeMessageToken** handshake_message_out,
@@ -109,6 +118,8 @@ class PKIDH : public Authentication
                 PKIHandshakeHandle& handshake_handle,
                 SecurityException& exception);
 
+        //! Ephemeral keys used on dh1 and dh2, generated in advance
+        DHKeyPool dh_key_pool_;
 };
 
 } //namespace security
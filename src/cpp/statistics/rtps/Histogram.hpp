@@ -0,0 +1,198 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Histogram.hpp
+ */
+
+#ifndef _STATISTICS_RTPS_HISTOGRAM_HPP_
+#define _STATISTICS_RTPS_HISTOGRAM_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif // if defined(_MSC_VER)
+
+namespace eprosima {
+namespace fastdds {
+namespace statistics {
+
+/**
+ * Summary of the values recorded on a Histogram during a period.
+ */
+struct HistogramSnapshot
+{
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    uint64_t max = 0;
+    uint64_t p50 = 0;
+    uint64_t p90 = 0;
+    uint64_t p99 = 0;
+
+    double mean() const
+    {
+        return 0 == count ? 0.0 : static_cast<double>(sum) / static_cast<double>(count);
+    }
+
+};
+
+/**
+ * Lock-free histogram of unsigned values with a bounded relative error.
+ *
+ * Values below 16 have their own bucket. Above that, every power of two is split in 8 linear sub-buckets,
+ * so the reported percentiles are at most 12.5% above the real ones, with 496 buckets covering all
+ * 64 bits values. Recording a value is a few relaxed atomic additions, so it can be called from any thread
+ * on the hot paths. A single consumer takes the snapshots.
+ */
+class Histogram
+{
+public:
+
+    static constexpr uint32_t linear_buckets = 16;
+    static constexpr uint32_t sub_bucket_bits = 3;
+    static constexpr uint32_t sub_buckets = 1u << sub_bucket_bits;
+    static constexpr uint32_t num_buckets = linear_buckets + (64 - 4) * sub_buckets;
+
+    Histogram()
+    {
+        for (std::atomic<uint64_t>& bucket : buckets_)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Record a value.
+     * @param value Value to record.
+     */
+    void record(
+            uint64_t value)
+    {
+        buckets_[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(value, std::memory_order_relaxed);
+
+        uint64_t current_max = max_.load(std::memory_order_relaxed);
+        while (value > current_max &&
+                !max_.compare_exchange_weak(current_max, value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    /**
+     * Take the summary of the values recorded since the last snapshot, and start a new period.
+     * @return Summary of the values recorded on the period.
+     */
+    HistogramSnapshot snapshot_and_reset()
+    {
+        HistogramSnapshot snapshot;
+        std::array<uint64_t, num_buckets> counts;
+        for (uint32_t i = 0; i < num_buckets; ++i)
+        {
+            counts[i] = buckets_[i].exchange(0, std::memory_order_relaxed);
+            snapshot.count += counts[i];
+        }
+        snapshot.sum = sum_.exchange(0, std::memory_order_relaxed);
+        snapshot.max = max_.exchange(0, std::memory_order_relaxed);
+
+        if (0 < snapshot.count)
+        {
+            // Bucket bounds may be above the real maximum
+            snapshot.p50 = (std::min)(percentile(counts, snapshot.count, 50), snapshot.max);
+            snapshot.p90 = (std::min)(percentile(counts, snapshot.count, 90), snapshot.max);
+            snapshot.p99 = (std::min)(percentile(counts, snapshot.count, 99), snapshot.max);
+        }
+
+        return snapshot;
+    }
+
+    static uint32_t bucket_index(
+            uint64_t value)
+    {
+        if (value < linear_buckets)
+        {
+            return static_cast<uint32_t>(value);
+        }
+
+        uint32_t msb = most_significant_bit(value);
+        uint32_t shift = msb - sub_bucket_bits;
+        uint32_t sub_bucket = static_cast<uint32_t>((value >> shift) & (sub_buckets - 1));
+        return linear_buckets + (msb - 4) * sub_buckets + sub_bucket;
+    }
+
+    //! Highest value stored on a bucket.
+    static uint64_t bucket_upper_bound(
+            uint32_t index)
+    {
+        if (index < linear_buckets)
+        {
+            return index;
+        }
+
+        uint32_t msb = (index - linear_buckets) / sub_buckets + 4;
+        uint64_t sub_bucket = (index - linear_buckets) % sub_buckets;
+        uint32_t shift = msb - sub_bucket_bits;
+        return (((sub_buckets + sub_bucket + 1) << shift) - 1);
+    }
+
+private:
+
+    static uint32_t most_significant_bit(
+            uint64_t value)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanReverse64(&index, value);
+        return static_cast<uint32_t>(index);
+#else
+        return 63u - static_cast<uint32_t>(__builtin_clzll(value));
+#endif // if defined(_MSC_VER)
+    }
+
+    static uint64_t percentile(
+            const std::array<uint64_t, num_buckets>& counts,
+            uint64_t total,
+            uint64_t percent)
+    {
+        uint64_t target = (total * percent + 99) / 100;
+        uint64_t accumulated = 0;
+        for (uint32_t i = 0; i < num_buckets; ++i)
+        {
+            accumulated += counts[i];
+            if (accumulated >= target)
+            {
+                return bucket_upper_bound(i);
+            }
+        }
+
+        return bucket_upper_bound(num_buckets - 1);
+    }
+
+    std::array<std::atomic<uint64_t>, num_buckets> buckets_;
+
+    std::atomic<uint64_t> sum_{0};
+
+    std::atomic<uint64_t> max_{0};
+};
+
+} // namespace statistics
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _STATISTICS_RTPS_HISTOGRAM_HPP_
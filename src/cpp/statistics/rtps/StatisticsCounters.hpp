@@ -0,0 +1,168 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatisticsCounters.hpp
+ */
+
+#ifndef _STATISTICS_RTPS_STATISTICSCOUNTERS_HPP_
+#define _STATISTICS_RTPS_STATISTICSCOUNTERS_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/Time_t.h>
+
+#include <statistics/rtps/Histogram.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace eprosima {
+namespace fastdds {
+namespace statistics {
+
+/**
+ * Event counter updated from the hot paths.
+ * Only the statistics publisher reads it, taking the value accumulated since its last read.
+ */
+class StatisticsCounter
+{
+public:
+
+    void add(
+            uint64_t value = 1)
+    {
+        value_.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    uint64_t take()
+    {
+        return value_.exchange(0, std::memory_order_relaxed);
+    }
+
+private:
+
+    std::atomic<uint64_t> value_{0};
+};
+
+/**
+ * Statistics of an RTPS writer or reader.
+ *
+ * Endpoints hold a reference to their statistics, so the hot paths only check it is not null before updating
+ * them. They are only allocated when statistics are enabled on the participant.
+ */
+class EndpointStatistics
+{
+public:
+
+    /**
+     * @param guid GUID of the endpoint.
+     * @param is_reader Whether the endpoint is a reader.
+     * @param measure_latency Whether the latency of the received samples should be recorded.
+     */
+    EndpointStatistics(
+            const fastrtps::rtps::GUID_t& guid,
+            bool is_reader,
+            bool measure_latency)
+        : guid_(guid)
+        , is_reader_(is_reader)
+        , latency_(measure_latency ? new Histogram() : nullptr)
+    {
+    }
+
+    const fastrtps::rtps::GUID_t& guid() const
+    {
+        return guid_;
+    }
+
+    bool is_reader() const
+    {
+        return is_reader_;
+    }
+
+    //! A sample was added to the history of the endpoint.
+    void on_sample(
+            uint32_t bytes)
+    {
+        samples.add();
+        sample_bytes.add(bytes);
+    }
+
+    //! A sample was received with the given source timestamp.
+    void on_sample_received(
+            const fastrtps::rtps::Time_t& source_timestamp,
+            const fastrtps::rtps::Time_t& reception_timestamp,
+            uint32_t bytes)
+    {
+        on_sample(bytes);
+        if (latency_)
+        {
+            int64_t latency = reception_timestamp.to_ns() - source_timestamp.to_ns();
+            latency_->record(latency > 0 ? static_cast<uint64_t>(latency) : 0u);
+        }
+    }
+
+    //! A DATA, DATA_FRAG or batched sample was added to a message.
+    void on_data_sent(
+            uint32_t bytes)
+    {
+        datas.add();
+        data_bytes.add(bytes);
+    }
+
+    //! Latency histogram, or nullptr when latencies are not measured.
+    Histogram* latency() const
+    {
+        return latency_.get();
+    }
+
+    StatisticsCounter samples;
+    StatisticsCounter sample_bytes;
+    StatisticsCounter datas;
+    StatisticsCounter data_bytes;
+    StatisticsCounter resent_datas;
+    StatisticsCounter heartbeats;
+    StatisticsCounter gaps;
+    StatisticsCounter acknacks;
+    StatisticsCounter nackfrags;
+
+private:
+
+    const fastrtps::rtps::GUID_t guid_;
+
+    const bool is_reader_;
+
+    std::unique_ptr<Histogram> latency_;
+};
+
+/**
+ * Participant wide statistics.
+ */
+struct ParticipantStatistics
+{
+    StatisticsCounter sent_packets;
+    StatisticsCounter sent_bytes;
+    StatisticsCounter received_packets;
+    StatisticsCounter received_bytes;
+    //! Milliseconds elapsed from the participant creation until each remote participant is discovered.
+    Histogram discovery_time;
+};
+
+} // namespace statistics
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _STATISTICS_RTPS_STATISTICSCOUNTERS_HPP_
@@ -0,0 +1,377 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatisticsParticipant.cpp
+ */
+
+#include <statistics/rtps/StatisticsParticipant.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/WriterAttributes.h>
+#include <fastdds/rtps/history/WriterHistory.h>
+#include <fastdds/rtps/resources/TimedEvent.h>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastdds/statistics/topic_names.hpp>
+#include <fastrtps/attributes/TopicAttributes.h>
+#include <fastrtps/qos/WriterQos.h>
+
+#include <rtps/participant/RTPSParticipantImpl.h>
+
+#include <cstdlib>
+#include <limits>
+#include <sstream>
+#include <string>
+
+namespace eprosima {
+namespace fastdds {
+namespace statistics {
+
+using namespace eprosima::fastrtps::rtps;
+using eprosima::fastrtps::TopicAttributes;
+using eprosima::fastrtps::WriterQos;
+
+//! Maximum number of samples kept on the history of each statistics writer.
+static constexpr int32_t STATISTICS_HISTORY_DEPTH = 256;
+
+//! Metrics collected on the endpoints.
+static constexpr uint32_t ENDPOINT_METRICS =
+        HISTORY2HISTORY_LATENCY | PUBLICATION_THROUGHPUT | SUBSCRIPTION_THROUGHPUT | RESENT_DATAS |
+        HEARTBEAT_COUNT | ACKNACK_COUNT | NACKFRAG_COUNT | GAP_COUNT | DATA_COUNT;
+
+struct StatisticsTopic
+{
+    EventKind kind;
+    const char* name;
+};
+
+static const StatisticsTopic statistics_topics[] =
+{
+    {HISTORY2HISTORY_LATENCY, HISTORY_LATENCY_TOPIC},
+    {PUBLICATION_THROUGHPUT, PUBLICATION_THROUGHPUT_TOPIC},
+    {SUBSCRIPTION_THROUGHPUT, SUBSCRIPTION_THROUGHPUT_TOPIC},
+    {RTPS_SENT, RTPS_SENT_TOPIC},
+    {RTPS_RECEIVED, RTPS_RECEIVED_TOPIC},
+    {RESENT_DATAS, RESENT_DATAS_TOPIC},
+    {HEARTBEAT_COUNT, HEARTBEAT_COUNT_TOPIC},
+    {ACKNACK_COUNT, ACKNACK_COUNT_TOPIC},
+    {NACKFRAG_COUNT, NACKFRAG_COUNT_TOPIC},
+    {GAP_COUNT, GAP_COUNT_TOPIC},
+    {DATA_COUNT, DATA_COUNT_TOPIC},
+    {DISCOVERED_ENTITY, DISCOVERY_TOPIC}
+};
+
+StatisticsParticipant::StatisticsParticipant(
+        RTPSParticipantImpl* participant,
+        const PropertyPolicy& properties)
+    : participant_(participant)
+    , creation_time_(std::chrono::steady_clock::now())
+{
+    const std::string* topics = PropertyPolicyHelper::find_property(properties, STATISTICS_PROPERTY);
+    if (nullptr == topics)
+    {
+        return;
+    }
+
+    std::istringstream topic_list(*topics);
+    std::string topic_name;
+    while (std::getline(topic_list, topic_name, ';'))
+    {
+        topic_name.erase(0, topic_name.find_first_not_of(" \t"));
+        topic_name.erase(topic_name.find_last_not_of(" \t") + 1);
+        if (topic_name.empty())
+        {
+            continue;
+        }
+
+        bool found = false;
+        for (const StatisticsTopic& topic : statistics_topics)
+        {
+            if (topic_name == topic.name)
+            {
+                enabled_mask_ |= topic.kind;
+                found = true;
+                break;
+            }
+        }
+
+        if (!found)
+        {
+            logWarning(STATISTICS, "Unknown statistics topic " << topic_name);
+        }
+    }
+
+    const std::string* period = PropertyPolicyHelper::find_property(properties, STATISTICS_PERIOD_PROPERTY);
+    if (nullptr != period)
+    {
+        unsigned long value = std::strtoul(period->c_str(), nullptr, 10);
+        if (0 < value && value <= std::numeric_limits<uint32_t>::max())
+        {
+            period_ms_ = static_cast<uint32_t>(value);
+        }
+        else
+        {
+            logWarning(STATISTICS, "Wrong statistics period '" << *period << "', using " << period_ms_ << " ms");
+        }
+    }
+}
+
+StatisticsParticipant::~StatisticsParticipant()
+{
+    disable();
+}
+
+void StatisticsParticipant::enable()
+{
+    if (0 == enabled_mask_ || nullptr != publication_event_)
+    {
+        return;
+    }
+
+    for (const StatisticsTopic& topic : statistics_topics)
+    {
+        if (0 == (enabled_mask_ & topic.kind))
+        {
+            continue;
+        }
+
+        HistoryAttributes hatt(PREALLOCATED_MEMORY_MODE, type_.m_typeSize, 16, STATISTICS_HISTORY_DEPTH);
+        WriterHistory* history = new WriterHistory(hatt);
+
+        WriterAttributes watt;
+        watt.endpoint.topicKind = NO_KEY;
+        watt.endpoint.reliabilityKind = BEST_EFFORT;
+        watt.endpoint.durabilityKind = VOLATILE;
+
+        RTPSWriter* writer = nullptr;
+        if (!participant_->createWriter(&writer, watt, history, nullptr, c_EntityId_Unknown, false))
+        {
+            logError(STATISTICS, "Error creating writer for statistics topic " << topic.name);
+            delete history;
+            continue;
+        }
+
+        TopicAttributes tatt;
+        tatt.topicKind = NO_KEY;
+        tatt.topicName = topic.name;
+        tatt.topicDataType = type_.getName();
+        tatt.auto_fill_type_object = false;
+        tatt.auto_fill_type_information = false;
+
+        WriterQos wqos;
+        wqos.m_reliability.kind = fastdds::dds::BEST_EFFORT_RELIABILITY_QOS;
+        wqos.m_durability.kind = fastdds::dds::VOLATILE_DURABILITY_QOS;
+        participant_->registerWriter(writer, tatt, wqos);
+
+        writers_.push_back({topic.kind, writer, history});
+    }
+
+    last_publication_ = std::chrono::steady_clock::now();
+    publication_event_ = new TimedEvent(participant_->getEventResource(), [this]() -> bool
+                    {
+                        return publish_all();
+                    }, period_ms_);
+    publication_event_->restart_timer();
+}
+
+void StatisticsParticipant::disable()
+{
+    if (nullptr != publication_event_)
+    {
+        delete publication_event_;
+        publication_event_ = nullptr;
+    }
+
+    for (StatisticsWriter& statistics_writer : writers_)
+    {
+        participant_->deleteUserEndpoint(statistics_writer.writer);
+        delete statistics_writer.history;
+    }
+    writers_.clear();
+}
+
+std::shared_ptr<EndpointStatistics> StatisticsParticipant::register_endpoint(
+        const GUID_t& guid,
+        bool is_reader)
+{
+    if (0 == (enabled_mask_ & ENDPOINT_METRICS))
+    {
+        return nullptr;
+    }
+
+    bool measure_latency = is_reader && 0 != (enabled_mask_ & HISTORY2HISTORY_LATENCY);
+    std::shared_ptr<EndpointStatistics> statistics =
+            std::make_shared<EndpointStatistics>(guid, is_reader, measure_latency);
+
+    std::lock_guard<std::mutex> guard(endpoints_mutex_);
+    endpoints_[guid] = statistics;
+    return statistics;
+}
+
+void StatisticsParticipant::unregister_endpoint(
+        const GUID_t& guid)
+{
+    std::lock_guard<std::mutex> guard(endpoints_mutex_);
+    endpoints_.erase(guid);
+}
+
+void StatisticsParticipant::on_participant_discovered()
+{
+    if (0 != (enabled_mask_ & DISCOVERED_ENTITY))
+    {
+        auto elapsed = std::chrono::steady_clock::now() - creation_time_;
+        participant_statistics_.discovery_time.record(static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()));
+    }
+}
+
+bool StatisticsParticipant::publish_all()
+{
+    auto now = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(now - last_publication_).count();
+    last_publication_ = now;
+
+    // Endpoints may be created or deleted while publishing, so work on a copy of the collection
+    std::vector<std::shared_ptr<EndpointStatistics>> endpoints;
+    {
+        std::lock_guard<std::mutex> guard(endpoints_mutex_);
+        endpoints.reserve(endpoints_.size());
+        for (const auto& endpoint : endpoints_)
+        {
+            endpoints.push_back(endpoint.second);
+        }
+    }
+
+    for (const std::shared_ptr<EndpointStatistics>& endpoint : endpoints)
+    {
+        const GUID_t& guid = endpoint->guid();
+        if (endpoint->is_reader())
+        {
+            publish_counter(SUBSCRIPTION_THROUGHPUT, guid, endpoint->samples.take(), endpoint->sample_bytes.take(),
+                    seconds);
+            publish_counter(ACKNACK_COUNT, guid, endpoint->acknacks.take(), 0, seconds);
+            publish_counter(NACKFRAG_COUNT, guid, endpoint->nackfrags.take(), 0, seconds);
+            if (nullptr != endpoint->latency())
+            {
+                publish_histogram(HISTORY2HISTORY_LATENCY, guid, *endpoint->latency());
+            }
+        }
+        else
+        {
+            publish_counter(PUBLICATION_THROUGHPUT, guid, endpoint->samples.take(), endpoint->sample_bytes.take(),
+                    seconds);
+            publish_counter(DATA_COUNT, guid, endpoint->datas.take(), endpoint->data_bytes.take(), seconds);
+            publish_counter(RESENT_DATAS, guid, endpoint->resent_datas.take(), 0, seconds);
+            publish_counter(HEARTBEAT_COUNT, guid, endpoint->heartbeats.take(), 0, seconds);
+            publish_counter(GAP_COUNT, guid, endpoint->gaps.take(), 0, seconds);
+        }
+    }
+
+    const GUID_t& participant_guid = participant_->getGuid();
+    publish_counter(RTPS_SENT, participant_guid, participant_statistics_.sent_packets.take(),
+            participant_statistics_.sent_bytes.take(), seconds);
+    publish_counter(RTPS_RECEIVED, participant_guid, participant_statistics_.received_packets.take(),
+            participant_statistics_.received_bytes.take(), seconds);
+    publish_histogram(DISCOVERED_ENTITY, participant_guid, participant_statistics_.discovery_time);
+
+    return true;
+}
+
+void StatisticsParticipant::publish_counter(
+        EventKind kind,
+        const GUID_t& guid,
+        uint64_t count,
+        uint64_t bytes,
+        double seconds)
+{
+    if (0 == (enabled_mask_ & kind))
+    {
+        return;
+    }
+
+    StatisticsData data;
+    data.kind = kind;
+    data.guid = guid;
+    data.count = count;
+    data.bytes = bytes;
+    data.value = 0 < seconds ? static_cast<double>(count) / seconds : 0.0;
+    publish(kind, data);
+}
+
+void StatisticsParticipant::publish_histogram(
+        EventKind kind,
+        const GUID_t& guid,
+        Histogram& histogram)
+{
+    if (0 == (enabled_mask_ & kind))
+    {
+        return;
+    }
+
+    HistogramSnapshot snapshot = histogram.snapshot_and_reset();
+    if (0 == snapshot.count)
+    {
+        return;
+    }
+
+    StatisticsData data;
+    data.kind = kind;
+    data.guid = guid;
+    data.count = snapshot.count;
+    data.value = snapshot.mean();
+    data.p50 = static_cast<double>(snapshot.p50);
+    data.p90 = static_cast<double>(snapshot.p90);
+    data.p99 = static_cast<double>(snapshot.p99);
+    data.max = static_cast<double>(snapshot.max);
+    publish(kind, data);
+}
+
+void StatisticsParticipant::publish(
+        EventKind kind,
+        StatisticsData& data)
+{
+    for (StatisticsWriter& statistics_writer : writers_)
+    {
+        if (statistics_writer.kind != kind)
+        {
+            continue;
+        }
+
+        CacheChange_t* change = statistics_writer.writer->new_change(type_.getSerializedSizeProvider(&data), ALIVE);
+        if (nullptr == change)
+        {
+            return;
+        }
+
+        if (!type_.serialize(&data, &change->serializedPayload))
+        {
+            logWarning(STATISTICS, "Error serializing statistics sample");
+            statistics_writer.writer->release_change(change);
+            return;
+        }
+
+        // Statistics are only relevant until the next period, so the oldest sample is discarded
+        if (statistics_writer.history->isFull())
+        {
+            statistics_writer.history->remove_min_change();
+        }
+        statistics_writer.history->add_change(change);
+        return;
+    }
+}
+
+} // namespace statistics
+} // namespace fastdds
+} // namespace eprosima
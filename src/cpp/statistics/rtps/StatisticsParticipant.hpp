@@ -0,0 +1,168 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatisticsParticipant.hpp
+ */
+
+#ifndef _STATISTICS_RTPS_STATISTICSPARTICIPANT_HPP_
+#define _STATISTICS_RTPS_STATISTICSPARTICIPANT_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/statistics/StatisticsData.hpp>
+
+#include <statistics/rtps/StatisticsCounters.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class RTPSParticipantImpl;
+class RTPSWriter;
+class TimedEvent;
+class WriterHistory;
+
+} // namespace rtps
+} // namespace fastrtps
+
+namespace fastdds {
+namespace statistics {
+
+/**
+ * Statistics module of an RTPSParticipant.
+ *
+ * The metrics to collect are read from the participant properties. Each enabled metric is published
+ * periodically on its statistics topic, with one StatisticsData sample per entity.
+ */
+class StatisticsParticipant
+{
+public:
+
+    /**
+     * @param participant Participant owning this object.
+     * @param properties Properties of the participant, with the enabled statistics topics.
+     */
+    StatisticsParticipant(
+            fastrtps::rtps::RTPSParticipantImpl* participant,
+            const fastrtps::rtps::PropertyPolicy& properties);
+
+    ~StatisticsParticipant();
+
+    /**
+     * Create the writers of the enabled statistics topics and start the periodic publication.
+     * Should be called once the builtin protocols are running.
+     */
+    void enable();
+
+    /**
+     * Stop the periodic publication and delete the statistics writers.
+     */
+    void disable();
+
+    /**
+     * Create the statistics of a new endpoint.
+     * @param guid GUID of the endpoint.
+     * @param is_reader Whether the endpoint is a reader.
+     * @return The statistics of the endpoint, or nullptr if no endpoint metric is enabled.
+     */
+    std::shared_ptr<EndpointStatistics> register_endpoint(
+            const fastrtps::rtps::GUID_t& guid,
+            bool is_reader);
+
+    /**
+     * Stop publishing the statistics of an endpoint.
+     * @param guid GUID of the endpoint.
+     */
+    void unregister_endpoint(
+            const fastrtps::rtps::GUID_t& guid);
+
+    /**
+     * Participant wide statistics.
+     * @return Pointer to the statistics, or nullptr when statistics are disabled.
+     */
+    ParticipantStatistics* participant_statistics()
+    {
+        return 0 != enabled_mask_ ? &participant_statistics_ : nullptr;
+    }
+
+    //! Record the discovery of a remote participant.
+    void on_participant_discovered();
+
+private:
+
+    struct StatisticsWriter
+    {
+        EventKind kind;
+        fastrtps::rtps::RTPSWriter* writer;
+        fastrtps::rtps::WriterHistory* history;
+    };
+
+    bool publish_all();
+
+    void publish(
+            EventKind kind,
+            StatisticsData& data);
+
+    void publish_counter(
+            EventKind kind,
+            const fastrtps::rtps::GUID_t& guid,
+            uint64_t count,
+            uint64_t bytes,
+            double seconds);
+
+    void publish_histogram(
+            EventKind kind,
+            const fastrtps::rtps::GUID_t& guid,
+            Histogram& histogram);
+
+    fastrtps::rtps::RTPSParticipantImpl* participant_;
+
+    //! Mask of EventKind with the enabled metrics.
+    uint32_t enabled_mask_ = 0;
+
+    //! Publication period in milliseconds.
+    uint32_t period_ms_ = 1000;
+
+    std::chrono::steady_clock::time_point creation_time_;
+
+    std::chrono::steady_clock::time_point last_publication_;
+
+    ParticipantStatistics participant_statistics_;
+
+    std::mutex endpoints_mutex_;
+
+    std::map<fastrtps::rtps::GUID_t, std::shared_ptr<EndpointStatistics>> endpoints_;
+
+    std::vector<StatisticsWriter> writers_;
+
+    StatisticsDataPubSubType type_;
+
+    fastrtps::rtps::TimedEvent* publication_event_ = nullptr;
+};
+
+} // namespace statistics
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _STATISTICS_RTPS_STATISTICSPARTICIPANT_HPP_
@@ -0,0 +1,176 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatisticsData.cpp
+ *
+ */
+
+#include <fastdds/statistics/StatisticsData.hpp>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/FastBuffer.h>
+#include <fastcdr/exceptions/NotEnoughMemoryException.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace statistics {
+
+using eprosima::fastrtps::rtps::SerializedPayload_t;
+using eprosima::fastrtps::rtps::InstanceHandle_t;
+using eprosima::fastrtps::rtps::CDR_BE;
+using eprosima::fastrtps::rtps::CDR_LE;
+
+size_t StatisticsData::getMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t initial_alignment = current_alignment;
+
+    // kind
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+    // guid
+    current_alignment += 16;
+    // count, bytes
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+    // value, p50, p90, p99, max
+    for (size_t i = 0; i < 5; ++i)
+    {
+        current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+    }
+
+    return current_alignment - initial_alignment;
+}
+
+void StatisticsData::serialize(
+        eprosima::fastcdr::Cdr& cdr) const
+{
+    cdr << kind;
+    cdr.serializeArray(guid.guidPrefix.value, fastrtps::rtps::GuidPrefix_t::size);
+    cdr.serializeArray(guid.entityId.value, fastrtps::rtps::EntityId_t::size);
+    cdr << count;
+    cdr << bytes;
+    cdr << value;
+    cdr << p50;
+    cdr << p90;
+    cdr << p99;
+    cdr << max;
+}
+
+void StatisticsData::deserialize(
+        eprosima::fastcdr::Cdr& cdr)
+{
+    cdr >> kind;
+    cdr.deserializeArray(guid.guidPrefix.value, fastrtps::rtps::GuidPrefix_t::size);
+    cdr.deserializeArray(guid.entityId.value, fastrtps::rtps::EntityId_t::size);
+    cdr >> count;
+    cdr >> bytes;
+    cdr >> value;
+    cdr >> p50;
+    cdr >> p90;
+    cdr >> p99;
+    cdr >> max;
+}
+
+StatisticsDataPubSubType::StatisticsDataPubSubType()
+{
+    setName("eprosima::fastdds::statistics::StatisticsData");
+    m_typeSize = static_cast<uint32_t>(StatisticsData::getMaxCdrSerializedSize()) + 4 /*encapsulation*/;
+    m_isGetKeyDefined = false;
+}
+
+StatisticsDataPubSubType::~StatisticsDataPubSubType()
+{
+}
+
+bool StatisticsDataPubSubType::serialize(
+        void* data,
+        SerializedPayload_t* payload)
+{
+    StatisticsData* p_type = static_cast<StatisticsData*>(data);
+    eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+    eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN,
+            eprosima::fastcdr::Cdr::DDS_CDR);
+    payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+    // Serialize encapsulation
+    ser.serialize_encapsulation();
+
+    try
+    {
+        p_type->serialize(ser);
+    }
+    catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+    {
+        return false;
+    }
+
+    payload->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+    return true;
+}
+
+bool StatisticsDataPubSubType::deserialize(
+        SerializedPayload_t* payload,
+        void* data)
+{
+    StatisticsData* p_type = static_cast<StatisticsData*>(data);
+    eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+    eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN,
+            eprosima::fastcdr::Cdr::DDS_CDR);
+    // Deserialize encapsulation.
+    deser.read_encapsulation();
+    payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+    try
+    {
+        p_type->deserialize(deser);
+    }
+    catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+std::function<uint32_t()> StatisticsDataPubSubType::getSerializedSizeProvider(
+        void* /*data*/)
+{
+    return []() -> uint32_t
+           {
+               return static_cast<uint32_t>(StatisticsData::getMaxCdrSerializedSize()) + 4 /*encapsulation*/;
+           };
+}
+
+bool StatisticsDataPubSubType::getKey(
+        void* /*data*/,
+        InstanceHandle_t* /*ihandle*/,
+        bool /*force_md5*/)
+{
+    return false;
+}
+
+void* StatisticsDataPubSubType::createData()
+{
+    return new StatisticsData();
+}
+
+void StatisticsDataPubSubType::deleteData(
+        void* data)
+{
+    delete static_cast<StatisticsData*>(data);
+}
+
+} // namespace statistics
+} // namespace fastdds
+} // namespace eprosima
@@ -43,11 +43,129 @@
 #include <netinet/in.h>
 #endif
 
+#if defined(__linux__)
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <errno.h>
+#include <fcntl.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstring>
+#include <mutex>
 
 using namespace eprosima::fastrtps::rtps;
 
+namespace {
+
+/**
+ * Process-wide list of the local interfaces, shared by all the transports and participants.
+ * On Linux it is invalidated by the kernel through a netlink socket, and on the rest of the platforms
+ * it expires after max_age.
+ */
+struct InterfaceSnapshot
+{
+    static constexpr std::chrono::milliseconds max_age{1000};
+
+    std::mutex mutex;
+    std::vector<IPFinder::info_IP> interfaces;
+    bool valid = false;
+    uint32_t generation = 0;
+    std::chrono::steady_clock::time_point timestamp;
+#if defined(__linux__)
+    //! Netlink socket receiving address and link changes. -2 when not opened yet, -1 when not available.
+    int netlink_socket = -2;
+
+    ~InterfaceSnapshot()
+    {
+        if (netlink_socket >= 0)
+        {
+            close(netlink_socket);
+        }
+    }
+
+#endif // if defined(__linux__)
+};
+
+constexpr std::chrono::milliseconds InterfaceSnapshot::max_age;
+
+InterfaceSnapshot& interface_snapshot()
+{
+    static InterfaceSnapshot snapshot;
+    return snapshot;
+}
+
+#if defined(__linux__)
+int open_netlink_socket()
+{
+    int fd = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    sockaddr_nl address;
+    memset(&address, 0, sizeof(address));
+    address.nl_family = AF_NETLINK;
+    address.nl_groups = RTMGRP_LINK | RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR;
+
+    if (bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 ||
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK) < 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+#endif // if defined(__linux__)
+
+//! Checks whether the interfaces may have changed since the snapshot was taken.
+bool snapshot_is_outdated_nts(
+        InterfaceSnapshot& snapshot)
+{
+    if (!snapshot.valid)
+    {
+        return true;
+    }
+
+#if defined(__linux__)
+    if (snapshot.netlink_socket >= 0)
+    {
+        // Any notification means a change. Only their presence matters, so they are just drained.
+        bool changed = false;
+        char buffer[4096];
+        ssize_t received = 0;
+        while ((received = recv(snapshot.netlink_socket, buffer, sizeof(buffer), 0)) > 0)
+        {
+            changed = true;
+        }
+
+        // Notifications were lost because the socket buffer was full
+        return changed || (received < 0 && errno == ENOBUFS);
+    }
+#endif // if defined(__linux__)
+
+    return std::chrono::steady_clock::now() - snapshot.timestamp > InterfaceSnapshot::max_age;
+}
+
+bool same_interfaces(
+        const std::vector<IPFinder::info_IP>& a,
+        const std::vector<IPFinder::info_IP>& b)
+{
+    return a.size() == b.size() &&
+           std::equal(a.begin(), a.end(), b.begin(),
+                   [](const IPFinder::info_IP& lhs, const IPFinder::info_IP& rhs)
+                   {
+                       return lhs.type == rhs.type && lhs.name == rhs.name && lhs.dev == rhs.dev;
+                   });
+}
+
+} // namespace
+
 IPFinder::IPFinder() {
 }
 
@@ -58,7 +176,7 @@ IPFinder::~IPFinder() {
 
 #define DEFAULT_ADAPTER_ADDRESSES_SIZE 15360
 
-bool IPFinder::getIPs(std::vector<info_IP>* vec_name, bool return_loopback)
+bool IPFinder::query_ips(std::vector<info_IP>* vec_name, bool return_loopback)
 {
     DWORD rv, size = DEFAULT_ADAPTER_ADDRESSES_SIZE;
     PIP_ADAPTER_ADDRESSES adapter_addresses, aa;
@@ -129,7 +247,7 @@ bool IPFinder::getIPs(std::vector<info_IP>* vec_name, bool return_loopback)
 
 #else
 
-bool IPFinder::getIPs(std::vector<info_IP>* vec_name, bool return_loopback)
+bool IPFinder::query_ips(std::vector<info_IP>* vec_name, bool return_loopback)
 {
     struct ifaddrs *ifaddr, *ifa;
     int family, s;
@@ -193,6 +311,74 @@ bool IPFinder::getIPs(std::vector<info_IP>* vec_name, bool return_loopback)
 }
 #endif
 
+bool IPFinder::update_snapshot_nts()
+{
+    InterfaceSnapshot& snapshot = interface_snapshot();
+
+#if defined(__linux__)
+    // Opened before querying, so no change can be missed
+    if (snapshot.netlink_socket == -2)
+    {
+        snapshot.netlink_socket = open_netlink_socket();
+    }
+#endif // if defined(__linux__)
+
+    if (!snapshot_is_outdated_nts(snapshot))
+    {
+        return true;
+    }
+
+    std::vector<info_IP> interfaces;
+    if (!query_ips(&interfaces, true))
+    {
+        return false;
+    }
+
+    if (snapshot.generation == 0 || !same_interfaces(snapshot.interfaces, interfaces))
+    {
+        snapshot.interfaces.swap(interfaces);
+        ++snapshot.generation;
+    }
+    snapshot.valid = true;
+    snapshot.timestamp = std::chrono::steady_clock::now();
+    return true;
+}
+
+bool IPFinder::getIPs(std::vector<info_IP>* vec_name, bool return_loopback)
+{
+    InterfaceSnapshot& snapshot = interface_snapshot();
+    std::lock_guard<std::mutex> guard(snapshot.mutex);
+
+    if (!update_snapshot_nts())
+    {
+        return false;
+    }
+
+    for (const info_IP& info : snapshot.interfaces)
+    {
+        if (return_loopback || (info.type != IP4_LOCAL && info.type != IP6_LOCAL))
+        {
+            vec_name->push_back(info);
+        }
+    }
+    return true;
+}
+
+void IPFinder::refresh()
+{
+    InterfaceSnapshot& snapshot = interface_snapshot();
+    std::lock_guard<std::mutex> guard(snapshot.mutex);
+    snapshot.valid = false;
+}
+
+uint32_t IPFinder::generation()
+{
+    InterfaceSnapshot& snapshot = interface_snapshot();
+    std::lock_guard<std::mutex> guard(snapshot.mutex);
+    update_snapshot_nts();
+    return snapshot.generation;
+}
+
 bool IPFinder::getIP4Address(LocatorList_t* locators)
 {
     std::vector<info_IP> ip_names;
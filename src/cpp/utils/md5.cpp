@@ -34,6 +34,8 @@ documentation and/or software.
 /* interface header */
 #include <fastrtps/utils/md5.h>
 
+#include <fastrtps/config.h>
+
 /* system implementation headers */
 #include <cstdio>
 #include <stdio.h>
@@ -60,12 +62,13 @@ documentation and/or software.
 ///////////////////////////////////////////////
 
 // F, G, H and I are basic MD5 functions.
+// F and G select bits with a xor instead of two ands and an or, which needs fewer operations.
 inline MD5::uint4 MD5::F(uint4 x, uint4 y, uint4 z) {
-  return (x&y) | (~x&z);
+  return z ^ (x & (y ^ z));
 }
 
 inline MD5::uint4 MD5::G(uint4 x, uint4 y, uint4 z) {
-  return (x&z) | (y&~z);
+  return y ^ (z & (x ^ y));
 }
 
 inline MD5::uint4 MD5::H(uint4 x, uint4 y, uint4 z) {
@@ -138,9 +141,14 @@ void MD5::init()
 // decodes input (unsigned char) into output (uint4). Assumes len is a multiple of 4.
 void MD5::decode(uint4 output[], const uint1 input[], size_type len)
 {
+#if !FASTDDS_IS_BIG_ENDIAN_TARGET
+  // MD5 words are little endian, so they can be copied as they are
+  memcpy(output, input, len);
+#else
   for (unsigned int i = 0, j = 0; j < len; i++, j += 4)
     output[i] = ((uint4)input[j]) | (((uint4)input[j+1]) << 8) |
       (((uint4)input[j+2]) << 16) | (((uint4)input[j+3]) << 24);
+#endif
 }
 
 //////////////////////////////
@@ -299,24 +307,22 @@ void MD5::update(const char input[], size_type length)
 // the message digest and zeroizing the context.
 MD5& MD5::finalize()
 {
-  static unsigned char padding[64] = {
-    0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-  };
-
   if (!finalized) {
-    // Save number of bits
-    unsigned char bits[8];
-    encode(bits, count, 8);
-
-    // pad out to 56 mod 64.
-    size_type index = count[0] / 8 % 64;
-    size_type padLen = (index < 56) ? (56 - index) : (120 - index);
-    update(padding, padLen);
+    // Pad the buffered bytes in place, so inputs shorter than 56 bytes are hashed with a single transform.
+    size_type index = count[0] / 8 % blocksize;
+    buffer[index++] = 0x80;
+
+    // pad out to 56 mod 64, using an extra block when the length does not fit.
+    if (index > 56) {
+      memset(&buffer[index], 0, blocksize - index);
+      transform(buffer);
+      index = 0;
+    }
+    memset(&buffer[index], 0, 56 - index);
 
     // Append length (before padding)
-    update(bits, 8);
+    encode(&buffer[56], count, 8);
+    transform(buffer);
 
     // Store state in digest
     encode(digest, state, 16);
@@ -783,6 +783,13 @@ public:
         return *this;
     }
 
+    PubSubReader& max_incomplete_samples_memory(
+            uint32_t max_memory)
+    {
+        datareader_qos_.reader_resource_limits().max_incomplete_samples_memory = max_memory;
+        return *this;
+    }
+
     PubSubReader& expect_no_allocs()
     {
         // TODO(Mcc): Add no allocations check code when feature is completely ready
@@ -921,6 +928,13 @@ public:
         return *this;
     }
 
+    PubSubReader& guid_prefix(
+            const eprosima::fastrtps::rtps::GuidPrefix_t& prefix)
+    {
+        participant_qos_.wire_protocol().prefix = prefix;
+        return *this;
+    }
+
     PubSubReader& disable_multicast(
             int32_t participantId)
     {
@@ -756,6 +756,16 @@ public:
         return *this;
     }
 
+    PubSubWriter& batch(
+            uint32_t max_samples,
+            uint32_t max_data_bytes)
+    {
+        datawriter_qos_.batch().enable = true;
+        datawriter_qos_.batch().max_samples = max_samples;
+        datawriter_qos_.batch().max_data_bytes = max_data_bytes;
+        return *this;
+    }
+
     PubSubWriter& history_kind(
             const eprosima::fastrtps::HistoryQosPolicyKind kind)
     {
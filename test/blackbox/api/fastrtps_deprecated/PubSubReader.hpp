@@ -679,6 +679,13 @@ public:
         return *this;
     }
 
+    PubSubReader& max_incomplete_samples_memory(
+            uint32_t max_memory)
+    {
+        subscriber_attr_.max_incomplete_samples_memory = max_memory;
+        return *this;
+    }
+
     PubSubReader& expect_no_allocs()
     {
         // TODO(Mcc): Add no allocations check code when feature is completely ready
@@ -817,6 +824,13 @@ public:
         return *this;
     }
 
+    PubSubReader& guid_prefix(
+            const eprosima::fastrtps::rtps::GuidPrefix_t& prefix)
+    {
+        participant_attr_.rtps.prefix = prefix;
+        return *this;
+    }
+
     PubSubReader& disable_multicast(
             int32_t participantId)
     {
@@ -658,6 +658,16 @@ public:
         return *this;
     }
 
+    PubSubWriter& batch(
+            uint32_t max_samples,
+            uint32_t max_data_bytes)
+    {
+        publisher_attr_.qos.m_batch.enable = true;
+        publisher_attr_.qos.m_batch.max_samples = max_samples;
+        publisher_attr_.qos.m_batch.max_data_bytes = max_data_bytes;
+        return *this;
+    }
+
     PubSubWriter& history_kind(
             const eprosima::fastrtps::HistoryQosPolicyKind kind)
     {
@@ -599,6 +599,123 @@ TEST_P(PubSubBasic, ReceivedPropertiesDataExceedsSizeLimit)
 }
 
 
+/*!
+ * @fn TEST_P(PubSubBasic, PubSubAsReliableHelloworldBatched)
+ * @brief This test checks a reliable reader receives in order every sample sent by a batching writer.
+ */
+TEST_P(PubSubBasic, PubSubAsReliableHelloworldBatched)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(100).
+            reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(100).batch(4, 1024).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    reader.startReception(data);
+
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+}
+
+/*!
+ * @fn TEST_P(PubSubBasic, PubSubAsNonReliableHelloworldBatched)
+ * @brief This test checks a best effort reader receives the samples sent by a batching writer.
+ */
+TEST_P(PubSubBasic, PubSubAsNonReliableHelloworldBatched)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(100).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.reliability(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS).
+            history_depth(100).batch(3, 1024).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    reader.startReception(data);
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_at_least(2);
+}
+
+/*!
+ * @fn TEST_P(PubSubBasic, PubSubAsReliableHelloworldBatchedMixedReaders)
+ * @brief This test checks a batching writer delivers every sample both to a reader that accepts batches and to a
+ * reader whose participant is not identified as eProsima's, which should receive plain DATA submessages.
+ */
+TEST_P(PubSubBasic, PubSubAsReliableHelloworldBatchedMixedReaders)
+{
+    PubSubReader<HelloWorldType> batch_reader(TEST_TOPIC_NAME);
+    PubSubReader<HelloWorldType> data_reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    batch_reader.history_depth(100).
+            reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(batch_reader.isInitialized());
+
+    // Batches are only sent to destinations whose GUID prefix starts with the eProsima vendor id
+    GuidPrefix_t prefix;
+    for (size_t i = 0; i < prefix.size; ++i)
+    {
+        prefix.value[i] = static_cast<octet>(0xF0 + i);
+    }
+    data_reader.guid_prefix(prefix).history_depth(100).
+            reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(data_reader.isInitialized());
+
+    writer.history_depth(100).batch(4, 1024).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery(2);
+    batch_reader.wait_discovery();
+    data_reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    batch_reader.startReception(data);
+    data_reader.startReception(data);
+
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block readers until reception finished or timeout.
+    batch_reader.block_for_all();
+    data_reader.block_for_all();
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z, w) INSTANTIATE_TEST_SUITE_P(x, y, z, w)
 #else
@@ -18,9 +18,12 @@
 #include "PubSubWriter.hpp"
 
 #include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/messages/CDRMessage.h>
 #include <fastrtps/transport/test_UDPv4Transport.h>
 #include <fastrtps/xmlparser/XMLProfileManager.h>
 
+#include <atomic>
+
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
 
@@ -663,6 +666,193 @@ TEST(PubSubFragments, AsyncFragmentSizeTest)
     }
 }
 
+TEST(PubSubFragments, ReaderDeletedWithIncompleteFragmentedSamples)
+{
+    PubSubWriter<Data64kbType> writer(TEST_TOPIC_NAME);
+
+    // The second fragment of every sample is lost for good
+    auto testTransport = std::make_shared<test_UDPv4TransportDescriptor>();
+    testTransport->maxMessageSize = 32000;
+    testTransport->sendBufferSize = 65536;
+    testTransport->receiveBufferSize = 65536;
+    testTransport->drop_data_frag_messages_filter_ = [](CDRMessage_t& msg)
+            {
+                // extraFlags, octetsToInlineQos, readerId, writerId and writerSN come before fragmentStartingNum
+                uint32_t old_pos = msg.pos;
+                msg.pos += 20;
+                uint32_t fragment_starting_num = 0;
+                CDRMessage::readUInt32(&msg, &fragment_starting_num);
+                msg.pos = old_pos;
+                return fragment_starting_num == 2;
+            };
+    writer.disable_builtin_transport();
+    writer.add_user_transport_to_pparams(testTransport);
+    writer.history_depth(10).
+            reliability(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    PubSubReader<Data64kbType> reader(TEST_TOPIC_NAME);
+    reader.history_depth(10).
+            reliability(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_data64kb_data_generator();
+    reader.startReception(data);
+    writer.send(data);
+    ASSERT_TRUE(data.empty());
+
+    // No sample can be completed, so their reassembly buffers are still in use
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    EXPECT_EQ(reader.getReceivedCount(), 0u);
+
+    // Deleting the reader releases the buffers and shrinks its payload pool
+    reader.destroy();
+}
+
+
+/*!
+ * @fn TEST(PubSubFragments, ReliableSampleLargerThanIncompleteSamplesLimit)
+ * @brief This test checks a reliable reader drops the samples that can never fit in its memory for incomplete
+ * samples, acknowledging them instead of having the writer send them forever.
+ */
+TEST(PubSubFragments, ReliableSampleLargerThanIncompleteSamplesLimit)
+{
+    PubSubReader<Data1mbType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<Data1mbType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(5).
+            max_incomplete_samples_memory(100000).
+            reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(5).
+            reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_data300kb_data_generator(5);
+    reader.startReception(data);
+    writer.send(data);
+    ASSERT_TRUE(data.empty());
+
+    EXPECT_TRUE(writer.waitForAllAcked(std::chrono::seconds(10)));
+    EXPECT_EQ(reader.getReceivedCount(), 0u);
+}
+
+/*!
+ * @fn TEST(PubSubFragments, ReliableIncompleteSamplesLimitInLossyConditions)
+ * @brief This test checks a reliable reader whose memory for incomplete samples holds less than two of them
+ * receives all the samples, while the repairs of several lost fragments are interleaved.
+ */
+TEST(PubSubFragments, ReliableIncompleteSamplesLimitInLossyConditions)
+{
+    PubSubReader<Data1mbType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<Data1mbType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(5).
+            max_incomplete_samples_memory(400000).
+            reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    // When doing fragmentation, it is necessary to have some degree of
+    // flow control not to overrun the receive buffer.
+    uint32_t bytesPerPeriod = 300000;
+    uint32_t periodInMs = 200;
+    writer.add_throughput_controller_descriptor_to_pparams(bytesPerPeriod, periodInMs);
+
+    auto testTransport = std::make_shared<test_UDPv4TransportDescriptor>();
+    testTransport->sendBufferSize = 65536;
+    testTransport->receiveBufferSize = 65536;
+    // We drop 20% of all data frags
+    testTransport->dropDataFragMessagesPercentage = 20;
+    writer.disable_builtin_transport();
+    writer.add_user_transport_to_pparams(testTransport);
+
+    writer.history_depth(5).
+            asynchronously(eprosima::fastrtps::ASYNCHRONOUS_PUBLISH_MODE).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_data300kb_data_generator(5);
+
+    reader.startReception(data);
+    writer.send(data);
+    ASSERT_TRUE(data.empty());
+
+    // Two incomplete samples evicting each other would never be completed
+    EXPECT_EQ(reader.block_for_all(std::chrono::seconds(30)), 5u);
+}
+
+/*!
+ * @fn TEST(PubSubFragments, BestEffortIncompleteSampleEvicted)
+ * @brief This test checks a best-effort reader evicts an incomplete sample to make room for the following ones
+ * when its memory for incomplete samples is exhausted.
+ */
+TEST(PubSubFragments, BestEffortIncompleteSampleEvicted)
+{
+    // Declared before the entities, as the transport filter uses it until the participants are destroyed
+    std::atomic<bool> fragment_dropped(false);
+
+    PubSubReader<Data1mbType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<Data1mbType> writer(TEST_TOPIC_NAME);
+
+    reader.socket_buffer_size(1048576).
+            history_depth(10).
+            max_incomplete_samples_memory(400000).
+            reliability(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    // Lose the second fragment of the first sample, so it is never completed
+    auto testTransport = std::make_shared<test_UDPv4TransportDescriptor>();
+    testTransport->drop_data_frag_messages_filter_ = [&fragment_dropped](CDRMessage_t& msg)
+            {
+                uint32_t old_pos = msg.pos;
+                SequenceNumber_t sn;
+                uint32_t fragment_starting_num = 0;
+                msg.pos += 12;
+                CDRMessage::readInt32(&msg, &sn.high);
+                CDRMessage::readUInt32(&msg, &sn.low);
+                CDRMessage::readUInt32(&msg, &fragment_starting_num);
+                msg.pos = old_pos;
+
+                return SequenceNumber_t(0, 1) == sn && 2u == fragment_starting_num &&
+                       !fragment_dropped.exchange(true);
+            };
+    writer.disable_builtin_transport();
+    writer.add_user_transport_to_pparams(testTransport);
+
+    writer.history_depth(10).
+            reliability(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_data300kb_data_generator(10);
+
+    reader.startReception(data);
+    writer.send(data, 10u);
+    ASSERT_TRUE(data.empty());
+    EXPECT_TRUE(fragment_dropped);
+
+    // The first sample is incomplete, and would leave no room for the following ones if it was not evicted
+    EXPECT_GE(reader.block_for_at_least(2), 2u);
+}
 
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z, w) INSTANTIATE_TEST_SUITE_P(x, y, z, w)
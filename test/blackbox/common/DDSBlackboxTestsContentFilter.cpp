@@ -0,0 +1,233 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "BlackboxTests.hpp"
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/DataWriterListener.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/publisher/qos/DataWriterQos.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/ContentFilteredTopic.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/rtps/messages/CDRMessage.h>
+#include <fastdds/rtps/transport/test_UDPv4TransportDescriptor.h>
+#include <fastrtps/types/DynamicData.h>
+#include <fastrtps/types/DynamicDataFactory.h>
+#include <fastrtps/types/DynamicPubSubType.h>
+#include <fastrtps/types/DynamicTypeBuilder.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/DynamicTypeBuilderPtr.h>
+
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastrtps::rtps;
+using eprosima::fastrtps::types::DynamicData;
+using eprosima::fastrtps::types::DynamicDataFactory;
+using eprosima::fastrtps::types::DynamicPubSubType;
+using eprosima::fastrtps::types::DynamicTypeBuilder_ptr;
+using eprosima::fastrtps::types::DynamicTypeBuilderFactory;
+using eprosima::fastrtps::types::DynamicType_ptr;
+
+namespace {
+
+//! Notifies when the writer has matched the expected number of readers
+class MatchedListener : public DataWriterListener
+{
+public:
+
+    void on_publication_matched(
+            DataWriter*,
+            const PublicationMatchedStatus& info) override
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        matched_ = info.current_count;
+        cv_.notify_all();
+    }
+
+    bool wait_matched(
+            int32_t matched)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, std::chrono::seconds(10), [&]()
+                       {
+                           return matched_ >= matched;
+                       });
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    int32_t matched_ = 0;
+};
+
+/*
+ * struct FilteredData
+ * {
+ *     unsigned long index;
+ *     string message;
+ * };
+ */
+DynamicType_ptr filtered_data_type()
+{
+    DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+    DynamicTypeBuilder_ptr builder = factory->create_struct_builder();
+    builder->add_member(0, "index", factory->create_uint32_type());
+    builder->add_member(1, "message", factory->create_string_type());
+    builder->set_name("FilteredData");
+    return builder->build();
+}
+
+} // namespace
+
+/*!
+ * @fn TEST(DDSContentFilter, WriterSkipsFilteredSamples)
+ * @brief This test checks a writer does not send the samples a remote reader on a ContentFilteredTopic filters out,
+ * and the reader receives only the samples passing its filter.
+ */
+TEST(DDSContentFilter, WriterSkipsFilteredSamples)
+{
+    // Declared before the entities, as the transport filter uses them until the participants are destroyed
+    std::mutex sent_mutex;
+    std::set<SequenceNumber_t> sent_sequences;
+
+    auto testTransport = std::make_shared<eprosima::fastdds::rtps::test_UDPv4TransportDescriptor>();
+    // Records the samples sent by the user writer, without dropping them
+    testTransport->drop_data_messages_filter_ = [&](CDRMessage_t& msg)
+            {
+                uint32_t old_pos = msg.pos;
+                EntityId_t writer_id;
+                SequenceNumber_t sn;
+                msg.pos += 8;
+                CDRMessage::readEntityId(&msg, &writer_id);
+                CDRMessage::readInt32(&msg, &sn.high);
+                CDRMessage::readUInt32(&msg, &sn.low);
+                msg.pos = old_pos;
+
+                if (0 == (writer_id.value[3] & 0xC0))
+                {
+                    std::lock_guard<std::mutex> guard(sent_mutex);
+                    sent_sequences.insert(sn);
+                }
+                return false;
+            };
+
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+    DomainParticipantQos writer_participant_qos;
+    writer_participant_qos.transport().use_builtin_transports = false;
+    writer_participant_qos.transport().user_transports.push_back(testTransport);
+    DomainParticipant* writer_participant =
+            factory->create_participant((uint32_t)GET_PID() % 230, writer_participant_qos);
+    ASSERT_NE(writer_participant, nullptr);
+    DomainParticipant* reader_participant =
+            factory->create_participant((uint32_t)GET_PID() % 230, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(reader_participant, nullptr);
+
+    DynamicType_ptr dynamic_type = filtered_data_type();
+    TypeSupport type(new DynamicPubSubType(dynamic_type));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, type.register_type(writer_participant));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, type.register_type(reader_participant));
+
+    Topic* writer_topic = writer_participant->create_topic(TEST_TOPIC_NAME, type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(writer_topic, nullptr);
+    Topic* reader_topic = reader_participant->create_topic(TEST_TOPIC_NAME, type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(reader_topic, nullptr);
+    ContentFilteredTopic* filtered_topic = reader_participant->create_contentfilteredtopic(
+        TEST_TOPIC_NAME + "_filtered", reader_topic, "index > %0", {"5"});
+    ASSERT_NE(filtered_topic, nullptr);
+
+    Subscriber* subscriber = reader_participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+    ASSERT_NE(subscriber, nullptr);
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    DataReader* reader = subscriber->create_datareader(filtered_topic, reader_qos);
+    ASSERT_NE(reader, nullptr);
+
+    MatchedListener listener;
+    Publisher* publisher = writer_participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    writer_qos.durability().kind = VOLATILE_DURABILITY_QOS;
+    writer_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    // Synchronous writers send each sample to all the readers at once, leaving the filtering to them
+    writer_qos.publish_mode().kind = ASYNCHRONOUS_PUBLISH_MODE;
+    DataWriter* writer = publisher->create_datawriter(writer_topic, writer_qos, &listener);
+    ASSERT_NE(writer, nullptr);
+
+    // Wait for discovery, so the writer knows the filter of the reader
+    ASSERT_TRUE(listener.wait_matched(1));
+
+    DynamicData* data = DynamicDataFactory::get_instance()->create_data(dynamic_type);
+    ASSERT_NE(data, nullptr);
+    for (uint32_t index = 1; index <= 10; ++index)
+    {
+        data->set_uint32_value(index, 0);
+        data->set_string_value("HelloWorld", 1);
+        ASSERT_TRUE(writer->write(data));
+    }
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, writer->wait_for_acknowledgments(eprosima::fastrtps::Duration_t(10, 0)));
+
+    std::vector<uint32_t> received;
+    SampleInfo info;
+    while (received.size() < 5 && reader->wait_for_unread_message(eprosima::fastrtps::Duration_t(5, 0)))
+    {
+        while (ReturnCode_t::RETCODE_OK == reader->take_next_sample(data, &info))
+        {
+            if (info.valid_data)
+            {
+                received.push_back(data->get_uint32_value(0));
+            }
+        }
+    }
+    EXPECT_EQ(received, std::vector<uint32_t>({6, 7, 8, 9, 10}));
+
+    // The samples with indexes 1 to 5 were written with sequence numbers 1 to 5
+    {
+        std::lock_guard<std::mutex> guard(sent_mutex);
+        for (int32_t sequence = 1; sequence <= 5; ++sequence)
+        {
+            EXPECT_EQ(0u, sent_sequences.count(SequenceNumber_t(0, sequence))) << "Sample " << sequence << " sent";
+        }
+        for (int32_t sequence = 6; sequence <= 10; ++sequence)
+        {
+            EXPECT_EQ(1u, sent_sequences.count(SequenceNumber_t(0, sequence))) << "Sample " << sequence << " not sent";
+        }
+    }
+
+    DynamicDataFactory::get_instance()->delete_data(data);
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, publisher->delete_datawriter(writer));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, writer_participant->delete_publisher(publisher));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, writer_participant->delete_topic(writer_topic));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, subscriber->delete_datareader(reader));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, reader_participant->delete_subscriber(subscriber));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, reader_participant->delete_contentfilteredtopic(filtered_topic));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, reader_participant->delete_topic(reader_topic));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, factory->delete_participant(writer_participant));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, factory->delete_participant(reader_participant));
+}
@@ -0,0 +1,103 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "BlackboxTests.hpp"
+
+#include "PubSubReader.hpp"
+#include "PubSubWriter.hpp"
+#include <fastrtps/xmlparser/XMLProfileManager.h>
+
+#include <gtest/gtest.h>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+class DDSIntraprocessSamples : public testing::Test
+{
+public:
+
+    void TearDown() override
+    {
+        set_intraprocess_delivery(IntraprocessDeliveryType::INTRAPROCESS_OFF);
+    }
+
+    static void set_intraprocess_delivery(
+            IntraprocessDeliveryType delivery)
+    {
+        LibrarySettingsAttributes library_settings;
+        library_settings.intraprocess_delivery = delivery;
+        xmlparser::XMLProfileManager::library_settings(library_settings);
+    }
+
+};
+
+/*!
+ * @fn TEST_F(DDSIntraprocessSamples, RemoteReaderMatchedAfterSharedWrites)
+ * @brief This test checks a reader matched as remote receives the samples written while all the readers of the
+ * writer were local, which the writer only serializes when the remote reader is matched.
+ */
+TEST_F(DDSIntraprocessSamples, RemoteReaderMatchedAfterSharedWrites)
+{
+    set_intraprocess_delivery(IntraprocessDeliveryType::INTRAPROCESS_FULL);
+
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+    PubSubReader<HelloWorldType> local_reader(TEST_TOPIC_NAME);
+
+    writer.reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).
+            durability_kind(eprosima::fastrtps::TRANSIENT_LOCAL_DURABILITY_QOS).
+            history_kind(eprosima::fastrtps::KEEP_ALL_HISTORY_QOS).init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    local_reader.reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).
+            durability_kind(eprosima::fastrtps::TRANSIENT_LOCAL_DURABILITY_QOS).
+            history_kind(eprosima::fastrtps::KEEP_ALL_HISTORY_QOS).init();
+    ASSERT_TRUE(local_reader.isInitialized());
+
+    writer.wait_discovery();
+    local_reader.wait_discovery();
+
+    // The only matched reader is local, so the writer shares the samples instead of serializing them
+    auto data = default_helloworld_data_generator();
+    local_reader.startReception(data);
+    writer.send(data);
+    ASSERT_TRUE(data.empty());
+    local_reader.block_for_all();
+
+    // Endpoints matched from now on do not use intraprocess, so the writer sees the new reader as remote
+    set_intraprocess_delivery(IntraprocessDeliveryType::INTRAPROCESS_OFF);
+
+    PubSubReader<HelloWorldType> remote_reader(TEST_TOPIC_NAME);
+    remote_reader.reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).
+            durability_kind(eprosima::fastrtps::TRANSIENT_LOCAL_DURABILITY_QOS).
+            history_kind(eprosima::fastrtps::KEEP_ALL_HISTORY_QOS).init();
+    ASSERT_TRUE(remote_reader.isInitialized());
+
+    // The samples in the history of the writer reach the remote reader once serialized
+    auto history_data = default_helloworld_data_generator();
+    remote_reader.startReception(history_data);
+    writer.wait_discovery(2);
+    remote_reader.wait_discovery();
+    remote_reader.block_for_all();
+
+    // New samples are serialized when written, and both readers receive them
+    auto new_data = default_helloworld_data_generator(2);
+    auto local_data = new_data;
+    auto remote_data = new_data;
+    local_reader.startReception(local_data);
+    remote_reader.startReception(remote_data);
+    writer.send(new_data);
+    ASSERT_TRUE(new_data.empty());
+    local_reader.block_for_all();
+    remote_reader.block_for_all();
+}
@@ -0,0 +1,450 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "BlackboxTests.hpp"
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/statistics/StatisticsData.hpp>
+#include <fastdds/statistics/topic_names.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastdds::statistics;
+using eprosima::fastrtps::rtps::GUID_t;
+
+namespace {
+
+//! Keeps track of the writers matched by a reader
+class MatchedListener : public DataReaderListener
+{
+public:
+
+    void on_subscription_matched(
+            DataReader*,
+            const SubscriptionMatchedStatus& info) override
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        matched_ = info.current_count;
+        cv_.notify_all();
+    }
+
+    int32_t matched()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return matched_;
+    }
+
+    bool wait_matched(
+            int32_t matched)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, std::chrono::seconds(10), [&]()
+                       {
+                           return matched_ >= matched;
+                       });
+    }
+
+protected:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+
+private:
+
+    int32_t matched_ = 0;
+};
+
+//! Subscribes to a statistics topic and keeps the received samples
+class StatisticsMonitor : public MatchedListener
+{
+public:
+
+    StatisticsMonitor(
+            DomainParticipant* participant,
+            Subscriber* subscriber,
+            const char* topic_name)
+        : participant_(participant)
+        , subscriber_(subscriber)
+    {
+        topic_ = participant->create_topic(topic_name, type_name(participant), TOPIC_QOS_DEFAULT);
+        if (nullptr != topic_)
+        {
+            DataReaderQos qos = DATAREADER_QOS_DEFAULT;
+            qos.reliability().kind = BEST_EFFORT_RELIABILITY_QOS;
+            qos.history().kind = KEEP_ALL_HISTORY_QOS;
+            reader_ = subscriber->create_datareader(topic_, qos, this);
+        }
+    }
+
+    ~StatisticsMonitor()
+    {
+        if (nullptr != reader_)
+        {
+            subscriber_->delete_datareader(reader_);
+        }
+        if (nullptr != topic_)
+        {
+            participant_->delete_topic(topic_);
+        }
+    }
+
+    bool is_valid() const
+    {
+        return nullptr != reader_;
+    }
+
+    void on_data_available(
+            DataReader* reader) override
+    {
+        StatisticsData data;
+        SampleInfo info;
+        while (ReturnCode_t::RETCODE_OK == reader->take_next_sample(&data, &info))
+        {
+            if (info.valid_data)
+            {
+                std::lock_guard<std::mutex> guard(mutex_);
+                samples_.push_back(data);
+                cv_.notify_all();
+            }
+        }
+    }
+
+    //! Waits until the received samples fulfill the given predicate
+    bool wait_for(
+            const std::function<bool(const std::vector<StatisticsData>&)>& predicate,
+            std::chrono::milliseconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, timeout, [&]()
+                       {
+                           return predicate(samples_);
+                       });
+    }
+
+    std::vector<StatisticsData> samples()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return samples_;
+    }
+
+private:
+
+    static std::string type_name(
+            DomainParticipant* participant)
+    {
+        TypeSupport type(new StatisticsDataPubSubType());
+        type.register_type(participant);
+        return type.get_type_name();
+    }
+
+    DomainParticipant* participant_;
+    Subscriber* subscriber_;
+    Topic* topic_ = nullptr;
+    DataReader* reader_ = nullptr;
+
+    std::vector<StatisticsData> samples_;
+};
+
+//! Samples referring to an entity
+std::vector<StatisticsData> samples_of(
+        const std::vector<StatisticsData>& samples,
+        const GUID_t& guid)
+{
+    std::vector<StatisticsData> ret;
+    for (const StatisticsData& sample : samples)
+    {
+        if (sample.guid == guid)
+        {
+            ret.push_back(sample);
+        }
+    }
+    return ret;
+}
+
+uint64_t total_count(
+        const std::vector<StatisticsData>& samples)
+{
+    uint64_t count = 0;
+    for (const StatisticsData& sample : samples)
+    {
+        count += sample.count;
+    }
+    return count;
+}
+
+/**
+ * Participant writing HelloWorld samples, with the given statistics properties,
+ * and a participant monitoring its statistics and reading its samples.
+ */
+class StatisticsScenario
+{
+public:
+
+    StatisticsScenario(
+            const std::vector<std::pair<std::string, std::string>>& properties)
+    {
+        DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+
+        DomainParticipantQos qos;
+        for (const auto& property : properties)
+        {
+            qos.properties().properties().emplace_back(property.first, property.second);
+        }
+        monitored_ = factory->create_participant((uint32_t)GET_PID() % 230, qos);
+        monitor_ = factory->create_participant((uint32_t)GET_PID() % 230, PARTICIPANT_QOS_DEFAULT);
+        if (nullptr == monitored_ || nullptr == monitor_)
+        {
+            return;
+        }
+
+        TypeSupport type(new HelloWorldType());
+        type.register_type(monitored_);
+        type.register_type(monitor_);
+
+        writer_topic_ = monitored_->create_topic(TEST_TOPIC_NAME, type.get_type_name(), TOPIC_QOS_DEFAULT);
+        reader_topic_ = monitor_->create_topic(TEST_TOPIC_NAME, type.get_type_name(), TOPIC_QOS_DEFAULT);
+        publisher_ = monitored_->create_publisher(PUBLISHER_QOS_DEFAULT);
+        subscriber_ = monitor_->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+        if (nullptr == writer_topic_ || nullptr == reader_topic_ || nullptr == publisher_ || nullptr == subscriber_)
+        {
+            return;
+        }
+
+        writer_ = publisher_->create_datawriter(writer_topic_, DATAWRITER_QOS_DEFAULT);
+        DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+        reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+        reader_ = subscriber_->create_datareader(reader_topic_, reader_qos, &reader_listener_);
+    }
+
+    ~StatisticsScenario()
+    {
+        monitors_.clear();
+
+        if (nullptr != monitored_)
+        {
+            if (nullptr != publisher_)
+            {
+                publisher_->delete_datawriter(writer_);
+                monitored_->delete_publisher(publisher_);
+            }
+            monitored_->delete_topic(writer_topic_);
+            DomainParticipantFactory::get_instance()->delete_participant(monitored_);
+        }
+
+        if (nullptr != monitor_)
+        {
+            if (nullptr != subscriber_)
+            {
+                subscriber_->delete_datareader(reader_);
+                monitor_->delete_subscriber(subscriber_);
+            }
+            monitor_->delete_topic(reader_topic_);
+            DomainParticipantFactory::get_instance()->delete_participant(monitor_);
+        }
+    }
+
+    bool is_valid() const
+    {
+        return nullptr != writer_ && nullptr != reader_;
+    }
+
+    StatisticsMonitor& monitor(
+            const char* topic_name)
+    {
+        monitors_.emplace_back(new StatisticsMonitor(monitor_, subscriber_, topic_name));
+        return *monitors_.back();
+    }
+
+    bool write(
+            uint16_t num_samples)
+    {
+        // Data is only sent once the reader is matched
+        if (!reader_listener_.wait_matched(1))
+        {
+            return false;
+        }
+
+        HelloWorld data;
+        data.message("HelloWorld");
+        for (uint16_t index = 1; index <= num_samples; ++index)
+        {
+            data.index(index);
+            if (!writer_->write(&data))
+            {
+                return false;
+            }
+        }
+        return ReturnCode_t::RETCODE_OK == writer_->wait_for_acknowledgments(eprosima::fastrtps::Duration_t(10, 0));
+    }
+
+    const GUID_t& writer_guid()
+    {
+        return writer_->guid();
+    }
+
+private:
+
+    DomainParticipant* monitored_ = nullptr;
+    DomainParticipant* monitor_ = nullptr;
+    Topic* writer_topic_ = nullptr;
+    Topic* reader_topic_ = nullptr;
+    Publisher* publisher_ = nullptr;
+    Subscriber* subscriber_ = nullptr;
+    DataWriter* writer_ = nullptr;
+    DataReader* reader_ = nullptr;
+    MatchedListener reader_listener_;
+    std::vector<std::unique_ptr<StatisticsMonitor>> monitors_;
+};
+
+} // namespace
+
+/*!
+ * @fn TEST(DDSStatistics, PublishesEnabledTopics)
+ * @brief This test checks only the statistics topics listed on the "fastdds.statistics" property get a writer,
+ * ignoring blanks and unknown names, and that the writers publish the samples written by the user writer every
+ * "fastdds.statistics.period_ms".
+ */
+TEST(DDSStatistics, PublishesEnabledTopics)
+{
+    std::string topics = std::string(" ") + PUBLICATION_THROUGHPUT_TOPIC + " ;unknown_topic;;" + DATA_COUNT_TOPIC;
+    StatisticsScenario scenario({{STATISTICS_PROPERTY, topics}, {STATISTICS_PERIOD_PROPERTY, "100"}});
+    ASSERT_TRUE(scenario.is_valid());
+
+    StatisticsMonitor& throughput = scenario.monitor(PUBLICATION_THROUGHPUT_TOPIC);
+    StatisticsMonitor& data_count = scenario.monitor(DATA_COUNT_TOPIC);
+    StatisticsMonitor& heartbeats = scenario.monitor(HEARTBEAT_COUNT_TOPIC);
+    ASSERT_TRUE(throughput.is_valid());
+    ASSERT_TRUE(data_count.is_valid());
+    ASSERT_TRUE(heartbeats.is_valid());
+
+    const GUID_t& writer_guid = scenario.writer_guid();
+
+    // Samples are published every period, even when nothing was written
+    ASSERT_TRUE(throughput.wait_for([&](const std::vector<StatisticsData>& samples)
+            {
+                return samples_of(samples, writer_guid).size() >= 2;
+            }, std::chrono::seconds(10)));
+    ASSERT_TRUE(data_count.wait_for([&](const std::vector<StatisticsData>& samples)
+            {
+                return !samples_of(samples, writer_guid).empty();
+            }, std::chrono::seconds(10)));
+
+    ASSERT_TRUE(scenario.write(10));
+
+    EXPECT_TRUE(throughput.wait_for([&](const std::vector<StatisticsData>& samples)
+            {
+                return total_count(samples_of(samples, writer_guid)) >= 10;
+            }, std::chrono::seconds(5)));
+    EXPECT_TRUE(data_count.wait_for([&](const std::vector<StatisticsData>& samples)
+            {
+                return total_count(samples_of(samples, writer_guid)) >= 10;
+            }, std::chrono::seconds(5)));
+
+    std::vector<StatisticsData> throughput_samples = samples_of(throughput.samples(), writer_guid);
+    EXPECT_EQ(10u, total_count(throughput_samples));
+    for (const StatisticsData& sample : throughput_samples)
+    {
+        EXPECT_EQ(static_cast<uint32_t>(PUBLICATION_THROUGHPUT), sample.kind);
+        EXPECT_LE(0.0, sample.value);
+    }
+    for (const StatisticsData& sample : samples_of(data_count.samples(), writer_guid))
+    {
+        EXPECT_EQ(static_cast<uint32_t>(DATA_COUNT), sample.kind);
+        EXPECT_EQ(0u == sample.count, 0u == sample.bytes);
+    }
+
+    // With a 100 ms period, one second gets around ten publications
+    size_t published = samples_of(throughput.samples(), writer_guid).size();
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    size_t published_in_one_second = samples_of(throughput.samples(), writer_guid).size() - published;
+    EXPECT_GE(published_in_one_second, 4u);
+    EXPECT_LE(published_in_one_second, 20u);
+
+    // Topics not listed on the property do not get a writer
+    EXPECT_EQ(0, heartbeats.matched());
+    EXPECT_TRUE(heartbeats.samples().empty());
+}
+
+/*!
+ * @fn TEST(DDSStatistics, WrongPeriodUsesDefault)
+ * @brief This test checks a wrong "fastdds.statistics.period_ms" is ignored, and the statistics are published
+ * with the default period of one second.
+ */
+TEST(DDSStatistics, WrongPeriodUsesDefault)
+{
+    StatisticsScenario scenario({{STATISTICS_PROPERTY, PUBLICATION_THROUGHPUT_TOPIC},
+                                 {STATISTICS_PERIOD_PROPERTY, "0"}});
+    ASSERT_TRUE(scenario.is_valid());
+
+    StatisticsMonitor& throughput = scenario.monitor(PUBLICATION_THROUGHPUT_TOPIC);
+    ASSERT_TRUE(throughput.is_valid());
+
+    const GUID_t& writer_guid = scenario.writer_guid();
+    ASSERT_TRUE(throughput.wait_for([&](const std::vector<StatisticsData>& samples)
+            {
+                return !samples_of(samples, writer_guid).empty();
+            }, std::chrono::seconds(10)));
+
+    size_t published = samples_of(throughput.samples(), writer_guid).size();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+    size_t published_in_period = samples_of(throughput.samples(), writer_guid).size() - published;
+    EXPECT_GE(published_in_period, 1u);
+    EXPECT_LE(published_in_period, 2u);
+}
+
+/*!
+ * @fn TEST(DDSStatistics, DisabledWithoutKnownTopics)
+ * @brief This test checks no statistics writer is created without the "fastdds.statistics" property, or when it
+ * does not list any known topic.
+ */
+TEST(DDSStatistics, DisabledWithoutKnownTopics)
+{
+    for (const std::vector<std::pair<std::string, std::string>>& properties :
+            {std::vector<std::pair<std::string, std::string>>(),
+             std::vector<std::pair<std::string, std::string>>({{STATISTICS_PROPERTY, "unknown_topic; "}})})
+    {
+        StatisticsScenario scenario(properties);
+        ASSERT_TRUE(scenario.is_valid());
+
+        StatisticsMonitor& throughput = scenario.monitor(PUBLICATION_THROUGHPUT_TOPIC);
+        ASSERT_TRUE(throughput.is_valid());
+        ASSERT_TRUE(scenario.write(10));
+
+        // Give time for the discovery of a statistics writer, if any
+        EXPECT_FALSE(throughput.wait_for([&](const std::vector<StatisticsData>& samples)
+                {
+                    return !samples.empty();
+                }, std::chrono::seconds(2)));
+        EXPECT_EQ(0, throughput.matched());
+    }
+}
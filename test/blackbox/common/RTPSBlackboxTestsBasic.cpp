@@ -18,12 +18,19 @@
 #include "RTPSAsSocketWriter.hpp"
 #include "RTPSWithRegistrationReader.hpp"
 #include "RTPSWithRegistrationWriter.hpp"
+#include <fastdds/rtps/messages/CDRMessage.h>
 #include <fastrtps/xmlparser/XMLProfileManager.h>
 #include <fastrtps/transport/test_UDPv4Transport.h>
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
@@ -445,6 +452,327 @@ TEST_P(RTPS, RTPSAsReliableWithRegistrationAndHolesInHistory)
 }
 
 
+/*!
+ * @fn TEST(RTPSAdaptiveHeartbeat, PeriodShortenedWhileReaderLags)
+ * @brief This test checks the adaptive heartbeat period of a writer shrinks when a reader NACKs a lost sample.
+ * The NACK halves the period, which should reschedule the heartbeat already armed.
+ */
+TEST(RTPSAdaptiveHeartbeat, PeriodShortenedWhileReaderLags)
+{
+    // Declared before the entities, as the transport filters use them until the participants are destroyed
+    std::mutex heartbeats_mutex;
+    std::vector<std::chrono::steady_clock::time_point> heartbeats;
+    std::atomic<bool> sample_dropped(false);
+    std::atomic<bool> record_heartbeats(false);
+
+    RTPSWithRegistrationReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    RTPSWithRegistrationWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    auto testTransport = std::make_shared<rtps::test_UDPv4TransportDescriptor>();
+    // Lose the second sample once, so the reader NACKs it on the first periodic heartbeat
+    testTransport->drop_data_messages_filter_ = [&sample_dropped](rtps::CDRMessage_t& msg)
+            {
+                uint32_t old_pos = msg.pos;
+                EntityId_t writer_id;
+                SequenceNumber_t sn;
+                msg.pos += 8;
+                CDRMessage::readEntityId(&msg, &writer_id);
+                CDRMessage::readInt32(&msg, &sn.high);
+                CDRMessage::readUInt32(&msg, &sn.low);
+                msg.pos = old_pos;
+
+                return 0 == (writer_id.value[3] & 0xC0) && SequenceNumber_t(0, 2) == sn &&
+                       !sample_dropped.exchange(true);
+            };
+    // Only the heartbeats of the user writer are recorded, the ones of the builtin writers are ignored
+    testTransport->drop_heartbeat_messages_filter_ = [&](rtps::CDRMessage_t& msg)
+            {
+                if (record_heartbeats && 0 == (msg.buffer[msg.pos + 7] & 0xC0))
+                {
+                    std::lock_guard<std::mutex> guard(heartbeats_mutex);
+                    heartbeats.push_back(std::chrono::steady_clock::now());
+                }
+                return false;
+            };
+
+    reader.reliability(eprosima::fastrtps::rtps::ReliabilityKind_t::RELIABLE).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    // The configured period is long enough to tell the shortened periods apart
+    writer.heartbeat_period_seconds(4).heartbeat_period_nanosec(0).
+            adaptive_heartbeat(Duration_t(0, 100000000), Duration_t(30, 0)).
+            disable_heartbeat_piggyback(true).
+            disable_builtin_transport().
+            add_user_transport_to_pparams(testTransport).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    reader.expected_data(data);
+    reader.startReception();
+
+    record_heartbeats = true;
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+    ASSERT_TRUE(writer.waitForAllAcked(std::chrono::seconds(10)));
+    EXPECT_TRUE(sample_dropped);
+
+    // The heartbeat answered with the NACK leaves 4s to the next one, which the NACK shortens to 4s / 2
+    std::lock_guard<std::mutex> guard(heartbeats_mutex);
+    ASSERT_GE(heartbeats.size(), 2u);
+    EXPECT_LT(heartbeats[1] - heartbeats[0], std::chrono::milliseconds(3000));
+}
+
+/*!
+ * @fn TEST(RTPSAdaptiveHeartbeat, PeriodHalvedWhileUnacknowledgedDataGrows)
+ * @brief This test checks the adaptive heartbeat period of a writer is halved on each periodic heartbeat while the
+ * reader does not acknowledge what the previous one announced, and is reset to the configured period once the
+ * reader is in sync.
+ */
+TEST(RTPSAdaptiveHeartbeat, PeriodHalvedWhileUnacknowledgedDataGrows)
+{
+    // Declared before the entities, as the transport filter uses it until the participants are destroyed
+    std::atomic<bool> drop_heartbeats(true);
+
+    RTPSWithRegistrationReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    RTPSWithRegistrationWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    auto testTransport = std::make_shared<rtps::test_UDPv4TransportDescriptor>();
+    // Without the heartbeats of the user writer, the reader never acknowledges the data
+    testTransport->drop_heartbeat_messages_filter_ = [&drop_heartbeats](rtps::CDRMessage_t& msg)
+            {
+                return drop_heartbeats && 0 == (msg.buffer[msg.pos + 7] & 0xC0);
+            };
+
+    reader.reliability(eprosima::fastrtps::rtps::ReliabilityKind_t::RELIABLE).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.heartbeat_period_seconds(1).heartbeat_period_nanosec(0).
+            adaptive_heartbeat(Duration_t(0, 100000000), Duration_t(30, 0)).
+            disable_heartbeat_piggyback(true).
+            disable_builtin_transport().
+            add_user_transport_to_pparams(testTransport).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    reader.expected_data(data);
+    reader.startReception();
+
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+
+    // The first heartbeat only announces the data, the next ones halve the period: 1s, 500ms, 250ms
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (writer.heartbeat_period_ms() > 250.0 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    EXPECT_LE(writer.heartbeat_period_ms(), 250.0);
+
+    drop_heartbeats = false;
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+    ASSERT_TRUE(writer.waitForAllAcked(std::chrono::seconds(10)));
+
+    // The heartbeat finding the reader in sync resets the period
+    deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (writer.heartbeat_period_ms() != 1000.0 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    EXPECT_EQ(writer.heartbeat_period_ms(), 1000.0);
+}
+
+/*!
+ * @fn TEST(RTPSAdaptiveHeartbeat, PeriodBacksOffWhileReaderKeepsUp)
+ * @brief This test checks the adaptive heartbeat period of a writer sending data continuously is doubled on each
+ * periodic heartbeat while the reader acknowledges what the previous one announced.
+ */
+TEST(RTPSAdaptiveHeartbeat, PeriodBacksOffWhileReaderKeepsUp)
+{
+    RTPSWithRegistrationReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    RTPSWithRegistrationWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.reliability(eprosima::fastrtps::rtps::ReliabilityKind_t::RELIABLE).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.heartbeat_period_seconds(0).heartbeat_period_nanosec(200000000).
+            adaptive_heartbeat(Duration_t(0, 100000000), Duration_t(30, 0)).
+            disable_heartbeat_piggyback(true).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator(200);
+
+    reader.expected_data(data);
+    reader.startReception();
+
+    // One sample every 20ms keeps unacknowledged data on every heartbeat: 200ms, 400ms, 800ms
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!data.empty() && writer.heartbeat_period_ms() < 800.0 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::list<HelloWorld> sample;
+        sample.splice(sample.end(), data, data.begin());
+        writer.send(sample);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    EXPECT_GE(writer.heartbeat_period_ms(), 800.0);
+
+    writer.send(data);
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+    ASSERT_TRUE(writer.waitForAllAcked(std::chrono::seconds(10)));
+}
+
+/*!
+ * Sends the default samples from a writer with separate sending to three reliable readers, each one listening on
+ * the multicast port given for it. The first send of the second sample to each reader is lost, so all of them NACK
+ * it on the same heartbeat.
+ *
+ * @param ports Multicast port of each reader.
+ * @param repairs Number of times the lost sample is sent again.
+ * @param coalesced_repairs Number of coalesced repairs reported by the writer.
+ * @param saved_retransmissions Number of saved retransmissions reported by the writer.
+ */
+static void repair_sample_lost_by_three_readers(
+        const std::array<uint16_t, 3>& ports,
+        uint32_t& repairs,
+        uint64_t& coalesced_repairs,
+        uint64_t& saved_retransmissions)
+{
+    // Declared before the entities, as the transport filter uses it until the participants are destroyed
+    std::atomic<uint32_t> sample_sends(0);
+
+    std::array<std::unique_ptr<RTPSWithRegistrationReader<HelloWorldType>>, 3> readers;
+    RTPSWithRegistrationWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    auto testTransport = std::make_shared<rtps::test_UDPv4TransportDescriptor>();
+    testTransport->drop_data_messages_filter_ = [&sample_sends](rtps::CDRMessage_t& msg)
+            {
+                uint32_t old_pos = msg.pos;
+                EntityId_t writer_id;
+                SequenceNumber_t sn;
+                msg.pos += 8;
+                CDRMessage::readEntityId(&msg, &writer_id);
+                CDRMessage::readInt32(&msg, &sn.high);
+                CDRMessage::readUInt32(&msg, &sn.low);
+                msg.pos = old_pos;
+
+                return 0 == (writer_id.value[3] & 0xC0) && SequenceNumber_t(0, 2) == sn && sample_sends++ < 3;
+            };
+
+    std::string ip("239.255.1.4");
+    for (size_t i = 0; i < readers.size(); ++i)
+    {
+        readers[i].reset(new RTPSWithRegistrationReader<HelloWorldType>(TEST_TOPIC_NAME));
+        readers[i]->reliability(eprosima::fastrtps::rtps::ReliabilityKind_t::RELIABLE).
+                add_to_multicast_locator_list(ip, ports[i]).init();
+
+        ASSERT_TRUE(readers[i]->isInitialized());
+    }
+
+    // Only the periodic heartbeat announces the lost sample, so the NACKs of all the readers arrive together
+    writer.heartbeat_period_seconds(1).heartbeat_period_nanosec(0).
+            disable_heartbeat_piggyback(true).
+            separate_sending(true).
+            disable_builtin_transport().
+            add_user_transport_to_pparams(testTransport).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery(static_cast<unsigned int>(readers.size()));
+    for (auto& reader : readers)
+    {
+        reader->wait_discovery();
+    }
+
+    auto data = default_helloworld_data_generator();
+
+    for (auto& reader : readers)
+    {
+        reader->expected_data(data);
+        reader->startReception();
+    }
+
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block readers until reception finished or timeout.
+    for (auto& reader : readers)
+    {
+        reader->block_for_all();
+    }
+    ASSERT_TRUE(writer.waitForAllAcked(std::chrono::seconds(10)));
+
+    ASSERT_GE(sample_sends.load(), 3u);
+    repairs = sample_sends - 3;
+    coalesced_repairs = writer.coalesced_repairs_count();
+    saved_retransmissions = writer.saved_retransmissions_count();
+}
+
+/*!
+ * @fn TEST(RTPSCoalescedRepairs, ReadersSharingLocator)
+ * @brief This test checks a sample NACKed by two readers sharing a multicast locator is sent again only once to
+ * both, while the reader on another locator still receives its own repair.
+ */
+TEST(RTPSCoalescedRepairs, ReadersSharingLocator)
+{
+    uint32_t repairs = 0;
+    uint64_t coalesced_repairs = 0;
+    uint64_t saved_retransmissions = 0;
+    repair_sample_lost_by_three_readers({global_port, global_port, static_cast<uint16_t>(global_port + 1)},
+            repairs, coalesced_repairs, saved_retransmissions);
+
+    EXPECT_EQ(2u, repairs);
+    EXPECT_EQ(1u, coalesced_repairs);
+    EXPECT_EQ(1u, saved_retransmissions);
+}
+
+/*!
+ * @fn TEST(RTPSCoalescedRepairs, ReadersOnDifferentLocators)
+ * @brief This test checks repairs requested by readers not sharing any multicast locator are sent separately to
+ * each of them.
+ */
+TEST(RTPSCoalescedRepairs, ReadersOnDifferentLocators)
+{
+    uint32_t repairs = 0;
+    uint64_t coalesced_repairs = 0;
+    uint64_t saved_retransmissions = 0;
+    repair_sample_lost_by_three_readers({global_port, static_cast<uint16_t>(global_port + 1),
+                                         static_cast<uint16_t>(global_port + 2)},
+            repairs, coalesced_repairs, saved_retransmissions);
+
+    EXPECT_EQ(3u, repairs);
+    EXPECT_EQ(0u, coalesced_repairs);
+    EXPECT_EQ(0u, saved_retransmissions);
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z, w) INSTANTIATE_TEST_SUITE_P(x, y, z, w)
 #else
@@ -28,6 +28,7 @@
 #include <fastrtps/qos/WriterQos.h>
 #include <fastrtps/attributes/TopicAttributes.h>
 #include <fastrtps/rtps/writer/RTPSWriter.h>
+#include <fastrtps/rtps/writer/StatefulWriter.h>
 #include <fastrtps/rtps/attributes/HistoryAttributes.h>
 #include <fastrtps/rtps/history/WriterHistory.h>
 #include <fastrtps/transport/TransportDescriptorInterface.h>
@@ -157,6 +158,8 @@ public:
             return;
         }
 
+        writer_->set_separate_sending(separate_sending_);
+
         ASSERT_EQ(participant_->registerWriter(writer_, topic_attr_, writer_qos_), true);
 
         initialized_ = true;
@@ -230,19 +233,20 @@ public:
         cv_.notify_one();
     }
 
-    void wait_discovery()
+    void wait_discovery(
+            unsigned int matched = 1)
     {
         std::unique_lock<std::mutex> lock(mutex_);
 
-        if (matched_ == 0)
+        if (matched_ < matched)
         {
-            cv_.wait(lock, [this]() -> bool
+            cv_.wait(lock, [this, matched]() -> bool
                     {
-                        return matched_ != 0;
+                        return matched_ >= matched;
                     });
         }
 
-        ASSERT_NE(matched_, 0u);
+        ASSERT_GE(matched_, matched);
     }
 
     void wait_undiscovery()
@@ -269,6 +273,21 @@ public:
         return writer_->wait_for_all_acked(eprosima::fastrtps::Time_t((int32_t)max_wait.count(), 0));
     }
 
+    double heartbeat_period_ms() const
+    {
+        return static_cast<eprosima::fastrtps::rtps::StatefulWriter*>(writer_)->get_heartbeat_period_ms();
+    }
+
+    uint64_t coalesced_repairs_count() const
+    {
+        return static_cast<eprosima::fastrtps::rtps::StatefulWriter*>(writer_)->get_coalesced_repairs_count();
+    }
+
+    uint64_t saved_retransmissions_count() const
+    {
+        return static_cast<eprosima::fastrtps::rtps::StatefulWriter*>(writer_)->get_saved_retransmissions_count();
+    }
+
     /*** Function to change QoS ***/
     RTPSWithRegistrationWriter& payload_pool(
             const std::shared_ptr<eprosima::fastrtps::rtps::IPayloadPool>& pool)
@@ -343,6 +362,30 @@ public:
         return *this;
     }
 
+    RTPSWithRegistrationWriter& adaptive_heartbeat(
+            const eprosima::fastrtps::Duration_t& min_period,
+            const eprosima::fastrtps::Duration_t& max_period)
+    {
+        writer_attr_.times.adaptiveHeartbeat = true;
+        writer_attr_.times.minHeartbeatPeriod = min_period;
+        writer_attr_.times.maxHeartbeatPeriod = max_period;
+        return *this;
+    }
+
+    RTPSWithRegistrationWriter& disable_heartbeat_piggyback(
+            bool disable)
+    {
+        writer_attr_.disable_heartbeat_piggyback = disable;
+        return *this;
+    }
+
+    RTPSWithRegistrationWriter& separate_sending(
+            bool enable)
+    {
+        separate_sending_ = enable;
+        return *this;
+    }
+
     RTPSWithRegistrationWriter& add_property(
             const std::string& prop,
             const std::string& value)
@@ -418,6 +461,7 @@ private:
     type_support type_;
     std::shared_ptr<eprosima::fastrtps::rtps::IPayloadPool> payload_pool_;
     bool has_payload_pool_ = false;
+    bool separate_sending_ = false;
 };
 
 #endif // _TEST_BLACKBOX_RTPSWITHREGISTRATIONWRITER_HPP_
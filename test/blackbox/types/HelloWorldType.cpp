@@ -84,6 +84,12 @@ void HelloWorldType::deleteData(void* data)
     delete((HelloWorld*)data);
 }
 
+bool HelloWorldType::copy_sample(const void* src, void* dst) const
+{
+    *(HelloWorld*)dst = *(const HelloWorld*)src;
+    return true;
+}
+
 bool HelloWorldType::getKey(void* /*data*/, InstanceHandle_t* /*ihandle*/, bool /*force_md5*/)
 {
     return false;
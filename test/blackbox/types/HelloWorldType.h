@@ -37,6 +37,7 @@ class HelloWorldType:public eprosima::fastrtps::TopicDataType
         bool getKey(void*data, eprosima::fastrtps::rtps::InstanceHandle_t* ihandle, bool force_md5);
         void* createData();
         void deleteData(void* data);
+        bool copy_sample(const void* src, void* dst) const override;
 };
 
 #endif /* HELLOWORLDTOPIC_H_ */
@@ -97,6 +97,11 @@ void KeyedHelloWorldType::deleteData(void* data) {
     delete((KeyedHelloWorld*)data);
 }
 
+bool KeyedHelloWorldType::copy_sample(const void *src, void *dst) const {
+    *(KeyedHelloWorld*)dst = *(const KeyedHelloWorld*)src;
+    return true;
+}
+
 bool KeyedHelloWorldType::getKey(void *data, InstanceHandle_t* handle, bool force_md5) {
     if(!m_isGetKeyDefined)
         return false;
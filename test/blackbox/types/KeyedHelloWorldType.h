@@ -43,6 +43,7 @@ public:
 	bool getKey(void *data, eprosima::fastrtps::rtps::InstanceHandle_t *ihandle, bool force_md5);
 	void* createData();
 	void deleteData(void * data);
+	bool copy_sample(const void *src, void *dst) const override;
 	MD5 m_md5;
 	unsigned char* m_keyBuffer;
 };
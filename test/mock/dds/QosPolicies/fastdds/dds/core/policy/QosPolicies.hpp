@@ -1169,6 +1169,48 @@ public:
 
 };
 
+/**
+ * Class BatchQosPolicy, configures the writer to coalesce several small samples into a single batch submessage.
+ */
+class BatchQosPolicy : public QosPolicy
+{
+public:
+
+    RTPS_DllAPI BatchQosPolicy()
+        : QosPolicy(false)
+        , enable(false)
+        , max_samples(0)
+        , max_data_bytes(1024)
+        , max_flush_delay(0, 1000000)
+    {
+    }
+
+    virtual RTPS_DllAPI ~BatchQosPolicy() = default;
+
+    bool operator ==(
+            const BatchQosPolicy& b) const
+    {
+        return (this->enable == b.enable) &&
+               (this->max_samples == b.max_samples) &&
+               (this->max_data_bytes == b.max_data_bytes) &&
+               (this->max_flush_delay == b.max_flush_delay);
+    }
+
+    inline void clear() override
+    {
+        BatchQosPolicy reset = BatchQosPolicy();
+        std::swap(*this, reset);
+    }
+
+    bool enable;
+
+    uint32_t max_samples;
+
+    uint32_t max_data_bytes;
+
+    fastrtps::Duration_t max_flush_delay;
+};
+
 /**
  * Enum DataRepresentationId, different kinds of topic data representation
  */
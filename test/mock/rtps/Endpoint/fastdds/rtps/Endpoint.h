@@ -23,6 +23,14 @@
 #include <fastdds/rtps/attributes/EndpointAttributes.h>
 
 namespace eprosima {
+namespace fastdds {
+namespace statistics {
+
+class EndpointStatistics;
+
+} // namespace statistics
+} // namespace fastdds
+
 namespace fastrtps {
 namespace rtps {
 
@@ -44,6 +52,11 @@ public:
         return m_att;
     }
 
+    fastdds::statistics::EndpointStatistics* statistics() const
+    {
+        return nullptr;
+    }
+
 #if HAVE_SECURITY
     bool supports_rtps_protection_;
 #endif // HAVE_SECURITY
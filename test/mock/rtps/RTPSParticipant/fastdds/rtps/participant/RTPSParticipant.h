@@ -19,6 +19,7 @@
 #include <cstdlib>
 #include <memory>
 #include <fastrtps/fastrtps_dll.h>
+#include <fastdds/rtps/common/ContentFilterProperty.hpp>
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/reader/StatefulReader.h>
 #include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
@@ -127,15 +128,17 @@ public:
                 const TopicAttributes& topicAtt,
                 const WriterQos& wqos));
 
-    MOCK_METHOD3(registerReader, bool(
+    MOCK_METHOD4(registerReader, bool(
                 RTPSReader * Reader,
                 const TopicAttributes& topicAtt,
-                const ReaderQos& rqos));
+                const ReaderQos& rqos,
+                const fastdds::rtps::ContentFilterProperty* content_filter));
 
-    MOCK_METHOD3(updateReader, bool(
+    MOCK_METHOD4(updateReader, bool(
                 RTPSReader * Reader,
                 const TopicAttributes& topicAtt,
-                const ReaderQos& rqos));
+                const ReaderQos& rqos,
+                const fastdds::rtps::ContentFilterProperty* content_filter));
 
     const RTPSParticipantAttributes& getRTPSParticipantAttributes()
     {
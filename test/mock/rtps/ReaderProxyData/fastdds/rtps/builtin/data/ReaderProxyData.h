@@ -21,6 +21,7 @@
 
 #include <fastrtps/rtps/common/Guid.h>
 #include <fastrtps/rtps/common/RemoteLocators.hpp>
+#include <fastdds/rtps/common/ContentFilterProperty.hpp>
 #include <fastrtps/qos/ReaderQos.h>
 #include <fastrtps/rtps/attributes/RTPSParticipantAllocationAttributes.hpp>
 
@@ -306,6 +307,17 @@ public:
         return m_userDefinedId;
     }
 
+    void content_filter(
+            const fastdds::rtps::ContentFilterProperty& filter)
+    {
+        content_filter_ = filter;
+    }
+
+    const fastdds::rtps::ContentFilterProperty& content_filter() const
+    {
+        return content_filter_;
+    }
+
 #if HAVE_SECURITY
     security::EndpointSecurityAttributesMask security_attributes_ = 0UL;
     security::PluginEndpointSecurityAttributesMask plugin_security_attributes_ = 0UL;
@@ -328,6 +340,7 @@ private:
     InstanceHandle_t m_key;
     InstanceHandle_t m_RTPSParticipantKey;
     uint16_t m_userDefinedId;
+    fastdds::rtps::ContentFilterProperty content_filter_;
 
 };
 
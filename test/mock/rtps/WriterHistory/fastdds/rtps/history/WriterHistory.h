@@ -105,6 +105,12 @@ public:
         return ret;
     }
 
+    virtual bool remove_change_g(
+            CacheChange_t* a_change)
+    {
+        return remove_change(a_change);
+    }
+
     void wait_for_more_samples_than(
             unsigned int minimum)
     {
@@ -0,0 +1,750 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReliabilityTest.cpp
+ *
+ * Measures how the reliability protocol recovers from network impairments with different QoS settings.
+ * A reliable writer sends samples at a fixed rate to N reliable readers, each one behind its own lossy link
+ * simulated by test_UDPv4Transport, which impairs the datagrams sent to the unicast port of the reader, and the
+ * ACKNACKs sent by the reader.
+ * The test is run once for each combination of the swept settings, and a CSV line is reported for each one with
+ * the delivered throughput, the 99.9th percentile of the latency, and the repairs, heartbeats and acknacks sent.
+ */
+
+#include "../optionparser.h"
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/ReaderAttributes.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/attributes/WriterAttributes.h>
+#include <fastdds/rtps/common/MatchingInfo.h>
+#include <fastdds/rtps/history/ReaderHistory.h>
+#include <fastdds/rtps/history/WriterHistory.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/reader/ReaderListener.h>
+#include <fastdds/rtps/reader/RTPSReader.h>
+#include <fastdds/rtps/transport/test_UDPv4Transport.h>
+#include <fastdds/rtps/transport/test_UDPv4TransportDescriptor.h>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastdds/rtps/writer/WriterListener.h>
+#include <fastrtps/attributes/TopicAttributes.h>
+#include <fastrtps/qos/ReaderQos.h>
+#include <fastrtps/qos/WriterQos.h>
+#include <fastrtps/utils/IPLocator.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+using eprosima::fastdds::rtps::test_UDPv4Transport;
+using eprosima::fastdds::rtps::test_UDPv4TransportDescriptor;
+
+struct Arg : public option::Arg
+{
+
+    static void print_error(
+            const char* msg1,
+            const option::Option& opt,
+            const char* msg2)
+    {
+        fprintf(stderr, "%s", msg1);
+        fwrite(opt.name, opt.namelen, 1, stderr);
+        fprintf(stderr, "%s", msg2);
+    }
+
+    static option::ArgStatus Unknown(
+            const option::Option& option,
+            bool msg)
+    {
+        if (msg)
+        {
+            print_error("Unknown option '", option, "'\n");
+        }
+        return option::ARG_ILLEGAL;
+    }
+
+    static option::ArgStatus Required(
+            const option::Option& option,
+            bool msg)
+    {
+        if (option.arg != 0 && option.arg[0] != 0)
+        {
+            return option::ARG_OK;
+        }
+
+        if (msg)
+        {
+            print_error("Option '", option, "' requires an argument\n");
+        }
+        return option::ARG_ILLEGAL;
+    }
+
+    static option::ArgStatus Numeric(
+            const option::Option& option,
+            bool msg)
+    {
+        char* endptr = 0;
+        if (option.arg != 0 && strtol(option.arg, &endptr, 10))
+        {
+        }
+        if (endptr != option.arg && *endptr == 0)
+        {
+            return option::ARG_OK;
+        }
+
+        if (msg)
+        {
+            print_error("Option '", option, "' requires a numeric argument\n");
+        }
+        return option::ARG_ILLEGAL;
+    }
+
+};
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    READERS,
+    SAMPLES,
+    RATE,
+    MSG_SIZE,
+    IMPAIRMENT,
+    HEARTBEAT_PERIOD,
+    NACK_RESPONSE_DELAY,
+    HISTORY_DEPTH,
+    ADAPTIVE_HEARTBEAT,
+    DRAIN_TIME,
+    SEED,
+    FORCED_DOMAIN,
+    EXPORT_CSV
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT,         0, "",  "",                    Arg::None,
+      "Usage: ReliabilityTest [options]\n\nGeneral options:" },
+    { HELP,                0, "h", "help",                Arg::None,
+      "  -h         --help                         Produce help message." },
+    { READERS,             0, "n", "readers",             Arg::Numeric,
+      "  -n <num>,  --readers=<num>                Number of readers (Defaults: 3)." },
+    { SAMPLES,             0, "",  "samples",             Arg::Numeric,
+      "             --samples=<num>                Samples sent with each setting (Defaults: 10000)." },
+    { RATE,                0, "",  "rate",                Arg::Numeric,
+      "             --rate=<num>                   Samples sent per second (Defaults: 5000)." },
+    { MSG_SIZE,            0, "s", "msg_size",            Arg::Numeric,
+      "  -s <num>,  --msg_size=<num>               Size of the samples in bytes, at least 16 (Defaults: 512)." },
+    { IMPAIRMENT,          0, "i", "impairment",          Arg::Required,
+      "  -i <arg>,  --impairment=<arg>             Impairment of a reader link, as "
+      "LOSS[:BURST[:DELAY_US[:REORDER]]] with the loss and reorder percentages. Repeat it to give each reader its "
+      "own, readers beyond the last one wrap around (Defaults: 5:3:100:1)." },
+    { UNKNOWN_OPT,         0, "",  "",                    Arg::None,
+      "\nSwept settings, as comma separated lists:" },
+    { HEARTBEAT_PERIOD,    0, "",  "heartbeat_period",    Arg::Required,
+      "             --heartbeat_period=<list>      Heartbeat periods in ms (Defaults: 10,100,1000)." },
+    { NACK_RESPONSE_DELAY, 0, "",  "nack_response_delay", Arg::Required,
+      "             --nack_response_delay=<list>   Nack response delays in ms (Defaults: 5)." },
+    { HISTORY_DEPTH,       0, "",  "history_depth",       Arg::Required,
+      "             --history_depth=<list>         Depth of the writer history, old samples are removed when it "
+      "is full, so they are not repaired anymore (Defaults: 100,10000)." },
+    { ADAPTIVE_HEARTBEAT,  0, "",  "adaptive_heartbeat",  Arg::Required,
+      "             --adaptive_heartbeat=<list>    Adaptive heartbeat disabled (0) or enabled (1) (Defaults: 0)." },
+    { UNKNOWN_OPT,         0, "",  "",                    Arg::None,
+      "\nOther options:" },
+    { DRAIN_TIME,          0, "",  "drain_time",          Arg::Numeric,
+      "             --drain_time=<num>             Maximum time in ms to wait for the repairs after the last sample "
+      "is sent (Defaults: 5000)." },
+    { SEED,                0, "",  "seed",                Arg::Numeric,
+      "             --seed=<num>                   Seed of the impairments (Defaults: 1)." },
+    { FORCED_DOMAIN,       0, "",  "domain",              Arg::Numeric,
+      "             --domain=<num>                 Set the domain to connect (Defaults: 0)." },
+    { EXPORT_CSV,          0, "",  "export_csv",          Arg::Required,
+      "             --export_csv=<file>            Also write the results to a CSV file." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+namespace {
+
+const uint32_t reader_port_base = 17400;
+
+//! QoS settings of a run
+struct Setting
+{
+    uint32_t heartbeat_period_ms;
+    uint32_t nack_response_delay_ms;
+    uint32_t history_depth;
+    bool adaptive_heartbeat;
+};
+
+//! Counts the readers matched by the writer
+class MatchCounter : public WriterListener
+{
+public:
+
+    void onWriterMatched(
+            RTPSWriter*,
+            MatchingInfo& info) override
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (info.status == MATCHED_MATCHING)
+        {
+            ++matched_;
+        }
+        else
+        {
+            --matched_;
+        }
+        cv_.notify_all();
+    }
+
+    //! Waits until the writer has matched the expected readers, returning false on timeout.
+    bool wait(
+            uint32_t expected,
+            const std::chrono::steady_clock::time_point& deadline)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_until(lock, deadline, [this, expected]()
+                       {
+                           return matched_ >= expected;
+                       });
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    uint32_t matched_ = 0;
+};
+
+//! Gathers the latency of the samples received by a reader
+class SampleCollector : public ReaderListener
+{
+public:
+
+    SampleCollector(
+            uint32_t samples)
+        : received_(samples, false)
+    {
+        latencies_ns_.reserve(samples);
+    }
+
+    void onNewCacheChangeAdded(
+            RTPSReader* reader,
+            const CacheChange_t* const change) override
+    {
+        auto now = std::chrono::steady_clock::now();
+        uint64_t index = 0;
+        int64_t sent_ns = 0;
+        if (change->serializedPayload.length >= sizeof(index) + sizeof(sent_ns))
+        {
+            memcpy(&index, change->serializedPayload.data, sizeof(index));
+            memcpy(&sent_ns, change->serializedPayload.data + sizeof(index), sizeof(sent_ns));
+
+            std::lock_guard<std::mutex> guard(mutex_);
+            if (index < received_.size() && !received_[index])
+            {
+                received_[index] = true;
+                ++delivered_;
+                delivered_bytes_ += change->serializedPayload.length;
+                last_reception_ = now;
+                latencies_ns_.push_back(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            now.time_since_epoch()).count() - sent_ns));
+            }
+            cv_.notify_all();
+        }
+
+        reader->getHistory()->remove_change((CacheChange_t*)change);
+    }
+
+    //! Waits until every sample in [first, last] has been received, returning false on timeout.
+    bool wait(
+            uint64_t first,
+            uint64_t last,
+            const std::chrono::steady_clock::time_point& deadline)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_until(lock, deadline, [this, first, last]()
+                       {
+                           return std::find(received_.begin() + first, received_.begin() + last + 1, false) ==
+                           received_.begin() + last + 1;
+                       });
+    }
+
+    uint64_t delivered_ = 0;
+    uint64_t delivered_bytes_ = 0;
+    std::chrono::steady_clock::time_point last_reception_;
+    std::vector<uint64_t> latencies_ns_;
+
+private:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<bool> received_;
+};
+
+//! Parses a comma separated list of numbers, returning false when it is empty or has anything else
+bool parse_list(
+        const char* arg,
+        std::vector<uint32_t>& values)
+{
+    values.clear();
+    std::stringstream stream(arg);
+    std::string item;
+    while (std::getline(stream, item, ','))
+    {
+        char* endptr = nullptr;
+        unsigned long value = strtoul(item.c_str(), &endptr, 10);
+        if (item.empty() || *endptr != 0)
+        {
+            return false;
+        }
+        values.push_back(static_cast<uint32_t>(value));
+    }
+    return !values.empty();
+}
+
+//! Parses an impairment LOSS[:BURST[:DELAY_US[:REORDER]]]
+bool parse_impairment(
+        const char* arg,
+        test_UDPv4TransportDescriptor::Impairment& impairment)
+{
+    std::vector<uint32_t> values;
+    std::string list(arg);
+    std::replace(list.begin(), list.end(), ':', ',');
+    if (!parse_list(list.c_str(), values) || values.size() > 4 || values[0] > 100 ||
+            (values.size() > 1 && values[1] == 0) || (values.size() > 3 && values[3] > 100))
+    {
+        return false;
+    }
+
+    impairment = test_UDPv4TransportDescriptor::Impairment();
+    impairment.lossPercentage = static_cast<uint8_t>(values[0]);
+    if (values.size() > 1)
+    {
+        impairment.meanBurstLength = values[1];
+    }
+    if (values.size() > 2)
+    {
+        impairment.delay = std::chrono::microseconds(values[2]);
+    }
+    if (values.size() > 3)
+    {
+        impairment.reorderPercentage = static_cast<uint8_t>(values[3]);
+    }
+    return true;
+}
+
+std::shared_ptr<test_UDPv4TransportDescriptor> transport_descriptor(
+        uint32_t seed)
+{
+    auto descriptor = std::make_shared<test_UDPv4TransportDescriptor>();
+    descriptor->interfaceWhiteList.push_back("127.0.0.1");
+    descriptor->impairmentsSeed = seed;
+    descriptor->trackUserTraffic = true;
+    return descriptor;
+}
+
+RTPSParticipant* create_participant(
+        uint32_t domain,
+        uint32_t participant_id,
+        uint32_t num_participants,
+        const std::shared_ptr<test_UDPv4TransportDescriptor>& descriptor)
+{
+    // Discovery through localhost, each participant with its own id so the initial peers reach all of them
+    descriptor->maxInitialPeersRange = num_participants;
+    RTPSParticipantAttributes attributes;
+    attributes.participantID = static_cast<int32_t>(participant_id);
+    attributes.useBuiltinTransports = false;
+    attributes.userTransports.push_back(descriptor);
+    Locator_t initial_peer;
+    IPLocator::setIPv4(initial_peer, 127, 0, 0, 1);
+    attributes.builtin.initialPeersList.push_back(initial_peer);
+    return RTPSDomain::createParticipant(domain, attributes);
+}
+
+//! Value at the given percentile of a set of values, which are sorted by this function
+uint64_t percentile(
+        std::vector<uint64_t>& values,
+        double percent)
+{
+    if (values.empty())
+    {
+        return 0;
+    }
+    std::sort(values.begin(), values.end());
+    size_t index = static_cast<size_t>(values.size() * percent / 100.0);
+    return values[std::min(index, values.size() - 1)];
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns;
+
+#if defined(_WIN32)
+    char* buf = nullptr;
+    size_t sz = 0;
+    if (_dupenv_s(&buf, &sz, "COLUMNS") == 0 && buf != nullptr)
+    {
+        columns = strtol(buf, nullptr, 10);
+        free(buf);
+    }
+    else
+    {
+        columns = 80;
+    }
+#else
+    columns = getenv("COLUMNS") ? atoi(getenv("COLUMNS")) : 80;
+#endif // if defined(_WIN32)
+
+    uint32_t num_readers = 3;
+    uint32_t samples = 10000;
+    uint32_t rate = 5000;
+    uint32_t msg_size = 512;
+    uint32_t drain_time_ms = 5000;
+    uint32_t seed = 1;
+    uint32_t domain = 0;
+    std::string export_csv = "";
+    std::vector<test_UDPv4TransportDescriptor::Impairment> impairments;
+    std::vector<uint32_t> heartbeat_periods = {10, 100, 1000};
+    std::vector<uint32_t> nack_response_delays = {5};
+    std::vector<uint32_t> history_depths = {100, 10000};
+    std::vector<uint32_t> adaptive_heartbeats = {0};
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    bool valid = true;
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case READERS:
+                num_readers = strtol(opt.arg, nullptr, 10);
+                break;
+
+            case SAMPLES:
+                samples = strtol(opt.arg, nullptr, 10);
+                break;
+
+            case RATE:
+                rate = strtol(opt.arg, nullptr, 10);
+                break;
+
+            case MSG_SIZE:
+                msg_size = strtol(opt.arg, nullptr, 10);
+                break;
+
+            case IMPAIRMENT:
+                impairments.emplace_back();
+                valid &= parse_impairment(opt.arg, impairments.back());
+                break;
+
+            case HEARTBEAT_PERIOD:
+                valid &= parse_list(opt.arg, heartbeat_periods);
+                break;
+
+            case NACK_RESPONSE_DELAY:
+                valid &= parse_list(opt.arg, nack_response_delays);
+                break;
+
+            case HISTORY_DEPTH:
+                valid &= parse_list(opt.arg, history_depths);
+                break;
+
+            case ADAPTIVE_HEARTBEAT:
+                valid &= parse_list(opt.arg, adaptive_heartbeats);
+                break;
+
+            case DRAIN_TIME:
+                drain_time_ms = strtol(opt.arg, nullptr, 10);
+                break;
+
+            case SEED:
+                seed = strtol(opt.arg, nullptr, 10);
+                break;
+
+            case FORCED_DOMAIN:
+                domain = strtol(opt.arg, nullptr, 10);
+                break;
+
+            case EXPORT_CSV:
+                export_csv = opt.arg;
+                break;
+
+            case UNKNOWN_OPT:
+            default:
+                option::printUsage(fwrite, stdout, usage, columns);
+                return 0;
+        }
+    }
+
+    if (impairments.empty())
+    {
+        impairments.emplace_back();
+        parse_impairment("5:3:100:1", impairments.back());
+    }
+
+    if (!valid || num_readers == 0 || samples == 0 || rate == 0 || msg_size < 16 ||
+            std::find(history_depths.begin(), history_depths.end(), 0u) != history_depths.end())
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    std::vector<Setting> settings;
+    for (uint32_t heartbeat_period : heartbeat_periods)
+    {
+        for (uint32_t nack_response_delay : nack_response_delays)
+        {
+            for (uint32_t history_depth : history_depths)
+            {
+                for (uint32_t adaptive_heartbeat : adaptive_heartbeats)
+                {
+                    settings.push_back({heartbeat_period, nack_response_delay, history_depth, adaptive_heartbeat != 0});
+                }
+            }
+        }
+    }
+
+    eprosima::fastdds::dds::Log::SetVerbosity(eprosima::fastdds::dds::Log::Kind::Error);
+
+    // The writer impairs the datagrams sent to the unicast port of each reader, and each reader all the datagrams
+    // it sends, so the impairment applies to both directions of its link
+    auto writer_descriptor = transport_descriptor(seed);
+    std::vector<std::shared_ptr<test_UDPv4TransportDescriptor>> reader_descriptors;
+    for (uint32_t i = 0; i < num_readers; ++i)
+    {
+        const auto& impairment = impairments[i % impairments.size()];
+        writer_descriptor->impairments[reader_port_base + i] = impairment;
+        reader_descriptors.push_back(transport_descriptor(seed + i + 1));
+        reader_descriptors.back()->impairments[0] = impairment;
+    }
+
+    RTPSParticipant* writer_participant = create_participant(domain, 0, num_readers + 1, writer_descriptor);
+    std::vector<RTPSParticipant*> reader_participants;
+    for (uint32_t i = 0; i < num_readers && writer_participant != nullptr; ++i)
+    {
+        reader_participants.push_back(create_participant(domain, i + 1, num_readers + 1, reader_descriptors[i]));
+        if (reader_participants.back() == nullptr)
+        {
+            writer_participant = nullptr;
+        }
+    }
+    if (writer_participant == nullptr)
+    {
+        std::cout << "Error creating the participants" << std::endl;
+        RTPSDomain::stopAll();
+        return 1;
+    }
+
+    std::ofstream csv_file;
+    if (!export_csv.empty())
+    {
+        csv_file.open(export_csv);
+    }
+    std::string header = "heartbeat_period_ms,nack_response_delay_ms,history_depth,adaptive_heartbeat,"
+            "samples_sent,samples_delivered,throughput_mbps,latency_p999_us,repair_datas,repair_bytes,"
+            "heartbeats,acknacks,gaps,impaired_drops";
+    std::cout << header << std::endl;
+    if (csv_file.is_open())
+    {
+        csv_file << header << std::endl;
+    }
+
+    for (size_t s = 0; s < settings.size(); ++s)
+    {
+        const Setting& setting = settings[s];
+
+        TopicAttributes topic;
+        topic.topicKind = NO_KEY;
+        topic.topicDataType = "ReliabilityType";
+        topic.topicName = "ReliabilityTopic_" + std::to_string(s);
+
+        HistoryAttributes history_attributes;
+        history_attributes.payloadMaxSize = msg_size;
+
+        MatchCounter counter;
+        WriterAttributes writer_attributes;
+        writer_attributes.endpoint.reliabilityKind = RELIABLE;
+        writer_attributes.endpoint.durabilityKind = VOLATILE;
+        writer_attributes.times.heartbeatPeriod = Duration_t(setting.heartbeat_period_ms * 1e-3);
+        writer_attributes.times.nackResponseDelay = Duration_t(setting.nack_response_delay_ms * 1e-3);
+        writer_attributes.times.adaptiveHeartbeat = setting.adaptive_heartbeat;
+        HistoryAttributes writer_history_attributes = history_attributes;
+        writer_history_attributes.initialReservedCaches = static_cast<int32_t>(std::min(setting.history_depth, 500u));
+        writer_history_attributes.maximumReservedCaches = static_cast<int32_t>(setting.history_depth);
+        WriterHistory writer_history(writer_history_attributes);
+        RTPSWriter* writer = RTPSDomain::createRTPSWriter(writer_participant, writer_attributes, &writer_history,
+                        &counter);
+        WriterQos writer_qos;
+        writer_qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+        writer_qos.m_durability.kind = VOLATILE_DURABILITY_QOS;
+        if (writer == nullptr || !writer_participant->registerWriter(writer, topic, writer_qos))
+        {
+            std::cout << "Error creating the writer" << std::endl;
+            RTPSDomain::stopAll();
+            return 1;
+        }
+
+        std::vector<std::unique_ptr<ReaderHistory>> reader_histories;
+        std::vector<std::unique_ptr<SampleCollector>> collectors;
+        std::vector<RTPSReader*> readers;
+        for (uint32_t i = 0; i < num_readers; ++i)
+        {
+            Locator_t unicast;
+            IPLocator::setIPv4(unicast, 127, 0, 0, 1);
+            unicast.port = reader_port_base + i;
+            ReaderAttributes reader_attributes;
+            reader_attributes.endpoint.reliabilityKind = RELIABLE;
+            reader_attributes.endpoint.durabilityKind = VOLATILE;
+            reader_attributes.endpoint.unicastLocatorList.push_back(unicast);
+            reader_histories.emplace_back(new ReaderHistory(history_attributes));
+            collectors.emplace_back(new SampleCollector(samples));
+            readers.push_back(RTPSDomain::createRTPSReader(reader_participants[i], reader_attributes,
+                    reader_histories.back().get(), collectors.back().get()));
+            ReaderQos reader_qos;
+            reader_qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+            reader_qos.m_durability.kind = VOLATILE_DURABILITY_QOS;
+            if (readers.back() == nullptr || !reader_participants[i]->registerReader(readers.back(), topic, reader_qos))
+            {
+                std::cout << "Error creating the reader " << i << std::endl;
+                RTPSDomain::stopAll();
+                return 1;
+            }
+        }
+        if (!counter.wait(num_readers, std::chrono::steady_clock::now() + std::chrono::seconds(30)))
+        {
+            std::cout << "Timeout waiting for the readers to be matched" << std::endl;
+            RTPSDomain::stopAll();
+            return 1;
+        }
+
+        test_UDPv4Transport::user_traffic.reset();
+
+        // Samples carry their index and the time they were sent
+        auto start = std::chrono::steady_clock::now();
+        auto period = std::chrono::nanoseconds(1000000000ull / rate);
+        for (uint64_t index = 0; index < samples; ++index)
+        {
+            std::this_thread::sleep_until(start + period * index);
+
+            if (writer_history.getHistorySize() >= setting.history_depth)
+            {
+                writer_history.remove_min_change();
+            }
+            CacheChange_t* change = writer->new_change([msg_size]() -> uint32_t
+                            {
+                                return msg_size;
+                            }, ALIVE);
+            if (change == nullptr)
+            {
+                continue;
+            }
+            int64_t sent_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+            memset(change->serializedPayload.data, 0, msg_size);
+            memcpy(change->serializedPayload.data, &index, sizeof(index));
+            memcpy(change->serializedPayload.data + sizeof(index), &sent_ns, sizeof(sent_ns));
+            change->serializedPayload.length = msg_size;
+            writer_history.add_change(change);
+        }
+
+        // Only the samples still in the history can be repaired
+        auto drain_deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(drain_time_ms);
+        uint64_t first_repairable = samples > setting.history_depth ? samples - setting.history_depth : 0;
+        for (auto& collector : collectors)
+        {
+            collector->wait(first_repairable, samples - 1, drain_deadline);
+        }
+
+        // Stop the traffic before gathering the results
+        uint64_t heartbeats = test_UDPv4Transport::user_traffic.heartbeats;
+        uint64_t acknacks = test_UDPv4Transport::user_traffic.acknacks;
+        uint64_t gaps = test_UDPv4Transport::user_traffic.gaps;
+        uint64_t repair_datas = test_UDPv4Transport::user_traffic.repair_datas;
+        uint64_t repair_bytes = test_UDPv4Transport::user_traffic.repair_bytes;
+        uint64_t impaired_drops = test_UDPv4Transport::user_traffic.impaired_drops;
+        for (RTPSReader* reader : readers)
+        {
+            RTPSDomain::removeRTPSReader(reader);
+        }
+        RTPSDomain::removeRTPSWriter(writer);
+
+        uint64_t delivered = 0;
+        double throughput_mbps = 0;
+        std::vector<uint64_t> latencies_ns;
+        for (auto& collector : collectors)
+        {
+            delivered += collector->delivered_;
+            double elapsed_us =
+                    std::chrono::duration<double, std::micro>(collector->last_reception_ - start).count();
+            if (collector->delivered_ > 0 && elapsed_us > 0)
+            {
+                throughput_mbps += collector->delivered_bytes_ * 8 / elapsed_us;
+            }
+            latencies_ns.insert(latencies_ns.end(), collector->latencies_ns_.begin(),
+                    collector->latencies_ns_.end());
+        }
+
+        std::stringstream line;
+        line << setting.heartbeat_period_ms << "," << setting.nack_response_delay_ms << "," <<
+            setting.history_depth << "," << (setting.adaptive_heartbeat ? 1 : 0) << "," << samples << "," <<
+            delivered / num_readers << "," << throughput_mbps / num_readers << "," <<
+            percentile(latencies_ns, 99.9) / 1000.0 << "," << repair_datas << "," << repair_bytes << "," <<
+            heartbeats << "," << acknacks << "," << gaps << "," << impaired_drops;
+        std::cout << line.str() << std::endl;
+        if (csv_file.is_open())
+        {
+            csv_file << line.str() << std::endl;
+        }
+    }
+
+    RTPSDomain::stopAll();
+    return 0;
+}
@@ -0,0 +1,224 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryBackupTest.cpp
+ *
+ * Measures the cost of the discovery database backup of a BACKUP discovery server, comparing the
+ * pretty-printed json dump of the whole database done on each server routine before the backup journal
+ * existed, with the backup journal storing only the entities changed on each routine:
+ *  - Steady state: time spent storing the backup on a routine where a few entities have changed.
+ *  - Restart: time spent reading the backup files into the json object the database is restored from.
+ */
+
+#include <fastdds/rtps/common/CacheChange.h>
+
+#include <rtps/builtin/discovery/database/backup/BackupJournal.hpp>
+#include <rtps/builtin/discovery/database/backup/SharedBackupFunctions.hpp>
+
+#include <json.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::rtps;
+
+namespace {
+
+const char* const json_file = "DiscoveryBackupTest.json";
+const char* const snapshot_file = "DiscoveryBackupTest_ddb.snapshot";
+const char* const journal_file = "DiscoveryBackupTest_ddb.journal";
+
+//! Json object of an entity, as stored by the database, with a DATA(w|r) of the given size
+nlohmann::json entity_json(
+        const GUID_t& guid,
+        uint32_t payload_size,
+        uint32_t sequence)
+{
+    CacheChange_t change;
+    change.kind = ALIVE;
+    change.writerGUID = GUID_t(guid.guidPrefix, c_EntityId_SEDPPubWriter);
+    change.instanceHandle = guid;
+    change.sequenceNumber = SequenceNumber_t(0, sequence);
+    SampleIdentity identity;
+    identity.writer_guid(change.writerGUID);
+    identity.sequence_number(change.sequenceNumber);
+    change.write_params.sample_identity(identity);
+    change.write_params.related_sample_identity(identity);
+    change.serializedPayload.reserve(payload_size);
+    change.serializedPayload.length = payload_size;
+    for (uint32_t i = 0; i < payload_size; ++i)
+    {
+        change.serializedPayload.data[i] = static_cast<octet>(i * sequence);
+    }
+
+    nlohmann::json j;
+    ddb::to_json(j["change"], change);
+    for (uint8_t i = 1; i <= 3; ++i)
+    {
+        GuidPrefix_t prefix;
+        prefix.value[0] = i;
+        j["ack_status"][ddb::object_to_string(prefix)] = (sequence % 2) == 0;
+    }
+    j["topic"] = "topic_" + std::to_string(guid.guidPrefix.value[11]);
+    return j;
+}
+
+double elapsed_ms(
+        std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+uint64_t file_size(
+        const char* file_name)
+{
+    std::ifstream file(file_name, std::ios_base::binary | std::ios_base::ate);
+    return file.is_open() ? static_cast<uint64_t>(file.tellg()) : 0;
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t num_endpoints = 20000;
+    uint32_t changes_per_routine = 10;
+    uint32_t routines = 200;
+    uint32_t payload_size = 300;
+
+    if (argc > 1)
+    {
+        num_endpoints = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        changes_per_routine = static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+    if (argc > 3)
+    {
+        routines = static_cast<uint32_t>(std::strtoul(argv[3], nullptr, 10));
+    }
+    if (num_endpoints == 0 || changes_per_routine == 0 || routines == 0)
+    {
+        std::cout << "Usage: DiscoveryBackupTest [num_endpoints] [changes_per_routine] [routines]" << std::endl;
+        return 1;
+    }
+
+    // Database with one participant every ten endpoints, and as many writers as readers
+    nlohmann::json ddb;
+    ddb["participants"] = nlohmann::json::object();
+    ddb["writers"] = nlohmann::json::object();
+    ddb["readers"] = nlohmann::json::object();
+    std::vector<std::pair<std::string, std::string>> endpoints;
+    for (uint32_t i = 0; i < num_endpoints; ++i)
+    {
+        GuidPrefix_t prefix;
+        prefix.value[0] = 1;
+        prefix.value[10] = static_cast<octet>((i / 10) >> 8);
+        prefix.value[11] = static_cast<octet>(i / 10);
+        if (i % 10 == 0)
+        {
+            ddb["participants"][ddb::object_to_string(prefix)] =
+                    entity_json(GUID_t(prefix, c_EntityId_RTPSParticipant), payload_size, 1);
+        }
+        GUID_t guid(prefix, i % 10 + 1);
+        const char* section = (i % 2) == 0 ? "writers" : "readers";
+        endpoints.emplace_back(section, ddb::object_to_string(guid));
+        ddb[section][endpoints.back().second] = entity_json(guid, payload_size, 1);
+    }
+
+    // Steady state: a few entities change on each routine
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t r = 0; r < routines; ++r)
+    {
+        for (uint32_t c = 0; c < changes_per_routine; ++c)
+        {
+            const auto& endpoint = endpoints[(r * changes_per_routine + c) % endpoints.size()];
+            ddb[endpoint.first][endpoint.second]["ack_status"].begin().value() = (r % 2) == 0;
+        }
+
+        std::ofstream backup_json_file(json_file, std::ios_base::out);
+        backup_json_file << std::setw(4) << ddb << std::endl;
+        backup_json_file.close();
+    }
+    double json_store_ms = elapsed_ms(start) / routines;
+
+    uint32_t snapshots = 0;
+    ddb::BackupJournal journal(snapshot_file, journal_file);
+    start = std::chrono::steady_clock::now();
+    for (uint32_t r = 0; r < routines; ++r)
+    {
+        for (uint32_t c = 0; c < changes_per_routine; ++c)
+        {
+            const auto& endpoint = endpoints[(r * changes_per_routine + c) % endpoints.size()];
+            nlohmann::json& entity = ddb[endpoint.first][endpoint.second];
+            entity["ack_status"].begin().value() = (r % 2) == 0;
+            if (!journal.snapshot_needed())
+            {
+                journal.update(endpoint.first, endpoint.second, entity);
+            }
+        }
+
+        if (journal.snapshot_needed())
+        {
+            journal.write_snapshot(ddb);
+            ++snapshots;
+        }
+        else
+        {
+            journal.commit();
+        }
+    }
+    double journal_store_ms = elapsed_ms(start) / routines;
+
+    // Restart: read the backup files
+    start = std::chrono::steady_clock::now();
+    nlohmann::json from_json;
+    std::ifstream backup_json_file(json_file, std::ios_base::in);
+    backup_json_file >> from_json;
+    backup_json_file.close();
+    double json_restore_ms = elapsed_ms(start);
+
+    start = std::chrono::steady_clock::now();
+    nlohmann::json from_journal;
+    ddb::BackupJournal restored(snapshot_file, journal_file);
+    bool restored_ok = restored.load(from_journal);
+    double journal_restore_ms = elapsed_ms(start);
+
+    std::cout << "Discovery database backup with " << num_endpoints << " endpoints, " << changes_per_routine <<
+        " changes per routine (" << routines << " routines)" << std::endl;
+    std::cout << "  Json dump:       " << json_store_ms << " ms/routine, " << file_size(json_file) <<
+        " bytes written per routine" << std::endl;
+    std::cout << "  Backup journal:  " << journal_store_ms << " ms/routine, " << snapshots << " snapshots, " <<
+        file_size(snapshot_file) << " bytes snapshot, " << file_size(journal_file) << " bytes journal" << std::endl;
+    std::cout << "  Json restore:    " << json_restore_ms << " ms" << std::endl;
+    std::cout << "  Journal restore: " << journal_restore_ms << " ms" << std::endl;
+    std::cout << "  Restored equal:  " << (restored_ok && from_journal == from_json ? "yes" : "no") << std::endl;
+
+    std::remove(json_file);
+    std::remove(snapshot_file);
+    std::remove(journal_file);
+
+    return restored_ok && from_journal == from_json ? 0 : 1;
+}
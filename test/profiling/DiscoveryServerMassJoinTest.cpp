@@ -0,0 +1,247 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryServerMassJoinTest.cpp
+ *
+ * Measures the time a discovery server needs to match the endpoints of N clients joining at once.
+ * Each client has a writer and a reader on one of T topics, and the test finishes once every writer
+ * has matched the readers of the other clients on its topic.
+ * The server must be launched beforehand with the fast-discovery-server tool, e.g.:
+ *     fast-discovery-server -i 0 -l 127.0.0.1 -p 11811 -t 3
+ */
+
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/ReaderAttributes.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/attributes/ServerAttributes.h>
+#include <fastdds/rtps/attributes/WriterAttributes.h>
+#include <fastdds/rtps/common/MatchingInfo.h>
+#include <fastdds/rtps/history/ReaderHistory.h>
+#include <fastdds/rtps/history/WriterHistory.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/reader/RTPSReader.h>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastdds/rtps/writer/WriterListener.h>
+#include <fastrtps/attributes/TopicAttributes.h>
+#include <fastrtps/qos/ReaderQos.h>
+#include <fastrtps/qos/WriterQos.h>
+#include <fastrtps/utils/IPLocator.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+namespace {
+
+//! Counts the matches of the writers with readers of other clients
+class MatchCounter : public WriterListener
+{
+public:
+
+    MatchCounter(
+            uint64_t expected)
+        : expected_(expected)
+    {
+    }
+
+    void onWriterMatched(
+            RTPSWriter* writer,
+            MatchingInfo& info) override
+    {
+        if (info.remoteEndpointGuid.guidPrefix == writer->getGuid().guidPrefix)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (info.status == MATCHED_MATCHING)
+        {
+            ++matched_;
+        }
+        else
+        {
+            --matched_;
+        }
+        cv_.notify_all();
+    }
+
+    //! Waits until all the expected matches happened, returning false on timeout.
+    bool wait(
+            const std::chrono::steady_clock::time_point& deadline)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_until(lock, deadline, [this]()
+                       {
+                           return matched_ >= expected_;
+                       });
+    }
+
+    uint64_t matched()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return matched_;
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    uint64_t expected_;
+    uint64_t matched_ = 0;
+};
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t num_clients = 100;
+    uint32_t num_topics = 10;
+    std::string server_address = "127.0.0.1";
+    uint16_t server_port = 11811;
+    uint32_t server_id = 0;
+
+    if (argc > 1)
+    {
+        num_clients = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        num_topics = static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+    if (argc > 3)
+    {
+        server_address = argv[3];
+    }
+    if (argc > 4)
+    {
+        server_port = static_cast<uint16_t>(std::strtoul(argv[4], nullptr, 10));
+    }
+    if (argc > 5)
+    {
+        server_id = static_cast<uint32_t>(std::strtoul(argv[5], nullptr, 10));
+    }
+
+    RTPSParticipantAttributes attributes;
+    eprosima::fastdds::rtps::RemoteServerAttributes server;
+    Locator_t locator;
+    if (num_clients < 2 || num_topics == 0 ||
+            !IPLocator::setIPv4(locator, server_address) ||
+            !IPLocator::setPhysicalPort(locator, server_port) ||
+            !eprosima::fastdds::rtps::get_server_client_default_guidPrefix(server_id, server.guidPrefix))
+    {
+        std::cout << "Usage: DiscoveryServerMassJoinTest [num_clients] [num_topics] [server_address] "
+                  << "[server_port] [server_id]" << std::endl;
+        return 1;
+    }
+    server.metatrafficUnicastLocatorList.push_back(locator);
+    attributes.builtin.discovery_config.discoveryProtocol = DiscoveryProtocol_t::CLIENT;
+    attributes.builtin.discovery_config.m_DiscoveryServers.push_back(server);
+    attributes.builtin.discovery_config.leaseDuration = c_TimeInfinite;
+
+    // Each writer matches the readers of the other clients on its topic
+    uint64_t expected = 0;
+    for (uint32_t t = 0; t < num_topics; ++t)
+    {
+        uint64_t clients_in_topic = num_clients / num_topics + (t < num_clients % num_topics ? 1 : 0);
+        expected += clients_in_topic * (clients_in_topic > 0 ? clients_in_topic - 1 : 0);
+    }
+    MatchCounter counter(expected);
+
+    HistoryAttributes history_attributes;
+    history_attributes.payloadMaxSize = 64;
+    std::vector<std::unique_ptr<WriterHistory>> writer_histories;
+    std::vector<std::unique_ptr<ReaderHistory>> reader_histories;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t i = 0; i < num_clients; ++i)
+    {
+        RTPSParticipant* participant = RTPSDomain::createParticipant(0, attributes);
+        if (participant == nullptr)
+        {
+            std::cout << "Error creating client " << i << std::endl;
+            RTPSDomain::stopAll();
+            return 1;
+        }
+
+        TopicAttributes topic;
+        topic.topicKind = NO_KEY;
+        topic.topicDataType = "MassJoinType";
+        topic.topicName = "MassJoinTopic_" + std::to_string(i % num_topics);
+
+        WriterAttributes writer_attributes;
+        writer_attributes.endpoint.reliabilityKind = RELIABLE;
+        writer_attributes.endpoint.durabilityKind = TRANSIENT_LOCAL;
+        writer_histories.emplace_back(new WriterHistory(history_attributes));
+        RTPSWriter* writer = RTPSDomain::createRTPSWriter(participant, writer_attributes,
+                        writer_histories.back().get(), &counter);
+        WriterQos writer_qos;
+        writer_qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+        writer_qos.m_durability.kind = TRANSIENT_LOCAL_DURABILITY_QOS;
+
+        ReaderAttributes reader_attributes;
+        reader_attributes.endpoint.reliabilityKind = RELIABLE;
+        reader_attributes.endpoint.durabilityKind = TRANSIENT_LOCAL;
+        reader_histories.emplace_back(new ReaderHistory(history_attributes));
+        RTPSReader* reader = RTPSDomain::createRTPSReader(participant, reader_attributes,
+                        reader_histories.back().get());
+        ReaderQos reader_qos;
+        reader_qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+        reader_qos.m_durability.kind = TRANSIENT_LOCAL_DURABILITY_QOS;
+
+        if (writer == nullptr || reader == nullptr ||
+                !participant->registerWriter(writer, topic, writer_qos) ||
+                !participant->registerReader(reader, topic, reader_qos))
+        {
+            std::cout << "Error creating the endpoints of client " << i << std::endl;
+            RTPSDomain::stopAll();
+            return 1;
+        }
+    }
+
+    auto created = std::chrono::steady_clock::now();
+    bool all_matched = counter.wait(start + std::chrono::seconds(300));
+    auto end = std::chrono::steady_clock::now();
+
+    std::cout << "Mass join of " << num_clients << " clients on " << num_topics << " topics against server "
+              << server_address << ":" << server_port << std::endl;
+    std::cout << "  Clients creation:         "
+              << std::chrono::duration<double, std::milli>(created - start).count() << " ms" << std::endl;
+    std::cout << "  Time until all matched:   "
+              << std::chrono::duration<double, std::milli>(end - start).count() << " ms" << std::endl;
+    std::cout << "  Matches:                  " << counter.matched() << " / " << expected << std::endl;
+
+    RTPSDomain::stopAll();
+
+    if (!all_matched)
+    {
+        std::cout << "Timeout waiting for all writers to be matched. Is the server running?" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,173 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file HistoryScanTest.cpp
+ *
+ * Measures the time needed to traverse a history whose changes come from a CacheChangePool,
+ * compared to a history whose changes were allocated one by one, interleaved with unrelated
+ * allocations, as happened before the pool allocated its changes in contiguous arrays.
+ */
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/resources/ResourceManagement.h>
+
+#include <rtps/history/CacheChangePool.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+
+namespace {
+
+/**
+ * Emulates the typical traversal of a history: count the alive, unread changes of a writer
+ * with a sequence number below a given one.
+ */
+uint64_t scan_history(
+        const std::vector<CacheChange_t*>& history,
+        const GUID_t& writer,
+        const SequenceNumber_t& limit)
+{
+    uint64_t result = 0;
+    for (const CacheChange_t* change : history)
+    {
+        if (change->writerGUID == writer && change->sequenceNumber < limit &&
+                change->kind == ALIVE && !change->isRead)
+        {
+            ++result;
+        }
+    }
+    return result;
+}
+
+void fill_change(
+        CacheChange_t* change,
+        const GUID_t& writer,
+        uint32_t index)
+{
+    change->kind = ALIVE;
+    change->writerGUID = writer;
+    change->sequenceNumber = SequenceNumber_t(0, index + 1);
+    change->isRead = (index % 3) == 0;
+}
+
+double measure(
+        const std::vector<CacheChange_t*>& history,
+        const GUID_t& writer,
+        uint32_t iterations,
+        uint64_t& checksum)
+{
+    SequenceNumber_t limit(0, static_cast<uint32_t>(history.size()));
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        checksum += scan_history(history, writer, limit);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() /
+           (static_cast<double>(iterations) * history.size());
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t num_changes = 100000;
+    uint32_t iterations = 50;
+
+    if (argc > 1)
+    {
+        num_changes = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        iterations = static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+    if (num_changes == 0 || iterations == 0)
+    {
+        std::cout << "Usage: HistoryScanTest [num_changes] [iterations]" << std::endl;
+        return 1;
+    }
+
+    GUID_t writer;
+    writer.guidPrefix.value[0] = 1;
+    writer.entityId.value[3] = 2;
+
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<size_t> noise_size(16, 512);
+
+    // History with changes individually allocated, interleaved with other allocations,
+    // emulating a heap that has been in use for a while.
+    std::vector<std::unique_ptr<char[]>> noise;
+    std::vector<std::unique_ptr<CacheChange_t>> scattered_storage;
+    std::vector<CacheChange_t*> scattered;
+    scattered.reserve(num_changes);
+    for (uint32_t i = 0; i < num_changes; ++i)
+    {
+        noise.emplace_back(new char[noise_size(generator)]);
+        scattered_storage.emplace_back(new CacheChange_t());
+        fill_change(scattered_storage.back().get(), writer, i);
+        scattered.push_back(scattered_storage.back().get());
+    }
+    // Release part of the unrelated allocations, so the heap gets fragmented
+    for (size_t i = 0; i < noise.size(); i += 2)
+    {
+        noise[i].reset();
+    }
+
+    // History with changes taken from the pool in a single bulk reservation
+    PoolConfig config{ PREALLOCATED_MEMORY_MODE, 0, num_changes, num_changes };
+    CacheChangePool pool(config);
+    std::vector<CacheChange_t*> pooled(num_changes, nullptr);
+    if (!pool.reserve_caches(pooled.data(), num_changes))
+    {
+        std::cout << "Error reserving " << num_changes << " changes from the pool" << std::endl;
+        return 1;
+    }
+    for (uint32_t i = 0; i < num_changes; ++i)
+    {
+        fill_change(pooled[i], writer, i);
+    }
+
+    uint64_t checksum = 0;
+
+    // Warm up both histories before measuring
+    measure(scattered, writer, 1, checksum);
+    measure(pooled, writer, 1, checksum);
+
+    double scattered_ns = measure(scattered, writer, iterations, checksum);
+    double pooled_ns = measure(pooled, writer, iterations, checksum);
+
+    std::cout << "History scan over " << num_changes << " changes (" << iterations << " iterations)" << std::endl;
+    std::cout << "  sizeof(CacheChange_t):    " << sizeof(CacheChange_t) << " bytes" << std::endl;
+    std::cout << "  Scattered allocation:     " << scattered_ns << " ns/change" << std::endl;
+    std::cout << "  CacheChangePool (bulk):   " << pooled_ns << " ns/change" << std::endl;
+    std::cout << "  Speedup:                  " << (pooled_ns > 0 ? scattered_ns / pooled_ns : 0) << "x" << std::endl;
+    std::cout << "  Checksum:                 " << checksum << std::endl;
+
+    pool.release_caches(pooled.data(), num_changes);
+
+    return 0;
+}
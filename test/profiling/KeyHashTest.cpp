@@ -0,0 +1,134 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file KeyHashTest.cpp
+ *
+ * Measures the cost of computing the instance handle of a keyed sample on each write, dispose and unregister,
+ * for several maximum key sizes:
+ *  - Copy: keys whose maximum serialized size is at most 16 bytes are copied to the handle as they are.
+ *  - MD5: larger keys, or any key when MD5 is forced, are hashed.
+ * The key is taken from a pool of serialized keys, so the measure is not biased by a single hot key.
+ */
+
+#include <fastdds/rtps/common/InstanceHandle.h>
+#include <fastrtps/utils/md5.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+
+namespace {
+
+const size_t num_keys = 1024;
+
+//! Computes the instance handle of a serialized key as the getKey of the type support does
+void compute_handle(
+        MD5& md5,
+        const unsigned char* key,
+        size_t key_size,
+        size_t max_key_size,
+        bool force_md5,
+        InstanceHandle_t& handle)
+{
+    if (force_md5 || max_key_size > 16)
+    {
+        md5.init();
+        md5.update(key, static_cast<unsigned int>(key_size));
+        md5.finalize();
+        memcpy(handle.value, md5.digest, 16);
+    }
+    else
+    {
+        memset(handle.value, 0, 16);
+        memcpy(handle.value, key, key_size);
+    }
+}
+
+//! Nanoseconds per handle computed
+double measure(
+        const std::vector<unsigned char>& keys,
+        size_t key_size,
+        bool force_md5,
+        uint32_t iterations,
+        uint64_t& checksum)
+{
+    MD5 md5;
+    InstanceHandle_t handle;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        compute_handle(md5, &keys[(i % num_keys) * key_size], key_size, key_size, force_md5, handle);
+        checksum += handle.value[i % 16];
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / iterations;
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t iterations = 2000000;
+
+    if (argc > 1)
+    {
+        iterations = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (iterations == 0)
+    {
+        std::cout << "Usage: KeyHashTest [iterations]" << std::endl;
+        return 1;
+    }
+
+    std::mt19937 generator(1);
+    uint64_t checksum = 0;
+
+    std::cout << "Instance handle computation (" << iterations << " keys per size)" << std::endl;
+    std::cout << "  Key size   Copy ns/key   MD5 ns/key   Keys/s on write path" << std::endl;
+    for (size_t key_size : {4u, 8u, 16u, 32u, 64u, 256u})
+    {
+        std::vector<unsigned char> keys(num_keys * key_size);
+        for (unsigned char& byte : keys)
+        {
+            byte = static_cast<unsigned char>(generator());
+        }
+
+        double md5_ns = measure(keys, key_size, true, iterations, checksum);
+        std::cout << "  " << std::setw(8) << key_size << "   ";
+        if (key_size <= 16)
+        {
+            double copy_ns = measure(keys, key_size, false, iterations, checksum);
+            std::cout << std::setw(11) << copy_ns << "   " << std::setw(10) << md5_ns << "   " <<
+                1e9 / copy_ns << std::endl;
+        }
+        else
+        {
+            std::cout << std::setw(11) << "-" << "   " << std::setw(10) << md5_ns << "   " << 1e9 / md5_ns <<
+                std::endl;
+        }
+    }
+
+    // Keeps the computations from being optimized away
+    std::cout << "  (checksum " << checksum << ")" << std::endl;
+    return 0;
+}
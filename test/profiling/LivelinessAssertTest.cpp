@@ -0,0 +1,133 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LivelinessAssertTest.cpp
+ *
+ * Measures the cost the liveliness assertion adds to the write path of a writer, emulating the
+ * assertion done by the writers each time a change is added to their history, with an infinite
+ * lease duration (no assertion) and with a finite lease duration of each liveliness kind.
+ */
+
+#include <fastdds/rtps/resources/ResourceEvent.h>
+#include <fastdds/rtps/writer/LivelinessManager.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+namespace {
+
+/**
+ * Emulates the write path of a writer: assert its liveliness, if its lease duration is finite,
+ * on each written sample.
+ */
+double measure(
+        LivelinessManager& manager,
+        const GUID_t& writer,
+        LivelinessQosPolicyKind kind,
+        const Duration_t& lease_duration,
+        uint32_t samples,
+        uint64_t& checksum)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < samples; ++i)
+    {
+        if (lease_duration < c_TimeInfinite)
+        {
+            checksum += manager.assert_liveliness(writer, kind, lease_duration) ? 1 : 0;
+        }
+        else
+        {
+            ++checksum;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / samples;
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t num_writers = 10;
+    uint32_t samples = 1000000;
+
+    if (argc > 1)
+    {
+        num_writers = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        samples = static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+    if (num_writers == 0 || samples == 0)
+    {
+        std::cout << "Usage: LivelinessAssertTest [num_writers] [samples]" << std::endl;
+        return 1;
+    }
+
+    ResourceEvent service;
+    service.init_thread();
+
+    LivelinessManager manager(nullptr, service);
+    Duration_t lease_duration(1);
+
+    // The measured writer is the last one of each kind, so a linear search goes through all the others
+    GuidPrefix_t prefix;
+    prefix.value[0] = 1;
+    GUID_t writers[3];
+    LivelinessQosPolicyKind kinds[3] = {
+        AUTOMATIC_LIVELINESS_QOS,
+        MANUAL_BY_PARTICIPANT_LIVELINESS_QOS,
+        MANUAL_BY_TOPIC_LIVELINESS_QOS
+    };
+    uint32_t entity = 1;
+    for (uint32_t k = 0; k < 3; ++k)
+    {
+        for (uint32_t i = 0; i < num_writers; ++i)
+        {
+            writers[k] = GUID_t(prefix, entity++);
+            manager.add_writer(writers[k], kinds[k], lease_duration);
+            manager.assert_liveliness(writers[k], kinds[k], lease_duration);
+        }
+    }
+
+    uint64_t checksum = 0;
+
+    // Warm up before measuring
+    measure(manager, writers[0], kinds[0], lease_duration, samples / 10, checksum);
+
+    double infinite_ns = measure(manager, writers[0], kinds[0], c_TimeInfinite, samples, checksum);
+    double automatic_ns = measure(manager, writers[0], kinds[0], lease_duration, samples, checksum);
+    double participant_ns = measure(manager, writers[1], kinds[1], lease_duration, samples, checksum);
+    double topic_ns = measure(manager, writers[2], kinds[2], lease_duration, samples, checksum);
+
+    std::cout << "Liveliness assertion on the write path (" << num_writers << " writers per kind, " <<
+        samples << " samples)" << std::endl;
+    std::cout << "  Infinite lease duration:  " << infinite_ns << " ns/sample" << std::endl;
+    std::cout << "  AUTOMATIC:                " << automatic_ns << " ns/sample" << std::endl;
+    std::cout << "  MANUAL_BY_PARTICIPANT:    " << participant_ns << " ns/sample" << std::endl;
+    std::cout << "  MANUAL_BY_TOPIC:          " << topic_ns << " ns/sample" << std::endl;
+    std::cout << "  Checksum:                 " << checksum << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,137 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LogQueueTest.cpp
+ *
+ * Measures the rate at which several threads queue log entries, and the time until the logging
+ * thread has consumed them, with the default double buffered queue and with the lock-free ring.
+ */
+
+#include <fastdds/dds/log/Log.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastdds::dds;
+
+namespace {
+
+//! Counts the consumed entries, so the cost of the consumer does not hide the cost of queueing
+class CountingConsumer : public LogConsumer
+{
+public:
+
+    void Consume(
+            const Log::Entry&) override
+    {
+        ++consumed;
+    }
+
+    static std::atomic<uint64_t> consumed;
+};
+
+std::atomic<uint64_t> CountingConsumer::consumed(0);
+
+void measure(
+        const char* mode,
+        uint32_t num_threads,
+        uint32_t messages_per_thread)
+{
+    CountingConsumer::consumed = 0;
+    uint64_t dropped = Log::DroppedEntries();
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::unique_ptr<std::thread>> threads;
+    for (uint32_t i = 0; i < num_threads; ++i)
+    {
+        threads.emplace_back(new std::thread([i, messages_per_thread]
+                {
+                    for (uint32_t j = 0; j < messages_per_thread; ++j)
+                    {
+                        logWarning(LogQueueTest, "I'm thread " << i << " logging sample " << j);
+                    }
+                }));
+    }
+
+    for (auto& thread : threads)
+    {
+        thread->join();
+    }
+
+    auto queued = std::chrono::steady_clock::now();
+    Log::Flush();
+    auto consumed = std::chrono::steady_clock::now();
+
+    uint64_t total = static_cast<uint64_t>(num_threads) * messages_per_thread;
+    double queue_seconds = std::chrono::duration<double>(queued - start).count();
+    double total_seconds = std::chrono::duration<double>(consumed - start).count();
+
+    std::cout << mode << std::endl;
+    std::cout << "  Queued:    " << total / queue_seconds << " entries/s" << std::endl;
+    std::cout << "  Consumed:  " << CountingConsumer::consumed << " entries in " << total_seconds << " s" << std::endl;
+    std::cout << "  Dropped:   " << Log::DroppedEntries() - dropped << " entries" << std::endl;
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t num_threads = 4;
+    uint32_t messages_per_thread = 5000;
+    size_t ring_capacity = 32768;
+
+    if (argc > 1)
+    {
+        num_threads = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        messages_per_thread = static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+    if (argc > 3)
+    {
+        ring_capacity = static_cast<size_t>(std::strtoul(argv[3], nullptr, 10));
+    }
+    if (num_threads == 0 || messages_per_thread == 0 || ring_capacity == 0)
+    {
+        std::cout << "Usage: LogQueueTest [num_threads] [messages_per_thread] [ring_capacity]" << std::endl;
+        return 1;
+    }
+
+    Log::ClearConsumers();
+    Log::RegisterConsumer(std::unique_ptr<LogConsumer>(new CountingConsumer()));
+    Log::SetVerbosity(Log::Warning);
+
+    std::cout << num_threads << " threads logging " << messages_per_thread << " entries each" << std::endl;
+
+    measure("Double buffered queue", num_threads, messages_per_thread);
+
+    Log::UseRingBuffer(ring_capacity);
+    measure("Ring buffer", num_threads, messages_per_thread);
+
+    Log::Reset();
+    Log::KillThread();
+
+    return 0;
+}
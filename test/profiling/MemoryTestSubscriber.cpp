@@ -62,7 +62,7 @@ MemoryTestSubscriber::~MemoryTestSubscriber()
 
 bool MemoryTestSubscriber::init(bool echo, int nsam, bool reliable, uint32_t pid, bool hostname,
         const PropertyPolicy& part_property_policy, const PropertyPolicy& property_policy,
-        const std::string& sXMLConfigFile, uint32_t data_size, bool dynamic_types)
+        const std::string& sXMLConfigFile, uint32_t data_size, bool dynamic_types, uint32_t n_readers)
 {
     m_sXMLConfigFile = sXMLConfigFile;
     m_echo = echo;
@@ -153,6 +153,20 @@ bool MemoryTestSubscriber::init(bool echo, int nsam, bool reliable, uint32_t pid
         return false;
     }
 
+    // Additional readers of the data topic, which share the received payloads with the first one.
+    // Only supported with static types, as the data reader is recreated with each dynamic type.
+    for (uint32_t i = 1; !dynamic_data && i < n_readers; ++i)
+    {
+        Subscriber* extra_datasub = (m_sXMLConfigFile.length() > 0) ?
+            Domain::createSubscriber(mp_participant, profile_name) :
+            Domain::createSubscriber(mp_participant, SubDataparam);
+        if (extra_datasub == nullptr)
+        {
+            return false;
+        }
+        m_extra_datasubs.push_back(extra_datasub);
+    }
+
     //COMMAND PUBLISHER
     PublisherAttributes PubCommandParam;
     PubCommandParam.topic.topicDataType = "TestCommandType";
@@ -22,6 +22,7 @@
 
 #include <asio.hpp>
 #include <condition_variable>
+#include <vector>
 #include "MemoryTestTypes.h"
 #include <fastrtps/types/DynamicTypeBuilderFactory.h>
 #include <fastrtps/types/DynamicDataFactory.h>
@@ -43,6 +44,7 @@ public:
     eprosima::fastrtps::Publisher* mp_commandpub;
     eprosima::fastrtps::Subscriber* mp_datasub;
     eprosima::fastrtps::Subscriber* mp_commandsub;
+    std::vector<eprosima::fastrtps::Subscriber*> m_extra_datasubs;
     eprosima::fastrtps::SampleInfo_t m_sampleinfo;
     std::mutex mutex_;
     int disc_count_;
@@ -57,7 +59,7 @@ public:
     bool init(bool echo, int nsam, bool reliable, uint32_t pid, bool hostname,
         const eprosima::fastrtps::rtps::PropertyPolicy& part_property_policy,
         const eprosima::fastrtps::rtps::PropertyPolicy& property_policy,
-        const std::string& sXMLConfigFile, uint32_t data_size, bool dynamic_types);
+        const std::string& sXMLConfigFile, uint32_t data_size, bool dynamic_types, uint32_t n_readers = 1);
 
     void run();
     bool test(uint32_t datasize);
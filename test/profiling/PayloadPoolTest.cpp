@@ -0,0 +1,108 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PayloadPoolTest.cpp
+ *
+ * Measures the cost of reserving a TopicPayloadPool, and of getting and releasing payloads from it,
+ * for every memory policy. Run it with FASTDDS_PAYLOAD_POOL_HUGE_PAGES=1 or
+ * FASTDDS_PAYLOAD_POOL_LOCK_MEMORY=1 to measure the preallocated slabs with those options.
+ */
+
+#include <rtps/history/TopicPayloadPool.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t num_payloads = 10000;
+    uint32_t num_loops = 10;
+    uint32_t payload_size = 512;
+
+    if (argc > 1)
+    {
+        num_payloads = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        num_loops = static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+    if (argc > 3)
+    {
+        payload_size = static_cast<uint32_t>(std::strtoul(argv[3], nullptr, 10));
+    }
+    if (num_payloads == 0 || num_loops == 0 || payload_size == 0)
+    {
+        std::cout << "Usage: PayloadPoolTest [num_payloads] [num_loops] [payload_size]" << std::endl;
+        return 1;
+    }
+
+    std::cout << "Payload pool with " << num_payloads << " payloads of " << payload_size << " bytes ("
+              << num_loops << " loops)" << std::endl;
+
+    for (MemoryManagementPolicy_t policy : {MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE,
+                                            MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE,
+                                            MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE,
+                                            MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE})
+    {
+        PoolConfig config{ policy, payload_size, num_payloads, 0 };
+
+        auto t0 = std::chrono::steady_clock::now();
+        std::unique_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+        if (!pool->reserve_history(config, false))
+        {
+            std::cout << "Error reserving " << num_payloads << " payloads" << std::endl;
+            return 1;
+        }
+        auto t1 = std::chrono::steady_clock::now();
+
+        std::vector<CacheChange_t> changes(num_payloads);
+        for (uint32_t loop = 0; loop < num_loops; ++loop)
+        {
+            for (CacheChange_t& ch : changes)
+            {
+                if (!pool->get_payload(payload_size, ch))
+                {
+                    std::cout << "Error getting a payload" << std::endl;
+                    return 1;
+                }
+                ch.serializedPayload.data[0] = static_cast<octet>(loop);
+            }
+            for (CacheChange_t& ch : changes)
+            {
+                pool->release_payload(ch);
+            }
+        }
+        auto t2 = std::chrono::steady_clock::now();
+
+        pool->release_history(config, false);
+
+        double reserve_us = std::chrono::duration<double, std::micro>(t1 - t0).count();
+        double cycle_ns = std::chrono::duration<double, std::nano>(t2 - t1).count() /
+                (static_cast<double>(num_payloads) * num_loops);
+        std::cout << "  Policy " << policy << ": reserve " << reserve_us << " us, get + release "
+                  << cycle_ns << " ns/payload" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,187 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SecureDiscoveryTest.cpp
+ *
+ * Measures the time needed for N secure participants on the same host to mutually authenticate.
+ * Certificates are taken from the directory on the CERTS_PATH environment variable.
+ */
+
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/participant/RTPSParticipantListener.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+namespace {
+
+class AuthenticationCounter : public RTPSParticipantListener
+{
+public:
+
+    AuthenticationCounter(
+            uint32_t expected)
+        : expected_(expected)
+    {
+    }
+
+    void onParticipantAuthentication(
+            RTPSParticipant*,
+            ParticipantAuthenticationInfo&& info) override
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (info.status == ParticipantAuthenticationInfo::AUTHORIZED_PARTICIPANT)
+        {
+            ++authorized_;
+        }
+        else
+        {
+            ++unauthorized_;
+        }
+        cv_.notify_all();
+    }
+
+    //! Waits until all the expected participants were authorized, returning false on timeout.
+    bool wait(
+            const std::chrono::steady_clock::time_point& deadline)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_until(lock, deadline, [this]()
+                       {
+                           return authorized_ >= expected_;
+                       });
+    }
+
+    uint32_t unauthorized()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return unauthorized_;
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    uint32_t expected_;
+    uint32_t authorized_ = 0;
+    uint32_t unauthorized_ = 0;
+};
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t num_participants = 10;
+    std::string handshake_threads = "0";
+    std::string dh_key_pool_size = "4";
+
+    if (argc > 1)
+    {
+        num_participants = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        handshake_threads = argv[2];
+    }
+    if (argc > 3)
+    {
+        dh_key_pool_size = argv[3];
+    }
+
+    const char* certs_path = std::getenv("CERTS_PATH");
+    if (num_participants < 2 || certs_path == nullptr)
+    {
+        std::cout << "Usage: CERTS_PATH=<dir> SecureDiscoveryTest [num_participants] [handshake_threads] "
+                  << "[dh_key_pool_size]" << std::endl;
+        return 1;
+    }
+
+    const std::string certs = std::string("file://") + certs_path;
+    RTPSParticipantAttributes attributes;
+    attributes.builtin.discovery_config.leaseDuration = c_TimeInfinite;
+    PropertyPolicy& properties = attributes.properties;
+    properties.properties().emplace_back("dds.sec.auth.plugin", "builtin.PKI-DH");
+    properties.properties().emplace_back("dds.sec.auth.builtin.PKI-DH.identity_ca", certs + "/maincacert.pem");
+    properties.properties().emplace_back("dds.sec.auth.builtin.PKI-DH.identity_certificate",
+            certs + "/mainpubcert.pem");
+    properties.properties().emplace_back("dds.sec.auth.builtin.PKI-DH.private_key", certs + "/mainpubkey.pem");
+    properties.properties().emplace_back("dds.sec.auth.builtin.PKI-DH.dh_key_pool_size", dh_key_pool_size);
+    properties.properties().emplace_back("dds.sec.auth.handshake_threads", handshake_threads);
+
+    const uint32_t domain_id = static_cast<uint32_t>(std::rand() % 100);
+    std::vector<std::unique_ptr<AuthenticationCounter>> listeners;
+    std::vector<RTPSParticipant*> participants;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t i = 0; i < num_participants; ++i)
+    {
+        listeners.emplace_back(new AuthenticationCounter(num_participants - 1));
+        RTPSParticipant* participant = RTPSDomain::createParticipant(domain_id, attributes, listeners.back().get());
+        if (participant == nullptr)
+        {
+            std::cout << "Error creating participant " << i << std::endl;
+            RTPSDomain::stopAll();
+            return 1;
+        }
+        participants.push_back(participant);
+    }
+
+    auto deadline = start + std::chrono::seconds(120);
+    bool all_authorized = true;
+    for (auto& listener : listeners)
+    {
+        all_authorized = listener->wait(deadline) && all_authorized;
+    }
+
+    auto end = std::chrono::steady_clock::now();
+
+    uint32_t unauthorized = 0;
+    for (auto& listener : listeners)
+    {
+        unauthorized += listener->unauthorized();
+    }
+
+    std::cout << "Mutual authentication of " << num_participants << " participants" << std::endl;
+    std::cout << "  Handshake threads:        " << handshake_threads << std::endl;
+    std::cout << "  DH key pool size:         " << dh_key_pool_size << std::endl;
+    std::cout << "  Total time:               "
+              << std::chrono::duration<double, std::milli>(end - start).count() << " ms" << std::endl;
+    std::cout << "  Unauthorized events:      " << unauthorized << std::endl;
+
+    RTPSDomain::stopAll();
+
+    if (!all_authorized)
+    {
+        std::cout << "Timeout waiting for all participants to be authorized" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,232 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatisticsWriteTest.cpp
+ *
+ * Measures the cost of writing samples to a matched remote reader, with statistics disabled and with
+ * all the statistics topics enabled on the participant of the writer.
+ */
+
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/ReaderAttributes.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/attributes/WriterAttributes.h>
+#include <fastdds/rtps/common/MatchingInfo.h>
+#include <fastdds/rtps/history/ReaderHistory.h>
+#include <fastdds/rtps/history/WriterHistory.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/reader/RTPSReader.h>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastdds/rtps/writer/WriterListener.h>
+#include <fastdds/statistics/topic_names.hpp>
+#include <fastrtps/attributes/TopicAttributes.h>
+#include <fastrtps/qos/ReaderQos.h>
+#include <fastrtps/qos/WriterQos.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::statistics;
+
+namespace {
+
+//! Notifies when the writer matches the reader
+class MatchWaiter : public WriterListener
+{
+public:
+
+    void onWriterMatched(
+            RTPSWriter*,
+            MatchingInfo& info) override
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        matched_ = MATCHED_MATCHING == info.status;
+        cv_.notify_all();
+    }
+
+    bool wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, std::chrono::seconds(10), [this]()
+                       {
+                           return matched_;
+                       });
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool matched_ = false;
+};
+
+//! Returns the nanoseconds per sample, or a negative value on error
+double measure(
+        bool statistics,
+        uint32_t num_samples,
+        uint32_t num_loops,
+        uint32_t payload_size)
+{
+    RTPSParticipantAttributes writer_participant_attributes;
+    if (statistics)
+    {
+        std::string topics;
+        for (const char* topic : {HISTORY_LATENCY_TOPIC, PUBLICATION_THROUGHPUT_TOPIC, SUBSCRIPTION_THROUGHPUT_TOPIC,
+                                  RTPS_SENT_TOPIC, RTPS_RECEIVED_TOPIC, RESENT_DATAS_TOPIC, HEARTBEAT_COUNT_TOPIC,
+                                  ACKNACK_COUNT_TOPIC, NACKFRAG_COUNT_TOPIC, GAP_COUNT_TOPIC, DATA_COUNT_TOPIC,
+                                  DISCOVERY_TOPIC})
+        {
+            topics += std::string(topic) + ";";
+        }
+        writer_participant_attributes.properties.properties().emplace_back(STATISTICS_PROPERTY, topics);
+        writer_participant_attributes.properties.properties().emplace_back(STATISTICS_PERIOD_PROPERTY, "100");
+    }
+
+    RTPSParticipant* writer_participant = RTPSDomain::createParticipant(0, writer_participant_attributes);
+    RTPSParticipant* reader_participant = RTPSDomain::createParticipant(0, RTPSParticipantAttributes());
+    if (writer_participant == nullptr || reader_participant == nullptr)
+    {
+        std::cout << "Error creating the participants" << std::endl;
+        RTPSDomain::stopAll();
+        return -1;
+    }
+
+    TopicAttributes topic;
+    topic.topicKind = NO_KEY;
+    topic.topicDataType = "StatisticsWriteType";
+    topic.topicName = "StatisticsWriteTopic";
+
+    HistoryAttributes history_attributes;
+    history_attributes.payloadMaxSize = payload_size;
+    history_attributes.initialReservedCaches = static_cast<int32_t>(num_samples);
+    history_attributes.maximumReservedCaches = static_cast<int32_t>(num_samples);
+    WriterHistory writer_history(history_attributes);
+    ReaderHistory reader_history(history_attributes);
+    MatchWaiter waiter;
+
+    WriterAttributes writer_attributes;
+    writer_attributes.endpoint.reliabilityKind = BEST_EFFORT;
+    RTPSWriter* writer = RTPSDomain::createRTPSWriter(writer_participant, writer_attributes, &writer_history,
+                    &waiter);
+    WriterQos writer_qos;
+    writer_qos.m_reliability.kind = BEST_EFFORT_RELIABILITY_QOS;
+
+    ReaderAttributes reader_attributes;
+    reader_attributes.endpoint.reliabilityKind = BEST_EFFORT;
+    RTPSReader* reader = RTPSDomain::createRTPSReader(reader_participant, reader_attributes, &reader_history);
+    ReaderQos reader_qos;
+    reader_qos.m_reliability.kind = BEST_EFFORT_RELIABILITY_QOS;
+
+    if (writer == nullptr || reader == nullptr ||
+            !writer_participant->registerWriter(writer, topic, writer_qos) ||
+            !reader_participant->registerReader(reader, topic, reader_qos) ||
+            !waiter.wait())
+    {
+        std::cout << "Error creating or matching the endpoints" << std::endl;
+        RTPSDomain::stopAll();
+        return -1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t loop = 0; loop < num_loops; ++loop)
+    {
+        for (uint32_t i = 0; i < num_samples; ++i)
+        {
+            CacheChange_t* change = writer->new_change([payload_size]() -> uint32_t
+                            {
+                                return payload_size;
+                            }, ALIVE);
+            if (change == nullptr)
+            {
+                std::cout << "Error creating a change" << std::endl;
+                RTPSDomain::stopAll();
+                return -1;
+            }
+
+            memset(change->serializedPayload.data, static_cast<int>(i), payload_size);
+            change->serializedPayload.length = payload_size;
+            writer_history.add_change(change);
+        }
+
+        // The reader may not have processed everything, but the samples of a best effort writer can be removed
+        writer_history.remove_all_changes();
+        reader_history.remove_all_changes();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    RTPSDomain::removeRTPSWriter(writer);
+    RTPSDomain::removeRTPSReader(reader);
+    RTPSDomain::removeRTPSParticipant(writer_participant);
+    RTPSDomain::removeRTPSParticipant(reader_participant);
+
+    return std::chrono::duration<double, std::nano>(end - start).count() /
+           (static_cast<double>(num_samples) * num_loops);
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t num_samples = 1000;
+    uint32_t num_loops = 20;
+    uint32_t payload_size = 64;
+
+    if (argc > 1)
+    {
+        num_samples = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        num_loops = static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+    if (argc > 3)
+    {
+        payload_size = static_cast<uint32_t>(std::strtoul(argv[3], nullptr, 10));
+    }
+    if (num_samples == 0 || num_loops == 0 || payload_size == 0)
+    {
+        std::cout << "Usage: StatisticsWriteTest [num_samples] [num_loops] [payload_size]" << std::endl;
+        return 1;
+    }
+
+    std::cout << "Writing " << num_samples << " samples of " << payload_size << " bytes (" << num_loops
+              << " loops)" << std::endl;
+
+    double disabled_ns = measure(false, num_samples, num_loops, payload_size);
+    double enabled_ns = measure(true, num_samples, num_loops, payload_size);
+    if (disabled_ns < 0 || enabled_ns < 0)
+    {
+        return 1;
+    }
+
+    std::cout << "  Statistics disabled: " << disabled_ns << " ns/sample" << std::endl;
+    std::cout << "  Statistics enabled:  " << enabled_ns << " ns/sample ("
+              << (enabled_ns - disabled_ns) * 100.0 / disabled_ns << "% overhead)" << std::endl;
+
+    RTPSDomain::stopAll();
+    return 0;
+}
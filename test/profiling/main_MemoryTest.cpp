@@ -146,6 +146,7 @@ enum  optionIndex
     XML_FILE,
     DATA_SIZE,
     DYNAMIC_TYPES,
+    READERS,
     TIME
 };
 
@@ -165,6 +166,8 @@ const option::Descriptor usage[] = {
     { UNKNOWN_OPT, 0, "", "",                Arg::None,      "\nSubscriber options:"},
     { ECHO_OPT, 0, "e", "echo",               Arg::Required,
       "  -e <arg>, \t--echo=<arg>  \tEcho mode (\"true\"/\"false\")." },
+    { READERS, 0, "", "readers",             Arg::Numeric,
+      "  \t--readers=<num>  \tNumber of readers of the data topic." },
     { HOSTNAME, 0, "", "hostname",             Arg::None,      "" },
     { EXPORT_CSV, 0, "", "export_csv",         Arg::None,      "" },
     { EXPORT_PREFIX, 0, "", "export_prefix",   Arg::String,    "\t--export_prefix \tFile prefix for the CSV file." },
@@ -221,6 +224,7 @@ int main(
     bool export_csv = false;
     bool dynamic_types = false;
     uint32_t data_size = 16;
+    uint32_t n_readers = 1;
     uint32_t test_time_sec = 5;
     std::string export_prefix = "";
     std::string sXMLConfigFile = "";
@@ -343,6 +347,10 @@ int main(
                 data_size = strtol(opt.arg, nullptr, 10);
                 break;
 
+            case READERS:
+                n_readers = strtol(opt.arg, nullptr, 10);
+                break;
+
             case XML_FILE:
                 if (opt.arg != nullptr)
                 {
@@ -452,7 +460,7 @@ int main(
     {
         MemoryTestSubscriber memorySub;
         memorySub.init(echo, n_samples, reliable, seed, hostname, sub_part_property_policy, sub_property_policy,
-                sXMLConfigFile, data_size, dynamic_types);
+                sXMLConfigFile, data_size, dynamic_types, n_readers);
         memorySub.run();
     }
 
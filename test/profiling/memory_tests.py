@@ -20,6 +20,8 @@ if os.environ.get("PROFILING_BINS"):
 valgrind = os.environ.get("VALGRIND_BIN")
 certs_path = os.environ.get("CERTS_PATH")
 test_time = "10"
+readers = ""
+data_size = ""
 
 if not valgrind:
     valgrind = "valgrind"
@@ -32,6 +34,13 @@ def start_test(command, pubsub, time, transport):
 
     options = ["--time=" + time]
 
+    if data_size:
+        options.append("--size=" + data_size)
+
+    # Several readers on the subscriber show the memory saved by sharing the received payloads
+    if readers and pubsub == "subscriber":
+        options.append("--readers=" + readers)
+
     if certs_path:
         options.extend(["--security=true", "--certs=" + certs_path])
 
@@ -61,6 +70,12 @@ def start_test(command, pubsub, time, transport):
 
 transport = ""
 
+if len(sys.argv) >= 7:
+    data_size = sys.argv[6]
+
+if len(sys.argv) >= 6:
+    readers = sys.argv[5]
+
 if len(sys.argv) >= 5:
     transport = sys.argv[4]
 
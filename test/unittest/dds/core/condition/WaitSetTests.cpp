@@ -0,0 +1,220 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <fastdds/dds/core/condition/GuardCondition.hpp>
+#include <fastdds/dds/core/condition/StatusCondition.hpp>
+#include <fastdds/dds/core/condition/WaitSet.hpp>
+#include <fastdds/core/condition/StatusConditionImpl.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace eprosima::fastdds::dds;
+using eprosima::fastrtps::Duration_t;
+using eprosima::fastrtps::c_TimeInfinite;
+
+static const Duration_t short_timeout(0, 10000000);
+
+TEST(WaitSetTests, AttachDetach)
+{
+    WaitSet wait_set;
+    GuardCondition condition;
+    ConditionSeq conditions;
+
+    ASSERT_EQ(wait_set.detach_condition(condition), ReturnCode_t::RETCODE_PRECONDITION_NOT_MET);
+    ASSERT_EQ(wait_set.attach_condition(condition), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(wait_set.attach_condition(condition), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(wait_set.get_conditions(conditions), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(conditions.size(), 1u);
+    ASSERT_EQ(conditions[0], &condition);
+
+    ASSERT_EQ(wait_set.detach_condition(condition), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(wait_set.get_conditions(conditions), ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(conditions.empty());
+
+    // Deleting a condition detaches it from the WaitSet
+    {
+        GuardCondition temporary;
+        ASSERT_EQ(wait_set.attach_condition(temporary), ReturnCode_t::RETCODE_OK);
+    }
+    ASSERT_EQ(wait_set.get_conditions(conditions), ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(conditions.empty());
+
+    // Deleting a WaitSet detaches the conditions
+    {
+        WaitSet temporary;
+        ASSERT_EQ(temporary.attach_condition(condition), ReturnCode_t::RETCODE_OK);
+    }
+    ASSERT_EQ(condition.set_trigger_value(true), ReturnCode_t::RETCODE_OK);
+}
+
+TEST(WaitSetTests, GuardCondition)
+{
+    WaitSet wait_set;
+    GuardCondition condition;
+    GuardCondition other_condition;
+    ConditionSeq active_conditions;
+
+    ASSERT_EQ(wait_set.attach_condition(condition), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(wait_set.attach_condition(other_condition), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(wait_set.wait(active_conditions, short_timeout), ReturnCode_t::RETCODE_TIMEOUT);
+    ASSERT_TRUE(active_conditions.empty());
+
+    // Triggered before waiting
+    ASSERT_EQ(condition.set_trigger_value(true), ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(condition.get_trigger_value());
+    ASSERT_EQ(wait_set.wait(active_conditions, short_timeout), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(active_conditions.size(), 1u);
+    ASSERT_EQ(active_conditions[0], &condition);
+
+    // Triggered while waiting
+    ASSERT_EQ(condition.set_trigger_value(false), ReturnCode_t::RETCODE_OK);
+    std::thread trigger_thread([&other_condition]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                other_condition.set_trigger_value(true);
+            });
+    ASSERT_EQ(wait_set.wait(active_conditions, c_TimeInfinite), ReturnCode_t::RETCODE_OK);
+    trigger_thread.join();
+    ASSERT_EQ(active_conditions.size(), 1u);
+    ASSERT_EQ(active_conditions[0], &other_condition);
+
+    // Attaching a triggered condition wakes up the waiting thread
+    ASSERT_EQ(other_condition.set_trigger_value(false), ReturnCode_t::RETCODE_OK);
+    GuardCondition triggered_condition;
+    ASSERT_EQ(triggered_condition.set_trigger_value(true), ReturnCode_t::RETCODE_OK);
+    std::thread attach_thread([&wait_set, &triggered_condition]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                wait_set.attach_condition(triggered_condition);
+            });
+    ASSERT_EQ(wait_set.wait(active_conditions, c_TimeInfinite), ReturnCode_t::RETCODE_OK);
+    attach_thread.join();
+    ASSERT_EQ(active_conditions.size(), 1u);
+    ASSERT_EQ(active_conditions[0], &triggered_condition);
+}
+
+TEST(WaitSetTests, SingleWaiter)
+{
+    WaitSet wait_set;
+    GuardCondition condition;
+    ASSERT_EQ(wait_set.attach_condition(condition), ReturnCode_t::RETCODE_OK);
+
+    std::atomic<bool> waiting(false);
+    std::thread waiter([&]()
+            {
+                ConditionSeq active_conditions;
+                waiting = true;
+                EXPECT_EQ(wait_set.wait(active_conditions, c_TimeInfinite), ReturnCode_t::RETCODE_OK);
+            });
+
+    while (!waiting)
+    {
+        std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    ConditionSeq active_conditions;
+    ASSERT_EQ(wait_set.wait(active_conditions, short_timeout), ReturnCode_t::RETCODE_PRECONDITION_NOT_MET);
+
+    ASSERT_EQ(condition.set_trigger_value(true), ReturnCode_t::RETCODE_OK);
+    waiter.join();
+}
+
+TEST(WaitSetTests, ManyConditions)
+{
+    constexpr size_t num_conditions = 1000;
+    constexpr size_t num_triggers = 100;
+
+    WaitSet wait_set;
+    std::vector<GuardCondition> conditions(num_conditions);
+    for (GuardCondition& condition : conditions)
+    {
+        ASSERT_EQ(wait_set.attach_condition(condition), ReturnCode_t::RETCODE_OK);
+    }
+
+    // A single thread services all the conditions
+    std::thread trigger_thread([&conditions]()
+            {
+                for (size_t i = 0; i < num_triggers; ++i)
+                {
+                    conditions[(i * 7919) % num_conditions].set_trigger_value(true);
+                }
+            });
+
+    size_t serviced = 0;
+    ConditionSeq active_conditions;
+    while (serviced < num_triggers)
+    {
+        ASSERT_EQ(wait_set.wait(active_conditions, c_TimeInfinite), ReturnCode_t::RETCODE_OK);
+        for (Condition* condition : active_conditions)
+        {
+            static_cast<GuardCondition*>(condition)->set_trigger_value(false);
+            ++serviced;
+        }
+    }
+    trigger_thread.join();
+    ASSERT_EQ(serviced, num_triggers);
+}
+
+TEST(WaitSetTests, StatusCondition)
+{
+    WaitSet wait_set;
+    StatusCondition condition(nullptr);
+    ConditionSeq active_conditions;
+
+    ASSERT_EQ(condition.get_entity(), nullptr);
+    ASSERT_EQ(condition.get_enabled_statuses(), StatusMask::all());
+    ASSERT_EQ(condition.get_raw_status(), StatusMask::none());
+    ASSERT_FALSE(condition.get_trigger_value());
+    ASSERT_EQ(wait_set.attach_condition(condition), ReturnCode_t::RETCODE_OK);
+
+    // Statuses not enabled do not trigger the condition
+    ASSERT_EQ(condition.set_enabled_statuses(StatusMask::data_available()), ReturnCode_t::RETCODE_OK);
+    condition.get_impl()->set_status(StatusMask::subscription_matched(), true);
+    ASSERT_EQ(condition.get_raw_status(), StatusMask::subscription_matched());
+    ASSERT_FALSE(condition.get_trigger_value());
+    ASSERT_EQ(wait_set.wait(active_conditions, short_timeout), ReturnCode_t::RETCODE_TIMEOUT);
+
+    // Enabling a changed status triggers the condition
+    ASSERT_EQ(condition.set_enabled_statuses(StatusMask::data_available() << StatusMask::subscription_matched()),
+            ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(condition.get_trigger_value());
+    ASSERT_EQ(wait_set.wait(active_conditions, short_timeout), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(active_conditions.size(), 1u);
+
+    condition.get_impl()->set_status(StatusMask::subscription_matched(), false);
+    ASSERT_FALSE(condition.get_trigger_value());
+
+    std::thread trigger_thread([&condition]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                condition.get_impl()->set_status(StatusMask::data_available(), true);
+            });
+    ASSERT_EQ(wait_set.wait(active_conditions, c_TimeInfinite), ReturnCode_t::RETCODE_OK);
+    trigger_thread.join();
+    ASSERT_EQ(active_conditions.size(), 1u);
+    ASSERT_EQ(condition.get_raw_status(), StatusMask::data_available());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,248 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/ContentFilterProperty.hpp>
+#include <fastrtps/types/DynamicPubSubType.h>
+#include <fastrtps/types/DynamicTypeBuilder.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/DynamicTypeBuilderPtr.h>
+#include <fastrtps/types/DynamicTypePtr.h>
+
+#include <fastdds/publisher/ReaderFilterCollection.hpp>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+using fastdds::rtps::ContentFilterProperty;
+using fastrtps::rtps::CacheChange_t;
+using fastrtps::rtps::GUID_t;
+using fastrtps::rtps::SequenceNumber_t;
+using fastrtps::types::DynamicPubSubType;
+using fastrtps::types::DynamicTypeBuilder_ptr;
+using fastrtps::types::DynamicTypeBuilderFactory;
+
+/*
+ * The tests use the following type:
+ *
+ * struct Data
+ * {
+ *     long id;
+ *     string name;
+ * };
+ */
+class ReaderFilterCollectionTests : public testing::Test
+{
+public:
+
+    void SetUp() override
+    {
+        Log::SetVerbosity(Log::Kind::Error);
+
+        DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+        DynamicTypeBuilder_ptr builder = factory->create_struct_builder();
+        builder->add_member(0, "id", factory->create_int32_type());
+        builder->add_member(1, "name", factory->create_string_type());
+        builder->set_name("Data");
+
+        type_.reset(new DynamicPubSubType(builder->build()));
+        filters_.reset(new ReaderFilterCollection(type_));
+    }
+
+    void TearDown() override
+    {
+        filters_.reset();
+        type_.reset();
+        DynamicTypeBuilderFactory::delete_instance();
+    }
+
+    //! Fills a change with a little endian CDR sample
+    static void sample(
+            CacheChange_t& change,
+            int32_t sequence,
+            int32_t id,
+            const std::string& name)
+    {
+        std::vector<uint8_t> buffer = {0x00, CDR_LE, 0x00, 0x00};
+        auto add_uint32 = [&buffer](uint32_t value)
+                {
+                    for (size_t i = 0; i < sizeof(value); ++i)
+                    {
+                        buffer.push_back(static_cast<uint8_t>(value >> (8 * i)));
+                    }
+                };
+        add_uint32(static_cast<uint32_t>(id));
+        add_uint32(static_cast<uint32_t>(name.size() + 1));
+        buffer.insert(buffer.end(), name.begin(), name.end());
+        buffer.push_back(0);
+
+        change.kind = fastrtps::rtps::ALIVE;
+        change.sequenceNumber = SequenceNumber_t(0, sequence);
+        change.serializedPayload.reserve(static_cast<uint32_t>(buffer.size()));
+        change.serializedPayload.length = static_cast<uint32_t>(buffer.size());
+        memcpy(change.serializedPayload.data, buffer.data(), buffer.size());
+    }
+
+    static ContentFilterProperty filter(
+            const std::string& expression,
+            const std::vector<std::string>& parameters = {})
+    {
+        ContentFilterProperty property;
+        property.content_filtered_topic_name = "filtered_topic";
+        property.related_topic_name = "topic";
+        property.filter_class_name = DDSSQLFilter::DDSFilterExpression::filter_class_name;
+        property.filter_expression = expression;
+        property.expression_parameters = parameters;
+        return property;
+    }
+
+    static GUID_t reader_guid(
+            uint8_t id)
+    {
+        GUID_t guid;
+        guid.guidPrefix.value[0] = 1;
+        guid.entityId.value[3] = 0x07;
+        guid.entityId.value[2] = id;
+        return guid;
+    }
+
+    TypeSupport type_;
+    std::unique_ptr<ReaderFilterCollection> filters_;
+};
+
+/*!
+ * @fn TEST_F(ReaderFilterCollectionTests, ReaderWithoutFilter)
+ * @brief This test checks every change is relevant for readers that did not announce a filter.
+ */
+TEST_F(ReaderFilterCollectionTests, ReaderWithoutFilter)
+{
+    CacheChange_t change;
+    sample(change, 1, 1, "one");
+
+    EXPECT_TRUE(filters_->is_relevant(change, reader_guid(1)));
+
+    filters_->update_reader(reader_guid(1), nullptr);
+    EXPECT_TRUE(filters_->is_relevant(change, reader_guid(1)));
+
+    ContentFilterProperty empty = filter("");
+    filters_->update_reader(reader_guid(1), &empty);
+    EXPECT_TRUE(filters_->is_relevant(change, reader_guid(1)));
+}
+
+/*!
+ * @fn TEST_F(ReaderFilterCollectionTests, AddUpdateRemove)
+ * @brief This test checks the filter of a reader is applied once added, replaced when updated, and no longer applied
+ * once the reader is removed or stops filtering.
+ */
+TEST_F(ReaderFilterCollectionTests, AddUpdateRemove)
+{
+    CacheChange_t low;
+    CacheChange_t high;
+    sample(low, 1, 3, "low");
+    sample(high, 2, 10, "high");
+
+    ContentFilterProperty greater = filter("id > 5");
+    filters_->update_reader(reader_guid(1), &greater);
+    EXPECT_FALSE(filters_->is_relevant(low, reader_guid(1)));
+    EXPECT_TRUE(filters_->is_relevant(high, reader_guid(1)));
+
+    ContentFilterProperty lower = filter("id < %0", {"5"});
+    filters_->update_reader(reader_guid(1), &lower);
+    EXPECT_TRUE(filters_->is_relevant(low, reader_guid(1)));
+    EXPECT_FALSE(filters_->is_relevant(high, reader_guid(1)));
+
+    filters_->update_reader(reader_guid(1), nullptr);
+    EXPECT_TRUE(filters_->is_relevant(low, reader_guid(1)));
+    EXPECT_TRUE(filters_->is_relevant(high, reader_guid(1)));
+
+    filters_->update_reader(reader_guid(1), &greater);
+    EXPECT_FALSE(filters_->is_relevant(low, reader_guid(1)));
+    filters_->remove_reader(reader_guid(1));
+    EXPECT_TRUE(filters_->is_relevant(low, reader_guid(1)));
+}
+
+/*!
+ * @fn TEST_F(ReaderFilterCollectionTests, EvaluatedPerReader)
+ * @brief This test checks each reader gets the result of its own filter, including readers sharing the same filter,
+ * when the same change is evaluated for all of them.
+ */
+TEST_F(ReaderFilterCollectionTests, EvaluatedPerReader)
+{
+    ContentFilterProperty greater = filter("id > 5");
+    ContentFilterProperty named = filter("name = 'low'");
+    filters_->update_reader(reader_guid(1), &greater);
+    filters_->update_reader(reader_guid(2), &greater);
+    filters_->update_reader(reader_guid(3), &named);
+
+    CacheChange_t low;
+    sample(low, 1, 3, "low");
+    EXPECT_FALSE(filters_->is_relevant(low, reader_guid(1)));
+    EXPECT_FALSE(filters_->is_relevant(low, reader_guid(2)));
+    EXPECT_TRUE(filters_->is_relevant(low, reader_guid(3)));
+    EXPECT_TRUE(filters_->is_relevant(low, reader_guid(4)));
+
+    CacheChange_t high;
+    sample(high, 2, 10, "high");
+    EXPECT_TRUE(filters_->is_relevant(high, reader_guid(1)));
+    EXPECT_TRUE(filters_->is_relevant(high, reader_guid(2)));
+    EXPECT_FALSE(filters_->is_relevant(high, reader_guid(3)));
+    EXPECT_TRUE(filters_->is_relevant(high, reader_guid(4)));
+
+    // The filter shared with the removed reader keeps being applied to the other one
+    filters_->remove_reader(reader_guid(1));
+    EXPECT_TRUE(filters_->is_relevant(low, reader_guid(1)));
+    EXPECT_FALSE(filters_->is_relevant(low, reader_guid(2)));
+}
+
+/*!
+ * @fn TEST_F(ReaderFilterCollectionTests, NotEvaluated)
+ * @brief This test checks the changes the writer cannot evaluate are relevant, so the reader filters them itself.
+ */
+TEST_F(ReaderFilterCollectionTests, NotEvaluated)
+{
+    CacheChange_t low;
+    sample(low, 1, 3, "low");
+
+    // Unsupported filter class
+    ContentFilterProperty other_class = filter("id > 5");
+    other_class.filter_class_name = "OTHER";
+    filters_->update_reader(reader_guid(1), &other_class);
+    EXPECT_TRUE(filters_->is_relevant(low, reader_guid(1)));
+
+    // Expression not valid for the type
+    ContentFilterProperty wrong_field = filter("unknown > 5");
+    filters_->update_reader(reader_guid(1), &wrong_field);
+    EXPECT_TRUE(filters_->is_relevant(low, reader_guid(1)));
+
+    // Only samples are filtered
+    ContentFilterProperty greater = filter("id > 5");
+    filters_->update_reader(reader_guid(1), &greater);
+    EXPECT_FALSE(filters_->is_relevant(low, reader_guid(1)));
+    low.kind = fastrtps::rtps::NOT_ALIVE_DISPOSED;
+    EXPECT_TRUE(filters_->is_relevant(low, reader_guid(1)));
+}
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
@@ -17,12 +17,19 @@
 
 #include <fastdds/dds/domain/DomainParticipantFactory.hpp>
 #include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/publisher/qos/DataWriterQos.hpp>
 #include <fastdds/dds/subscriber/qos/SubscriberQos.hpp>
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
 #include <dds/domain/DomainParticipant.hpp>
 #include <dds/core/types.hpp>
 #include <fastdds/dds/subscriber/Subscriber.hpp>
 #include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/QueryCondition.hpp>
+#include <fastdds/dds/subscriber/ReadCondition.hpp>
+#include <fastdds/dds/core/condition/StatusCondition.hpp>
+#include <fastdds/dds/core/condition/WaitSet.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
 #include <dds/sub/Subscriber.hpp>
 #include <dds/sub/DataReader.hpp>
@@ -106,7 +113,10 @@ public:
     std::function<uint32_t()> getSerializedSizeProvider(
             void* /*data*/) override
     {
-        return std::function<uint32_t()>();
+        return [this]()
+               {
+                   return m_typeSize;
+               };
     }
 
     void* createData() override
@@ -158,6 +168,165 @@ TEST(DataReaderTests, ReadData)
 }
 
 
+TEST(DataReaderTests, ReadConditions)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    Subscriber* subscriber = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+    ASSERT_NE(subscriber, nullptr);
+
+    TypeSupport type(new TopicDataTypeMock());
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    DataReader* data_reader = subscriber->create_datareader(topic, DATAREADER_QOS_DEFAULT);
+    ASSERT_NE(data_reader, nullptr);
+    DataReader* other_reader = subscriber->create_datareader(topic, DATAREADER_QOS_DEFAULT);
+    ASSERT_NE(other_reader, nullptr);
+
+    ReadCondition* read_condition =
+            data_reader->create_readcondition(NOT_READ_SAMPLE_STATE, ANY_VIEW_STATE, ANY_INSTANCE_STATE);
+    ASSERT_NE(read_condition, nullptr);
+    ASSERT_EQ(read_condition->get_datareader(), data_reader);
+    ASSERT_EQ(read_condition->get_sample_state_mask(), NOT_READ_SAMPLE_STATE);
+    ASSERT_EQ(read_condition->get_view_state_mask(), ANY_VIEW_STATE);
+    ASSERT_EQ(read_condition->get_instance_state_mask(), ANY_INSTANCE_STATE);
+    ASSERT_FALSE(read_condition->get_trigger_value());
+
+    // The mock type has no type information, so only an empty query can be compiled
+    ASSERT_EQ(data_reader->create_querycondition(ANY_SAMPLE_STATE, ANY_VIEW_STATE, ANY_INSTANCE_STATE,
+            "message = 'a'", {}), nullptr);
+    QueryCondition* query_condition =
+            data_reader->create_querycondition(ANY_SAMPLE_STATE, ANY_VIEW_STATE, ANY_INSTANCE_STATE, "", {"1"});
+    ASSERT_NE(query_condition, nullptr);
+    ASSERT_FALSE(query_condition->get_trigger_value());
+    std::vector<std::string> parameters;
+    ASSERT_EQ(query_condition->get_query_parameters(parameters), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(parameters, std::vector<std::string>({"1"}));
+
+    // Nothing has been received, so the wait times out
+    WaitSet wait_set;
+    ASSERT_EQ(wait_set.attach_condition(*read_condition), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(wait_set.attach_condition(*query_condition), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(wait_set.attach_condition(data_reader->get_statuscondition()), ReturnCode_t::RETCODE_OK);
+    ConditionSeq active_conditions;
+    ASSERT_EQ(wait_set.wait(active_conditions, fastrtps::Duration_t(0, 1000000)), ReturnCode_t::RETCODE_TIMEOUT);
+    ASSERT_TRUE(active_conditions.empty());
+
+    // Conditions can only be deleted through their reader, and should be deleted before it
+    ASSERT_EQ(other_reader->delete_readcondition(read_condition), ReturnCode_t::RETCODE_PRECONDITION_NOT_MET);
+    ASSERT_EQ(data_reader->delete_readcondition(nullptr), ReturnCode_t::RETCODE_BAD_PARAMETER);
+    ASSERT_EQ(subscriber->delete_datareader(data_reader), ReturnCode_t::RETCODE_PRECONDITION_NOT_MET);
+
+    // Deleting an attached condition detaches it
+    ASSERT_EQ(data_reader->delete_readcondition(read_condition), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(data_reader->delete_readcondition(query_condition), ReturnCode_t::RETCODE_OK);
+    ConditionSeq attached_conditions;
+    ASSERT_EQ(wait_set.get_conditions(attached_conditions), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(attached_conditions.size(), 1u);
+    ASSERT_EQ(wait_set.detach_condition(data_reader->get_statuscondition()), ReturnCode_t::RETCODE_OK);
+
+    ASSERT_EQ(subscriber->delete_datareader(data_reader), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(subscriber->delete_datareader(other_reader), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_topic(topic), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_subscriber(subscriber), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(DomainParticipantFactory::get_instance()->delete_participant(participant), ReturnCode_t::RETCODE_OK);
+}
+
+
+/*!
+ * @fn TEST(DataReaderTests, ReadConditionsTriggeredByWrite)
+ * @brief This test checks a sample written on the topic wakes a WaitSet waiting on a ReadCondition and another one
+ * waiting on a QueryCondition of the reader, and that taking the sample resets both conditions.
+ */
+TEST(DataReaderTests, ReadConditionsTriggeredByWrite)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    TypeSupport type(new TopicDataTypeMock());
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    Subscriber* subscriber = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+    ASSERT_NE(subscriber, nullptr);
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    DataReader* data_reader = subscriber->create_datareader(topic, reader_qos);
+    ASSERT_NE(data_reader, nullptr);
+
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+    DataWriter* data_writer = publisher->create_datawriter(topic, DATAWRITER_QOS_DEFAULT);
+    ASSERT_NE(data_writer, nullptr);
+
+    // Wait until both endpoints have matched, so the sample is not lost
+    ConditionSeq active_conditions;
+    for (Entity* entity : std::vector<Entity*>({data_writer, data_reader}))
+    {
+        StatusCondition& status_condition = entity->get_statuscondition();
+        StatusMask matched = entity == data_writer ?
+                StatusMask::publication_matched() : StatusMask::subscription_matched();
+        ASSERT_EQ(status_condition.set_enabled_statuses(matched), ReturnCode_t::RETCODE_OK);
+        WaitSet matched_wait_set;
+        ASSERT_EQ(matched_wait_set.attach_condition(status_condition), ReturnCode_t::RETCODE_OK);
+        ASSERT_EQ(matched_wait_set.wait(active_conditions, fastrtps::Duration_t(10, 0)), ReturnCode_t::RETCODE_OK);
+    }
+
+    ReadCondition* read_condition =
+            data_reader->create_readcondition(NOT_READ_SAMPLE_STATE, ANY_VIEW_STATE, ANY_INSTANCE_STATE);
+    ASSERT_NE(read_condition, nullptr);
+    QueryCondition* query_condition =
+            data_reader->create_querycondition(ANY_SAMPLE_STATE, ANY_VIEW_STATE, ANY_INSTANCE_STATE, "", {});
+    ASSERT_NE(query_condition, nullptr);
+
+    WaitSet read_wait_set;
+    ASSERT_EQ(read_wait_set.attach_condition(*read_condition), ReturnCode_t::RETCODE_OK);
+    WaitSet query_wait_set;
+    ASSERT_EQ(query_wait_set.attach_condition(*query_condition), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(read_wait_set.wait(active_conditions, fastrtps::Duration_t(0, 1000000)), ReturnCode_t::RETCODE_TIMEOUT);
+    ASSERT_EQ(query_wait_set.wait(active_conditions, fastrtps::Duration_t(0, 1000000)), ReturnCode_t::RETCODE_TIMEOUT);
+
+    // The write wakes both WaitSets
+    FooType data;
+    data.message("HelloWorld");
+    ASSERT_TRUE(data_writer->write(&data));
+
+    ASSERT_EQ(read_wait_set.wait(active_conditions, fastrtps::Duration_t(10, 0)), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(active_conditions.size(), 1u);
+    EXPECT_EQ(active_conditions[0], read_condition);
+    ASSERT_EQ(query_wait_set.wait(active_conditions, fastrtps::Duration_t(10, 0)), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(active_conditions.size(), 1u);
+    EXPECT_EQ(active_conditions[0], query_condition);
+    EXPECT_TRUE(read_condition->get_trigger_value());
+    EXPECT_TRUE(query_condition->get_trigger_value());
+
+    // Taking the only sample resets both conditions
+    FooType taken;
+    SampleInfo info;
+    ASSERT_EQ(data_reader->take_next_sample(&taken, &info), ReturnCode_t::RETCODE_OK);
+    EXPECT_FALSE(read_condition->get_trigger_value());
+    EXPECT_FALSE(query_condition->get_trigger_value());
+    EXPECT_EQ(read_wait_set.wait(active_conditions, fastrtps::Duration_t(0, 1000000)), ReturnCode_t::RETCODE_TIMEOUT);
+    EXPECT_EQ(query_wait_set.wait(active_conditions, fastrtps::Duration_t(0, 1000000)), ReturnCode_t::RETCODE_TIMEOUT);
+
+    ASSERT_EQ(data_reader->delete_readcondition(read_condition), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(data_reader->delete_readcondition(query_condition), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(publisher->delete_datawriter(data_writer), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(subscriber->delete_datareader(data_reader), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_publisher(publisher), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_subscriber(subscriber), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_topic(topic), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(DomainParticipantFactory::get_instance()->delete_participant(participant), ReturnCode_t::RETCODE_OK);
+}
+
 
 void set_listener_test (
         DataReader* reader,
@@ -0,0 +1,329 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastrtps/types/DynamicTypeBuilder.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/DynamicTypeBuilderPtr.h>
+#include <fastrtps/types/DynamicTypePtr.h>
+
+#include <fastdds/topic/DDSSQLFilter/DDSFilterExpression.hpp>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace DDSSQLFilter {
+
+using fastrtps::rtps::SerializedPayload_t;
+using fastrtps::types::DynamicTypeBuilder_ptr;
+using fastrtps::types::DynamicTypeBuilderFactory;
+using fastrtps::types::DynamicType_ptr;
+
+/*
+ * Builds CDR payloads by hand, following the layout of the type used on the tests:
+ *
+ * enum Color { RED, GREEN, BLUE };
+ * struct Inner { short x; string label; };
+ * struct Data
+ * {
+ *     long id;
+ *     double value;
+ *     string name;
+ *     Color color;
+ *     sequence<unsigned short> values;
+ *     Inner inner;
+ *     boolean flag;
+ * };
+ */
+class CdrBuilder
+{
+public:
+
+    explicit CdrBuilder(
+            bool big_endian = false)
+        : big_endian_(big_endian)
+    {
+        buffer_ = {0x00, static_cast<uint8_t>(big_endian ? CDR_BE : CDR_LE), 0x00, 0x00};
+    }
+
+    template<typename T>
+    CdrBuilder& add(
+            T value)
+    {
+        while ((buffer_.size() - 4) % sizeof(T) != 0)
+        {
+            buffer_.push_back(0);
+        }
+
+        uint8_t bytes[sizeof(T)];
+        memcpy(bytes, &value, sizeof(T));
+        bool host_big_endian = fastrtps::rtps::DEFAULT_ENDIAN == fastrtps::rtps::BIGEND;
+        for (size_t i = 0; i < sizeof(T); ++i)
+        {
+            buffer_.push_back(bytes[big_endian_ == host_big_endian ? i : sizeof(T) - 1 - i]);
+        }
+        return *this;
+    }
+
+    CdrBuilder& add_string(
+            const std::string& value)
+    {
+        add<uint32_t>(static_cast<uint32_t>(value.size() + 1));
+        buffer_.insert(buffer_.end(), value.begin(), value.end());
+        buffer_.push_back(0);
+        return *this;
+    }
+
+    SerializedPayload_t payload(
+            size_t truncate = 0) const
+    {
+        SerializedPayload_t payload(static_cast<uint32_t>(buffer_.size()));
+        payload.length = static_cast<uint32_t>(buffer_.size() - truncate);
+        memcpy(payload.data, buffer_.data(), payload.length);
+        return payload;
+    }
+
+private:
+
+    bool big_endian_;
+    std::vector<uint8_t> buffer_;
+};
+
+class DDSSQLFilterTests : public testing::Test
+{
+public:
+
+    void SetUp() override
+    {
+        Log::SetVerbosity(Log::Kind::Error);
+
+        DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+
+        DynamicTypeBuilder_ptr color_builder = factory->create_enum_builder();
+        color_builder->add_empty_member(0, "RED");
+        color_builder->add_empty_member(1, "GREEN");
+        color_builder->add_empty_member(2, "BLUE");
+        color_builder->set_name("Color");
+
+        DynamicTypeBuilder_ptr inner_builder = factory->create_struct_builder();
+        inner_builder->add_member(0, "x", factory->create_int16_type());
+        inner_builder->add_member(1, "label", factory->create_string_type());
+        inner_builder->set_name("Inner");
+
+        DynamicTypeBuilder_ptr values_builder = factory->create_sequence_builder(factory->create_uint16_type(), 10);
+
+        DynamicTypeBuilder_ptr builder = factory->create_struct_builder();
+        builder->add_member(0, "id", factory->create_int32_type());
+        builder->add_member(1, "value", factory->create_float64_type());
+        builder->add_member(2, "name", factory->create_string_type());
+        builder->add_member(3, "color", color_builder->build());
+        builder->add_member(4, "values", values_builder->build());
+        builder->add_member(5, "inner", inner_builder->build());
+        builder->add_member(6, "flag", factory->create_bool_type());
+        builder->set_name("Data");
+        type_ = builder->build();
+    }
+
+    void TearDown() override
+    {
+        type_ = DynamicType_ptr(nullptr);
+        DynamicTypeBuilderFactory::delete_instance();
+    }
+
+    static SerializedPayload_t sample(
+            int32_t id,
+            double value,
+            const std::string& name,
+            uint32_t color,
+            const std::vector<uint16_t>& values,
+            int16_t x,
+            const std::string& label,
+            bool flag,
+            bool big_endian = false)
+    {
+        CdrBuilder builder(big_endian);
+        builder.add(id).add(value).add_string(name).add(color);
+        builder.add(static_cast<uint32_t>(values.size()));
+        for (uint16_t element : values)
+        {
+            builder.add(element);
+        }
+        builder.add(x).add_string(label).add(static_cast<uint8_t>(flag ? 1 : 0));
+        return builder.payload();
+    }
+
+    bool passes(
+            const std::string& expression,
+            const SerializedPayload_t& payload,
+            const std::vector<std::string>& parameters = {})
+    {
+        DDSFilterExpression filter;
+        EXPECT_EQ(ReturnCode_t::RETCODE_OK, filter.compile(type_, expression, parameters)) << expression;
+        return filter.evaluate(payload);
+    }
+
+    ReturnCode_t compile(
+            const std::string& expression,
+            const std::vector<std::string>& parameters = {})
+    {
+        DDSFilterExpression filter;
+        return filter.compile(type_, expression, parameters);
+    }
+
+    DynamicType_ptr type_;
+};
+
+TEST_F(DDSSQLFilterTests, EmptyExpression)
+{
+    SerializedPayload_t payload = sample(1, 1.0, "one", 0, {}, 0, "", false);
+    EXPECT_TRUE(passes("", payload));
+    EXPECT_TRUE(passes("   ", payload));
+}
+
+TEST_F(DDSSQLFilterTests, InvalidExpressions)
+{
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("id >"));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("id = 1 AND"));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("(id = 1"));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("name = 'unterminated"));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("inner.unknown = 1"));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("name = 3"));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("id = 'three'"));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("color = PURPLE"));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("id = %1", {"1"}));
+
+    DDSFilterExpression filter;
+    EXPECT_EQ(ReturnCode_t::RETCODE_UNSUPPORTED, filter.compile(DynamicType_ptr(nullptr), "id = 1", {}));
+}
+
+TEST_F(DDSSQLFilterTests, NumericComparisons)
+{
+    SerializedPayload_t payload = sample(42, 1.5, "one", 0, {}, -3, "", true);
+
+    EXPECT_TRUE(passes("id = 42", payload));
+    EXPECT_FALSE(passes("id <> 42", payload));
+    EXPECT_TRUE(passes("id > 41 AND id < 43", payload));
+    EXPECT_TRUE(passes("id >= 42 AND id <= 42", payload));
+    EXPECT_FALSE(passes("id > 42", payload));
+    EXPECT_TRUE(passes("id > -1", payload));
+    EXPECT_TRUE(passes("value = 1.5", payload));
+    EXPECT_TRUE(passes("value BETWEEN 1 AND 2", payload));
+    EXPECT_FALSE(passes("value NOT BETWEEN 1 AND 2", payload));
+    EXPECT_TRUE(passes("inner.x < 0", payload));
+    EXPECT_TRUE(passes("flag = TRUE", payload));
+    EXPECT_FALSE(passes("flag = FALSE", payload));
+}
+
+TEST_F(DDSSQLFilterTests, Parameters)
+{
+    SerializedPayload_t payload = sample(42, 1.5, "one", 2, {}, 0, "", false);
+
+    EXPECT_TRUE(passes("id = %0", payload, {"42"}));
+    EXPECT_FALSE(passes("id = %0", payload, {"43"}));
+    EXPECT_TRUE(passes("name = %0 AND value < %1", payload, {"'one'", "2.0"}));
+    EXPECT_TRUE(passes("color = %0", payload, {"BLUE"}));
+}
+
+TEST_F(DDSSQLFilterTests, Strings)
+{
+    SerializedPayload_t payload = sample(1, 0.0, "temperature", 0, {}, 0, "sensor_12", false);
+
+    EXPECT_TRUE(passes("name = 'temperature'", payload));
+    EXPECT_FALSE(passes("name = 'temp'", payload));
+    EXPECT_TRUE(passes("name > 'pressure'", payload));
+    EXPECT_TRUE(passes("name LIKE 'temp%'", payload));
+    EXPECT_TRUE(passes("name LIKE '%rat%'", payload));
+    EXPECT_TRUE(passes("name LIKE 't_mperature'", payload));
+    EXPECT_FALSE(passes("name LIKE 'pres%'", payload));
+    EXPECT_TRUE(passes("inner.label LIKE 'sensor__2'", payload));
+}
+
+TEST_F(DDSSQLFilterTests, Enumerations)
+{
+    SerializedPayload_t payload = sample(1, 0.0, "", 1, {}, 0, "", false);
+
+    EXPECT_TRUE(passes("color = GREEN", payload));
+    EXPECT_TRUE(passes("color = 'GREEN'", payload));
+    EXPECT_FALSE(passes("color = RED", payload));
+    EXPECT_TRUE(passes("color > RED", payload));
+}
+
+TEST_F(DDSSQLFilterTests, Sequences)
+{
+    SerializedPayload_t payload = sample(1, 0.0, "", 0, {5, 7, 9}, 11, "end", false);
+
+    EXPECT_TRUE(passes("values[0] = 5", payload));
+    EXPECT_TRUE(passes("values[2] = 9", payload));
+    // Elements beyond the length of the sequence make the predicate false
+    EXPECT_FALSE(passes("values[3] = 0", payload));
+    EXPECT_TRUE(passes("NOT values[3] = 0", payload));
+    // Members after a sequence are reached skipping its elements
+    EXPECT_TRUE(passes("inner.x = 11 AND inner.label = 'end'", payload));
+}
+
+TEST_F(DDSSQLFilterTests, LogicalOperators)
+{
+    SerializedPayload_t payload = sample(3, 0.0, "three", 0, {}, 0, "", false);
+
+    EXPECT_TRUE(passes("id = 1 OR id = 3", payload));
+    EXPECT_FALSE(passes("id = 1 OR id = 2", payload));
+    EXPECT_TRUE(passes("NOT (id = 1 OR id = 2)", payload));
+    EXPECT_TRUE(passes("(id = 3 AND name = 'three') OR id = 4", payload));
+    EXPECT_FALSE(passes("id = 3 AND NOT name = 'three'", payload));
+    EXPECT_TRUE(passes("id = 3 and name = 'three'", payload));
+}
+
+TEST_F(DDSSQLFilterTests, Endianness)
+{
+    SerializedPayload_t little = sample(-7, 2.25, "le", 2, {1, 2}, 5, "x", true, false);
+    SerializedPayload_t big = sample(-7, 2.25, "le", 2, {1, 2}, 5, "x", true, true);
+
+    const std::string expression =
+            "id = -7 AND value = 2.25 AND name = 'le' AND color = BLUE AND values[1] = 2 AND inner.x = 5";
+    EXPECT_TRUE(passes(expression, little));
+    EXPECT_TRUE(passes(expression, big));
+}
+
+TEST_F(DDSSQLFilterTests, UnevaluablePayloads)
+{
+    SerializedPayload_t payload = sample(1, 0.0, "one", 0, {}, 0, "", false);
+
+    // Truncated payloads pass the filter
+    SerializedPayload_t truncated = CdrBuilder().add<int32_t>(1).payload();
+    EXPECT_TRUE(passes("name = 'two'", truncated));
+
+    // Parameter list encapsulations are not evaluated
+    payload.data[1] = PL_CDR_LE;
+    EXPECT_TRUE(passes("id = 2", payload));
+}
+
+} // namespace DDSSQLFilter
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -17,6 +17,7 @@
 
 #include <fastdds/dds/domain/DomainParticipantFactory.hpp>
 #include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/topic/ContentFilteredTopic.hpp>
 #include <fastdds/dds/topic/Topic.hpp>
 #include <fastdds/dds/topic/TopicListener.hpp>
 #include <fastdds/dds/topic/qos/TopicQos.hpp>
@@ -222,6 +223,50 @@ TEST(TopicTests, SetListener)
     ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == ReturnCode_t::RETCODE_OK);
 }
 
+TEST(TopicTests, ContentFilteredTopic)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    TypeSupport type(new TopicDataTypeMock());
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    // Invalid expressions and names
+    ASSERT_EQ(participant->create_contentfilteredtopic("filtered", nullptr, "", {}), nullptr);
+    ASSERT_EQ(participant->create_contentfilteredtopic("filtered", topic, "x >", {}), nullptr);
+    ASSERT_EQ(participant->create_contentfilteredtopic("footopic", topic, "", {}), nullptr);
+
+    // An empty expression does not need type information
+    ContentFilteredTopic* filtered = participant->create_contentfilteredtopic("filtered", topic, "", {"1"});
+    ASSERT_NE(filtered, nullptr);
+    ASSERT_EQ(filtered->get_related_topic(), topic);
+    ASSERT_EQ(filtered->get_participant(), participant);
+    ASSERT_EQ(filtered->get_type_name(), type.get_type_name());
+    ASSERT_EQ(participant->lookup_topicdescription("filtered"), filtered);
+    ASSERT_EQ(participant->create_contentfilteredtopic("filtered", topic, "", {}), nullptr);
+    ASSERT_EQ(participant->create_topic("filtered", type.get_type_name(), TOPIC_QOS_DEFAULT), nullptr);
+
+    std::vector<std::string> parameters;
+    ASSERT_EQ(filtered->get_expression_parameters(parameters), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(parameters, std::vector<std::string>({"1"}));
+    ASSERT_EQ(filtered->set_expression_parameters({"2", "3"}), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(filtered->get_expression_parameters(parameters), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(parameters, std::vector<std::string>({"2", "3"}));
+
+    // The related topic cannot be deleted while the filtered topic exists
+    ASSERT_EQ(participant->delete_topic(topic), ReturnCode_t::RETCODE_PRECONDITION_NOT_MET);
+    ASSERT_EQ(participant->delete_contentfilteredtopic(nullptr), ReturnCode_t::RETCODE_BAD_PARAMETER);
+    ASSERT_EQ(participant->delete_contentfilteredtopic(filtered), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->lookup_topicdescription("filtered"), nullptr);
+
+    ASSERT_TRUE(participant->delete_topic(topic) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == ReturnCode_t::RETCODE_OK);
+}
+
 } // namespace dds
 } // namespace fastdds
 } // namespace eprosima
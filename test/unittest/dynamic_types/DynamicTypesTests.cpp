@@ -5069,6 +5069,28 @@ TEST(TypeIdentifierTests, MinimalTypeIdentifierComparision)
     ASSERT_FALSE(unionUnionStruct1 == unionUnion1);
 }
 
+TEST(TypeObjectFactoryTests, ExternalIdentifierLookup)
+{
+    TypeObjectFactory* factory = TypeObjectFactory::get_instance();
+
+    // A copy of a registered identifier must resolve to the stored name and object
+    const TypeIdentifier* stored = GetBoolStructIdentifier(false);
+    ASSERT_NE(stored, nullptr);
+    TypeIdentifier external = *stored;
+    ASSERT_EQ(factory->get_type_name(&external), "BoolStruct");
+    ASSERT_EQ(factory->get_type_object(&external), GetBoolStructObject(false));
+
+    // Primitive identifiers shared by several names resolve to the lowest name
+    TypeIdentifier byte_identifier;
+    byte_identifier._d(TK_BYTE);
+    ASSERT_EQ(factory->get_type_name(&byte_identifier), TKNAME_INT8);
+
+    // Unknown EK_MINIMAL identifiers are not resolved
+    TypeIdentifier unknown = *stored;
+    unknown.equivalence_hash()[0] ^= 0xFF;
+    ASSERT_EQ(factory->get_type_object(&unknown), nullptr);
+}
+
 int main(
         int argc,
         char** argv)
@@ -23,10 +23,60 @@
 #include <thread>
 #include <chrono>
 #include <sstream>
+#include <iostream>
+#include <condition_variable>
+#include <mutex>
 
 using namespace eprosima::fastdds::dds;
 using namespace std;
 
+// Length up to which messages are kept on the ring buffer, as documented on Log::UseRingBuffer
+const size_t ring_message_size = 256;
+
+// Keeps the logging thread delivering the first entry until it is released
+class BlockingConsumer : public LogConsumer
+{
+public:
+
+    void Consume(
+            const Log::Entry&) override
+    {
+        std::unique_lock<std::mutex> guard(mutex_);
+        if (!blocked_)
+        {
+            blocked_ = true;
+            cv_.notify_all();
+            cv_.wait(guard, [this]()
+                    {
+                        return released_;
+                    });
+        }
+    }
+
+    void WaitBlocked()
+    {
+        std::unique_lock<std::mutex> guard(mutex_);
+        cv_.wait(guard, [this]()
+                {
+                    return blocked_;
+                });
+    }
+
+    void Release()
+    {
+        std::unique_lock<std::mutex> guard(mutex_);
+        released_ = true;
+        cv_.notify_all();
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool blocked_ = false;
+    bool released_ = false;
+};
+
 class LogTests : public ::testing::Test
 {
 public:
@@ -107,6 +157,131 @@ TEST_F(LogTests, multithreaded_logging)
     ASSERT_EQ(5u, consumedEntries.size());
 }
 
+TEST_F(LogTests, duplicates_coalescing)
+{
+    Log::CoalesceDuplicates(true);
+
+    for (int i = 0; i != 10; i++)
+    {
+        logWarning(Coalescing, "Repeated message");
+    }
+    logWarning(Coalescing, "Different message");
+
+    Log::Flush();
+    auto consumedEntries = mockConsumer->ConsumedEntries();
+    ASSERT_LE(2u, consumedEntries.size());
+    ASSERT_GE(11u, consumedEntries.size());
+
+    // Repetitions may be split between logging loops, but none of them is lost
+    uint32_t repeated = 0;
+    for (const Log::Entry& entry : consumedEntries)
+    {
+        if (entry.message.find("Repeated message") == 0)
+        {
+            size_t pos = entry.message.find("[repeated ");
+            repeated += (pos == std::string::npos) ? 1u :
+                    static_cast<uint32_t>(std::stoul(entry.message.substr(pos + 10)));
+        }
+        ASSERT_FALSE(entry.timestamp.empty());
+    }
+    ASSERT_EQ(10u, repeated);
+    ASSERT_EQ("Different message", consumedEntries.back().message);
+}
+
+// Entries logged from several threads on a small ring are either consumed or counted as dropped
+TEST_F(LogTests, multithreaded_ring_buffer_logging)
+{
+    constexpr int threads_number = 4;
+    constexpr int messages_per_thread = 1000;
+
+    Log::UseRingBuffer(64);
+    uint64_t dropped = Log::DroppedEntries();
+
+    vector<unique_ptr<thread>> threads;
+    for (int i = 0; i != threads_number; i++)
+    {
+        threads.emplace_back(new thread([i]
+                {
+                    for (int j = 0; j != messages_per_thread; j++)
+                    {
+                        logWarning(Multithread, "I'm thread " << i << " logging sample " << j);
+                    }
+                }));
+    }
+
+    for (auto& thread: threads)
+    {
+        thread->join();
+    }
+
+    Log::Flush();
+    dropped = Log::DroppedEntries() - dropped;
+    ASSERT_EQ(static_cast<size_t>(threads_number * messages_per_thread),
+            mockConsumer->ConsumedEntries().size() + dropped);
+}
+
+TEST_F(LogTests, ring_buffer_logging)
+{
+    Log::UseRingBuffer(16);
+
+    for (int i = 0; i != 10; i++)
+    {
+        logWarning(Ring, "Sample " << i);
+    }
+    std::string long_message(ring_message_size + 10, 'a');
+    logError(Ring, long_message);
+
+    Log::Flush();
+    auto consumedEntries = mockConsumer->ConsumedEntries();
+    ASSERT_EQ(11u, consumedEntries.size());
+    for (int i = 0; i != 10; i++)
+    {
+        EXPECT_EQ("Sample " + std::to_string(i), consumedEntries[i].message);
+        EXPECT_EQ(Log::Kind::Warning, consumedEntries[i].kind);
+        EXPECT_STREQ("Ring", consumedEntries[i].context.category);
+        EXPECT_FALSE(consumedEntries[i].timestamp.empty());
+    }
+
+    // Long messages are truncated
+    EXPECT_EQ(Log::Kind::Error, consumedEntries[10].kind);
+    EXPECT_EQ(long_message.substr(0, ring_message_size - 3) + "...", consumedEntries[10].message);
+
+    // Going back to the default queue
+    Log::UseRingBuffer(0);
+    logError(Ring, long_message);
+    consumedEntries = HELPER_WaitForEntries(12);
+    ASSERT_EQ(12u, consumedEntries.size());
+    EXPECT_EQ(long_message, consumedEntries.back().message);
+}
+
+TEST_F(LogTests, ring_buffer_drops_when_full)
+{
+    BlockingConsumer* blockingConsumer = new BlockingConsumer();
+    Log::RegisterConsumer(std::unique_ptr<LogConsumer>(blockingConsumer));
+    Log::UseRingBuffer(4);
+    uint64_t dropped = Log::DroppedEntries();
+
+    // The logging thread takes the first entry out of the ring, and stays delivering it
+    logWarning(Ring, "First");
+    blockingConsumer->WaitBlocked();
+
+    for (int i = 0; i != 7; i++)
+    {
+        logWarning(Ring, "Sample " << i);
+    }
+    EXPECT_EQ(3u, Log::DroppedEntries() - dropped);
+
+    blockingConsumer->Release();
+    Log::Flush();
+    auto consumedEntries = mockConsumer->ConsumedEntries();
+    ASSERT_EQ(5u, consumedEntries.size());
+    EXPECT_EQ("First", consumedEntries[0].message);
+    for (int i = 0; i != 4; i++)
+    {
+        EXPECT_EQ("Sample " + std::to_string(i), consumedEntries[i + 1].message);
+    }
+}
+
 TEST_F(LogTests, regex_category_filtering)
 {
     Log::SetCategoryFilter(std::regex("(Good)"));
@@ -0,0 +1,266 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastdds/rtps/messages/CDRMessage.h>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace eprosima::fastrtps::rtps;
+
+namespace {
+
+const Endianness_t other_endian = DEFAULT_ENDIAN == LITTLEEND ? BIGEND : LITTLEEND;
+
+SequenceNumberSet_t sequence_number_set(
+        uint32_t num_bits)
+{
+    SequenceNumberSet_t set(SequenceNumber_t(1, 10));
+    for (uint32_t i = 0; i < num_bits; i += 3)
+    {
+        set.add(SequenceNumber_t(1, 10 + i));
+    }
+    set.add(SequenceNumber_t(1, 10 + num_bits - 1));
+    return set;
+}
+
+//! Writes a bitmap one word at a time, as the message creator did before the bulk helpers existed
+void add_bitmap_per_word(
+        CDRMessage_t* msg,
+        const uint32_t* bitmap,
+        uint32_t n_longs)
+{
+    for (uint32_t i = 0; i < n_longs; ++i)
+    {
+        CDRMessage::addUInt32(msg, bitmap[i]);
+    }
+}
+
+//! Reads a bitmap one word at a time, as the message receiver did before the bulk helpers existed
+void read_bitmap_per_word(
+        CDRMessage_t* msg,
+        uint32_t* bitmap,
+        uint32_t n_longs)
+{
+    for (uint32_t i = 0; i < n_longs; ++i)
+    {
+        CDRMessage::readUInt32(msg, &bitmap[i]);
+    }
+}
+
+} // namespace
+
+/*!
+ * @fn TEST(CDRMessageTests, SequenceNumberSetRoundTrip)
+ * @brief This test checks sequence number sets of any size are read back as they were added, with both endiannesses.
+ */
+TEST(CDRMessageTests, SequenceNumberSetRoundTrip)
+{
+    for (Endianness_t endian : {DEFAULT_ENDIAN, other_endian})
+    {
+        for (uint32_t num_bits : {1u, 31u, 32u, 33u, 100u, 256u})
+        {
+            SequenceNumberSet_t set = sequence_number_set(num_bits);
+
+            CDRMessage_t msg(RTPSMESSAGE_DEFAULT_SIZE);
+            msg.msg_endian = endian;
+            ASSERT_TRUE(CDRMessage::addSequenceNumberSet(&msg, &set));
+            EXPECT_EQ(12u + 4u * ((num_bits + 31u) / 32u), msg.length);
+
+            msg.pos = 0;
+            SequenceNumberSet_t read = CDRMessage::readSequenceNumberSet(&msg);
+            EXPECT_EQ(msg.length, msg.pos);
+            EXPECT_EQ(set.base(), read.base());
+            EXPECT_EQ(set.max(), read.max());
+
+            std::vector<SequenceNumber_t> expected;
+            std::vector<SequenceNumber_t> actual;
+            set.for_each([&expected](const SequenceNumber_t& seq)
+                    {
+                        expected.push_back(seq);
+                    });
+            read.for_each([&actual](const SequenceNumber_t& seq)
+                    {
+                        actual.push_back(seq);
+                    });
+            EXPECT_EQ(expected, actual);
+        }
+    }
+}
+
+/*!
+ * @fn TEST(CDRMessageTests, SequenceNumberSetWireFormat)
+ * @brief This test checks the bitmap words are written with the endianness of the message.
+ */
+TEST(CDRMessageTests, SequenceNumberSetWireFormat)
+{
+    SequenceNumberSet_t set(SequenceNumber_t(0, 1));
+    set.add(SequenceNumber_t(0, 1));
+    set.add(SequenceNumber_t(0, 40));
+
+    CDRMessage_t msg(RTPSMESSAGE_DEFAULT_SIZE);
+    msg.msg_endian = BIGEND;
+    ASSERT_TRUE(CDRMessage::addSequenceNumberSet(&msg, &set));
+    ASSERT_EQ(20u, msg.length);
+
+    // numBits = 40, bitmap = 0x80000000 0x01000000
+    const octet expected[] = {0, 0, 0, 40, 0x80, 0, 0, 0, 0x01, 0, 0, 0};
+    EXPECT_EQ(0, memcmp(expected, &msg.buffer[8], sizeof(expected)));
+}
+
+/*!
+ * @fn TEST(CDRMessageTests, FragmentNumberSetRoundTrip)
+ * @brief This test checks fragment number sets are read back as they were added, with both endiannesses.
+ */
+TEST(CDRMessageTests, FragmentNumberSetRoundTrip)
+{
+    for (Endianness_t endian : {DEFAULT_ENDIAN, other_endian})
+    {
+        FragmentNumberSet_t set(5u);
+        set.add(5u);
+        set.add(77u);
+        set.add(260u);
+
+        CDRMessage_t msg(RTPSMESSAGE_DEFAULT_SIZE);
+        msg.msg_endian = endian;
+        ASSERT_TRUE(CDRMessage::addFragmentNumberSet(&msg, &set));
+
+        msg.pos = 0;
+        FragmentNumberSet_t read;
+        ASSERT_TRUE(CDRMessage::readFragmentNumberSet(&msg, &read));
+        EXPECT_EQ(msg.length, msg.pos);
+        EXPECT_EQ(set.base(), read.base());
+        EXPECT_TRUE(read.is_set(5u));
+        EXPECT_TRUE(read.is_set(77u));
+        EXPECT_TRUE(read.is_set(260u));
+        EXPECT_FALSE(read.is_set(6u));
+    }
+}
+
+/*!
+ * @fn TEST(CDRMessageTests, UInt32ArrayBounds)
+ * @brief This test checks arrays are neither read nor written beyond the boundaries of the message.
+ */
+TEST(CDRMessageTests, UInt32ArrayBounds)
+{
+    uint32_t values[4] = {1u, 2u, 3u, 4u};
+
+    CDRMessage_t msg(12);
+    EXPECT_FALSE(CDRMessage::addUInt32Array(&msg, values, 4));
+    EXPECT_EQ(0u, msg.length);
+    EXPECT_TRUE(CDRMessage::addUInt32Array(&msg, values, 3));
+    EXPECT_EQ(12u, msg.length);
+
+    msg.pos = 4;
+    uint32_t read[4] = {0u, 0u, 0u, 0u};
+    EXPECT_FALSE(CDRMessage::readUInt32Array(&msg, read, 3));
+    EXPECT_EQ(4u, msg.pos);
+    EXPECT_TRUE(CDRMessage::readUInt32Array(&msg, read, 2));
+    EXPECT_EQ(2u, read[0]);
+    EXPECT_EQ(3u, read[1]);
+}
+
+/*!
+ * @fn TEST(CDRMessageTests, OctetVectorPadding)
+ * @brief This test checks octet vectors are padded to a multiple of four bytes.
+ */
+TEST(CDRMessageTests, OctetVectorPadding)
+{
+    for (size_t size : {0u, 1u, 3u, 4u, 5u})
+    {
+        std::vector<octet> data(size, 0xAB);
+        CDRMessage_t msg(RTPSMESSAGE_DEFAULT_SIZE);
+        memset(msg.buffer, 0xFF, msg.max_size);
+        ASSERT_TRUE(CDRMessage::addOctetVector(&msg, &data));
+        ASSERT_EQ(4u + ((size + 3u) & ~3u), msg.length);
+        for (uint32_t i = static_cast<uint32_t>(4u + size); i < msg.length; ++i)
+        {
+            EXPECT_EQ(0u, msg.buffer[i]);
+        }
+
+        msg.pos = 0;
+        std::vector<octet> read;
+        ASSERT_TRUE(CDRMessage::readOctetVector(&msg, &read));
+        EXPECT_EQ(data, read);
+        EXPECT_EQ(msg.length, msg.pos);
+    }
+}
+
+/*!
+ * @fn TEST(CDRMessageTests, BitmapMicroBenchmark)
+ * @brief Micro-benchmark comparing full 256 bit bitmaps added and read one word at a time with the bulk helpers.
+ * It only checks both produce the same results, the times are reported for reference.
+ */
+TEST(CDRMessageTests, BitmapMicroBenchmark)
+{
+    const uint32_t iterations = 200000;
+    uint32_t bitmap[8] = {0x80000001u, 0x12345678u, 0x9ABCDEF0u, 0xFFFFFFFFu, 0x0u, 0x1u, 0x80000000u, 0xDEADBEEFu};
+
+    for (Endianness_t endian : {DEFAULT_ENDIAN, other_endian})
+    {
+        CDRMessage_t per_word_msg(RTPSMESSAGE_DEFAULT_SIZE);
+        CDRMessage_t bulk_msg(RTPSMESSAGE_DEFAULT_SIZE);
+        per_word_msg.msg_endian = endian;
+        bulk_msg.msg_endian = endian;
+        uint32_t per_word_read[8];
+        uint32_t bulk_read[8];
+        uint64_t checksum = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; ++i)
+        {
+            per_word_msg.pos = 0;
+            per_word_msg.length = 0;
+            bitmap[0] = i;
+            add_bitmap_per_word(&per_word_msg, bitmap, 8);
+            per_word_msg.pos = 0;
+            read_bitmap_per_word(&per_word_msg, per_word_read, 8);
+            checksum += per_word_read[i & 7];
+        }
+        auto per_word_time = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; ++i)
+        {
+            bulk_msg.pos = 0;
+            bulk_msg.length = 0;
+            bitmap[0] = i;
+            CDRMessage::addUInt32Array(&bulk_msg, bitmap, 8);
+            bulk_msg.pos = 0;
+            CDRMessage::readUInt32Array(&bulk_msg, bulk_read, 8);
+            checksum -= bulk_read[i & 7];
+        }
+        auto bulk_time = std::chrono::steady_clock::now() - start;
+
+        EXPECT_EQ(0u, checksum);
+        EXPECT_EQ(0, memcmp(per_word_msg.buffer, bulk_msg.buffer, 32));
+        EXPECT_EQ(0, memcmp(per_word_read, bulk_read, sizeof(bulk_read)));
+
+        std::cout << (endian == DEFAULT_ENDIAN ? "Native" : "Swapped") << " endianness, 256 bit bitmap add + read: " <<
+            std::chrono::duration<double, std::nano>(per_word_time).count() / iterations << " ns word by word, " <<
+            std::chrono::duration<double, std::nano>(bulk_time).count() / iterations << " ns bulk" << std::endl;
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -14,7 +14,9 @@
 
 #include <fastrtps/rtps/common/CacheChange.h>
 
+#include <algorithm>
 #include <climits>
+#include <random>
 #include <vector>
 #include <gtest/gtest.h>
 
@@ -132,6 +134,119 @@ TEST(CacheChange, FragmentManagement)
     }
 }
 
+/*!
+ * @fn TEST(CacheChange, OutOfOrderReassembly)
+ * @brief This test checks the reassembly of a change with a large number of tiny fragments received out of order.
+ */
+TEST(CacheChange, OutOfOrderReassembly)
+{
+    const uint16_t fragment_size = 2;
+    const uint32_t num_fragments = 1000;
+    const uint32_t sample_size = fragment_size * num_fragments - 1;
+
+    SerializedPayload_t source(sample_size);
+    source.length = sample_size;
+    for (uint32_t i = 0; i < sample_size; ++i)
+    {
+        source.data[i] = static_cast<octet>(i * 7);
+    }
+
+    CacheChange_t uut(sample_size);
+    uut.serializedPayload.length = sample_size;
+    uut.setFragmentSize(fragment_size, true);
+    ASSERT_EQ(uut.getFragmentCount(), num_fragments);
+    ASSERT_FALSE(uut.is_fully_assembled());
+
+    std::vector<uint32_t> order(num_fragments);
+    for (uint32_t i = 0; i < num_fragments; ++i)
+    {
+        order[i] = i;
+    }
+    std::shuffle(order.begin(), order.end(), std::mt19937(1234));
+
+    std::vector<bool> received(num_fragments, false);
+    for (uint32_t n = 0; n < num_fragments; ++n)
+    {
+        uint32_t frag = order[n];
+        SerializedPayload_t incoming(fragment_size);
+        incoming.length = fragment_size;
+        uint32_t offset = frag * fragment_size;
+        uint32_t len = std::min<uint32_t>(fragment_size, sample_size - offset);
+        memcpy(incoming.data, &source.data[offset], len);
+
+        bool completed = uut.add_fragments(incoming, frag + 1, 1);
+        received[frag] = true;
+        ASSERT_EQ(completed, n + 1 == num_fragments);
+
+        FragmentNumberSet_t fns;
+        uut.get_missing_fragments(fns);
+        if (completed)
+        {
+            ASSERT_TRUE(fns.empty());
+            break;
+        }
+
+        // First missing fragment should be the base, and every fragment in range should be reported
+        uint32_t first_missing = static_cast<uint32_t>(
+            std::find(received.begin(), received.end(), false) - received.begin());
+        ASSERT_EQ(fns.base(), first_missing + 1);
+        for (uint32_t i = first_missing; i < num_fragments && i < first_missing + 256u; ++i)
+        {
+            ASSERT_EQ(fns.is_set(i + 1), !received[i]) << "fragment " << i << " after " << n + 1 << " fragments";
+        }
+    }
+
+    ASSERT_TRUE(uut.is_fully_assembled());
+    ASSERT_EQ(0, memcmp(uut.serializedPayload.data, source.data, sample_size));
+}
+
+TEST(CacheChange, SharedReassembly)
+{
+    const uint16_t fragment_size = 4;
+    const uint32_t num_fragments = 10;
+    const uint32_t sample_size = fragment_size * num_fragments - 2;
+
+    // Reassembly buffer shared with the change under test, already holding some fragments
+    CacheChange_t assembly(sample_size);
+    assembly.serializedPayload.length = sample_size;
+    assembly.setFragmentSize(fragment_size, true);
+    for (uint32_t i = 0; i < sample_size; ++i)
+    {
+        assembly.serializedPayload.data[i] = static_cast<octet>(i + 1);
+    }
+
+    CacheChange_t uut;
+    uut.serializedPayload.data = assembly.serializedPayload.data;
+    uut.serializedPayload.length = sample_size;
+    uut.serializedPayload.max_size = sample_size;
+    uut.setFragmentSize(fragment_size, true);
+
+    // Fragments in place are only marked as received
+    const uint32_t received_fragments[] = { 1, 2, 5, 10 };
+    for (uint32_t frag : received_fragments)
+    {
+        SerializedPayload_t incoming;
+        incoming.data = &assembly.serializedPayload.data[(frag - 1) * fragment_size];
+        incoming.length = fragment_size;
+        uut.add_fragments(incoming, frag, 1);
+        incoming.data = nullptr;
+    }
+    ASSERT_FALSE(uut.is_fully_assembled());
+
+    // Only received fragments are copied
+    std::vector<octet> copy(sample_size, 0);
+    uut.copy_received_fragments(copy.data());
+    for (uint32_t i = 0; i < sample_size; ++i)
+    {
+        uint32_t frag = i / fragment_size + 1;
+        bool received = std::find(std::begin(received_fragments), std::end(received_fragments), frag) !=
+                std::end(received_fragments);
+        ASSERT_EQ(copy[i], received ? static_cast<octet>(i + 1) : 0) << "byte " << i;
+    }
+
+    uut.serializedPayload.data = nullptr;
+}
+
 int main(
         int argc,
         char **argv)
@@ -0,0 +1,285 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <rtps/builtin/discovery/database/backup/BackupJournal.hpp>
+
+#include <json.hpp>
+
+using namespace eprosima::fastdds::rtps::ddb;
+
+class BackupJournalTests : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        const ::testing::TestInfo* info = ::testing::UnitTest::GetInstance()->current_test_info();
+        snapshot_file_ = std::string("BackupJournalTests_") + info->name() + ".snapshot";
+        journal_file_ = std::string("BackupJournalTests_") + info->name() + ".journal";
+        legacy_file_ = std::string("BackupJournalTests_") + info->name() + ".json";
+        remove_files();
+    }
+
+    void TearDown() override
+    {
+        remove_files();
+    }
+
+    void remove_files()
+    {
+        std::remove(snapshot_file_.c_str());
+        std::remove(journal_file_.c_str());
+        std::remove((snapshot_file_ + ".tmp").c_str());
+        std::remove(legacy_file_.c_str());
+    }
+
+    static nlohmann::json entity(
+            const std::string& topic,
+            bool acked)
+    {
+        nlohmann::json j;
+        j["change"]["kind"] = 0;
+        j["change"]["serialized_payload"]["data"] = "AAECAwQFBgc=";
+        j["ack_status"]["01.0f.00.00.00.00.00.00.00.00.00.00"] = acked;
+        j["topic"] = topic;
+        return j;
+    }
+
+    static nlohmann::json database()
+    {
+        nlohmann::json j;
+        j["participants"]["01.0f.00.00.00.00.00.00.00.00.00.01"] = entity("", true);
+        j["participants"]["01.0f.00.00.00.00.00.00.00.00.00.02"] = entity("", false);
+        j["writers"]["01.0f.00.00.00.00.00.00.00.00.00.01|0.0.1.3"] = entity("topic_a", true);
+        j["readers"] = nlohmann::json::object();
+        return j;
+    }
+
+    std::vector<char> read_file(
+            const std::string& file_name)
+    {
+        std::ifstream file(file_name, std::ios_base::binary);
+        return std::vector<char>((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    }
+
+    void write_file(
+            const std::string& file_name,
+            const std::vector<char>& data)
+    {
+        std::ofstream file(file_name, std::ios_base::binary | std::ios_base::trunc);
+        file.write(data.data(), data.size());
+    }
+
+    std::string snapshot_file_;
+    std::string journal_file_;
+    std::string legacy_file_;
+};
+
+/*!
+ * @fn TEST_F(BackupJournalTests, ReplayJournalOverSnapshot)
+ * @brief This test checks the database is restored from the snapshot with the journal records replayed over it.
+ */
+TEST_F(BackupJournalTests, ReplayJournalOverSnapshot)
+{
+    nlohmann::json expected = database();
+    {
+        BackupJournal journal(snapshot_file_, journal_file_);
+        EXPECT_TRUE(journal.snapshot_needed());
+        ASSERT_TRUE(journal.write_snapshot(expected));
+        EXPECT_FALSE(journal.snapshot_needed());
+
+        expected["writers"]["01.0f.00.00.00.00.00.00.00.00.00.01|0.0.1.3"] = entity("topic_a", false);
+        journal.update("writers", "01.0f.00.00.00.00.00.00.00.00.00.01|0.0.1.3",
+                expected["writers"]["01.0f.00.00.00.00.00.00.00.00.00.01|0.0.1.3"]);
+        expected["participants"].erase("01.0f.00.00.00.00.00.00.00.00.00.02");
+        journal.remove("participants", "01.0f.00.00.00.00.00.00.00.00.00.02");
+        ASSERT_TRUE(journal.commit());
+
+        expected["readers"]["01.0f.00.00.00.00.00.00.00.00.00.01|0.0.1.4"] = entity("topic_b", true);
+        journal.update("readers", "01.0f.00.00.00.00.00.00.00.00.00.01|0.0.1.4",
+                expected["readers"]["01.0f.00.00.00.00.00.00.00.00.00.01|0.0.1.4"]);
+        ASSERT_TRUE(journal.commit());
+    }
+
+    BackupJournal restored(snapshot_file_, journal_file_);
+    nlohmann::json j;
+    ASSERT_TRUE(restored.load(j));
+    EXPECT_EQ(expected, j);
+    // A restored backup starts with a new snapshot
+    EXPECT_TRUE(restored.snapshot_needed());
+}
+
+/*!
+ * @fn TEST_F(BackupJournalTests, IncompleteRecordIsDiscarded)
+ * @brief This test checks a record not completely written at the end of the journal is ignored, keeping the
+ * previous ones.
+ */
+TEST_F(BackupJournalTests, IncompleteRecordIsDiscarded)
+{
+    nlohmann::json expected = database();
+    {
+        BackupJournal journal(snapshot_file_, journal_file_);
+        ASSERT_TRUE(journal.write_snapshot(expected));
+
+        expected["participants"].erase("01.0f.00.00.00.00.00.00.00.00.00.02");
+        journal.remove("participants", "01.0f.00.00.00.00.00.00.00.00.00.02");
+        ASSERT_TRUE(journal.commit());
+
+        journal.update("readers", "01.0f.00.00.00.00.00.00.00.00.00.01|0.0.1.4", entity("topic_b", true));
+        ASSERT_TRUE(journal.commit());
+    }
+
+    // Cut the last record
+    std::vector<char> data = read_file(journal_file_);
+    data.resize(data.size() - 5);
+    write_file(journal_file_, data);
+
+    BackupJournal restored(snapshot_file_, journal_file_);
+    nlohmann::json j;
+    ASSERT_TRUE(restored.load(j));
+    EXPECT_EQ(expected, j);
+}
+
+/*!
+ * @fn TEST_F(BackupJournalTests, JournalOfPreviousSnapshotIsIgnored)
+ * @brief This test checks the journal is not replayed when it belongs to a previous snapshot, as happens when
+ * the server stops after replacing the snapshot but before emptying the journal.
+ */
+TEST_F(BackupJournalTests, JournalOfPreviousSnapshotIsIgnored)
+{
+    nlohmann::json expected = database();
+    std::vector<char> old_journal;
+    {
+        BackupJournal journal(snapshot_file_, journal_file_);
+        ASSERT_TRUE(journal.write_snapshot(expected));
+        journal.update("participants", "01.0f.00.00.00.00.00.00.00.00.00.02", entity("", true));
+        ASSERT_TRUE(journal.commit());
+        old_journal = read_file(journal_file_);
+
+        expected["participants"].erase("01.0f.00.00.00.00.00.00.00.00.00.02");
+        ASSERT_TRUE(journal.write_snapshot(expected));
+    }
+    write_file(journal_file_, old_journal);
+
+    BackupJournal restored(snapshot_file_, journal_file_);
+    nlohmann::json j;
+    ASSERT_TRUE(restored.load(j));
+    EXPECT_EQ(expected, j);
+}
+
+/*!
+ * @fn TEST_F(BackupJournalTests, SnapshotNeededWhenJournalGrows)
+ * @brief This test checks a new snapshot is requested once the journal is bigger than the current snapshot.
+ */
+TEST_F(BackupJournalTests, SnapshotNeededWhenJournalGrows)
+{
+    BackupJournal journal(snapshot_file_, journal_file_);
+    ASSERT_TRUE(journal.write_snapshot(database()));
+    uint64_t snapshot_size = journal.snapshot_size();
+
+    uint32_t records = 0;
+    while (!journal.snapshot_needed())
+    {
+        journal.update("writers", "01.0f.00.00.00.00.00.00.00.00.00.01|0.0.1.3", entity("topic_a", 0 == records % 2));
+        ASSERT_TRUE(journal.commit());
+        ++records;
+    }
+    EXPECT_GT(journal.journal_size(), BackupJournal::min_compaction_size);
+    EXPECT_GT(journal.journal_size(), snapshot_size);
+
+    ASSERT_TRUE(journal.write_snapshot(database()));
+    EXPECT_FALSE(journal.snapshot_needed());
+    EXPECT_EQ(snapshot_size, journal.snapshot_size());
+}
+
+/*!
+ * @fn TEST_F(BackupJournalTests, MissingSnapshot)
+ * @brief This test checks there is nothing to restore without a snapshot.
+ */
+TEST_F(BackupJournalTests, MissingSnapshot)
+{
+    BackupJournal journal(snapshot_file_, journal_file_);
+    nlohmann::json j;
+    EXPECT_FALSE(journal.load(j));
+}
+
+/*!
+ * @fn TEST_F(BackupJournalTests, MigrateLegacyBackup)
+ * @brief This test checks a json backup of a previous version is restored and replaced by a snapshot, over which
+ * new changes are journaled.
+ */
+TEST_F(BackupJournalTests, MigrateLegacyBackup)
+{
+    nlohmann::json expected = database();
+    {
+        std::ofstream legacy(legacy_file_);
+        legacy << std::setw(4) << expected << std::endl;
+    }
+
+    {
+        BackupJournal journal(snapshot_file_, journal_file_);
+        nlohmann::json j;
+        ASSERT_FALSE(journal.load(j));
+        ASSERT_TRUE(journal.migrate_legacy(legacy_file_, j));
+        EXPECT_EQ(expected, j);
+        EXPECT_FALSE(std::ifstream(legacy_file_).is_open());
+
+        // The migrated backup is already a snapshot, so the changes go to the journal
+        EXPECT_FALSE(journal.snapshot_needed());
+        expected["participants"].erase("01.0f.00.00.00.00.00.00.00.00.00.02");
+        journal.remove("participants", "01.0f.00.00.00.00.00.00.00.00.00.02");
+        ASSERT_TRUE(journal.commit());
+    }
+
+    BackupJournal restored(snapshot_file_, journal_file_);
+    nlohmann::json j;
+    ASSERT_TRUE(restored.load(j));
+    EXPECT_EQ(expected, j);
+}
+
+/*!
+ * @fn TEST_F(BackupJournalTests, InvalidLegacyBackup)
+ * @brief This test checks a missing or unreadable json backup is not migrated, and the unreadable one is kept.
+ */
+TEST_F(BackupJournalTests, InvalidLegacyBackup)
+{
+    BackupJournal journal(snapshot_file_, journal_file_);
+    nlohmann::json j;
+    EXPECT_FALSE(journal.migrate_legacy(legacy_file_, j));
+
+    {
+        std::ofstream legacy(legacy_file_);
+        legacy << "{\"participants\": {";
+    }
+    EXPECT_FALSE(journal.migrate_legacy(legacy_file_, j));
+    EXPECT_TRUE(std::ifstream(legacy_file_).is_open());
+    EXPECT_FALSE(std::ifstream(snapshot_file_).is_open());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
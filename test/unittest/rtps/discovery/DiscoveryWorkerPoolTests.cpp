@@ -0,0 +1,114 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <rtps/builtin/discovery/database/DiscoveryWorkerPool.hpp>
+
+using namespace eprosima::fastdds::rtps::ddb;
+
+/*!
+ * @fn TEST(DiscoveryWorkerPoolTests, EveryPartitionProcessedOnce)
+ * @brief This test checks every partition of each run is processed exactly once, and that run() does not
+ * return before all of them have been processed.
+ */
+TEST(DiscoveryWorkerPoolTests, EveryPartitionProcessedOnce)
+{
+    DiscoveryWorkerPool pool;
+    pool.start(3);
+    EXPECT_EQ(4u, pool.concurrency());
+
+    for (size_t num_partitions : {0u, 1u, 2u, 7u, 1000u})
+    {
+        std::vector<std::atomic<uint32_t>> processed(num_partitions);
+        for (auto& count : processed)
+        {
+            count = 0;
+        }
+
+        pool.run(num_partitions, [&processed](size_t partition)
+                {
+                    ++processed[partition];
+                });
+
+        for (auto& count : processed)
+        {
+            EXPECT_EQ(1u, count);
+        }
+    }
+}
+
+/*!
+ * @fn TEST(DiscoveryWorkerPoolTests, PartitionsRunInParallel)
+ * @brief This test checks the partitions are processed by the threads of the pool besides the caller.
+ */
+TEST(DiscoveryWorkerPoolTests, PartitionsRunInParallel)
+{
+    DiscoveryWorkerPool pool;
+    pool.start(2);
+
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    std::atomic<uint32_t> started(0);
+    pool.run(3, [&](size_t)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    threads.insert(std::this_thread::get_id());
+                }
+                // Keep each thread on its partition until every partition has started
+                ++started;
+                while (started < 3)
+                {
+                    std::this_thread::yield();
+                }
+            });
+
+    EXPECT_EQ(3u, threads.size());
+}
+
+/*!
+ * @fn TEST(DiscoveryWorkerPoolTests, NoThreads)
+ * @brief This test checks a pool without threads processes every partition on the caller.
+ */
+TEST(DiscoveryWorkerPoolTests, NoThreads)
+{
+    DiscoveryWorkerPool pool;
+    pool.start(0);
+    EXPECT_EQ(1u, pool.concurrency());
+
+    std::thread::id caller = std::this_thread::get_id();
+    std::vector<size_t> order;
+    pool.run(5, [&order, caller](size_t partition)
+            {
+                EXPECT_EQ(caller, std::this_thread::get_id());
+                order.push_back(partition);
+            });
+
+    EXPECT_EQ((std::vector<size_t>{0, 1, 2, 3, 4}), order);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
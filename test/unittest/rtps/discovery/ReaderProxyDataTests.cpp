@@ -0,0 +1,105 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/builtin/data/ReaderProxyData.h>
+#include <fastdds/rtps/common/CDRMessage_t.h>
+#include <fastdds/rtps/common/ContentFilterProperty.hpp>
+#include <fastdds/rtps/network/NetworkFactory.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+using fastdds::rtps::ContentFilterProperty;
+
+class ReaderProxyDataTests : public testing::Test
+{
+public:
+
+    ReaderProxyDataTests()
+        : data_(4u, 1u)
+    {
+        data_.guid().guidPrefix.value[0] = 1;
+        data_.guid().entityId.value[3] = 0x07;
+        data_.topicName("topic");
+        data_.typeName("Data");
+    }
+
+    //! Serializes the reader data as it is sent on discovery, and reads it back
+    bool round_trip(
+            ReaderProxyData& read_data)
+    {
+        CDRMessage_t msg(RTPSMESSAGE_DEFAULT_SIZE);
+        if (!data_.writeToCDRMessage(&msg, true))
+        {
+            return false;
+        }
+
+        CDRMessage_t read_msg(msg);
+        return read_data.readFromCDRMessage(&read_msg, network_, false);
+    }
+
+    ReaderProxyData data_;
+    NetworkFactory network_;
+};
+
+/*!
+ * @fn TEST_F(ReaderProxyDataTests, ContentFilterRoundTrip)
+ * @brief This test checks the content filter of a reader, including its parameters, is read back as it was written
+ * on the PID_CONTENT_FILTER_PROPERTY parameter.
+ */
+TEST_F(ReaderProxyDataTests, ContentFilterRoundTrip)
+{
+    ContentFilterProperty filter;
+    filter.content_filtered_topic_name = "filtered_topic";
+    filter.related_topic_name = "topic";
+    filter.filter_class_name = "DDSSQL";
+    filter.filter_expression = "id > %0 AND name = %1";
+    filter.expression_parameters = {"5", "'unaligned'", "", "abc"};
+    data_.content_filter(filter);
+
+    ReaderProxyData read_data(4u, 1u);
+    ASSERT_TRUE(round_trip(read_data));
+    EXPECT_EQ(data_.guid(), read_data.guid());
+    EXPECT_EQ(filter, read_data.content_filter());
+    EXPECT_TRUE(read_data.content_filter().is_set());
+
+    // Without parameters
+    filter.filter_expression = "id > 5";
+    filter.expression_parameters.clear();
+    data_.content_filter(filter);
+
+    ReaderProxyData no_parameters(4u, 1u);
+    ASSERT_TRUE(round_trip(no_parameters));
+    EXPECT_EQ(filter, no_parameters.content_filter());
+}
+
+/*!
+ * @fn TEST_F(ReaderProxyDataTests, NoContentFilter)
+ * @brief This test checks a reader that does not filter is read back without a content filter.
+ */
+TEST_F(ReaderProxyDataTests, NoContentFilter)
+{
+    ReaderProxyData read_data(4u, 1u);
+    ASSERT_TRUE(round_trip(read_data));
+    EXPECT_EQ(data_.guid(), read_data.guid());
+    EXPECT_FALSE(read_data.content_filter().is_set());
+    EXPECT_EQ(ContentFilterProperty(), read_data.content_filter());
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,258 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <rtps/builtin/discovery/participant/WriterAckState.hpp>
+
+using namespace eprosima::fastdds::rtps;
+using eprosima::fastrtps::rtps::GUID_t;
+using eprosima::fastrtps::rtps::GuidPrefix_t;
+using eprosima::fastrtps::rtps::SequenceNumber_t;
+
+namespace {
+
+typedef std::map<GUID_t, SequenceNumber_t> LowMarks;
+
+GUID_t reader(
+        uint32_t id)
+{
+    return GUID_t(GuidPrefix_t(), id);
+}
+
+SequenceNumber_t sn(
+        uint32_t value)
+{
+    return SequenceNumber_t(0, value);
+}
+
+//! Sequence numbers of the changes in [1, end) the ranges include
+std::set<uint32_t> checked(
+        const std::vector<WriterAckState::Range>& ranges,
+        uint32_t end)
+{
+    std::set<uint32_t> result;
+    for (uint32_t i = 1; i < end; ++i)
+    {
+        for (const auto& range : ranges)
+        {
+            if (range.first <= sn(i) && sn(i) < range.second)
+            {
+                result.insert(i);
+            }
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+/*!
+ * @fn TEST(WriterAckStateTests, OnlyNewChangesAndNewAcks)
+ * @brief This test checks the first pass checks every change, and the next ones only the changes added or
+ * acknowledged since the previous pass.
+ */
+TEST(WriterAckStateTests, OnlyNewChangesAndNewAcks)
+{
+    WriterAckState state;
+    LowMarks low_marks{{reader(1), sn(0)}, {reader(2), sn(0)}};
+    EXPECT_EQ(std::set<uint32_t>({1, 2, 3, 4}), checked(state.update(low_marks, sn(5)), 5));
+
+    low_marks = {{reader(1), sn(0)}, {reader(2), sn(0)}};
+    EXPECT_TRUE(checked(state.update(low_marks, sn(5)), 5).empty());
+
+    low_marks = {{reader(1), sn(2)}, {reader(2), sn(0)}};
+    EXPECT_EQ(std::set<uint32_t>({1, 2, 5}), checked(state.update(low_marks, sn(6)), 6));
+}
+
+/*!
+ * @fn TEST(WriterAckStateTests, OutOfOrderAcks)
+ * @brief This test checks changes acknowledged by the readers in a different order, or acknowledged after a later
+ * change of the same reader, are checked once the low mark of the reader goes past them.
+ */
+TEST(WriterAckStateTests, OutOfOrderAcks)
+{
+    WriterAckState state;
+    LowMarks low_marks{{reader(1), sn(0)}, {reader(2), sn(0)}};
+    state.update(low_marks, sn(6));
+
+    // Reader 2 acknowledges before reader 1
+    low_marks = {{reader(1), sn(0)}, {reader(2), sn(3)}};
+    EXPECT_EQ(std::set<uint32_t>({1, 2, 3}), checked(state.update(low_marks, sn(6)), 6));
+
+    // Reader 1 acknowledges 2 and 4, but 3 is missing so its low mark stops at 2
+    low_marks = {{reader(1), sn(2)}, {reader(2), sn(3)}};
+    EXPECT_EQ(std::set<uint32_t>({1, 2}), checked(state.update(low_marks, sn(6)), 6));
+
+    // Once 3 arrives, the low mark jumps over the change acknowledged before
+    low_marks = {{reader(1), sn(4)}, {reader(2), sn(3)}};
+    EXPECT_EQ(std::set<uint32_t>({3, 4}), checked(state.update(low_marks, sn(6)), 6));
+
+    low_marks = {{reader(1), sn(5)}, {reader(2), sn(5)}};
+    EXPECT_EQ(std::set<uint32_t>({4, 5}), checked(state.update(low_marks, sn(6)), 6));
+}
+
+/*!
+ * @fn TEST(WriterAckStateTests, ReaderUnmatchedMidRange)
+ * @brief This test checks the changes a reader had not acknowledged are checked once it is unmatched, as they may
+ * be acknowledged by all the remaining readers.
+ */
+TEST(WriterAckStateTests, ReaderUnmatchedMidRange)
+{
+    WriterAckState state;
+    LowMarks low_marks{{reader(1), sn(5)}, {reader(2), sn(3)}, {reader(3), sn(7)}};
+    state.update(low_marks, sn(8));
+
+    low_marks = {{reader(1), sn(5)}, {reader(3), sn(7)}};
+    EXPECT_EQ(std::set<uint32_t>({4, 5, 6, 7}), checked(state.update(low_marks, sn(8)), 8));
+
+    // Unmatching the first and the last reader of the map
+    low_marks = {{reader(3), sn(7)}};
+    EXPECT_EQ(std::set<uint32_t>({6, 7}), checked(state.update(low_marks, sn(8)), 8));
+
+    low_marks.clear();
+    EXPECT_TRUE(checked(state.update(low_marks, sn(8)), 8).empty());
+}
+
+/*!
+ * @fn TEST(WriterAckStateTests, ChangesRedirtiedAfterAck)
+ * @brief This test checks a change sent again by the database after being acknowledged by all is checked again,
+ * as well as the changes a reader matched later had acknowledged before it was seen.
+ */
+TEST(WriterAckStateTests, ChangesRedirtiedAfterAck)
+{
+    WriterAckState state;
+    LowMarks low_marks{{reader(1), sn(4)}};
+    state.update(low_marks, sn(5));
+
+    // The database sends the change again, so it is added to the history with a new sequence number
+    low_marks = {{reader(1), sn(4)}};
+    EXPECT_EQ(std::set<uint32_t>({5}), checked(state.update(low_marks, sn(6)), 6));
+
+    low_marks = {{reader(1), sn(4)}, {reader(2), sn(3)}};
+    EXPECT_EQ(std::set<uint32_t>({1, 2, 3}), checked(state.update(low_marks, sn(6)), 6));
+
+    low_marks = {{reader(1), sn(5)}, {reader(2), sn(5)}};
+    EXPECT_EQ(std::set<uint32_t>({4, 5}), checked(state.update(low_marks, sn(6)), 6));
+}
+
+/*!
+ * @fn TEST(WriterAckStateTests, RandomSequences)
+ * @brief This test checks, on random sequences of new changes, acknowledgements, matches and unmatches, that every
+ * change that becomes acknowledged by all the readers is checked.
+ * Changes not relevant for a reader count as acknowledged by it, as the writer does.
+ */
+TEST(WriterAckStateTests, RandomSequences)
+{
+    struct ReaderModel
+    {
+        uint32_t low_mark;
+        std::set<uint32_t> irrelevant;
+    };
+
+    std::mt19937 random(1234);
+    for (uint32_t run = 0; run < 200; ++run)
+    {
+        WriterAckState state;
+        std::map<uint32_t, ReaderModel> readers;
+        uint32_t end = 1;
+        uint32_t next_reader = 1;
+        std::set<uint32_t> acked_by_all;
+
+        auto is_acked_by_all = [&readers](uint32_t change)
+                {
+                    for (const auto& r : readers)
+                    {
+                        if (change > r.second.low_mark && 0 == r.second.irrelevant.count(change))
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                };
+
+        for (uint32_t step = 0; step < 50; ++step)
+        {
+            uint32_t events = random() % 4;
+            for (uint32_t e = 0; e < events; ++e)
+            {
+                switch (random() % 5)
+                {
+                    case 0:
+                        for (auto& r : readers)
+                        {
+                            if (0 == random() % 4)
+                            {
+                                r.second.irrelevant.insert(end);
+                            }
+                        }
+                        ++end;
+                        break;
+                    case 1:
+                    case 2:
+                        if (!readers.empty())
+                        {
+                            auto it = readers.begin();
+                            std::advance(it, random() % readers.size());
+                            it->second.low_mark += random() % (end - it->second.low_mark);
+                        }
+                        break;
+                    case 3:
+                        if (!readers.empty())
+                        {
+                            auto it = readers.begin();
+                            std::advance(it, random() % readers.size());
+                            readers.erase(it);
+                        }
+                        break;
+                    default:
+                        readers[next_reader++] = ReaderModel{static_cast<uint32_t>(random() % end), {}};
+                        break;
+                }
+            }
+
+            LowMarks low_marks;
+            for (const auto& r : readers)
+            {
+                low_marks[reader(r.first)] = sn(r.second.low_mark);
+            }
+            std::set<uint32_t> to_check = checked(state.update(low_marks, sn(end)), end);
+
+            std::set<uint32_t> now_acked_by_all;
+            for (uint32_t change = 1; change < end; ++change)
+            {
+                if (is_acked_by_all(change))
+                {
+                    now_acked_by_all.insert(change);
+                    ASSERT_TRUE(acked_by_all.count(change) != 0 || to_check.count(change) != 0)
+                        << "run " << run << " step " << step << " change " << change;
+                }
+            }
+            acked_by_all.swap(now_acked_by_all);
+        }
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
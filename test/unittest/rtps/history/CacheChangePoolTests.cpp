@@ -19,6 +19,7 @@
 
 #include <rtps/history/CacheChangePool.h>
 
+#include <algorithm>
 #include <tuple>
 
 using namespace eprosima::fastrtps::rtps;
@@ -221,6 +222,61 @@ TEST_P(CacheChangePoolTests, change_reset_on_release)
     }
 }
 
+TEST_P(CacheChangePoolTests, bulk_reserve_and_release)
+{
+    const size_t num_changes = 10;
+    CacheChange_t* changes[num_changes + 1] = {};
+
+    ASSERT_TRUE(pool->reserve_caches(changes, num_changes));
+    for (size_t i = 0; i < num_changes; ++i)
+    {
+        ASSERT_NE(changes[i], nullptr);
+        for (size_t j = 0; j < i; ++j)
+        {
+            ASSERT_NE(changes[i], changes[j]);
+        }
+    }
+
+    bool preallocated = memory_policy == MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE ||
+            memory_policy == MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
+    if (preallocated)
+    {
+        // Changes allocated in the same group are handed out contiguously
+        if (pool_size >= num_changes)
+        {
+            for (size_t i = 1; i < num_changes; ++i)
+            {
+                ASSERT_EQ(changes[i], changes[i - 1] + 1);
+            }
+        }
+
+        // A bounded pool should refuse the whole request when it cannot be fulfilled
+        if (max_pool_size > 0)
+        {
+            size_t free_caches_size = pool->get_freeCachesSize();
+            uint32_t remaining = std::max(pool_size, max_pool_size) - static_cast<uint32_t>(num_changes);
+            CacheChange_t** extra = new CacheChange_t*[remaining + 1];
+            ASSERT_FALSE(pool->reserve_caches(extra, remaining + 1));
+            ASSERT_EQ(pool->get_freeCachesSize(), free_caches_size);
+            delete[] extra;
+        }
+    }
+
+    size_t all_caches_size = pool->get_allCachesSize();
+    ASSERT_TRUE(pool->release_caches(changes, num_changes));
+
+    if (memory_policy == MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE)
+    {
+        ASSERT_EQ(pool->get_allCachesSize(), 0U);
+        ASSERT_EQ(pool->get_freeCachesSize(), 0U);
+    }
+    else
+    {
+        ASSERT_EQ(pool->get_allCachesSize(), all_caches_size);
+        ASSERT_EQ(pool->get_freeCachesSize(), all_caches_size);
+    }
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z) INSTANTIATE_TEST_SUITE_P(x, y, z)
 #else
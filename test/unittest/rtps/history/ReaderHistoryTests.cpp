@@ -19,6 +19,8 @@
 #include <fastrtps/rtps/reader/StatefulReader.h>
 #include <fastrtps/utils/TimedMutex.hpp>
 
+#include <algorithm>
+#include <map>
 #include <vector>
 
 using namespace eprosima::fastrtps;
@@ -26,6 +28,44 @@ using namespace ::rtps;
 using namespace ::testing;
 using namespace std;
 
+//! History keeping the changes of each instance, as keyed histories of the upper layers do
+class KeyedReaderHistory : public ReaderHistory
+{
+public:
+
+    KeyedReaderHistory(
+            const HistoryAttributes& att)
+        : ReaderHistory(att)
+    {
+    }
+
+    bool received_change(
+            CacheChange_t* change,
+            size_t) override
+    {
+        if (add_change(change))
+        {
+            instances[change->instanceHandle].push_back(change);
+            return true;
+        }
+        return false;
+    }
+
+    iterator remove_change_nts(
+            const_iterator removal,
+            bool release = true) override
+    {
+        if (removal != changesEnd())
+        {
+            vector<CacheChange_t*>& instance_changes = instances[(*removal)->instanceHandle];
+            instance_changes.erase(std::find(instance_changes.begin(), instance_changes.end(), *removal));
+        }
+        return ReaderHistory::remove_change_nts(removal, release);
+    }
+
+    map<InstanceHandle_t, vector<CacheChange_t*>> instances;
+};
+
 class ReaderHistoryTests : public Test
 {
 protected:
@@ -218,6 +258,41 @@ TEST_F(ReaderHistoryTests, remove_changes_with_guid)
     ASSERT_EQ(history->getHistorySize(), num_changes - num_sequence_numbers);
 }
 
+TEST_F(ReaderHistoryTests, remove_fragmented_changes_until_keyed)
+{
+    KeyedReaderHistory keyed_history(history_attr);
+    StatefulReader keyed_reader(&keyed_history, &mutex);
+
+    // First writer sends incomplete changes, second writer complete ones, each writer on its own instance
+    GUID_t w1 = GUID_t(GuidPrefix_t::unknown(), 1U);
+    for (uint32_t i = 0; i < num_changes; i++)
+    {
+        CacheChange_t* ch = changes_list[i];
+        ch->instanceHandle.value[0] = ch->writerGUID == w1 ? 1 : 2;
+        if (ch->writerGUID == w1)
+        {
+            ch->serializedPayload.length = 4;
+            ch->setFragmentSize(1, true);
+        }
+        ASSERT_TRUE(keyed_history.received_change(ch, 0));
+    }
+
+    InstanceHandle_t first_instance;
+    first_instance.value[0] = 1;
+    ASSERT_EQ(keyed_history.instances[first_instance].size(), num_sequence_numbers);
+
+    EXPECT_CALL(keyed_reader, change_removed_by_history(_)).Times(1).
+            WillRepeatedly(Return(true));
+    EXPECT_CALL(keyed_reader, releaseCache(_)).Times(1);
+
+    ASSERT_TRUE(keyed_history.remove_fragmented_changes_until(SequenceNumber_t(0, 2U), w1));
+
+    // The evicted change is not kept on its instance
+    ASSERT_EQ(keyed_history.getHistorySize(), num_changes - 1U);
+    ASSERT_EQ(keyed_history.instances[first_instance].size(), num_sequence_numbers - 1U);
+    ASSERT_EQ(keyed_history.instances[first_instance].front()->sequenceNumber, SequenceNumber_t(0, 2U));
+}
+
 int main(
         int argc,
         char** argv)
@@ -16,6 +16,7 @@
 
 #include <rtps/history/TopicPayloadPool.hpp>
 
+#include <algorithm>
 #include <tuple>
 
 using namespace eprosima::fastrtps::rtps;
@@ -406,6 +407,75 @@ TEST_P(TopicPayloadPoolTests, release_history_writer_finite_size)
     do_history_test(reserve_size, reserve_max_size, false);
 }
 
+TEST(TopicPayloadPoolSlabTests, preallocated_payloads_are_contiguous)
+{
+    constexpr uint32_t num_payloads = 1000u;
+    constexpr uint32_t payload_size = 1024u;
+
+    for (MemoryManagementPolicy_t policy : {MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE,
+                                            MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE})
+    {
+        PoolConfig config{ policy, payload_size, num_payloads, num_payloads };
+        std::unique_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+        ASSERT_TRUE(pool->reserve_history(config, false));
+
+        std::vector<CacheChange_t> changes(num_payloads);
+        octet* lowest = nullptr;
+        octet* highest = nullptr;
+        for (CacheChange_t& ch : changes)
+        {
+            ASSERT_TRUE(pool->get_payload(payload_size, ch));
+            lowest = (lowest == nullptr) ? ch.serializedPayload.data : std::min(lowest, ch.serializedPayload.data);
+            highest = std::max(highest, ch.serializedPayload.data);
+        }
+
+        // All payloads reserved together live on the same block, with a small per-payload overhead
+        EXPECT_LT(static_cast<size_t>(highest - lowest), static_cast<size_t>(num_payloads) * (payload_size + 128u));
+
+        // Growing one of them must not affect the others
+        if (policy == MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE)
+        {
+            ASSERT_TRUE(pool->release_payload(changes[0]));
+            ASSERT_TRUE(pool->get_payload(payload_size * 4u, changes[0]));
+            ASSERT_GE(changes[0].serializedPayload.max_size, payload_size * 4u);
+            memset(changes[0].serializedPayload.data, 0xFF, payload_size * 4u);
+        }
+
+        for (CacheChange_t& ch : changes)
+        {
+            ASSERT_TRUE(pool->release_payload(ch));
+        }
+        ASSERT_TRUE(pool->release_history(config, false));
+    }
+}
+
+TEST(TopicPayloadPoolReleaseTests, release_history_with_payload_in_use)
+{
+    // A reader is deleted while a MessageReceiver still uses the reassembly buffer of one of its samples
+    for (MemoryManagementPolicy_t policy : {MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE,
+                                            MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE,
+                                            MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE,
+                                            MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE})
+    {
+        PoolConfig config{ policy, 128u, 2u, 2u };
+        std::unique_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+        ASSERT_TRUE(pool->reserve_history(config, true));
+
+        CacheChange_t in_use;
+        ASSERT_TRUE(pool->get_payload(128u, in_use));
+
+        // Only the free payloads are deleted
+        EXPECT_TRUE(pool->release_history(config, true));
+        EXPECT_EQ(pool->payload_pool_allocated_size(), 1u);
+        EXPECT_EQ(pool->payload_pool_available_size(), 0u);
+
+        // The payload in use is deleted once released
+        EXPECT_TRUE(pool->release_payload(in_use));
+        EXPECT_EQ(pool->payload_pool_allocated_size(), 0u);
+        EXPECT_EQ(pool->payload_pool_available_size(), 0u);
+    }
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z) INSTANTIATE_TEST_SUITE_P(x, y, z)
 #else
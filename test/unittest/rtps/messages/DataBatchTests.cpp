@@ -0,0 +1,257 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastdds/rtps/messages/CDRMessage.h>
+#include <fastdds/rtps/messages/RTPSMessageCreator.h>
+#include <rtps/messages/DataBatchReader.hpp>
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace eprosima::fastrtps::rtps;
+
+namespace {
+
+// Offsets of the fields of a DATA_BATCH from the start of its submessage header
+const uint32_t length_offset = 2;
+const uint32_t octets_to_inline_qos_offset = 6;
+const uint32_t sample_count_offset = 24;
+const uint32_t first_sample_offset = 28;
+
+const EntityId_t reader_id(0x00000104);
+const EntityId_t writer_id(0x00000103);
+const SequenceNumber_t first_sn(0, 5);
+
+class DataBatchTests : public ::testing::Test
+{
+protected:
+
+    //! Builds a batch with one sample for each payload size, leaving a gap in the sequence numbers
+    void build_batch(
+            const std::vector<uint32_t>& payload_sizes,
+            bool with_key)
+    {
+        ASSERT_TRUE(RTPSMessageCreator::addSubmessageDataBatchHeader(&msg, reader_id, writer_id, first_sn, with_key));
+        for (uint32_t i = 0; i < payload_sizes.size(); ++i)
+        {
+            std::unique_ptr<CacheChange_t> change(new CacheChange_t(payload_sizes[i]));
+            change->sequenceNumber = first_sn + (i < 2 ? i : i + 1);
+            change->sourceTimestamp = Time_t(10, i);
+            change->instanceHandle.value[0] = static_cast<octet>(i + 1);
+            change->serializedPayload.length = payload_sizes[i];
+            memset(change->serializedPayload.data, static_cast<int>(i + 1), payload_sizes[i]);
+            ASSERT_TRUE(RTPSMessageCreator::addDataBatchSample(&msg, change.get(), first_sn, with_key));
+        }
+        RTPSMessageCreator::finishSubmessageDataBatch(&msg, 0, static_cast<uint32_t>(payload_sizes.size()));
+        msg.length = msg.pos;
+    }
+
+    //! Positions the message after the submessage header, as the receiver does before parsing the batch
+    SubmessageHeader_t read_submessage_header()
+    {
+        SubmessageHeader_t smh;
+        smh.submessageId = msg.buffer[0];
+        smh.flags = msg.buffer[1];
+        memcpy(&smh.submessageLength, &msg.buffer[length_offset], sizeof(uint16_t));
+        msg.pos = RTPSMESSAGE_SUBMESSAGEHEADER_SIZE;
+        return smh;
+    }
+
+    template<typename T>
+    void write_field(
+            uint32_t offset,
+            T value)
+    {
+        memcpy(&msg.buffer[offset], &value, sizeof(T));
+    }
+
+    CDRMessage_t msg{RTPSMESSAGE_DEFAULT_SIZE};
+    CacheChange_t change;
+
+    ~DataBatchTests()
+    {
+        // Payloads point to the message buffer
+        change.serializedPayload.data = nullptr;
+    }
+
+};
+
+} // namespace
+
+/*!
+ * @fn TEST_F(DataBatchTests, RoundTrip)
+ * @brief This test checks the samples added to a batch are read back as they were added, with and without keys.
+ */
+TEST_F(DataBatchTests, RoundTrip)
+{
+    for (bool with_key : {false, true})
+    {
+        msg.pos = 0;
+        msg.length = 0;
+        build_batch({1u, 4u, 7u}, with_key);
+
+        SubmessageHeader_t smh = read_submessage_header();
+        EXPECT_EQ(DATA_BATCH, smh.submessageId);
+        EXPECT_EQ(msg.length - RTPSMESSAGE_SUBMESSAGEHEADER_SIZE, smh.submessageLength);
+
+        DataBatchReader batch(&msg, smh);
+        ASSERT_TRUE(batch.read_header());
+        EXPECT_EQ(reader_id, batch.reader_id());
+        EXPECT_EQ(writer_id, batch.writer_id());
+        ASSERT_EQ(3u, batch.sample_count());
+        EXPECT_EQ(first_sample_offset, msg.pos);
+
+        const SequenceNumber_t expected_sn[] = {first_sn, first_sn + 1, first_sn + 3};
+        const uint32_t expected_size[] = {1u, 4u, 7u};
+        for (uint32_t i = 0; i < 3u; ++i)
+        {
+            ASSERT_TRUE(batch.read_sample(change));
+            EXPECT_EQ(ALIVE, change.kind);
+            EXPECT_EQ(expected_sn[i], change.sequenceNumber);
+            EXPECT_EQ(Time_t(10, i), change.sourceTimestamp);
+            EXPECT_EQ(with_key ? i + 1 : 0u, change.instanceHandle.value[0]);
+            ASSERT_EQ(expected_size[i], change.serializedPayload.length);
+            for (uint32_t j = 0; j < expected_size[i]; ++j)
+            {
+                EXPECT_EQ(i + 1, change.serializedPayload.data[j]);
+            }
+            EXPECT_EQ(0u, msg.pos % 4);
+        }
+        EXPECT_EQ(msg.length, msg.pos);
+    }
+}
+
+/*!
+ * @fn TEST_F(DataBatchTests, ExtendedHeader)
+ * @brief This test checks samples are found after header fields unknown to this version.
+ */
+TEST_F(DataBatchTests, ExtendedHeader)
+{
+    build_batch({4u, 4u}, false);
+
+    // Insert 4 unknown octets before the first sample
+    memmove(&msg.buffer[first_sample_offset + 4], &msg.buffer[first_sample_offset], msg.length - first_sample_offset);
+    msg.length += 4;
+    write_field<uint16_t>(length_offset, static_cast<uint16_t>(msg.length - RTPSMESSAGE_SUBMESSAGEHEADER_SIZE));
+    write_field<uint16_t>(octets_to_inline_qos_offset, RTPSMESSAGE_OCTETSTOINLINEQOS_DATABATCHSUBMSG + 4);
+
+    DataBatchReader batch(&msg, read_submessage_header());
+    ASSERT_TRUE(batch.read_header());
+    ASSERT_EQ(2u, batch.sample_count());
+    ASSERT_TRUE(batch.read_sample(change));
+    EXPECT_EQ(first_sn, change.sequenceNumber);
+    ASSERT_TRUE(batch.read_sample(change));
+    EXPECT_EQ(first_sn + 1, change.sequenceNumber);
+    EXPECT_EQ(msg.length, msg.pos);
+}
+
+/*!
+ * @fn TEST_F(DataBatchTests, BadOctetsToInlineQos)
+ * @brief This test checks batches whose octetsToInlineQos skips known fields or the whole submessage are rejected.
+ */
+TEST_F(DataBatchTests, BadOctetsToInlineQos)
+{
+    build_batch({4u}, false);
+    uint16_t submessage_length = static_cast<uint16_t>(msg.length - RTPSMESSAGE_SUBMESSAGEHEADER_SIZE);
+
+    for (uint16_t octets_to_inline_qos : {uint16_t(0), uint16_t(RTPSMESSAGE_OCTETSTOINLINEQOS_DATABATCHSUBMSG - 4),
+                                          uint16_t(0xFFFC), uint16_t(submessage_length)})
+    {
+        write_field<uint16_t>(octets_to_inline_qos_offset, octets_to_inline_qos);
+        DataBatchReader batch(&msg, read_submessage_header());
+        EXPECT_FALSE(batch.read_header()) << "octetsToInlineQos " << octets_to_inline_qos;
+    }
+}
+
+/*!
+ * @fn TEST_F(DataBatchTests, TooShort)
+ * @brief This test checks submessages shorter than the batch header are rejected.
+ */
+TEST_F(DataBatchTests, TooShort)
+{
+    build_batch({4u}, false);
+    write_field<uint16_t>(length_offset, RTPSMESSAGE_DATA_BATCH_MIN_LENGTH - 4);
+
+    DataBatchReader batch(&msg, read_submessage_header());
+    EXPECT_FALSE(batch.read_header());
+}
+
+/*!
+ * @fn TEST_F(DataBatchTests, BadSampleCount)
+ * @brief This test checks batches without samples, or with more samples than fit on the submessage, are rejected.
+ */
+TEST_F(DataBatchTests, BadSampleCount)
+{
+    build_batch({4u, 4u}, true);
+
+    for (uint32_t sample_count : {0u, 3u, 0xFFFFFFFFu})
+    {
+        write_field<uint32_t>(sample_count_offset, sample_count);
+        DataBatchReader batch(&msg, read_submessage_header());
+        EXPECT_FALSE(batch.read_header()) << "sample count " << sample_count;
+    }
+}
+
+/*!
+ * @fn TEST_F(DataBatchTests, TruncatedSampleInfo)
+ * @brief This test checks a sample whose information is cut by the end of the submessage is rejected.
+ */
+TEST_F(DataBatchTests, TruncatedSampleInfo)
+{
+    build_batch({4u, 4u, 4u}, false);
+
+    // The third sample keeps its offset and part of its timestamp
+    uint32_t sample_size = RTPSMESSAGE_DATA_BATCH_SAMPLE_HEADER_SIZE + 4u;
+    write_field<uint16_t>(length_offset,
+            static_cast<uint16_t>(first_sample_offset - RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + 2 * sample_size + 8));
+
+    DataBatchReader batch(&msg, read_submessage_header());
+    ASSERT_TRUE(batch.read_header());
+    ASSERT_EQ(3u, batch.sample_count());
+    EXPECT_TRUE(batch.read_sample(change));
+    EXPECT_TRUE(batch.read_sample(change));
+    EXPECT_FALSE(batch.read_sample(change));
+}
+
+/*!
+ * @fn TEST_F(DataBatchTests, BadPayloadLength)
+ * @brief This test checks samples with empty payloads, or payloads beyond the end of the submessage, are rejected.
+ */
+TEST_F(DataBatchTests, BadPayloadLength)
+{
+    build_batch({4u, 4u}, false);
+    // The sequence number offset and the timestamp come before the payload length
+    uint32_t sample_size = RTPSMESSAGE_DATA_BATCH_SAMPLE_HEADER_SIZE + 4u;
+    uint32_t second_length_offset = first_sample_offset + sample_size + 12u;
+
+    for (uint32_t payload_length : {0u, 5u, 0xFFFFFFFFu})
+    {
+        write_field<uint32_t>(second_length_offset, payload_length);
+        DataBatchReader batch(&msg, read_submessage_header());
+        ASSERT_TRUE(batch.read_header());
+        EXPECT_TRUE(batch.read_sample(change));
+        EXPECT_FALSE(batch.read_sample(change)) << "payload length " << payload_length;
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -15,6 +15,13 @@
 #include "SecurityTests.hpp"
 #include <fastrtps/rtps/network/NetworkFactory.h>
 
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 TEST_F(SecurityTest, discovered_participant_begin_handshake_request_fail_and_then_ok)
 {
     initialization_ok();
@@ -1100,6 +1107,144 @@ TEST_F(SecurityTest, discovered_participant_process_message_ok_process_handshake
     stateless_reader_->listener_->onNewCacheChangeAdded(stateless_reader_, change);
 }
 
+/*!
+ * @fn TEST_F(SecurityTest, discovered_participants_handshake_requests_on_workers)
+ * @brief This test checks the handshake requests of several participants discovered at once are generated on the
+ * handshake workers, and that the request of a participant failing the first time is generated again when the
+ * participant is discovered again.
+ */
+TEST_F(SecurityTest, discovered_participants_handshake_requests_on_workers)
+{
+    constexpr size_t num_participants = 4;
+
+    participant_properties_.properties().emplace_back("dds.sec.auth.handshake_threads", "2");
+    initialization_ok();
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t requests_sent = 0;
+    bool request_failed = false;
+    std::vector<std::thread::id> request_threads;
+    std::vector<CacheChange_t*> changes;
+
+    std::array<ParticipantProxyData, num_participants> participants_data {{
+        ParticipantProxyData(c_default_RTPSParticipantAllocationAttributes),
+        ParticipantProxyData(c_default_RTPSParticipantAllocationAttributes),
+        ParticipantProxyData(c_default_RTPSParticipantAllocationAttributes),
+        ParticipantProxyData(c_default_RTPSParticipantAllocationAttributes)}};
+    std::array<MockIdentityHandle, num_participants> remote_identity_handles;
+    std::array<MockHandshakeHandle, num_participants> handshake_handles;
+    std::array<HandshakeMessageToken, num_participants> handshake_messages;
+
+    for (size_t i = 0; i < num_participants; ++i)
+    {
+        fill_participant_key(participants_data[i].m_guid);
+        participants_data[i].m_guid.guidPrefix.value[11] = static_cast<octet>(20 + i);
+
+        EXPECT_CALL(*auth_plugin_, validate_remote_identity_rvr(_, Ref(local_identity_handle_), _,
+                participants_data[i].m_guid, _)).Times(1).
+        WillOnce(DoAll(SetArgPointee<0>(&remote_identity_handles[i]),
+                Return(ValidationResult_t::VALIDATION_PENDING_HANDSHAKE_REQUEST)));
+
+        auto request_ok = [&, i](HandshakeHandle** handshake_handle, HandshakeMessageToken** handshake_message,
+                        const IdentityHandle&, IdentityHandle&, const CDRMessage_t&, SecurityException&)
+                {
+                    std::lock_guard<std::mutex> guard(mutex);
+                    request_threads.push_back(std::this_thread::get_id());
+                    *handshake_handle = &handshake_handles[i];
+                    *handshake_message = &handshake_messages[i];
+                    return ValidationResult_t::VALIDATION_PENDING_HANDSHAKE_MESSAGE;
+                };
+
+        if (0 == i)
+        {
+            // The first request fails, and is generated again when the participant is discovered again
+            EXPECT_CALL(*auth_plugin_, begin_handshake_request(_, _, Ref(local_identity_handle_),
+                    Ref(remote_identity_handles[i]), _, _)).Times(2).
+            WillOnce(Return(ValidationResult_t::VALIDATION_FAILED)).
+            WillOnce(Invoke(request_ok));
+        }
+        else
+        {
+            EXPECT_CALL(*auth_plugin_, begin_handshake_request(_, _, Ref(local_identity_handle_),
+                    Ref(remote_identity_handles[i]), _, _)).Times(1).
+            WillOnce(Invoke(request_ok));
+        }
+
+        EXPECT_CALL(*auth_plugin_, return_identity_handle(&remote_identity_handles[i], _)).Times(1).
+        WillOnce(Return(true));
+        EXPECT_CALL(*auth_plugin_, return_handshake_handle(&handshake_handles[i], _)).Times(1).
+        WillOnce(Return(true));
+    }
+
+    EXPECT_CALL(*stateless_writer_, new_change(_, _, _)).Times(static_cast<int>(num_participants)).
+    WillRepeatedly(Invoke([&](const std::function<uint32_t()>&, ChangeKind_t, InstanceHandle_t)
+            {
+                std::lock_guard<std::mutex> guard(mutex);
+                changes.push_back(new CacheChange_t(200));
+                return changes.back();
+            }));
+    EXPECT_CALL(*stateless_writer_->history_, add_change_mock(_)).Times(static_cast<int>(num_participants)).
+    WillRepeatedly(Invoke([&](CacheChange_t*)
+            {
+                std::lock_guard<std::mutex> guard(mutex);
+                ++requests_sent;
+                cv.notify_all();
+                return true;
+            }));
+    EXPECT_CALL(participant_, pdpsimple()).WillRepeatedly(Return(&pdpsimple_));
+    EXPECT_CALL(pdpsimple_, get_participant_proxy_data_serialized(BIGEND)).Times(
+        static_cast<int>(num_participants + 1));
+
+    ParticipantAuthenticationInfo info;
+    info.status = ParticipantAuthenticationInfo::UNAUTHORIZED_PARTICIPANT;
+    info.guid = participants_data[0].m_guid;
+    EXPECT_CALL(*participant_.getListener(), onParticipantAuthentication(_, info)).Times(1).
+    WillOnce(Invoke([&](RTPSParticipant*, const ParticipantAuthenticationInfo&)
+            {
+                std::lock_guard<std::mutex> guard(mutex);
+                request_failed = true;
+                cv.notify_all();
+            }));
+    EXPECT_CALL(*auth_plugin_, return_identity_handle(&local_identity_handle_, _)).Times(1).
+    WillOnce(Return(true));
+
+    // Discovery only queues the requests on the handshake workers
+    for (const ParticipantProxyData& participant_data : participants_data)
+    {
+        ASSERT_TRUE(manager_.discovered_participant(participant_data));
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(cv.wait_for(lock, std::chrono::seconds(10), [&]()
+                {
+                    return request_failed && requests_sent == num_participants - 1;
+                }));
+    }
+
+    ASSERT_TRUE(manager_.discovered_participant(participants_data[0]));
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(cv.wait_for(lock, std::chrono::seconds(10), [&]()
+                {
+                    return requests_sent == num_participants;
+                }));
+        for (const std::thread::id& request_thread : request_threads)
+        {
+            EXPECT_NE(request_thread, std::this_thread::get_id());
+        }
+    }
+
+    manager_.destroy();
+
+    for (CacheChange_t* change : changes)
+    {
+        delete change;
+    }
+}
+
 int main(
         int argc,
         char** argv)
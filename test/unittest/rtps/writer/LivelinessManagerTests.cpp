@@ -478,6 +478,55 @@ TEST_F(LivelinessManagerTests, TimerOwnerRemoved)
     EXPECT_EQ(num_writers_lost, 1u);
 }
 
+//! Tests that writers asserted while alive, which does not restart the timer, do not lose liveliness
+//! until they stop being asserted
+TEST_F(LivelinessManagerTests, TimerRearmedOnAssertion)
+{
+    LivelinessManager liveliness_manager(
+                std::bind(&LivelinessManagerTests::liveliness_changed,
+                          this,
+                          std::placeholders::_1,
+                          std::placeholders::_2,
+                          std::placeholders::_3,
+                          std::placeholders::_4,
+                          std::placeholders::_5),
+                service_);
+
+
+    GuidPrefix_t guidP;
+    guidP.value[0] = 1;
+
+    liveliness_manager.add_writer(GUID_t(guidP, 1), AUTOMATIC_LIVELINESS_QOS, Duration_t(0.1));
+    liveliness_manager.add_writer(GUID_t(guidP, 2), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.1));
+
+    liveliness_manager.assert_liveliness(GUID_t(guidP, 1), AUTOMATIC_LIVELINESS_QOS, Duration_t(0.1));
+    liveliness_manager.assert_liveliness(GUID_t(guidP, 2), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.1));
+    wait_liveliness_recovered(2u);
+
+    // Keep asserting both writers for several lease durations
+    auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(500);
+    while (std::chrono::steady_clock::now() < end)
+    {
+        EXPECT_TRUE(liveliness_manager.assert_liveliness(
+                    GUID_t(guidP, 1), AUTOMATIC_LIVELINESS_QOS, Duration_t(0.1)));
+        EXPECT_TRUE(liveliness_manager.assert_liveliness(
+                    GUID_t(guidP, 2), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.1)));
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(num_writers_lost, 0u);
+    EXPECT_TRUE(liveliness_manager.is_any_alive(AUTOMATIC_LIVELINESS_QOS));
+    EXPECT_TRUE(liveliness_manager.is_any_alive(MANUAL_BY_TOPIC_LIVELINESS_QOS));
+
+    // Both writers lose liveliness once they are not asserted anymore
+    wait_liveliness_lost(2u);
+    EXPECT_EQ(num_writers_lost, 2u);
+
+    // And recover it on the next assertion
+    liveliness_manager.assert_liveliness(GUID_t(guidP, 1), AUTOMATIC_LIVELINESS_QOS, Duration_t(0.1));
+    wait_liveliness_recovered(3u);
+    EXPECT_EQ(writer_recovering_liveliness, GUID_t(guidP, 1));
+}
+
 }
 }
 
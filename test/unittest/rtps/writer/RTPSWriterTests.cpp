@@ -171,6 +171,69 @@ TEST(RTPSWriterTests, WriterWithCustomPayloadPool_DoesNotInitializePool_WhenDyna
     pool_initialization_test(DYNAMIC_REUSABLE_MEMORY_MODE);
 }
 
+/*!
+ * This test checks the changes of a WriterHistory are found by their sequence number after removing changes from the
+ * middle of the history, and that changes of other writers are not removed.
+ */
+TEST(RTPSWriterTests, WriterHistory_FindsChangesBySequenceNumber)
+{
+    RTPSParticipantAttributes p_attr;
+    RTPSParticipant* participant = RTPSDomain::createParticipant(0, true, p_attr);
+    ASSERT_NE(participant, nullptr);
+
+    HistoryAttributes h_attr;
+    h_attr.payloadMaxSize = TestDataType::data_size;
+    WriterHistory* history = new WriterHistory(h_attr);
+
+    WriterAttributes w_attr;
+    RTPSWriter* writer = RTPSDomain::createRTPSWriter(participant, w_attr, history);
+    ASSERT_NE(writer, nullptr);
+
+    TestDataType data;
+    for (int i = 0; i < 10; ++i)
+    {
+        CacheChange_t* ch = writer->new_change(data, ALIVE);
+        ASSERT_NE(ch, nullptr);
+        ASSERT_TRUE(history->add_change(ch));
+    }
+
+    // Remove the changes with an even sequence number
+    for (int32_t i = 2; i <= 10; i += 2)
+    {
+        EXPECT_TRUE(history->remove_change(SequenceNumber_t(0, i)));
+    }
+    EXPECT_EQ(5u, history->getHistorySize());
+
+    for (int32_t i = 1; i <= 11; ++i)
+    {
+        SequenceNumber_t sequence_number(0, i);
+        bool in_history = (i % 2 == 1) && (i < 11);
+
+        History::const_iterator it = history->find_change_nts(sequence_number);
+        ASSERT_EQ(in_history, it != history->changesEnd());
+        if (in_history)
+        {
+            EXPECT_EQ(sequence_number, (*it)->sequenceNumber);
+        }
+    }
+
+    CacheChange_t other_writer_change;
+    other_writer_change.writerGUID = GUID_t::unknown();
+    other_writer_change.sequenceNumber = SequenceNumber_t(0, 1);
+    EXPECT_FALSE(history->remove_change_g(&other_writer_change));
+    EXPECT_EQ(5u, history->getHistorySize());
+
+    // Removes the change through the lookup by sequence number
+    CacheChange_t* first_change = *history->changesBegin();
+    EXPECT_TRUE(history->remove_change_g(first_change));
+    EXPECT_EQ(4u, history->getHistorySize());
+    EXPECT_EQ(history->changesEnd(), history->find_change_nts(SequenceNumber_t(0, 1)));
+
+    RTPSDomain::removeRTPSWriter(writer);
+    RTPSDomain::removeRTPSParticipant(participant);
+    delete(history);
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
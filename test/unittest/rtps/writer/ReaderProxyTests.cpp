@@ -133,6 +133,50 @@ TEST(ReaderProxyTests, are_there_gaps)
     ASSERT_FALSE(rproxy.are_there_gaps());
 }
 
+/*
+ * Check perform_acknack_response reports the requested changes which have to be resent, so the writer is able to
+ * coalesce the repairs requested by several readers.
+ */
+TEST(ReaderProxyTests, perform_acknack_response_repairs)
+{
+    StatefulWriter writerMock;
+    WriterTimes wTimes;
+    RemoteLocatorsAllocationAttributes alloc;
+    ReaderProxy rproxy(wTimes, alloc, &writerMock);
+
+    CacheChange_t changes[4];
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        changes[i].sequenceNumber = SequenceNumber_t(0, i + 1);
+        // Third change has no cache change, as happens when it is removed from the history
+        ChangeForReader_t change = (i == 2) ? ChangeForReader_t(changes[i].sequenceNumber) :
+                ChangeForReader_t(&changes[i]);
+        change.setStatus(UNACKNOWLEDGED);
+        rproxy.add_change(change, false);
+    }
+
+    SequenceNumberSet_t requested(SequenceNumber_t(0, 2));
+    requested.add(SequenceNumber_t(0, 2));
+    requested.add(SequenceNumber_t(0, 3));
+    requested.add(SequenceNumber_t(0, 4));
+    ASSERT_TRUE(rproxy.requested_changes_set(requested));
+
+    std::vector<SequenceNumber_t> repairs;
+    ASSERT_TRUE(rproxy.perform_acknack_response(&repairs));
+    EXPECT_EQ((std::vector<SequenceNumber_t>{SequenceNumber_t(0, 2), SequenceNumber_t(0, 4)}), repairs);
+
+    bool is_irrelevant = false;
+    EXPECT_FALSE(rproxy.change_is_unsent(SequenceNumber_t(0, 1), is_irrelevant));
+    EXPECT_TRUE(rproxy.change_is_unsent(SequenceNumber_t(0, 2), is_irrelevant));
+    EXPECT_TRUE(rproxy.change_is_unsent(SequenceNumber_t(0, 3), is_irrelevant));
+    EXPECT_TRUE(rproxy.change_is_unsent(SequenceNumber_t(0, 4), is_irrelevant));
+
+    // Nothing else was requested
+    repairs.clear();
+    ASSERT_FALSE(rproxy.perform_acknack_response(&repairs));
+    EXPECT_TRUE(repairs.empty());
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
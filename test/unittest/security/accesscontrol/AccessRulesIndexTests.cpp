@@ -0,0 +1,169 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <security/accesscontrol/AccessRulesIndex.h>
+#include <fastrtps/utils/StringMatching.h>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastrtps::rtps::security;
+
+static Rule make_rule(
+        const std::vector<std::string>& publish_topics)
+{
+    Rule rule;
+    rule.allow = true;
+    Criteria criteria;
+    criteria.topics = publish_topics;
+    rule.publishes.push_back(criteria);
+    return rule;
+}
+
+TEST(AccessRulesIndexTests, glob_pattern_matches_as_string_matching)
+{
+    const std::vector<std::string> patterns =
+    {
+        "Square", "Sq*", "*re", "S?uare", "*", "?", "**a*", "Sq[uv]are", "", "a*b*c", "*.*"
+    };
+
+    std::mt19937 generator(1);
+    std::uniform_int_distribution<int> length(0, 8);
+    const std::string alphabet = "Sqa.bcreu";
+    std::uniform_int_distribution<size_t> letter(0, alphabet.size() - 1);
+
+    std::vector<std::string> names = { "Square", "Sqvare", "Sq", "re", "", "a.b", "abc", "aXbYc" };
+    for (int i = 0; i < 500; ++i)
+    {
+        std::string name;
+        for (int n = length(generator); n > 0; --n)
+        {
+            name.push_back(alphabet[letter(generator)]);
+        }
+        names.push_back(name);
+    }
+
+    for (const std::string& expression : patterns)
+    {
+        GlobPattern pattern(expression);
+        for (const std::string& name : names)
+        {
+            EXPECT_EQ(pattern.matches(name.c_str()),
+                    StringMatching::matchPattern(expression.c_str(), name.c_str()))
+                << "pattern '" << expression << "' name '" << name << "'";
+        }
+    }
+}
+
+TEST(AccessRulesIndexTests, topic_rules_index_returns_first_matching_rule)
+{
+    std::vector<Rule> rules;
+    rules.push_back(make_rule({ "Circle" }));
+    rules.push_back(make_rule({ "Sq*" }));
+    rules.push_back(make_rule({ "Square", "Triangle" }));
+    rules.push_back(make_rule({ "*" }));
+
+    TopicRulesIndex index;
+    index.build(rules, &Rule::publishes);
+
+    auto any_rule = [](size_t)
+            {
+                return true;
+            };
+
+    EXPECT_EQ(index.find("Circle", any_rule), 0u);
+    EXPECT_EQ(index.find("Square", any_rule), 1u);
+    EXPECT_EQ(index.find("Triangle", any_rule), 2u);
+    EXPECT_EQ(index.find("Hexagon", any_rule), 3u);
+
+    // Filtered rules are skipped
+    auto skip_wildcard_rules = [](size_t rule_index)
+            {
+                return rule_index != 1 && rule_index != 3;
+            };
+    EXPECT_EQ(index.find("Square", skip_wildcard_rules), 2u);
+    EXPECT_EQ(index.find("Hexagon", skip_wildcard_rules), TopicRulesIndex::npos);
+
+    // Subscribe criteria are not indexed
+    TopicRulesIndex empty_index;
+    empty_index.build(rules, &Rule::subscribes);
+    EXPECT_EQ(empty_index.find("Square", any_rule), TopicRulesIndex::npos);
+}
+
+TEST(AccessRulesIndexTests, governance_index_returns_first_matching_rule)
+{
+    GovernanceTopicIndex::TopicRules rules;
+    EndpointSecurityAttributes attributes;
+    rules.emplace_back("Circle", attributes);
+    rules.emplace_back("Sq*", attributes);
+    rules.emplace_back("Square", attributes);
+    rules.emplace_back("*", attributes);
+
+    GovernanceTopicIndex index;
+    index.build(rules);
+
+    EXPECT_EQ(index.find("Circle", rules), &rules[0].second);
+    EXPECT_EQ(index.find("Square", rules), &rules[1].second);
+    EXPECT_EQ(index.find("Hexagon", rules), &rules[3].second);
+
+    // Topic names with wildcards are matched both ways
+    EXPECT_EQ(index.find("Cir*", rules), &rules[0].second);
+
+    rules.pop_back();
+    index.build(rules);
+    EXPECT_EQ(index.find("Hexagon", rules), nullptr);
+}
+
+TEST(AccessRulesIndexTests, decision_cache_evicts_least_recently_used)
+{
+    AccessDecisionCache cache;
+    AccessDecision decision;
+    decision.allowed = true;
+
+    std::string first_key = AccessDecisionCache::make_key('w', 0, "Topic0", {});
+    cache.put(first_key, decision);
+    for (size_t i = 1; i < AccessDecisionCache::max_entries; ++i)
+    {
+        cache.put(AccessDecisionCache::make_key('w', 0, ("Topic" + std::to_string(i)).c_str(), {}), decision);
+    }
+
+    // Use the first entry, so the second one is the least recently used
+    AccessDecision result;
+    ASSERT_TRUE(cache.get(first_key, result));
+    EXPECT_TRUE(result.allowed);
+
+    cache.put(AccessDecisionCache::make_key('w', 0, "NewTopic", {}), decision);
+    EXPECT_TRUE(cache.get(first_key, result));
+    EXPECT_FALSE(cache.get(AccessDecisionCache::make_key('w', 0, "Topic1", {}), result));
+
+    // Keys depend on all the parameters of the check
+    EXPECT_FALSE(cache.get(AccessDecisionCache::make_key('r', 0, "Topic0", {}), result));
+    EXPECT_FALSE(cache.get(AccessDecisionCache::make_key('w', 1, "Topic0", {}), result));
+    EXPECT_FALSE(cache.get(AccessDecisionCache::make_key('w', 0, "Topic0", { "" }), result));
+
+    cache.clear();
+    EXPECT_FALSE(cache.get(first_key, result));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -16,6 +16,7 @@
 
 #include <security/authentication/PKIIdentityHandle.h>
 #include <security/authentication/PKIHandshakeHandle.h>
+#include <security/authentication/DHKeyPool.h>
 #include <fastrtps/rtps/messages/CDRMessage.h>
 
 #include <openssl/opensslv.h>
@@ -26,7 +27,11 @@
 #define IS_OPENSSL_1_1 0
 #endif
 
+#include <atomic>
+#include <chrono>
 #include <iostream>
+#include <thread>
+#include <openssl/ec.h>
 #include <openssl/pem.h>
 
 using namespace eprosima::fastrtps::rtps;
@@ -589,6 +594,139 @@ TEST_F(AuthenticationPluginTest, validate_local_identity_expired_certificate)
     ASSERT_TRUE(adjusted_participant_key == GUID_t::unknown());
 }
 
+static std::atomic<uint32_t> generated_keys(0);
+
+static EVP_PKEY* generate_ec_key(
+        int type,
+        SecurityException& exception)
+{
+    EVP_PKEY* key = nullptr;
+    EVP_PKEY_CTX* kctx = EVP_PKEY_CTX_new_id(type, NULL);
+
+    if (kctx == nullptr ||
+            1 != EVP_PKEY_keygen_init(kctx) ||
+            1 != EVP_PKEY_CTX_set_ec_paramgen_curve_nid(kctx, NID_X9_62_prime256v1) ||
+            1 != EVP_PKEY_keygen(kctx, &key))
+    {
+        exception = SecurityException("Cannot generate EC key");
+    }
+    else
+    {
+        ++generated_keys;
+    }
+
+    EVP_PKEY_CTX_free(kctx);
+    return key;
+}
+
+TEST(DHKeyPool, keys_are_generated_in_advance_and_taken_once)
+{
+    generated_keys = 0;
+    DHKeyPool pool(generate_ec_key);
+    SecurityException exception;
+
+    // Without reserving, keys are generated on the calling thread
+    EVP_PKEY* key = pool.take(EVP_PKEY_EC, exception);
+    ASSERT_NE(key, nullptr);
+    EXPECT_EQ(generated_keys.load(), 1u);
+    EVP_PKEY_free(key);
+
+    // A zero size does not start the background thread
+    pool.reserve(EVP_PKEY_EC, 0);
+    EXPECT_FALSE(pool.running());
+    EXPECT_EQ(pool.available(EVP_PKEY_EC), 0u);
+
+    pool.reserve(EVP_PKEY_EC, 3);
+    EXPECT_TRUE(pool.running());
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (pool.available(EVP_PKEY_EC) < 3 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(pool.available(EVP_PKEY_EC), 3u);
+
+    // Each key is handed out only once
+    EVP_PKEY* first = pool.take(EVP_PKEY_EC, exception);
+    EVP_PKEY* second = pool.take(EVP_PKEY_EC, exception);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_NE(first, second);
+    EVP_PKEY_free(first);
+    EVP_PKEY_free(second);
+
+    // Taken keys are replaced in the background
+    deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (pool.available(EVP_PKEY_EC) < 3 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(pool.available(EVP_PKEY_EC), 3u);
+    EXPECT_EQ(generated_keys.load(), 6u);
+
+    // Reducing the size releases the keys in excess
+    pool.reserve(EVP_PKEY_EC, 1);
+    EXPECT_EQ(pool.available(EVP_PKEY_EC), 1u);
+}
+
+TEST_F(AuthenticationPluginTest, dh_key_pool_disabled_by_default)
+{
+    IdentityHandle* local_identity_handle = nullptr;
+    GUID_t adjusted_participant_key;
+    uint32_t domain_id = 0;
+    RTPSParticipantAttributes participant_attr;
+    GUID_t candidate_participant_key;
+    SecurityException exception;
+
+    fill_candidate_participant_key(candidate_participant_key);
+    participant_attr.properties = get_valid_policy();
+
+    ValidationResult_t result = plugin.validate_local_identity(&local_identity_handle,
+            adjusted_participant_key,
+            domain_id,
+            participant_attr,
+            candidate_participant_key,
+            exception);
+
+    ASSERT_TRUE(result == ValidationResult_t::VALIDATION_OK);
+    ASSERT_TRUE(local_identity_handle != nullptr);
+
+    // No key is generated in advance, nor a thread started for it
+    EXPECT_EQ(plugin.dh_key_pool().reserved(), 0u);
+    EXPECT_FALSE(plugin.dh_key_pool().running());
+
+    ASSERT_TRUE(plugin.return_identity_handle(local_identity_handle, exception));
+}
+
+TEST_F(AuthenticationPluginTest, dh_key_pool_enabled_by_property)
+{
+    IdentityHandle* local_identity_handle = nullptr;
+    GUID_t adjusted_participant_key;
+    uint32_t domain_id = 0;
+    RTPSParticipantAttributes participant_attr;
+    GUID_t candidate_participant_key;
+    SecurityException exception;
+
+    fill_candidate_participant_key(candidate_participant_key);
+    participant_attr.properties = get_valid_policy();
+    participant_attr.properties.properties().
+        emplace_back(Property("dds.sec.auth.builtin.PKI-DH.dh_key_pool_size", "2"));
+
+    ValidationResult_t result = plugin.validate_local_identity(&local_identity_handle,
+            adjusted_participant_key,
+            domain_id,
+            participant_attr,
+            candidate_participant_key,
+            exception);
+
+    ASSERT_TRUE(result == ValidationResult_t::VALIDATION_OK);
+    ASSERT_TRUE(local_identity_handle != nullptr);
+
+    EXPECT_EQ(plugin.dh_key_pool().reserved(), 2u);
+    EXPECT_TRUE(plugin.dh_key_pool().running());
+
+    ASSERT_TRUE(plugin.return_identity_handle(local_identity_handle, exception));
+}
+
 int main(int argc, char **argv)
 {
     testing::InitGoogleTest(&argc, argv);
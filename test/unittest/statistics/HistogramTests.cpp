@@ -0,0 +1,123 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <statistics/rtps/Histogram.hpp>
+
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace eprosima::fastdds::statistics;
+
+/*!
+ * @fn TEST(Histogram, BucketBounds)
+ * @brief This test checks every value is stored on a bucket whose upper bound is within 12.5% of it.
+ */
+TEST(Histogram, BucketBounds)
+{
+    std::vector<uint64_t> values;
+    for (uint64_t value = 0; value < 100000; ++value)
+    {
+        values.push_back(value);
+    }
+    for (uint32_t bit = 17; bit < 64; ++bit)
+    {
+        values.push_back((1ull << bit) - 1);
+        values.push_back(1ull << bit);
+        values.push_back((1ull << bit) + 1);
+    }
+    values.push_back(std::numeric_limits<uint64_t>::max());
+
+    for (uint64_t value : values)
+    {
+        uint32_t index = Histogram::bucket_index(value);
+        ASSERT_LT(index, Histogram::num_buckets);
+        uint64_t upper_bound = Histogram::bucket_upper_bound(index);
+        ASSERT_GE(upper_bound, value);
+        ASSERT_LE(upper_bound - value, value / 8);
+        if (0 < index)
+        {
+            ASSERT_LT(Histogram::bucket_upper_bound(index - 1), value);
+        }
+    }
+}
+
+/*!
+ * @fn TEST(Histogram, Percentiles)
+ * @brief This test checks the summary of the recorded values, and that taking it starts a new period.
+ */
+TEST(Histogram, Percentiles)
+{
+    Histogram histogram;
+    for (uint64_t value = 1; value <= 1000; ++value)
+    {
+        histogram.record(value);
+    }
+
+    HistogramSnapshot snapshot = histogram.snapshot_and_reset();
+    ASSERT_EQ(snapshot.count, 1000u);
+    ASSERT_EQ(snapshot.sum, 500500u);
+    ASSERT_EQ(snapshot.max, 1000u);
+    ASSERT_DOUBLE_EQ(snapshot.mean(), 500.5);
+    ASSERT_GE(snapshot.p50, 500u);
+    ASSERT_LE(snapshot.p50, 500u + 500u / 8);
+    ASSERT_GE(snapshot.p90, 900u);
+    ASSERT_LE(snapshot.p90, 1000u);
+    ASSERT_GE(snapshot.p99, 990u);
+    ASSERT_LE(snapshot.p99, 1000u);
+
+    snapshot = histogram.snapshot_and_reset();
+    ASSERT_EQ(snapshot.count, 0u);
+    ASSERT_EQ(snapshot.sum, 0u);
+    ASSERT_EQ(snapshot.max, 0u);
+}
+
+/*!
+ * @fn TEST(Histogram, ConcurrentRecord)
+ * @brief This test checks no value is lost when several threads record at the same time.
+ */
+TEST(Histogram, ConcurrentRecord)
+{
+    Histogram histogram;
+    const uint64_t values_per_thread = 100000;
+    std::vector<std::thread> threads;
+    for (uint64_t i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&histogram, i, values_per_thread]()
+                {
+                    for (uint64_t value = 0; value < values_per_thread; ++value)
+                    {
+                        histogram.record(value + i);
+                    }
+                });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    HistogramSnapshot snapshot = histogram.snapshot_and_reset();
+    ASSERT_EQ(snapshot.count, 4 * values_per_thread);
+    ASSERT_EQ(snapshot.max, values_per_thread + 2);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
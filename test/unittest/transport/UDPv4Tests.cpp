@@ -20,7 +20,9 @@
 #include <fastrtps/utils/IPFinder.h>
 #include <fastrtps/utils/IPLocator.h>
 //#include <fastdds/dds/log/Log.hpp>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <asio.hpp>
 #include <MockReceiverResource.h>
 
@@ -52,6 +54,61 @@ uint16_t get_port()
     return port;
 }
 
+//! UDPv4Transport whose sockets report a full send buffer while congested
+class CongestedUDPv4Transport : public UDPv4Transport
+{
+public:
+
+    CongestedUDPv4Transport(
+            const UDPv4TransportDescriptor& descriptor)
+        : UDPv4Transport(descriptor)
+    {
+    }
+
+    ~CongestedUDPv4Transport()
+    {
+        // The flush thread calls send_datagram, so it is stopped before the members it uses are destroyed
+        shutdown();
+    }
+
+    std::vector<octet> sent_datagrams()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return sent_datagrams_;
+    }
+
+    std::atomic<bool> congested{true};
+
+protected:
+
+    void send_datagram(
+            asio::ip::udp::socket& socket,
+            const octet* data,
+            uint32_t size,
+            const asio::ip::udp::endpoint& destination,
+            asio::error_code& ec) override
+    {
+        if (congested)
+        {
+            ec = asio::error::would_block;
+            return;
+        }
+
+        UDPv4Transport::send_datagram(socket, data, size, destination, ec);
+        if (!ec)
+        {
+            // Keep the first octet to check the sending order
+            std::lock_guard<std::mutex> lock(mutex_);
+            sent_datagrams_.push_back(data[0]);
+        }
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::vector<octet> sent_datagrams_;
+};
+
 class UDPv4Tests : public ::testing::Test
 {
 public:
@@ -694,6 +751,171 @@ TEST_F(UDPv4Tests, simple_throughput)
             , std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count() / (num_samples_per_batch * 1000.0));
 }
 
+TEST_F(UDPv4Tests, non_blocking_send_with_pending_queue)
+{
+    const size_t sample_size = 1024;
+    const int num_samples = 10000;
+
+    octet sample_data[sample_size];
+    memset(sample_data, 0, sizeof(sample_data));
+
+    Locator_t sub_locator;
+    sub_locator.kind = LOCATOR_KIND_UDPv4;
+    sub_locator.port = g_default_port + 2;
+    IPLocator::setIPv4(sub_locator, 127, 0, 0, 1);
+
+    UDPv4TransportDescriptor my_descriptor;
+    my_descriptor.non_blocking_send = true;
+    my_descriptor.maxMessageSize = sample_size;
+    my_descriptor.sendBufferSize = 8 * sample_size;
+
+    UDPv4TransportDescriptor copied_descriptor(my_descriptor);
+    ASSERT_TRUE(copied_descriptor.non_blocking_send);
+
+    UDPv4Transport pub_transport(my_descriptor);
+    ASSERT_TRUE(pub_transport.init());
+
+    LocatorList_t send_locators_list;
+    send_locators_list.push_back(sub_locator);
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(pub_transport.OpenOutputChannel(send_resource_list, sub_locator));
+
+    uint64_t failed_sends = 0;
+    for (int i = 0; i < num_samples; i++)
+    {
+        Locators locators_begin(send_locators_list.begin());
+        Locators locators_end(send_locators_list.end());
+
+        if (!send_resource_list.at(0)->send(sample_data, sizeof(sample_data), &locators_begin, &locators_end,
+                std::chrono::steady_clock::now()))
+        {
+            ++failed_sends;
+        }
+
+        // Pending datagrams never exceed the size of the socket buffer
+        ASSERT_LE(pub_transport.queued_bytes(), my_descriptor.sendBufferSize);
+    }
+
+    // Datagrams dropped because of a full pending queue are counted, but not reported as failed
+    EXPECT_EQ(failed_sends, 0u);
+    EXPECT_LE(pub_transport.dropped_datagrams_count(), pub_transport.would_block_count());
+
+    // Closing the channel discards the pending datagrams
+    send_resource_list.clear();
+    EXPECT_EQ(pub_transport.queued_bytes(), 0u);
+}
+
+TEST_F(UDPv4Tests, interfaces_snapshot_is_shared_and_refreshed)
+{
+    std::vector<IPFinder::info_IP> first;
+    std::vector<IPFinder::info_IP> second;
+    ASSERT_TRUE(IPFinder::getIPs(&first, true));
+    uint32_t generation = IPFinder::generation();
+    ASSERT_TRUE(IPFinder::getIPs(&second, true));
+    ASSERT_EQ(first.size(), second.size());
+    for (size_t i = 0; i < first.size(); ++i)
+    {
+        EXPECT_EQ(first[i].name, second[i].name);
+        EXPECT_EQ(first[i].dev, second[i].dev);
+    }
+
+    // Enumerating again the same interfaces keeps the generation
+    IPFinder::refresh();
+    second.clear();
+    ASSERT_TRUE(IPFinder::getIPs(&second, true));
+    EXPECT_EQ(first.size(), second.size());
+    EXPECT_EQ(generation, IPFinder::generation());
+
+    // Loopback addresses are only filtered from the snapshot
+    std::vector<IPFinder::info_IP> no_loopback;
+    ASSERT_TRUE(IPFinder::getIPs(&no_loopback, false));
+    for (const IPFinder::info_IP& ip : no_loopback)
+    {
+        EXPECT_NE(ip.type, IPFinder::IP4_LOCAL);
+        EXPECT_NE(ip.type, IPFinder::IP6_LOCAL);
+    }
+
+    // Transports look up the local interfaces on the snapshot, also after it is refreshed
+    UDPv4Transport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+    IPFinder::refresh();
+    for (const IPFinder::info_IP& ip : first)
+    {
+        if (ip.type == IPFinder::IP4 || ip.type == IPFinder::IP4_LOCAL)
+        {
+            Locator_t locator = ip.locator;
+            locator.kind = LOCATOR_KIND_UDPv4;
+            EXPECT_TRUE(transportUnderTest.is_local_locator(locator));
+        }
+    }
+
+    // TEST-NET-1 addresses are never assigned to the host
+    Locator_t remote_locator;
+    remote_locator.kind = LOCATOR_KIND_UDPv4;
+    IPLocator::setIPv4(remote_locator, 192, 0, 2, 1);
+    EXPECT_FALSE(transportUnderTest.is_local_locator(remote_locator));
+}
+
+TEST_F(UDPv4Tests, non_blocking_send_fills_socket_buffer)
+{
+    const uint32_t sample_size = 1024;
+    const uint32_t queue_capacity = 4;
+    const uint32_t num_samples = 16;
+
+    Locator_t sub_locator;
+    sub_locator.kind = LOCATOR_KIND_UDPv4;
+    sub_locator.port = g_default_port + 3;
+    IPLocator::setIPv4(sub_locator, 127, 0, 0, 1);
+
+    UDPv4TransportDescriptor my_descriptor;
+    my_descriptor.non_blocking_send = true;
+    my_descriptor.maxMessageSize = sample_size;
+    my_descriptor.sendBufferSize = queue_capacity * sample_size;
+
+    CongestedUDPv4Transport pub_transport(my_descriptor);
+    ASSERT_TRUE(pub_transport.init());
+
+    LocatorList_t send_locators_list;
+    send_locators_list.push_back(sub_locator);
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(pub_transport.OpenOutputChannel(send_resource_list, sub_locator));
+
+    // The socket buffer is full: the first datagrams are queued and the rest dropped, without failing the send
+    octet sample_data[sample_size];
+    memset(sample_data, 0, sizeof(sample_data));
+    for (uint32_t i = 0; i < num_samples; i++)
+    {
+        Locators locators_begin(send_locators_list.begin());
+        Locators locators_end(send_locators_list.end());
+
+        sample_data[0] = static_cast<octet>(i);
+        EXPECT_TRUE(send_resource_list.at(0)->send(sample_data, sizeof(sample_data), &locators_begin, &locators_end,
+                std::chrono::steady_clock::now() + std::chrono::milliseconds(1)));
+    }
+
+    EXPECT_EQ(pub_transport.queued_bytes(), queue_capacity * sample_size);
+    EXPECT_EQ(pub_transport.dropped_datagrams_count(), num_samples - queue_capacity);
+    EXPECT_TRUE(pub_transport.sent_datagrams().empty());
+
+    // Once the socket drains, the queue is flushed in order without waiting for another send
+    pub_transport.congested = false;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (pub_transport.queued_bytes() > 0 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    EXPECT_EQ(pub_transport.queued_bytes(), 0u);
+    std::vector<octet> expected_sent;
+    for (uint32_t i = 0; i < queue_capacity; i++)
+    {
+        expected_sent.push_back(static_cast<octet>(i));
+    }
+    EXPECT_EQ(pub_transport.sent_datagrams(), expected_sent);
+}
+
 void UDPv4Tests::HELPER_SetDescriptorDefaults()
 {
     descriptor.maxMessageSize = 5;
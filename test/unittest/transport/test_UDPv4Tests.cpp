@@ -220,6 +220,146 @@ void test_UDPv4Tests::HELPER_WarmUpOutput(test_UDPv4Transport& transport)
 }
 */
 
+//! Sends datagrams to the port of the locator and returns how many of them the impairments dropped
+static uint64_t send_impaired(
+        test_UDPv4Transport& transport,
+        const Locator_t& destination,
+        uint32_t datagrams)
+{
+    Locator_t output_locator;
+    output_locator.kind = LOCATOR_KIND_UDPv4;
+    IPLocator::setIPv4(output_locator, 127, 0, 0, 1);
+    SendResourceList send_resource_list;
+    EXPECT_TRUE(transport.OpenOutputChannel(send_resource_list, output_locator));
+    if (send_resource_list.empty())
+    {
+        return 0;
+    }
+
+    LocatorList_t locator_list;
+    locator_list.push_back(destination);
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+
+    test_UDPv4Transport::user_traffic.reset();
+    for (uint32_t i = 0; i < datagrams; ++i)
+    {
+        Locators locators_begin(locator_list.begin());
+        Locators locators_end(locator_list.end());
+        EXPECT_TRUE(send_resource_list.at(0)->send(message, 5, &locators_begin, &locators_end,
+                (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+    }
+
+    return test_UDPv4Transport::user_traffic.impaired_drops;
+}
+
+/*!
+ * @fn TEST(test_UDPv4Impairments, loss_rate)
+ * @brief This test checks the impairment of a destination port loses the configured percentage of the datagrams,
+ * including when its mean burst length is too short to reach that percentage.
+ */
+TEST(test_UDPv4Impairments, loss_rate)
+{
+    const uint32_t datagrams = 20000;
+    Locator_t destination;
+    destination.kind = LOCATOR_KIND_UDPv4;
+    destination.port = g_default_port;
+    IPLocator::setIPv4(destination, 127, 0, 0, 1);
+
+    test_UDPv4TransportDescriptor descriptor;
+    descriptor.impairmentsSeed = 7;
+    descriptor.impairments[g_default_port].lossPercentage = 20;
+    descriptor.impairments[g_default_port].meanBurstLength = 4;
+    {
+        test_UDPv4Transport transport(descriptor);
+        ASSERT_TRUE(transport.init());
+        uint64_t drops = send_impaired(transport, destination, datagrams);
+        EXPECT_NEAR(20.0, drops * 100.0 / datagrams, 1.5);
+    }
+
+    // Bursts of a single datagram cannot lose more than half of them, so they are made longer
+    descriptor.impairments[g_default_port].lossPercentage = 60;
+    descriptor.impairments[g_default_port].meanBurstLength = 1;
+    {
+        test_UDPv4Transport transport(descriptor);
+        ASSERT_TRUE(transport.init());
+        uint64_t drops = send_impaired(transport, destination, datagrams);
+        EXPECT_NEAR(60.0, drops * 100.0 / datagrams, 1.5);
+    }
+
+    // Other ports are not impaired
+    destination.port = g_default_port + 1;
+    {
+        test_UDPv4Transport transport(descriptor);
+        ASSERT_TRUE(transport.init());
+        EXPECT_EQ(0u, send_impaired(transport, destination, 1000));
+    }
+}
+
+/*!
+ * @fn TEST(test_UDPv4Impairments, user_traffic_repairs)
+ * @brief This test checks the DATA and DATA_FRAG submessages of a sample already sent to a destination are counted
+ * as repairs, including the resent fragments of the newest sample.
+ */
+TEST(test_UDPv4Impairments, user_traffic_repairs)
+{
+    Locator_t destination;
+    destination.kind = LOCATOR_KIND_UDPv4;
+    destination.port = g_default_port;
+    IPLocator::setIPv4(destination, 127, 0, 0, 1);
+
+    test_UDPv4TransportDescriptor descriptor;
+    descriptor.trackUserTraffic = true;
+    test_UDPv4Transport transport(descriptor);
+    ASSERT_TRUE(transport.init());
+
+    Locator_t output_locator;
+    output_locator.kind = LOCATOR_KIND_UDPv4;
+    IPLocator::setIPv4(output_locator, 127, 0, 0, 1);
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(transport.OpenOutputChannel(send_resource_list, output_locator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    LocatorList_t locator_list;
+    locator_list.push_back(destination);
+    auto send = [&](const CDRMessage_t& message)
+            {
+                Locators locators_begin(locator_list.begin());
+                Locators locators_end(locator_list.end());
+                EXPECT_TRUE(send_resource_list.at(0)->send(message.buffer, message.length, &locators_begin,
+                        &locators_end, (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+            };
+
+    GuidPrefix_t prefix;
+    CacheChange_t change;
+    change.writerGUID.entityId.value[3] = 0x03;
+    change.sequenceNumber = SequenceNumber_t(0, 1);
+    change.serializedPayload.reserve(300);
+    change.serializedPayload.length = 300;
+    change.setFragmentSize(100);
+
+    test_UDPv4Transport::user_traffic.reset();
+    for (uint32_t fragment : {1u, 2u, 2u, 3u, 1u})
+    {
+        CDRMessage_t message;
+        RTPSMessageCreator::addMessageDataFrag(&message, prefix, &change, fragment, NO_KEY, c_EntityId_Unknown,
+                false, nullptr);
+        send(message);
+    }
+    EXPECT_EQ(5u, test_UDPv4Transport::user_traffic.datas);
+    EXPECT_EQ(2u, test_UDPv4Transport::user_traffic.repair_datas);
+
+    change.sequenceNumber = SequenceNumber_t(0, 2);
+    change.setFragmentSize(0);
+    for (int i = 0; i < 2; ++i)
+    {
+        CDRMessage_t message;
+        RTPSMessageCreator::addMessageData(&message, prefix, &change, NO_KEY, c_EntityId_Unknown, false, nullptr);
+        send(message);
+    }
+    EXPECT_EQ(7u, test_UDPv4Transport::user_traffic.datas);
+    EXPECT_EQ(3u, test_UDPv4Transport::user_traffic.repair_datas);
+}
+
 void test_UDPv4Tests::HELPER_FillDataMessage(CDRMessage_t& message, SequenceNumber_t sequenceNumber)
 {
    GuidPrefix_t prefix;
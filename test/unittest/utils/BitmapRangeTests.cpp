@@ -455,6 +455,17 @@ TEST_F(BitmapRangeTests, serialization)
     EXPECT_EQ(num_bits, 20u);
     EXPECT_EQ(num_longs, 1u);
     EXPECT_EQ(bitmap[0], 0xFFFFF000u);
+
+    // A bitmap ending on a word boundary keeps its last word
+    for (uint32_t bits : {32u, 64u, 256u})
+    {
+        bitmap.fill(std::numeric_limits<uint32_t>::max());
+        uut.bitmap_set(bits, bitmap.data());
+        uut.bitmap_get(num_bits, bitmap, num_longs);
+        EXPECT_EQ(num_bits, bits);
+        EXPECT_EQ(num_longs, bits / 32u);
+        EXPECT_EQ(bitmap[num_longs - 1], std::numeric_limits<uint32_t>::max());
+    }
 }
 
 TEST_F(BitmapRangeTests, traversal)
@@ -0,0 +1,122 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/utils/md5.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+//! Hashes the text feeding it to update in chunks of the given size
+std::string chunked_md5(
+        const std::string& text,
+        MD5::size_type chunk_size)
+{
+    MD5 md5;
+    for (size_t pos = 0; pos < text.size(); pos += chunk_size)
+    {
+        MD5::size_type length = static_cast<MD5::size_type>(std::min<size_t>(chunk_size, text.size() - pos));
+        md5.update(&text[pos], length);
+    }
+    md5.finalize();
+    return md5.hexdigest();
+}
+
+//! Checks the digest of the text, hashing it at once and in chunks of several sizes
+void check_digest(
+        const std::string& text,
+        const std::string& expected)
+{
+    EXPECT_EQ(expected, md5(text)) << "Length " << text.size();
+    EXPECT_EQ(expected, MD5(text).hexdigest()) << "Length " << text.size();
+
+    for (MD5::size_type chunk_size : {1u, 3u, 7u, 8u, 55u, 56u, 63u, 64u, 65u})
+    {
+        EXPECT_EQ(expected, chunked_md5(text, chunk_size)) << "Length " << text.size() << ", chunks of " <<
+            chunk_size;
+    }
+}
+
+} // namespace
+
+/*!
+ * @fn TEST(MD5Tests, RFC1321TestSuite)
+ * @brief This test checks the digests of the test suite in RFC 1321, appendix A.5.
+ */
+TEST(MD5Tests, RFC1321TestSuite)
+{
+    const std::vector<std::pair<std::string, std::string>> vectors = {
+        {"", "d41d8cd98f00b204e9800998ecf8427e"},
+        {"a", "0cc175b9c0f1b6a831c399e269772661"},
+        {"abc", "900150983cd24fb0d6963f7d28e17f72"},
+        {"message digest", "f96b697d7cb7938d525a2f31aaf161d0"},
+        {"abcdefghijklmnopqrstuvwxyz", "c3fcd3d76192e4007dfb496cca67e13b"},
+        {"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", "d174ab98d277d9f5a5611c2c9f419d9f"},
+        {"12345678901234567890123456789012345678901234567890123456789012345678901234567890",
+         "57edf4a22be3c955ac49da2e2107b67a"}
+    };
+
+    for (const auto& vector : vectors)
+    {
+        check_digest(vector.first, vector.second);
+    }
+}
+
+/*!
+ * @fn TEST(MD5Tests, PaddingBoundaries)
+ * @brief This test checks the digests of inputs around the lengths where the padding and the length no longer fit
+ * in the last block, so finalize needs an extra block.
+ */
+TEST(MD5Tests, PaddingBoundaries)
+{
+    const std::vector<std::pair<size_t, std::string>> vectors = {
+        {55, "ef1772b6dff9a122358552954ad0df65"},
+        {56, "3b0c8ac703f828b04c6c197006d17218"},
+        {57, "652b906d60af96844ebd21b674f35e93"},
+        {63, "b06521f39153d618550606be297466d5"},
+        {64, "014842d480b571495a4a0363793f7367"},
+        {65, "c743a45e0d2e6a95cb859adae0248435"},
+        {119, "8a7bd0732ed6a28ce75f6dabc90e1613"},
+        {120, "5f61c0ccad4cac44c75ff505e1f1e537"},
+        {128, "e510683b3f5ffe4093d021808bc6ff70"}
+    };
+
+    for (const auto& vector : vectors)
+    {
+        check_digest(std::string(vector.first, 'a'), vector.second);
+    }
+}
+
+/*!
+ * @fn TEST(MD5Tests, Reuse)
+ * @brief This test checks an object can hash a new input after init, and finalize can be called more than once.
+ */
+TEST(MD5Tests, Reuse)
+{
+    MD5 md5;
+    md5.update("abc", 3);
+    md5.finalize();
+    md5.finalize();
+    EXPECT_EQ("900150983cd24fb0d6963f7d28e17f72", md5.hexdigest());
+
+    md5.init();
+    md5.update("message digest", 14);
+    md5.finalize();
+    EXPECT_EQ("f96b697d7cb7938d525a2f31aaf161d0", md5.hexdigest());
+}
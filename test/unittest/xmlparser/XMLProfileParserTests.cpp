@@ -326,6 +326,11 @@ TEST_F(XMLProfileParserTests, XMLParserPublisher)
     EXPECT_EQ(pub_times.nackResponseDelay, c_TimeZero);
     EXPECT_EQ(pub_times.nackSupressionDuration.seconds, 121);
     EXPECT_EQ(pub_times.nackSupressionDuration.nanosec, 332u);
+    EXPECT_TRUE(pub_times.adaptiveHeartbeat);
+    EXPECT_EQ(pub_times.minHeartbeatPeriod.seconds, 0);
+    EXPECT_EQ(pub_times.minHeartbeatPeriod.nanosec, 50000000u);
+    EXPECT_EQ(pub_times.maxHeartbeatPeriod.seconds, 60);
+    EXPECT_EQ(pub_times.maxHeartbeatPeriod.nanosec, 0u);
     IPLocator::setIPv4(locator, 192, 168, 1, 3);
     locator.port = 197;
     EXPECT_EQ(*(loc_list_it = publisher_atts.unicastLocatorList.begin()), locator);
@@ -395,6 +400,11 @@ TEST_F(XMLProfileParserTests, XMLParserDefaultPublisherProfile)
     EXPECT_EQ(pub_times.nackResponseDelay, c_TimeZero);
     EXPECT_EQ(pub_times.nackSupressionDuration.seconds, 121);
     EXPECT_EQ(pub_times.nackSupressionDuration.nanosec, 332u);
+    EXPECT_TRUE(pub_times.adaptiveHeartbeat);
+    EXPECT_EQ(pub_times.minHeartbeatPeriod.seconds, 0);
+    EXPECT_EQ(pub_times.minHeartbeatPeriod.nanosec, 50000000u);
+    EXPECT_EQ(pub_times.maxHeartbeatPeriod.seconds, 60);
+    EXPECT_EQ(pub_times.maxHeartbeatPeriod.nanosec, 0u);
     IPLocator::setIPv4(locator, 192, 168, 1, 3);
     locator.port = 197;
     EXPECT_EQ(*(loc_list_it = publisher_atts.unicastLocatorList.begin()), locator);
@@ -489,6 +499,7 @@ TEST_F(XMLProfileParserTests, XMLParserSubscriber)
     EXPECT_EQ(subscriber_atts.getEntityID(), 31);
     EXPECT_EQ(subscriber_atts.matched_publisher_allocation, ResourceLimitedContainerConfig::fixed_size_configuration(
                 10u));
+    EXPECT_EQ(subscriber_atts.max_incomplete_samples_memory, 1048576u);
 }
 
 TEST_F(XMLProfileParserTests, XMLParserDefaultSubscriberProfile)
@@ -555,6 +566,7 @@ TEST_F(XMLProfileParserTests, XMLParserDefaultSubscriberProfile)
     EXPECT_EQ(subscriber_atts.getEntityID(), 31);
     EXPECT_EQ(subscriber_atts.matched_publisher_allocation, ResourceLimitedContainerConfig::fixed_size_configuration(
                 10u));
+    EXPECT_EQ(subscriber_atts.max_incomplete_samples_memory, 1048576u);
 }
 
 TEST_F(XMLProfileParserTests, XMLParserRequesterProfile)
@@ -134,6 +134,13 @@ int main (
     rtps.builtin.discovery_config.discoveryProtocol =
             options[BACKUP] ? rtps::DiscoveryProtocol_t::BACKUP : rtps::DiscoveryProtocol_t::SERVER;
 
+    // Threads processing the discovery database along with the server one
+    pOp = options[THREADS];
+    if ( nullptr != pOp )
+    {
+        rtps.properties.properties().emplace_back("fastdds.discovery.server_threads", pOp->arg);
+    }
+
     // Set up listening locators.
     // If the number of specify ports doesn't match the number of IPs the last port is used.
     // If at least one port specified replace the default one
@@ -330,4 +337,34 @@ option::ArgStatus Arg::check_udp_port(
     return option::ARG_ILLEGAL;
 }
 
+/*static*/
+option::ArgStatus Arg::check_threads(
+        const option::Option& option,
+        bool msg)
+{
+    // the argument is required
+    if ( nullptr != option.arg )
+    {
+        stringstream is;
+        is << option.arg;
+        int threads;
+
+        if ( is >> threads
+                && is.eof()
+                && threads >= 0
+                && threads < 256 )
+        {
+            return option::ARG_OK;
+        }
+    }
+
+    if (msg)
+    {
+        cout << "Option '" << option.name
+             << "' value should be a number of threads between 0 and 255." << endl;
+    }
+
+    return option::ARG_ILLEGAL;
+}
+
 #endif // FASTDDS_SERVER_SERVER_CPP_
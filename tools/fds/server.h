@@ -25,7 +25,8 @@ enum  optionIndex
     SERVERID,
     IPADDRESS,
     PORT,
-    BACKUP
+    BACKUP,
+    THREADS
 };
 
 struct Arg : public option::Arg
@@ -41,6 +42,10 @@ struct Arg : public option::Arg
     static option::ArgStatus check_udp_port(
             const option::Option& option,
             bool msg);
+
+    static option::ArgStatus check_threads(
+            const option::Option& option,
+            bool msg);
 };
 
 const option::Descriptor usage[] = {
@@ -66,6 +71,10 @@ const option::Descriptor usage[] = {
     { BACKUP,    0, "b",  "backup",       Arg::None,
       "  -b  \t--backup     Creates a server with a backup file associated.\n" },
 
+    { THREADS,   0, "t",  "threads",      Arg::check_threads,
+      "  -t  \t--threads    Additional threads processing the discovery database.\n"
+      "\t             Defaults to 0 (only the server thread).\n" },
+
     { UNKNOWN,   0, "",  "",              Arg::None,
       "Examples:\n"
 